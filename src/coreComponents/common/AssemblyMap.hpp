@@ -0,0 +1,189 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file AssemblyMap.hpp
+ */
+
+#ifndef GEOS_COMMON_ASSEMBLYMAP_HPP
+#define GEOS_COMMON_ASSEMBLYMAP_HPP
+
+#include "common/DataTypes.hpp"
+#include "common/GEOS_RAJA_Interface.hpp"
+
+namespace geos
+{
+
+/**
+ * @class AssemblyMap
+ * @brief Cache of the positions of the local contributions in the values of a CRS matrix.
+ *
+ * Assembly kernels add the local Jacobian of each item (element, connection, ...) row by row,
+ * which requires a binary search of every column index in the sparsity pattern of the row.
+ * As long as the sparsity pattern does not change, these searches always return the same
+ * positions. The map records them the first time an item row is assembled, and subsequent
+ * assemblies add the values directly into the entries of the matrix.
+ *
+ * The map is laid out as (item, row slot, column slot), where the row and column slots are
+ * the positions in the local Jacobian of the item. Before use, a recorded position is checked
+ * against the column index stored at that position, which only costs one load: entries whose
+ * position is stale, e.g. after a change of the sparsity pattern, are searched and recorded again.
+ */
+class AssemblyMap
+{
+public:
+
+  /// Marker of an entry whose position is unknown
+  static constexpr localIndex unknown = -1;
+
+  /**
+   * @class View
+   * @brief Kernel-side view of the map.
+   *
+   * A default-constructed (empty) view falls back to the binary search.
+   */
+  class View
+  {
+public:
+
+    /// Default constructor, creating an empty view
+    View() = default;
+
+    /**
+     * @brief Constructor.
+     * @param positions the positions of the entries, of size (numItems, maxNumRows * maxNumCols)
+     * @param maxNumCols the maximum number of columns of the local Jacobian of an item
+     */
+    View( arrayView2d< localIndex > const & positions,
+          localIndex const maxNumCols )
+      : m_positions( positions ),
+      m_maxNumCols( maxNumCols )
+    {}
+
+    /**
+     * @brief Add a row of the local Jacobian of an item into the matrix.
+     * @tparam ATOMIC_POLICY the atomic policy used to add the values
+     * @tparam COL_INDEX the type of column indices of the matrix
+     * @param matrix the matrix
+     * @param item the index of the item
+     * @param rowSlot the index of the row in the local Jacobian of the item
+     * @param row the local row of the matrix
+     * @param cols the column indices (not necessarily sorted)
+     * @param vals the values
+     * @param numCols the number of values to add
+     *
+     * Each (item, rowSlot) pair must only be assembled by one thread at a time. The fastest path is
+     * taken when it is assembled into the same matrix row with the same column indices every time.
+     */
+    template< typename ATOMIC_POLICY, typename COL_INDEX >
+    GEOS_HOST_DEVICE
+    inline
+    void addToRow( CRSMatrixView< real64, COL_INDEX const > const & matrix,
+                   localIndex const item,
+                   localIndex const rowSlot,
+                   localIndex const row,
+                   COL_INDEX const * const cols,
+                   real64 const * const vals,
+                   localIndex const numCols ) const
+    {
+      if( m_positions.size() == 0 )
+      {
+        matrix.template addToRowBinarySearchUnsorted< ATOMIC_POLICY >( row, cols, vals, numCols );
+        return;
+      }
+
+      GEOS_ASSERT_GE( m_maxNumCols, numCols );
+      GEOS_ASSERT_GE( m_positions.size( 1 ), ( rowSlot + 1 ) * m_maxNumCols );
+
+      arraySlice1d< COL_INDEX const > const columns = matrix.getColumns( row );
+      arraySlice1d< real64 > const entries = matrix.getEntries( row );
+      localIndex const rowLength = columns.size();
+      localIndex * const positions = &m_positions( item, rowSlot * m_maxNumCols );
+
+      for( localIndex j = 0; j < numCols; ++j )
+      {
+        localIndex pos = positions[j];
+        if( pos < 0 || pos >= rowLength || columns[pos] != cols[j] )
+        {
+          pos = LvArray::sortedArrayManipulation::find( columns.dataIfContiguous(), rowLength, cols[j] );
+          if( pos >= rowLength || columns[pos] != cols[j] )
+          {
+            // the column is not in the sparsity pattern of the row
+            positions[j] = unknown;
+            continue;
+          }
+          positions[j] = pos;
+        }
+        RAJA::atomicAdd( ATOMIC_POLICY{}, &entries[pos], vals[j] );
+      }
+    }
+
+private:
+
+    /// Positions of the entries in the rows of the matrix
+    arrayView2d< localIndex > m_positions;
+
+    /// Maximum number of columns of the local Jacobian of an item
+    localIndex m_maxNumCols = 0;
+  };
+
+  /**
+   * @brief Size the map for a given kernel.
+   * @param numItems the number of items assembled by the kernel
+   * @param maxNumRows the maximum number of rows of the local Jacobian of an item
+   * @param maxNumCols the maximum number of columns of the local Jacobian of an item
+   *
+   * The recorded positions are kept if the dimensions are unchanged.
+   */
+  void setup( localIndex const numItems,
+              localIndex const maxNumRows,
+              localIndex const maxNumCols )
+  {
+    if( m_positions.size( 0 ) != numItems || m_positions.size( 1 ) != maxNumRows * maxNumCols || m_maxNumCols != maxNumCols )
+    {
+      m_positions.resize( numItems, maxNumRows * maxNumCols );
+      m_maxNumCols = maxNumCols;
+      reset();
+    }
+  }
+
+  /**
+   * @brief Discard the recorded positions.
+   */
+  void reset()
+  {
+    m_positions.setValues< parallelDevicePolicy<> >( unknown );
+  }
+
+  /**
+   * @brief @return a view of the map to be captured by the kernels
+   */
+  View toView() const
+  {
+    return View( m_positions.toView(), m_maxNumCols );
+  }
+
+private:
+
+  /// Positions of the entries in the rows of the matrix
+  array2d< localIndex > m_positions;
+
+  /// Maximum number of columns of the local Jacobian of an item
+  localIndex m_maxNumCols = 0;
+};
+
+} // namespace geos
+
+#endif // GEOS_COMMON_ASSEMBLYMAP_HPP
@@ -46,6 +46,10 @@ auto const parallelHostMemorySpace = hostMemorySpace;
 
 using parallelHostPolicy = RAJA::omp_parallel_for_exec;
 using parallelHostReduce = RAJA::omp_reduce;
+
+/// Host policy distributing chunks of iterations dynamically, for loops with uneven cost per iteration
+template< int CHUNK_SIZE >
+using parallelHostDynamicPolicy = RAJA::omp_parallel_exec< RAJA::omp_for_dynamic_exec< CHUNK_SIZE > >;
 using parallelHostAtomic = RAJA::builtin_atomic;
 
 // issues with Raja::resources::Omp on lassen
@@ -60,6 +64,9 @@ auto const parallelHostMemorySpace = hostMemorySpace;
 
 using parallelHostPolicy = serialPolicy;
 using parallelHostReduce = serialReduce;
+
+template< int CHUNK_SIZE >
+using parallelHostDynamicPolicy = serialPolicy;
 using parallelHostAtomic = serialAtomic;
 using parallelHostStream = serialStream;
 using parallelHostEvent = serialEvent;
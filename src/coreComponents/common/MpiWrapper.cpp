@@ -161,6 +161,18 @@ MPI_Comm MpiWrapper::commSplit( MPI_Comm const comm, int color, int key )
 #endif
 }
 
+MPI_Comm MpiWrapper::commSplitShared( MPI_Comm const comm, int key )
+{
+#ifdef GEOS_USE_MPI
+  MPI_Comm scomm;
+  MPI_CHECK_ERROR( MPI_Comm_split_type( comm, MPI_COMM_TYPE_SHARED, key, MPI_INFO_NULL, &scomm ) );
+  return scomm;
+#else
+  GEOS_UNUSED_VAR( key );
+  return comm;
+#endif
+}
+
 int MpiWrapper::test( MPI_Request * request, int * flag, MPI_Status * status )
 {
 #ifdef GEOS_USE_MPI
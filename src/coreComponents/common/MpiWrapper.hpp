@@ -173,6 +173,14 @@ public:
 
   static MPI_Comm commSplit( MPI_Comm const comm, int color, int key );
 
+  /**
+   * @brief Split a communicator into sub-communicators of ranks that can share memory (MPI_Comm_split_type).
+   * @param comm the communicator to split
+   * @param key the ordering key of the ranks in the sub-communicators
+   * @return the sub-communicator of the ranks on the same node as the calling rank
+   */
+  static MPI_Comm commSplitShared( MPI_Comm const comm, int key );
+
   static int test( MPI_Request * request, int * flag, MPI_Status * status );
 
   static int testAny( int count, MPI_Request array_of_requests[], int * idx, int * flags, MPI_Status array_of_statuses[] );
@@ -385,6 +393,19 @@ public:
   template< typename T >
   static void allReduce( Span< T const > src, Span< T > dst, Reduction const op, MPI_Comm comm = MPI_COMM_GEOS );
 
+  /**
+   * @brief Strongly typed wrapper around MPI_Iallreduce.
+   * @param[in] sendbuf The pointer to the sending buffer.
+   * @param[out] recvbuf The pointer to the receive buffer.
+   * @param[in] count The number of values to send/receive.
+   * @param[in] op The MPI_Op to perform.
+   * @param[in] comm The MPI_Comm over which the gather operates.
+   * @param[out] request The MPI_Request used to wait for the completion of the reduction.
+   * @return The return value of the underlying call to MPI_Iallreduce().
+   */
+  template< typename T >
+  static int iAllReduce( T const * sendbuf, T * recvbuf, int count, MPI_Op op, MPI_Comm comm, MPI_Request * request );
+
 
   /**
    * @brief Strongly typed wrapper around MPI_Reduce.
@@ -791,6 +812,27 @@ int MpiWrapper::allReduce( T const * const sendbuf,
 #endif
 }
 
+template< typename T >
+int MpiWrapper::iAllReduce( T const * const sendbuf,
+                            T * const recvbuf,
+                            int const count,
+                            MPI_Op const MPI_PARAM( op ),
+                            MPI_Comm const MPI_PARAM( comm ),
+                            MPI_Request * const request )
+{
+#ifdef GEOS_USE_MPI
+  MPI_Datatype const mpiType = internal::getMpiType< T >();
+  return MPI_Iallreduce( sendbuf == recvbuf ? MPI_IN_PLACE : sendbuf, recvbuf, count, mpiType, op, comm, request );
+#else
+  if( sendbuf != recvbuf )
+  {
+    memcpy( recvbuf, sendbuf, count * sizeof( T ) );
+  }
+  *request = MPI_REQUEST_NULL;
+  return 0;
+#endif
+}
+
 template< typename T >
 int MpiWrapper::reduce( T const * const sendbuf,
                         T * const recvbuf,
@@ -0,0 +1,100 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file NodeSharedBuffer.cpp
+ */
+
+#include "NodeSharedBuffer.hpp"
+
+namespace geos
+{
+
+NodeSharedBuffer::~NodeSharedBuffer()
+{
+  free();
+}
+
+void NodeSharedBuffer::allocate( std::size_t const numBytes, MPI_Comm const comm )
+{
+  free();
+  m_size = numBytes;
+
+#ifdef GEOS_USE_MPI
+  int const rank = MpiWrapper::commRank( comm );
+  m_nodeComm = MpiWrapper::commSplitShared( comm, rank );
+  m_isNodeRoot = MpiWrapper::commRank( m_nodeComm ) == 0;
+  m_nodeRootComm = MpiWrapper::commSplit( comm, m_isNodeRoot ? 0 : MPI_UNDEFINED, rank );
+
+  // Only the node root contributes memory to the window, the other ranks query its address
+  MPI_Aint const localSize = m_isNodeRoot ? static_cast< MPI_Aint >( numBytes ) : 0;
+  void * localData = nullptr;
+  MPI_CHECK_ERROR( MPI_Win_allocate_shared( localSize, 1, MPI_INFO_NULL, m_nodeComm, &localData, &m_window ) );
+
+  MPI_Aint rootSize = 0;
+  int rootDispUnit = 0;
+  MPI_CHECK_ERROR( MPI_Win_shared_query( m_window, 0, &rootSize, &rootDispUnit, &m_data ) );
+  GEOS_ERROR_IF_LT( static_cast< std::size_t >( rootSize ), numBytes );
+#else
+  GEOS_UNUSED_VAR( comm );
+  m_localStorage.resize( numBytes );
+  m_data = m_localStorage.data();
+#endif
+}
+
+void NodeSharedBuffer::free()
+{
+#ifdef GEOS_USE_MPI
+  // The window cannot be released anymore once MPI has been finalized
+  int finalized = 0;
+  MPI_Finalized( &finalized );
+  if( !finalized )
+  {
+    if( m_window != MPI_WIN_NULL )
+    {
+      MPI_Win_free( &m_window );
+    }
+    if( m_nodeRootComm != MPI_COMM_NULL )
+    {
+      MpiWrapper::commFree( m_nodeRootComm );
+    }
+    if( m_nodeComm != MPI_COMM_NULL )
+    {
+      MpiWrapper::commFree( m_nodeComm );
+    }
+  }
+  m_window = MPI_WIN_NULL;
+#else
+  m_localStorage.clear();
+  m_localStorage.shrink_to_fit();
+#endif
+  m_nodeRootComm = MPI_COMM_NULL;
+  m_nodeComm = MPI_COMM_NULL;
+  m_data = nullptr;
+  m_size = 0;
+  m_isNodeRoot = true;
+}
+
+void NodeSharedBuffer::nodeBarrier() const
+{
+#ifdef GEOS_USE_MPI
+  if( m_nodeComm != MPI_COMM_NULL )
+  {
+    MpiWrapper::barrier( m_nodeComm );
+  }
+#endif
+}
+
+} /* namespace geos */
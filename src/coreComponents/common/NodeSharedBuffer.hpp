@@ -0,0 +1,126 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file NodeSharedBuffer.hpp
+ */
+
+#ifndef GEOS_COMMON_NODESHAREDBUFFER_HPP_
+#define GEOS_COMMON_NODESHAREDBUFFER_HPP_
+
+#include "common/MpiWrapper.hpp"
+
+#include <vector>
+
+namespace geos
+{
+
+/**
+ * @class NodeSharedBuffer
+ * @brief Host memory buffer held once per compute node and shared by all the ranks of the node.
+ *
+ * The memory is allocated in an MPI-3 shared-memory window owned by the first rank of each node,
+ * and all the ranks of the node access it directly. Writing to the buffer is the responsibility of
+ * the first rank of each node (see isNodeRoot()), followed by a call to nodeBarrier() before any
+ * other rank reads it. Without MPI, the buffer is a plain local allocation.
+ *
+ * Allocation and deallocation are collective over the communicator given to allocate().
+ */
+class NodeSharedBuffer
+{
+public:
+
+  /**
+   * @brief Constructor, no memory is allocated.
+   */
+  NodeSharedBuffer() = default;
+
+  /**
+   * @brief Destructor, frees the shared memory.
+   */
+  ~NodeSharedBuffer();
+
+  /// @cond DO_NOT_DOCUMENT
+  NodeSharedBuffer( NodeSharedBuffer const & ) = delete;
+  NodeSharedBuffer & operator=( NodeSharedBuffer const & ) = delete;
+  /// @endcond
+
+  /**
+   * @brief Allocate the shared memory, releasing any previous allocation (collective).
+   * @param numBytes the size of the buffer in bytes, must be the same on all ranks
+   * @param comm the communicator whose ranks take part in the allocation
+   */
+  void allocate( std::size_t const numBytes, MPI_Comm const comm = MPI_COMM_GEOS );
+
+  /**
+   * @brief Release the shared memory (collective over the communicator used in allocate()).
+   */
+  void free();
+
+  /**
+   * @return the size of the buffer in bytes
+   */
+  std::size_t size() const { return m_size; }
+
+  /**
+   * @return a pointer to the beginning of the buffer, or nullptr if it is not allocated
+   */
+  void * data() const { return m_data; }
+
+  /**
+   * @return whether the calling rank is the first rank of its node, which owns the memory
+   */
+  bool isNodeRoot() const { return m_isNodeRoot; }
+
+  /**
+   * @return the communicator of the first rank of each node (MPI_COMM_NULL on other ranks),
+   *         with the ranks in the same order as in the communicator given to allocate()
+   */
+  MPI_Comm nodeRootComm() const { return m_nodeRootComm; }
+
+  /**
+   * @brief Synchronize the ranks of the node, making the writes of the node root visible to them.
+   */
+  void nodeBarrier() const;
+
+private:
+
+  /// Communicator of the ranks of the node
+  MPI_Comm m_nodeComm = MPI_COMM_NULL;
+
+  /// Communicator of the first rank of each node
+  MPI_Comm m_nodeRootComm = MPI_COMM_NULL;
+
+#ifdef GEOS_USE_MPI
+  /// Shared-memory window holding the buffer
+  MPI_Win m_window = MPI_WIN_NULL;
+#else
+  /// Local storage used without MPI
+  std::vector< char > m_localStorage;
+#endif
+
+  /// Pointer to the beginning of the buffer
+  void * m_data = nullptr;
+
+  /// Size of the buffer in bytes
+  std::size_t m_size = 0;
+
+  /// Whether the calling rank owns the memory
+  bool m_isNodeRoot = true;
+};
+
+} /* namespace geos */
+
+#endif /* GEOS_COMMON_NODESHAREDBUFFER_HPP_ */
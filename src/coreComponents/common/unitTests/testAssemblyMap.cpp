@@ -0,0 +1,119 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "common/AssemblyMap.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geos;
+
+namespace
+{
+
+// Tridiagonal pattern of size n
+CRSMatrix< real64, globalIndex > createMatrix( localIndex const n )
+{
+  CRSMatrix< real64, globalIndex > matrix( n, n, 3 );
+  for( localIndex i = 0; i < n; ++i )
+  {
+    for( globalIndex j = LvArray::math::max( i - 1, localIndex( 0 ) ); j <= LvArray::math::min( i + 1, n - 1 ); ++j )
+    {
+      matrix.insertNonZero( i, j, 0.0 );
+    }
+  }
+  return matrix;
+}
+
+// Assemble the two-node "elements" (i, i+1), with a column outside of the pattern
+void assemble( CRSMatrixView< real64, globalIndex const > const & matrix,
+               AssemblyMap::View const & map )
+{
+  localIndex const numElems = matrix.numRows() - 1;
+  for( localIndex k = 0; k < numElems; ++k )
+  {
+    globalIndex const cols[3] = { k + 1, k, ( k + 3 ) % matrix.numRows() };
+    real64 const vals[2][3] = { { -1.0, 2.0, 5.0 }, { 2.0 + k, -1.0, 7.0 } };
+    for( localIndex a = 0; a < 2; ++a )
+    {
+      map.addToRow< serialAtomic >( matrix, k, a, k + a, cols, vals[a], 3 );
+    }
+  }
+}
+
+void compare( CRSMatrix< real64, globalIndex > const & expected,
+              CRSMatrix< real64, globalIndex > const & actual )
+{
+  for( localIndex i = 0; i < expected.numRows(); ++i )
+  {
+    ASSERT_EQ( expected.numNonZeros( i ), actual.numNonZeros( i ) );
+    for( localIndex j = 0; j < expected.numNonZeros( i ); ++j )
+    {
+      EXPECT_EQ( expected.getColumns( i )[j], actual.getColumns( i )[j] );
+      EXPECT_DOUBLE_EQ( expected.getEntries( i )[j], actual.getEntries( i )[j] );
+    }
+  }
+}
+
+} // namespace
+
+TEST( AssemblyMap, matchesBinarySearch )
+{
+  localIndex const n = 6;
+  CRSMatrix< real64, globalIndex > expected = createMatrix( n );
+  CRSMatrix< real64, globalIndex > actual = createMatrix( n );
+
+  AssemblyMap map;
+  map.setup( n - 1, 2, 3 );
+
+  // The first assembly records the positions, the second one reuses them
+  for( int iter = 0; iter < 2; ++iter )
+  {
+    assemble( expected.toViewConstSizes(), AssemblyMap::View() );
+    assemble( actual.toViewConstSizes(), map.toView() );
+    compare( expected, actual );
+  }
+}
+
+TEST( AssemblyMap, patternChange )
+{
+  localIndex const n = 5;
+  CRSMatrix< real64, globalIndex > matrix = createMatrix( n );
+
+  AssemblyMap map;
+  map.setup( n - 1, 2, 3 );
+  assemble( matrix.toViewConstSizes(), map.toView() );
+
+  // The positions recorded for the tridiagonal pattern are stale for a pattern with an extra diagonal
+  CRSMatrix< real64, globalIndex > expected( n, n, 4 );
+  CRSMatrix< real64, globalIndex > actual( n, n, 4 );
+  for( localIndex i = 0; i < n; ++i )
+  {
+    for( globalIndex j = LvArray::math::max( i - 2, localIndex( 0 ) ); j <= LvArray::math::min( i + 1, n - 1 ); ++j )
+    {
+      expected.insertNonZero( i, j, 0.0 );
+      actual.insertNonZero( i, j, 0.0 );
+    }
+  }
+
+  assemble( expected.toViewConstSizes(), AssemblyMap::View() );
+  assemble( actual.toViewConstSizes(), map.toView() );
+  compare( expected, actual );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  return RUN_ALL_TESTS();
+}
@@ -34,6 +34,7 @@ TableCapillaryPressureHelpers::validateCapillaryPressureTable( TableFunction con
 {
   ArrayOfArraysView< real64 const > coords = capPresTable.getCoordinates();
 
+  capPresTable.checkValuesAccessible( fullConstitutiveName );
   GEOS_THROW_IF_NE_MSG( capPresTable.getInterpolationMethod(), TableFunction::InterpolationType::Linear,
                         GEOS_FMT( "{}: in table '{}' interpolation method must be linear", fullConstitutiveName, capPresTable.getName() ),
                         InputError );
@@ -119,6 +119,7 @@ void HydraulicApertureTable::allocateConstitutiveData( Group & parent,
 
 void HydraulicApertureTable::validateApertureTable( TableFunction const & apertureTable ) const
 {
+  apertureTable.checkValuesAccessible( getFullName() );
   ArrayOfArraysView< real64 const > const coords = apertureTable.getCoordinates();
   arrayView1d< real64 const > const & hydraulicApertureValues = apertureTable.getValues();
 
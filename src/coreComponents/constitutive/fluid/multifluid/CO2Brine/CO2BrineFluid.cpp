@@ -109,6 +109,12 @@ CO2BrineFluid( string const & name, Group * const parent ):
     setDescription( "Write PVT tables into a CSV file" ).
     setDefaultValue( 0 );
 
+  registerWrapper( viewKeyStruct::tableCacheDirectoryString(), &m_tableCacheDirectory ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setRestartFlags( RestartFlags::NO_WRITE ).
+    setDescription( "Directory where the PVT tables computed from the model parameters are stored, to be read back "
+                    "instead of recomputed by subsequent runs of the same GEOS version with the same parameters. If empty, the tables are always computed." );
+
   // if this is a thermal model, we need to make sure that the arrays will be properly displayed and saved to restart
   if( isThermal() )
   {
@@ -340,12 +346,14 @@ void CO2BrineFluid< PHASE1, PHASE2, FLASH >::createPVTModels()
                                          phase1InputParams,
                                          m_componentNames,
                                          m_componentMolarWeight,
-                                         pvtOutputOpts );
+                                         pvtOutputOpts,
+                                         m_tableCacheDirectory );
   m_phase2 = std::make_unique< PHASE2 >( getName() + "_phaseModel2",
                                          phase2InputParams,
                                          m_componentNames,
                                          m_componentMolarWeight,
-                                         pvtOutputOpts );
+                                         pvtOutputOpts,
+                                         m_tableCacheDirectory );
 
 
   // 2) Create the flash model
@@ -376,7 +384,8 @@ void CO2BrineFluid< PHASE1, PHASE2, FLASH >::createPVTModels()
                                                  m_phaseNames,
                                                  m_componentNames,
                                                  m_componentMolarWeight,
-                                                 flashOutputOpts );
+                                                 flashOutputOpts,
+                                                 m_tableCacheDirectory );
           }
         }
         else
@@ -423,7 +432,8 @@ void CO2BrineFluid< PHASE1, PHASE2, FLASH >::createPVTModels()
                                          m_phaseNames,
                                          m_componentNames,
                                          m_componentMolarWeight,
-                                         flashOutputOpts );
+                                         flashOutputOpts,
+                                         m_tableCacheDirectory );
   }
 
   GEOS_THROW_IF( m_flash == nullptr,
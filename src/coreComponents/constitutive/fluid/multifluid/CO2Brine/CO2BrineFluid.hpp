@@ -172,6 +172,7 @@ private:
     static constexpr char const * solubilityTablesString() { return "solubilityTableNames"; }
     static constexpr char const * phasePVTParaFilesString() { return "phasePVTParaFiles"; }
     static constexpr char const * writeCSVFlagString() { return "writeCSV"; }
+    static constexpr char const * tableCacheDirectoryString() { return "tableCacheDirectory"; }
   };
 
 protected:
@@ -205,6 +206,9 @@ private:
   /// Output csv file containing informations about PVT
   integer m_writeCSV;
 
+  /// Directory of the cache of the precomputed PVT tables
+  Path m_tableCacheDirectory;
+
   /// Brine constitutive models
   std::unique_ptr< PHASE1 > m_phase1;
 
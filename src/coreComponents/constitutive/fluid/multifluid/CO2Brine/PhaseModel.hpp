@@ -57,27 +57,32 @@ struct PhaseModel
    * @param[in] componentNames names of the components
    * @param[in] componentMolarWeight molar weights of the components
    * @param[in] pvtOutputOpts A structure containing generated table output options
+   * @param[in] tableCacheDirectory directory of the cache of the computed property tables, empty to disable the cache
    */
   PhaseModel( string const & phaseModelName,
               array1d< array1d< string > > const & inputParams,
               string_array const & componentNames,
               array1d< real64 > const & componentMolarWeight,
-              TableFunction::OutputOptions const pvtOutputOpts )
+              TableFunction::OutputOptions const pvtOutputOpts,
+              string const & tableCacheDirectory )
     : density( phaseModelName + "_" + Density::catalogName(),
                inputParams[InputParamOrder::DENSITY],
                componentNames,
                componentMolarWeight,
-               pvtOutputOpts ),
+               pvtOutputOpts,
+               tableCacheDirectory ),
     viscosity( phaseModelName + "_" + Viscosity::catalogName(),
                inputParams[InputParamOrder::VISCOSITY],
                componentNames,
                componentMolarWeight,
-               pvtOutputOpts ),
+               pvtOutputOpts,
+               tableCacheDirectory ),
     enthalpy( phaseModelName + "_" + Enthalpy::catalogName(),
               inputParams[InputParamOrder::ENTHALPY],
               componentNames,
               componentMolarWeight,
-              pvtOutputOpts )
+              pvtOutputOpts,
+              tableCacheDirectory )
   {}
 
   /// The phase density model
@@ -88,6 +88,7 @@ void calculateBrineEnthalpy( PTTableCoordinates const & tableCoords,
 
 TableFunction const * makeCO2EnthalpyTable( string_array const & inputParams,
                                             string const & functionName,
+                                            string const & tableCacheDirectory,
                                             FunctionManager & functionManager )
 {
   string const tableName = functionName + "_CO2_enthalpy_table";
@@ -123,9 +124,11 @@ TableFunction const * makeCO2EnthalpyTable( string_array const & inputParams,
     array1d< real64 > densities( tableCoords.nPressures() * tableCoords.nTemperatures() );
     array1d< real64 > enthalpies( tableCoords.nPressures() * tableCoords.nTemperatures() );
 
-    SpanWagnerCO2Density::calculateCO2Density( functionName, tolerance, tableCoords, densities );
-
-    CO2Enthalpy::calculateCO2Enthalpy( tableCoords, densities, enthalpies );
+    PVTTableCache::computeOrRead( tableCacheDirectory, BrineEnthalpy::catalogName() + "_CO2", inputParams, tableCoords, { enthalpies.toView() }, [&]()
+    {
+      SpanWagnerCO2Density::calculateCO2Density( functionName, tolerance, tableCoords, densities );
+      CO2Enthalpy::calculateCO2Enthalpy( tableCoords, densities, enthalpies );
+    } );
 
     TableFunction * const enthalpyTable = dynamicCast< TableFunction * >( functionManager.createChild( TableFunction::catalogName(), tableName ) );
     enthalpyTable->setTableCoordinates( tableCoords.getCoords(), tableCoords.coordsUnits );
@@ -192,7 +195,8 @@ BrineEnthalpy::BrineEnthalpy( string const & name,
                               string_array const & inputParams,
                               string_array const & componentNames,
                               array1d< real64 > const & componentMolarWeight,
-                              TableFunction::OutputOptions const pvtOutputOpts ):
+                              TableFunction::OutputOptions const pvtOutputOpts,
+                              string const & tableCacheDirectory ):
   PVTFunctionBase( name,
                    componentNames,
                    componentMolarWeight )
@@ -203,7 +207,7 @@ BrineEnthalpy::BrineEnthalpy( string const & name,
   string const expectedWaterComponentNames[] = { "Water", "water" };
   m_waterIndex = PVTFunctionHelpers::findName( componentNames, expectedWaterComponentNames, "componentNames" );
 
-  m_CO2EnthalpyTable = makeCO2EnthalpyTable( inputParams, m_functionName, FunctionManager::getInstance() );
+  m_CO2EnthalpyTable = makeCO2EnthalpyTable( inputParams, m_functionName, tableCacheDirectory, FunctionManager::getInstance() );
   m_brineEnthalpyTable = makeBrineEnthalpyTable( inputParams, m_functionName, FunctionManager::getInstance() );
 
   m_CO2EnthalpyTable->outputPVTTableData( pvtOutputOpts );
@@ -92,7 +92,8 @@ public:
                  string_array const & inputParams,
                  string_array const & componentNames,
                  array1d< real64 > const & componentMolarWeight,
-                 TableFunction::OutputOptions const pvtOutputOpts );
+                 TableFunction::OutputOptions const pvtOutputOpts,
+                 string const & tableCacheDirectory );
 
   static string catalogName() { return "BrineEnthalpy"; }
 
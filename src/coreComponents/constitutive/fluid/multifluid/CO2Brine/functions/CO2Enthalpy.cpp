@@ -202,6 +202,7 @@ real64 helmholtzCO2Enthalpy( real64 const & T,
 
 TableFunction const * makeCO2EnthalpyTable( string_array const & inputParams,
                                             string const & functionName,
+                                            string const & tableCacheDirectory,
                                             FunctionManager & functionManager )
 {
   string const tableName = functionName + "_CO2_enthalpy_table";
@@ -238,9 +239,11 @@ TableFunction const * makeCO2EnthalpyTable( string_array const & inputParams,
     array1d< real64 > enthalpies( tableCoords.nPressures() * tableCoords.nTemperatures() );
 
 
-    SpanWagnerCO2Density::calculateCO2Density( functionName, tolerance, tableCoords, densities );
-
-    CO2Enthalpy::calculateCO2Enthalpy( tableCoords, densities, enthalpies );
+    PVTTableCache::computeOrRead( tableCacheDirectory, CO2Enthalpy::catalogName(), inputParams, tableCoords, { enthalpies.toView() }, [&]()
+    {
+      SpanWagnerCO2Density::calculateCO2Density( functionName, tolerance, tableCoords, densities );
+      CO2Enthalpy::calculateCO2Enthalpy( tableCoords, densities, enthalpies );
+    } );
 
     TableFunction * const enthalpyTable = dynamicCast< TableFunction * >( functionManager.createChild( TableFunction::catalogName(), tableName ) );
     enthalpyTable->setTableCoordinates( tableCoords.getCoords(),
@@ -257,7 +260,8 @@ CO2Enthalpy::CO2Enthalpy( string const & name,
                           string_array const & inputParams,
                           string_array const & componentNames,
                           array1d< real64 > const & componentMolarWeight,
-                          TableFunction::OutputOptions const pvtOutputOpts ):
+                          TableFunction::OutputOptions const pvtOutputOpts,
+                          string const & tableCacheDirectory ):
   PVTFunctionBase( name,
                    componentNames,
                    componentMolarWeight )
@@ -265,7 +269,7 @@ CO2Enthalpy::CO2Enthalpy( string const & name,
   string const expectedCO2ComponentNames[] = { "CO2", "co2" };
   m_CO2Index = PVTFunctionHelpers::findName( componentNames, expectedCO2ComponentNames, "componentNames" );
 
-  m_CO2EnthalpyTable = makeCO2EnthalpyTable( inputParams, m_functionName, FunctionManager::getInstance() );
+  m_CO2EnthalpyTable = makeCO2EnthalpyTable( inputParams, m_functionName, tableCacheDirectory, FunctionManager::getInstance() );
 
   m_CO2EnthalpyTable->outputPVTTableData( pvtOutputOpts );
   m_CO2EnthalpyTable->outputPVTTableData( pvtOutputOpts );
@@ -56,7 +56,8 @@ TableFunction const * makeTable( string const & tableName,
 std::pair< TableFunction const *, TableFunction const * >
 makeSolubilityTables( string const & functionName,
                       string_array const & inputParams,
-                      constitutive::PVTProps::CO2Solubility::SolubilityModel const & solubilityModel )
+                      constitutive::PVTProps::CO2Solubility::SolubilityModel const & solubilityModel,
+                      string const & tableCacheDirectory )
 {
   FunctionManager & functionManager = FunctionManager::getInstance();
   constitutive::PVTProps::PTTableCoordinates tableCoords;
@@ -133,26 +134,32 @@ makeSolubilityTables( string const & functionName,
   array1d< real64 > co2Solubility( nPressures * nTemperatures );
   array1d< real64 > h2oSolubility( nPressures * nTemperatures );
 
-  if( solubilityModel == constitutive::PVTProps::CO2Solubility::SolubilityModel::DuanSun )
+  string const cacheModelName = GEOS_FMT( "{}_{}", constitutive::PVTProps::CO2Solubility::catalogName(),
+                                          EnumStrings< constitutive::PVTProps::CO2Solubility::SolubilityModel >::toString( solubilityModel ) );
+  constitutive::PVTProps::PVTTableCache::computeOrRead( tableCacheDirectory, cacheModelName, inputParams, tableCoords,
+                                                        { co2Solubility.toView(), h2oSolubility.toView() }, [&]()
   {
-    constitutive::PVTProps::CO2SolubilityDuanSun::populateSolubilityTables(
-      functionName,
-      tableCoords,
-      salinity,
-      tolerance,
-      co2Solubility,
-      h2oSolubility );
-  }
-  else if( solubilityModel == constitutive::PVTProps::CO2Solubility::SolubilityModel::SpycherPruess )
-  {
-    constitutive::PVTProps::CO2SolubilitySpycherPruess::populateSolubilityTables(
-      functionName,
-      tableCoords,
-      salinity,
-      tolerance,
-      co2Solubility,
-      h2oSolubility );
-  }
+    if( solubilityModel == constitutive::PVTProps::CO2Solubility::SolubilityModel::DuanSun )
+    {
+      constitutive::PVTProps::CO2SolubilityDuanSun::populateSolubilityTables(
+        functionName,
+        tableCoords,
+        salinity,
+        tolerance,
+        co2Solubility,
+        h2oSolubility );
+    }
+    else if( solubilityModel == constitutive::PVTProps::CO2Solubility::SolubilityModel::SpycherPruess )
+    {
+      constitutive::PVTProps::CO2SolubilitySpycherPruess::populateSolubilityTables(
+        functionName,
+        tableCoords,
+        salinity,
+        tolerance,
+        co2Solubility,
+        h2oSolubility );
+    }
+  } );
 
   // Truncate negative solubility and warn
   integer constexpr maxBad = 5;     // Maximum number of bad values to report
@@ -221,7 +228,8 @@ CO2Solubility::CO2Solubility( string const & name,
                               string_array const & phaseNames,
                               string_array const & componentNames,
                               array1d< real64 > const & componentMolarWeight,
-                              TableFunction::OutputOptions const pvtOutputOpts ):
+                              TableFunction::OutputOptions const pvtOutputOpts,
+                              string const & tableCacheDirectory ):
   FlashModelBase( name,
                   componentNames,
                   componentMolarWeight )
@@ -255,7 +263,7 @@ CO2Solubility::CO2Solubility( string const & name,
     solubilityModel = EnumStrings< SolubilityModel >::fromString( inputParams[10] );
   }
 
-  std::tie( m_CO2SolubilityTable, m_WaterVapourisationTable ) = makeSolubilityTables( m_modelName, inputParams, solubilityModel );
+  std::tie( m_CO2SolubilityTable, m_WaterVapourisationTable ) = makeSolubilityTables( m_modelName, inputParams, solubilityModel, tableCacheDirectory );
 
   m_CO2SolubilityTable->outputPVTTableData( pvtOutputOpts );
   m_WaterVapourisationTable->outputPVTTableData( pvtOutputOpts );
@@ -38,11 +38,14 @@ EzrokhiBrineDensity::EzrokhiBrineDensity( string const & name,
                                           string_array const & inputPara,
                                           string_array const & componentNames,
                                           array1d< real64 > const & componentMolarWeight,
-                                          TableFunction::OutputOptions const pvtOutputOpts ):
+                                          TableFunction::OutputOptions const pvtOutputOpts,
+                                          string const & tableCacheDirectory ):
   PVTFunctionBase( name,
                    componentNames,
                    componentMolarWeight )
 {
+  GEOS_UNUSED_VAR( tableCacheDirectory );
+
   string const expectedCO2ComponentNames[] = { "CO2", "co2" };
   m_CO2Index = PVTFunctionHelpers::findName( componentNames, expectedCO2ComponentNames, "componentNames" );
 
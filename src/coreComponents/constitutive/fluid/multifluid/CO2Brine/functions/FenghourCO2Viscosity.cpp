@@ -90,6 +90,7 @@ void calculateCO2Viscosity( PTTableCoordinates const & tableCoords,
 
 TableFunction const * makeViscosityTable( string_array const & inputParams,
                                           string const & functionName,
+                                          string const & tableCacheDirectory,
                                           FunctionManager & functionManager )
 {
   string const tableName = functionName + "_table";
@@ -124,8 +125,11 @@ TableFunction const * makeViscosityTable( string_array const & inputParams,
     localIndex const nT = tableCoords.nTemperatures();
     array1d< real64 > density( nP * nT );
     array1d< real64 > viscosity( nP * nT );
-    SpanWagnerCO2Density::calculateCO2Density( functionName, tolerance, tableCoords, density );
-    calculateCO2Viscosity( tableCoords, density, viscosity );
+    PVTTableCache::computeOrRead( tableCacheDirectory, FenghourCO2Viscosity::catalogName(), inputParams, tableCoords, { viscosity.toView() }, [&]()
+    {
+      SpanWagnerCO2Density::calculateCO2Density( functionName, tolerance, tableCoords, density );
+      calculateCO2Viscosity( tableCoords, density, viscosity );
+    } );
 
     TableFunction * const viscosityTable = dynamicCast< TableFunction * >( functionManager.createChild( "TableFunction", tableName ) );
     viscosityTable->setTableCoordinates( tableCoords.getCoords(),
@@ -142,12 +146,13 @@ FenghourCO2Viscosity::FenghourCO2Viscosity( string const & name,
                                             string_array const & inputParams,
                                             string_array const & componentNames,
                                             array1d< real64 > const & componentMolarWeight,
-                                            TableFunction::OutputOptions const pvtOutputOpts )
+                                            TableFunction::OutputOptions const pvtOutputOpts,
+                                            string const & tableCacheDirectory )
   : PVTFunctionBase( name,
                      componentNames,
                      componentMolarWeight )
 {
-  m_CO2ViscosityTable = makeViscosityTable( inputParams, m_functionName, FunctionManager::getInstance() );
+  m_CO2ViscosityTable = makeViscosityTable( inputParams, m_functionName, tableCacheDirectory, FunctionManager::getInstance() );
 
   m_CO2ViscosityTable->outputPVTTableData( pvtOutputOpts );
 }
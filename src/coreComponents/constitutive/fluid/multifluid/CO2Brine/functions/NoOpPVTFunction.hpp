@@ -71,12 +71,13 @@ public:
                    string_array const & inputPara,
                    string_array const & componentNames,
                    array1d< real64 > const & componentMolarWeight,
-                   TableFunction::OutputOptions const pvtOutputOpts )
+                   TableFunction::OutputOptions const pvtOutputOpts,
+                   string const & tableCacheDirectory )
     : PVTFunctionBase( name,
                        componentNames,
                        componentMolarWeight )
   {
-    GEOS_UNUSED_VAR( inputPara, pvtOutputOpts );
+    GEOS_UNUSED_VAR( inputPara, pvtOutputOpts, tableCacheDirectory );
   }
 
   virtual ~NoOpPVTFunction() override = default;
@@ -19,6 +19,13 @@
 
 #include "constitutive/fluid/multifluid/CO2Brine/functions/PVTFunctionHelpers.hpp"
 #include "LvArray/src/sortedArrayManipulation.hpp"
+#include "common/MpiWrapper.hpp"
+#include "common/Path.hpp"
+#include "mainInterface/GeosxVersion.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <unistd.h>
 
 namespace geos
 {
@@ -29,6 +36,165 @@ namespace constitutive
 namespace PVTProps
 {
 
+namespace
+{
+
+/// Version of the layout of the cache files, to be increased when the layout changes
+constexpr std::uint64_t tableCacheVersion = 2;
+
+/// Version of the code computing the tables: files written by another build are never read
+#if defined(GEOS_GIT_HASH)
+constexpr char tableCacheCodeVersion[] = GEOS_VERSION_FULL "-" GEOS_GIT_HASH;
+#else
+constexpr char tableCacheCodeVersion[] = GEOS_VERSION_FULL;
+#endif
+
+/// Identifier at the beginning of the cache files
+constexpr char tableCacheMagic[8] = { 'G', 'E', 'O', 'S', 'P', 'V', 'T', 'C' };
+
+/**
+ * @brief Update a 64-bit FNV-1a hash with a sequence of bytes
+ * @param[inout] hash the hash
+ * @param[in] data the bytes
+ * @param[in] size the number of bytes
+ */
+void hashBytes( std::uint64_t & hash, void const * const data, std::size_t const size )
+{
+  unsigned char const * const bytes = static_cast< unsigned char const * >( data );
+  for( std::size_t i = 0; i < size; ++i )
+  {
+    hash ^= bytes[i];
+    hash *= 1099511628211ULL;
+  }
+}
+
+/**
+ * @brief Read tables from a cache file
+ * @param[in] filename the cache file
+ * @param[in] hash the hash of the tables
+ * @param[in] tables the tables to fill
+ * @return true if the file exists and matches the tables, false otherwise
+ */
+bool readTableCacheFile( string const & filename,
+                         std::uint64_t const hash,
+                         std::vector< arrayView1d< real64 > > const & tables )
+{
+  std::ifstream is( filename, std::ios::binary );
+  if( !is.is_open() )
+  {
+    return false;
+  }
+
+  char magic[sizeof( tableCacheMagic )]{};
+  std::uint64_t fileHash = 0;
+  std::uint64_t numTables = 0;
+  is.read( magic, sizeof( magic ) );
+  is.read( reinterpret_cast< char * >( &fileHash ), sizeof( fileHash ) );
+  is.read( reinterpret_cast< char * >( &numTables ), sizeof( numTables ) );
+  if( !is || !std::equal( std::begin( magic ), std::end( magic ), std::begin( tableCacheMagic ) ) ||
+      fileHash != hash || numTables != tables.size() )
+  {
+    return false;
+  }
+
+  for( arrayView1d< real64 > const & table : tables )
+  {
+    std::uint64_t tableSize = 0;
+    is.read( reinterpret_cast< char * >( &tableSize ), sizeof( tableSize ) );
+    if( !is || tableSize != static_cast< std::uint64_t >( table.size() ) )
+    {
+      return false;
+    }
+    is.read( reinterpret_cast< char * >( table.data() ), table.size() * sizeof( real64 ) );
+  }
+  return static_cast< bool >( is );
+}
+
+/**
+ * @brief Write tables to a cache file
+ * @param[in] filename the cache file
+ * @param[in] hash the hash of the tables
+ * @param[in] tables the tables to write
+ */
+void writeTableCacheFile( string const & filename,
+                          std::uint64_t const hash,
+                          std::vector< arrayView1d< real64 > > const & tables )
+{
+  // Write to a temporary file first, so that other runs never read a partially written file
+  string const tmpFilename = GEOS_FMT( "{}.{}.tmp", filename, getpid() );
+  {
+    std::ofstream os( tmpFilename, std::ios::binary );
+    if( !os.is_open() )
+    {
+      GEOS_WARNING( GEOS_FMT( "PVTTableCache: could not write cache file {}", filename ) );
+      return;
+    }
+    std::uint64_t const numTables = tables.size();
+    os.write( tableCacheMagic, sizeof( tableCacheMagic ) );
+    os.write( reinterpret_cast< char const * >( &hash ), sizeof( hash ) );
+    os.write( reinterpret_cast< char const * >( &numTables ), sizeof( numTables ) );
+    for( arrayView1d< real64 > const & table : tables )
+    {
+      std::uint64_t const tableSize = table.size();
+      os.write( reinterpret_cast< char const * >( &tableSize ), sizeof( tableSize ) );
+      os.write( reinterpret_cast< char const * >( table.data() ), table.size() * sizeof( real64 ) );
+    }
+  }
+  GEOS_WARNING_IF( std::rename( tmpFilename.c_str(), filename.c_str() ) != 0,
+                   GEOS_FMT( "PVTTableCache: could not write cache file {}", filename ) );
+}
+
+}
+
+void PVTTableCache::computeOrRead( string const & directory,
+                                   string const & modelName,
+                                   string_array const & inputParams,
+                                   PTTableCoordinates const & tableCoords,
+                                   std::vector< arrayView1d< real64 > > const & tables,
+                                   std::function< void() > const & computeTables )
+{
+  if( directory.empty() )
+  {
+    computeTables();
+    return;
+  }
+
+  // The key covers everything the tables depend on: code version, model, parameters, coordinates and table sizes
+  std::uint64_t hash = 14695981039346656037ULL;
+  hashBytes( hash, &tableCacheVersion, sizeof( tableCacheVersion ) );
+  hashBytes( hash, tableCacheCodeVersion, sizeof( tableCacheCodeVersion ) );
+  hashBytes( hash, modelName.c_str(), modelName.size() + 1 );
+  for( string const & param : inputParams )
+  {
+    hashBytes( hash, param.c_str(), param.size() + 1 );
+  }
+  for( array1d< real64 > const & axis : tableCoords.getCoords() )
+  {
+    std::uint64_t const axisSize = axis.size();
+    hashBytes( hash, &axisSize, sizeof( axisSize ) );
+    hashBytes( hash, axis.data(), axis.size() * sizeof( real64 ) );
+  }
+  for( arrayView1d< real64 > const & table : tables )
+  {
+    std::uint64_t const tableSize = table.size();
+    hashBytes( hash, &tableSize, sizeof( tableSize ) );
+  }
+
+  string const filename = joinPath( directory, GEOS_FMT( "{}_{:016x}.bin", modelName, hash ) );
+  if( readTableCacheFile( filename, hash, tables ) )
+  {
+    return;
+  }
+
+  computeTables();
+
+  if( MpiWrapper::commRank() == 0 )
+  {
+    makeDirsForPath( directory );
+    writeTableCacheFile( filename, hash, tables );
+  }
+}
+
 void
 BlackOilTables::readTable( string const & fileName,
                            integer minRowLength,
@@ -22,6 +22,8 @@
 #include "common/logger/Logger.hpp"
 #include "common/format/StringUtilities.hpp"
 
+#include <functional>
+
 #ifndef GEOS_CONSTITUTIVE_FLUID_MULTIFLUID_CO2BRINE_FUNCTIONS_PVTFUNCTIONHELPERS_HPP_
 #define GEOS_CONSTITUTIVE_FLUID_MULTIFLUID_CO2BRINE_FUNCTIONS_PVTFUNCTIONHELPERS_HPP_
 
@@ -150,6 +152,36 @@ private:
   array1d< array1d< real64 > > coords;
 };
 
+/**
+ * @class PVTTableCache
+ *
+ * A binary cache of the property tables computed from the parameters of the PVT models.
+ * The tables of a model are stored in a file whose name contains a hash of the GEOS version and
+ * git hash, of the model name, of the model parameters and of the table coordinates, so that
+ * changing any of them (including the code of the property models) leads to a recomputation. The directory of the cache is given by the fluid model to the PVT functions
+ * that it creates, and the cache is disabled when the directory is empty.
+ */
+class PVTTableCache
+{
+public:
+
+  /**
+   * @brief Read the property tables of a model from the cache, or compute them and add them to the cache
+   * @param[in] directory the directory of the cache files, or an empty string to always compute the tables
+   * @param[in] modelName the name identifying the model (and its variant) that computes the tables
+   * @param[in] inputParams the parameters of the model
+   * @param[in] tableCoords the (p,T) coordinates of the tables
+   * @param[in] tables the tables to fill, already sized
+   * @param[in] computeTables the function filling the tables when they are not in the cache
+   */
+  static void computeOrRead( string const & directory,
+                             string const & modelName,
+                             string_array const & inputParams,
+                             PTTableCoordinates const & tableCoords,
+                             std::vector< arrayView1d< real64 > > const & tables,
+                             std::function< void() > const & computeTables );
+};
+
 namespace PVTFunctionHelpers
 {
 
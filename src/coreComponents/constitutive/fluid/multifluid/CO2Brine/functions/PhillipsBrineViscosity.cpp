@@ -37,11 +37,14 @@ PhillipsBrineViscosity::PhillipsBrineViscosity( string const & name,
                                                 string_array const & inputPara,
                                                 string_array const & componentNames,
                                                 array1d< real64 > const & componentMolarWeight,
-                                                TableFunction::OutputOptions const pvtOutputOpts ):
+                                                TableFunction::OutputOptions const pvtOutputOpts,
+                                                string const & tableCacheDirectory ):
   PVTFunctionBase( name,
                    componentNames,
                    componentMolarWeight )
 {
+  GEOS_UNUSED_VAR( tableCacheDirectory );
+
   m_waterViscosityTable = PureWaterProperties::makeSaturationViscosityTable( m_functionName, FunctionManager::getInstance() );
   makeCoefficients( inputPara );
 
@@ -84,7 +84,8 @@ public:
                           string_array const & inputPara,
                           string_array const & componentNames,
                           array1d< real64 > const & componentMolarWeight,
-                          TableFunction::OutputOptions const pvtOutputOpts );
+                          TableFunction::OutputOptions const pvtOutputOpts,
+                          string const & tableCacheDirectory );
 
   virtual ~PhillipsBrineViscosity() override = default;
 
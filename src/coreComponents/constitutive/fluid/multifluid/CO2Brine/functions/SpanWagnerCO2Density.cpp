@@ -210,6 +210,7 @@ real64 spanWagnerCO2DensityFunction( string const & name,
 
 TableFunction const * makeDensityTable( string_array const & inputParams,
                                         string const & functionName,
+                                        string const & tableCacheDirectory,
                                         FunctionManager & functionManager )
 {
   string const tableName = functionName + "_table";
@@ -241,7 +242,10 @@ TableFunction const * makeDensityTable( string_array const & inputParams,
     }
 
     array1d< real64 > densities( tableCoords.nPressures() * tableCoords.nTemperatures() );
-    SpanWagnerCO2Density::calculateCO2Density( functionName, tolerance, tableCoords, densities );
+    PVTTableCache::computeOrRead( tableCacheDirectory, SpanWagnerCO2Density::catalogName(), inputParams, tableCoords, { densities.toView() }, [&]()
+    {
+      SpanWagnerCO2Density::calculateCO2Density( functionName, tolerance, tableCoords, densities );
+    } );
 
     TableFunction * const densityTable = dynamicCast< TableFunction * >( functionManager.createChild( "TableFunction", tableName ) );
     densityTable->setTableCoordinates( tableCoords.getCoords(), tableCoords.coordsUnits );
@@ -279,7 +283,8 @@ SpanWagnerCO2Density::SpanWagnerCO2Density( string const & name,
                                             string_array const & inputParams,
                                             string_array const & componentNames,
                                             array1d< real64 > const & componentMolarWeight,
-                                            TableFunction::OutputOptions const pvtOutputOpts ):
+                                            TableFunction::OutputOptions const pvtOutputOpts,
+                                            string const & tableCacheDirectory ):
   PVTFunctionBase( name,
                    componentNames,
                    componentMolarWeight )
@@ -287,7 +292,7 @@ SpanWagnerCO2Density::SpanWagnerCO2Density( string const & name,
   string const expectedCO2ComponentNames[] = { "CO2", "co2" };
   m_CO2Index = PVTFunctionHelpers::findName( componentNames, expectedCO2ComponentNames, "componentNames" );
 
-  m_CO2DensityTable = makeDensityTable( inputParams, m_functionName, FunctionManager::getInstance() );
+  m_CO2DensityTable = makeDensityTable( inputParams, m_functionName, tableCacheDirectory, FunctionManager::getInstance() );
 
   m_CO2DensityTable->outputPVTTableData( pvtOutputOpts );
 }
@@ -37,12 +37,13 @@ WaterDensity::WaterDensity( string const & name,
                             string_array const & inputParams,
                             string_array const & componentNames,
                             array1d< real64 > const & componentMolarWeight,
-                            TableFunction::OutputOptions const pvtOutputOpts ):
+                            TableFunction::OutputOptions const pvtOutputOpts,
+                            string const & tableCacheDirectory ):
   PVTFunctionBase( name,
                    componentNames,
                    componentMolarWeight )
 {
-  GEOS_UNUSED_VAR( inputParams );
+  GEOS_UNUSED_VAR( inputParams, tableCacheDirectory );
   m_waterDensityTable = PureWaterProperties::makeSaturationDensityTable( m_functionName, FunctionManager::getInstance() );
 
   m_waterDensityTable->outputPVTTableData( pvtOutputOpts );
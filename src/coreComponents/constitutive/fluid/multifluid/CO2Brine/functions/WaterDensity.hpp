@@ -76,7 +76,8 @@ public:
                 string_array const & inputParams,
                 string_array const & componentNames,
                 array1d< real64 > const & componentMolarWeight,
-                TableFunction::OutputOptions const pvtOutputOpts );
+                TableFunction::OutputOptions const pvtOutputOpts,
+                string const & tableCacheDirectory );
 
   static string catalogName() { return "WaterDensity"; }
   virtual string getCatalogName() const final { return catalogName(); }
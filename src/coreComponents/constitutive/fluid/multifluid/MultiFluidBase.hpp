@@ -113,6 +113,33 @@ public:
    */
   virtual bool isThermal() const { return false; }
 
+  /**
+   * @brief Iteration statistics of the phase equilibrium calculations of the last fluid update
+   */
+  struct FlashStatistics
+  {
+    /// Number of iterative flash calculations
+    integer numFlashes = 0;
+    /// Number of successive substitution iterations
+    integer numSSIIterations = 0;
+    /// Number of Newton iterations
+    integer numNewtonIterations = 0;
+    /// Number of restarts from the initial k-values after a failed warm-started flash
+    integer numRestarts = 0;
+  };
+
+  /**
+   * @brief Add the iteration statistics of the phase equilibrium calculations of the last update
+   * @param[in] ghostRank the ghost rank of the elements, only locally owned elements are counted
+   * @param[in,out] statistics the statistics to add to
+   * @note Models without an iterative phase equilibrium calculation add nothing
+   */
+  virtual void accumulateFlashStatistics( arrayView1d< integer const > const & ghostRank,
+                                          FlashStatistics & statistics ) const
+  {
+    GEOS_UNUSED_VAR( ghostRank, statistics );
+  }
+
   /**
    * @brief Get the mass flag.
    * @return boolean value indicating whether the model is using mass-based quantities (as opposed to mole-based)
@@ -291,6 +291,7 @@ void BlackOilFluidBase::createAllKernelWrappers()
 void BlackOilFluidBase::validateTable( TableFunction const & table,
                                        bool warningIfDecreasing ) const
 {
+  table.checkValuesAccessible( getFullName() );
   arrayView1d< real64 const > const property = table.getValues();
   GEOS_THROW_IF_NE_MSG( table.getInterpolationMethod(), TableFunction::InterpolationType::Linear,
                         GEOS_FMT( "{}: in table '{}' interpolation method must be linear", getFullName(), table.getName() ),
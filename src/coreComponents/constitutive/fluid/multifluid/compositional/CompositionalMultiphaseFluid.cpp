@@ -38,6 +38,20 @@ DECLARE_FIELD( kValues,
                NOPLOT,
                WRITE_AND_READ,
                "Phase equilibrium ratios" );
+DECLARE_FIELD( stabilityCache,
+               "stabilityCache",
+               array3d< real64 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Result of the last stability test and state at which it was performed" );
+DECLARE_FIELD( flashStatistics,
+               "flashStatistics",
+               array3d< integer >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Iteration statistics of the flash calculations of the last update" );
 }
 }
 
@@ -79,6 +93,8 @@ CompositionalMultiphaseFluid( string const & name, Group * const parent )
     setDescription( "Table of binary interaction coefficients" );
 
   registerField( fields::multifluid::kValues{}, &m_kValues );
+  registerField( fields::multifluid::stabilityCache{}, &m_stabilityCache );
+  registerField( fields::multifluid::flashStatistics{}, &m_flashStatistics );
 
   // Link parameters specific to each model
   m_parameters->registerParameters( this );
@@ -112,6 +128,11 @@ void CompositionalMultiphaseFluid< FLASH, PHASE1, PHASE2, PHASE3 >::allocateCons
 
   // Zero k-Values to force initialisation with Wilson k-Values
   m_kValues.zero();
+
+  // Zero the stability cache to force a stability test on the first update
+  m_stabilityCache.zero();
+
+  m_flashStatistics.zero();
 }
 
 template< typename FLASH, typename PHASE1, typename PHASE2, typename PHASE3 >
@@ -201,6 +222,8 @@ void CompositionalMultiphaseFluid< FLASH, PHASE1, PHASE2, PHASE3 >::resizeFields
   MultiFluidBase::resizeFields( size, numPts );
 
   m_kValues.resize( size, numPts, numFluidPhases()-1, numFluidComponents() );
+  m_stabilityCache.resize( size, numPts, FLASH::KernelWrapper::getStabilityCacheSize( numFluidComponents() ) );
+  m_flashStatistics.resize( size, numPts, FLASH::KernelWrapper::FlashStatistics::SIZE );
 }
 
 template< typename FLASH, typename PHASE1, typename PHASE2, typename PHASE3 >
@@ -234,7 +257,43 @@ CompositionalMultiphaseFluid< FLASH, PHASE1, PHASE2, PHASE3 >::createKernelWrapp
                         m_phaseInternalEnergy.toView(),
                         m_phaseCompFraction.toView(),
                         m_totalDensity.toView(),
-                        m_kValues.toView() );
+                        m_kValues.toView(),
+                        m_stabilityCache.toView(),
+                        m_flashStatistics.toView() );
+}
+
+template< typename FLASH, typename PHASE1, typename PHASE2, typename PHASE3 >
+void CompositionalMultiphaseFluid< FLASH, PHASE1, PHASE2, PHASE3 >::accumulateFlashStatistics( arrayView1d< integer const > const & ghostRank,
+                                                                                               FlashStatistics & statistics ) const
+{
+  using Offset = typename FLASH::KernelWrapper::FlashStatistics;
+
+  arrayView3d< integer const > const flashStatistics = m_flashStatistics.toViewConst();
+
+  RAJA::ReduceSum< parallelDeviceReduce, integer > numFlashes( 0 );
+  RAJA::ReduceSum< parallelDeviceReduce, integer > numSSIIterations( 0 );
+  RAJA::ReduceSum< parallelDeviceReduce, integer > numNewtonIterations( 0 );
+  RAJA::ReduceSum< parallelDeviceReduce, integer > numRestarts( 0 );
+
+  forAll< parallelDevicePolicy<> >( flashStatistics.size( 0 ), [=] GEOS_HOST_DEVICE ( localIndex const k )
+  {
+    if( ghostRank[k] >= 0 )
+    {
+      return;
+    }
+    for( localIndex q = 0; q < flashStatistics.size( 1 ); ++q )
+    {
+      numFlashes += flashStatistics( k, q, Offset::NUM_FLASHES );
+      numSSIIterations += flashStatistics( k, q, Offset::NUM_SSI_ITERATIONS );
+      numNewtonIterations += flashStatistics( k, q, Offset::NUM_NEWTON_ITERATIONS );
+      numRestarts += flashStatistics( k, q, Offset::NUM_RESTARTS );
+    }
+  } );
+
+  statistics.numFlashes += numFlashes.get();
+  statistics.numSSIIterations += numSSIIterations.get();
+  statistics.numNewtonIterations += numNewtonIterations.get();
+  statistics.numRestarts += numRestarts.get();
 }
 
 // Create the fluid models
@@ -87,6 +87,9 @@ public:
 
   virtual integer getWaterPhaseIndex() const override final;
 
+  virtual void accumulateFlashStatistics( arrayView1d< integer const > const & ghostRank,
+                                          FlashStatistics & statistics ) const override;
+
   struct viewKeyStruct : MultiFluidBase::viewKeyStruct
   {
     static constexpr char const * componentCriticalPressureString() { return "componentCriticalPressure"; }
@@ -147,6 +150,12 @@ private:
 
   // backup data
   PhaseComp::ValueType m_kValues;
+
+  // Result of the last stability test used to skip the test for unchanged stable cells
+  array3d< real64 > m_stabilityCache;
+
+  // Iteration statistics of the flash calculations of the last update
+  array3d< integer > m_flashStatistics;
 };
 
 using CompositionalTwoPhaseConstantViscosity = CompositionalMultiphaseFluid<
@@ -57,7 +57,9 @@ public:
                                        MultiFluidBase::PhaseProp::ViewType phaseInternalEnergy,
                                        MultiFluidBase::PhaseComp::ViewType phaseCompFrac,
                                        MultiFluidBase::FluidProp::ViewType totalDensity,
-                                       MultiFluidBase::PhaseComp::ViewValueType kValues );
+                                       MultiFluidBase::PhaseComp::ViewValueType kValues,
+                                       arrayView3d< real64 > const & stabilityCache,
+                                       arrayView3d< integer > const & flashStatistics );
 
   GEOS_HOST_DEVICE
   virtual void compute( real64 const pressure,
@@ -92,7 +94,9 @@ protected:
                 MultiFluidBase::PhaseProp::SliceType const phaseInternalEnergy,
                 MultiFluidBase::PhaseComp::SliceType const phaseCompFrac,
                 MultiFluidBase::FluidProp::SliceType const totalDensity,
-                MultiFluidBase::PhaseComp::SliceType::ValueType const & kValues ) const;
+                MultiFluidBase::PhaseComp::SliceType::ValueType const & kValues,
+                arraySlice1d< real64 > const & stabilityCache,
+                arraySlice1d< integer > const & flashStatistics ) const;
 
   /**
    * @brief Convert derivatives from phase mole fraction to total mole fraction
@@ -133,6 +137,12 @@ private:
 
   // Backup variables
   MultiFluidBase::PhaseComp::ViewValueType m_kValues;
+
+  // Result of the last stability test
+  arrayView3d< real64 > m_stabilityCache;
+
+  // Iteration statistics of the flash calculations of the last update
+  arrayView3d< integer > m_flashStatistics;
 };
 
 template< typename FLASH, typename PHASE1, typename PHASE2, typename PHASE3 >
@@ -153,7 +163,9 @@ CompositionalMultiphaseFluidUpdates( compositional::ComponentProperties const &
                                      MultiFluidBase::PhaseProp::ViewType phaseInternalEnergy,
                                      MultiFluidBase::PhaseComp::ViewType phaseCompFrac,
                                      MultiFluidBase::FluidProp::ViewType totalDensity,
-                                     MultiFluidBase::PhaseComp::ViewValueType kValues ):
+                                     MultiFluidBase::PhaseComp::ViewValueType kValues,
+                                     arrayView3d< real64 > const & stabilityCache,
+                                     arrayView3d< integer > const & flashStatistics ):
   MultiFluidBase::KernelWrapper( componentMolarWeight,
                                  useMass,
                                  std::move( phaseFrac ),
@@ -170,7 +182,9 @@ CompositionalMultiphaseFluidUpdates( compositional::ComponentProperties const &
   m_phase1( phase1.createKernelWrapper() ),
   m_phase2( phase2.createKernelWrapper() ),
   m_phase3( phase3.createKernelWrapper() ),
-  m_kValues( kValues )
+  m_kValues( kValues ),
+  m_stabilityCache( stabilityCache ),
+  m_flashStatistics( flashStatistics )
 {}
 
 template< typename FLASH, typename PHASE1, typename PHASE2, typename PHASE3 >
@@ -196,6 +210,13 @@ CompositionalMultiphaseFluidUpdates< FLASH, PHASE1, PHASE2, PHASE3 >::compute(
 
   LvArray::forValuesInSlice( kValues[0][0], setZero );   // Force initialisation of k-Values
 
+  integer constexpr maxCacheSize = FLASH::KernelWrapper::getStabilityCacheSize( maxNumComp );
+  stackArray1d< real64, maxCacheSize > stabilityCache( FLASH::KernelWrapper::getStabilityCacheSize( numComponents() ) );
+  LvArray::forValuesInSlice( stabilityCache.toSlice(), setZero );   // Force the stability test
+
+  using FlashStatistics = typename FLASH::KernelWrapper::FlashStatistics;
+  stackArray1d< integer, FlashStatistics::SIZE > flashStatistics( FlashStatistics::SIZE );
+
   compute( pressure,
            temperature,
            composition,
@@ -207,7 +228,9 @@ CompositionalMultiphaseFluidUpdates< FLASH, PHASE1, PHASE2, PHASE3 >::compute(
            phaseInternalEnergy,
            phaseCompFrac,
            totalDensity,
-           kValues[0][0] );
+           kValues[0][0],
+           stabilityCache.toSlice(),
+           flashStatistics.toSlice() );
 }
 
 template< typename FLASH, typename PHASE1, typename PHASE2, typename PHASE3 >
@@ -226,7 +249,9 @@ CompositionalMultiphaseFluidUpdates< FLASH, PHASE1, PHASE2, PHASE3 >::compute(
   MultiFluidBase::PhaseProp::SliceType const phaseInternalEnergy,
   MultiFluidBase::PhaseComp::SliceType const phaseCompFrac,
   MultiFluidBase::FluidProp::SliceType const totalDensity,
-  MultiFluidBase::PhaseComp::SliceType::ValueType const & kValues ) const
+  MultiFluidBase::PhaseComp::SliceType::ValueType const & kValues,
+  arraySlice1d< real64 > const & stabilityCache,
+  arraySlice1d< integer > const & flashStatistics ) const
 {
   integer constexpr maxNumComp = MultiFluidBase::MAX_NUM_COMPONENTS;
   integer constexpr maxNumDof = MultiFluidBase::MAX_NUM_COMPONENTS + 2;
@@ -256,11 +281,17 @@ CompositionalMultiphaseFluidUpdates< FLASH, PHASE1, PHASE2, PHASE3 >::compute(
   }
 
   // 2. Compute phase fractions and phase component fractions
+  for( integer i = 0; i < flashStatistics.size(); ++i )
+  {
+    flashStatistics[i] = 0;
+  }
   m_flash.compute( m_componentProperties,
                    pressure,
                    temperature,
                    compMoleFrac.toSliceConst(),
                    kValues,
+                   stabilityCache,
+                   flashStatistics,
                    phaseFrac,
                    phaseCompFrac );
 
@@ -414,7 +445,9 @@ update( localIndex const k,
            m_phaseInternalEnergy( k, q ),
            m_phaseCompFraction( k, q ),
            m_totalDensity( k, q ),
-           m_kValues[k][q] );
+           m_kValues[k][q],
+           m_stabilityCache[k][q],
+           m_flashStatistics[k][q] );
 }
 
 template< typename FLASH, typename PHASE1, typename PHASE2, typename PHASE3 >
@@ -40,6 +40,23 @@ struct NegativeTwoPhaseFlash
   using Deriv = constitutive::multifluid::DerivativeOffset;
 
 public:
+  /**
+   * @brief Iteration statistics of a flash calculation
+   */
+  struct Statistics
+  {
+    integer numSSIIterations = 0;    ///< Number of successive substitution iterations
+    integer numNewtonIterations = 0; ///< Number of Newton iterations
+    integer numRestarts = 0;         ///< Number of restarts from Wilson k-values after a failed warm start
+    bool warmStarted = false;        ///< Whether the flash was started from the provided k-values
+  };
+
+  /// Number of successive substitution iterations after which the solver switches to Newton
+  static constexpr integer numSSIIterationsBeforeNewton = 5;
+
+  /// Error below which the solver switches from successive substitution to Newton
+  static constexpr real64 newtonSwitchTolerance = 1.0e-2;
+
   /**
    * @brief Perform negative two-phase EOS flash
    * @param[in] numComps number of components
@@ -69,6 +86,42 @@ public:
                        arraySlice1d< real64, USD2 > const & liquidComposition,
                        arraySlice1d< real64, USD2 > const & vapourComposition );
 
+  /**
+   * @brief Perform negative two-phase EOS flash and collect iteration statistics
+   * @details The flash is warm-started from the provided k-values when they are valid (i.e. positive
+   *          and not trivial), which is typically the case when they have been stored from a previous
+   *          call for the same cell. Otherwise, or if the warm-started solve fails, the k-values are
+   *          initialised with the Wilson correlation. The fugacity equations are solved with successive
+   *          substitution, switching to Newton on ln K once close enough to the solution.
+   * @param[in] numComps number of components
+   * @param[in] pressure pressure
+   * @param[in] temperature temperature
+   * @param[in] composition composition of the mixture
+   * @param[in] componentProperties The compositional component properties
+   * @param[in] liquidEos The equation of state for the liquid phase
+   * @param[in] vapourEos The equation of state for the vapour phase
+   * @param[in/out] kValues The phase equilibrium ratios
+   * @param[out] vapourPhaseMoleFraction the calculated vapour (gas) mole fraction
+   * @param[out] liquidComposition the calculated liquid phase composition
+   * @param[out] vapourComposition the calculated vapour phase composition
+   * @param[out] statistics the iteration statistics
+   * @return an indicator of success of the flash
+   */
+  template< int USD1, int USD2 >
+  GEOS_HOST_DEVICE
+  static bool compute( integer const numComps,
+                       real64 const pressure,
+                       real64 const temperature,
+                       arraySlice1d< real64 const > const & composition,
+                       ComponentProperties::KernelWrapper const & componentProperties,
+                       EquationOfStateType const liquidEos,
+                       EquationOfStateType const vapourEos,
+                       arraySlice2d< real64, USD1 > const & kValues,
+                       real64 & vapourPhaseMoleFraction,
+                       arraySlice1d< real64, USD2 > const & liquidComposition,
+                       arraySlice1d< real64, USD2 > const & vapourComposition,
+                       Statistics & statistics );
+
   /**
    * @brief Calculate derivatives from the two-phase negative flash
    * @param[in] numComps number of components
@@ -193,6 +246,102 @@ private:
     arraySlice1d< real64 > const & logVapourFugacity,
     arraySlice1d< real64 > const & fugacityRatios );
 
+  /**
+   * @brief Check whether the k-values can be used as a starting point for the flash
+   * @param[in] kValues the k-values
+   * @param[in] presentComponents The indices of the present components
+   * @return @c true if all k-values are positive and not all close to unity
+   */
+  template< integer USD >
+  GEOS_HOST_DEVICE
+  GEOS_FORCE_INLINE
+  static bool hasValidKValues( arraySlice1d< real64 const, USD > const & kValues,
+                               arraySlice1d< integer const > const & presentComponents )
+  {
+    real64 distanceToTrivial = 0.0;
+    for( integer const ic : presentComponents )
+    {
+      if( !(MultiFluidConstants::epsilon < kValues[ic]) )
+      {
+        return false;
+      }
+      distanceToTrivial = LvArray::math::max( distanceToTrivial, LvArray::math::abs( LvArray::math::log( kValues[ic] ) ) );
+    }
+    return MultiFluidConstants::SSITolerance < distanceToTrivial;
+  }
+
+  /**
+   * @brief Iteratively solve the fugacity equations starting from the given k-values
+   * @param[in] numComps number of components
+   * @param[in] pressure pressure
+   * @param[in] temperature temperature
+   * @param[in] composition composition of the mixture
+   * @param[in] componentProperties The compositional component properties
+   * @param[in] liquidEos The equation of state for the liquid phase
+   * @param[in] vapourEos The equation of state for the vapour phase
+   * @param[in] presentComponents The indices of the present components
+   * @param[in/out] kValues The vapour-liquid k-values
+   * @param[out] vapourPhaseMoleFraction the calculated vapour (gas) mole fraction
+   * @param[out] liquidComposition the calculated liquid phase composition
+   * @param[out] vapourComposition the calculated vapour phase composition
+   * @param[in/out] statistics the iteration statistics
+   * @return @c true if the fugacity equations have converged
+   */
+  template< integer USD1, integer USD2 >
+  GEOS_HOST_DEVICE
+  static bool solveFugacityEquations( integer const numComps,
+                                      real64 const pressure,
+                                      real64 const temperature,
+                                      arraySlice1d< real64 const > const & composition,
+                                      ComponentProperties::KernelWrapper const & componentProperties,
+                                      EquationOfStateType const liquidEos,
+                                      EquationOfStateType const vapourEos,
+                                      arraySlice1d< integer const > const & presentComponents,
+                                      arraySlice1d< real64, USD1 > const & kValues,
+                                      real64 & vapourPhaseMoleFraction,
+                                      arraySlice1d< real64, USD2 > const & liquidComposition,
+                                      arraySlice1d< real64, USD2 > const & vapourComposition,
+                                      Statistics & statistics );
+
+  /**
+   * @brief Update the k-values with a Newton step on the logarithm of the k-values
+   * @details The unknowns are ln K_i for the present components, and the residuals are the log fugacity
+   *          ratios. The phase compositions are differentiated through the Rachford-Rice equation.
+   * @param[in] numComps number of components
+   * @param[in] pressure pressure
+   * @param[in] temperature temperature
+   * @param[in] composition composition of the mixture
+   * @param[in] componentProperties The compositional component properties
+   * @param[in] liquidEos The equation of state for the liquid phase
+   * @param[in] vapourEos The equation of state for the vapour phase
+   * @param[in] presentComponents The indices of the present components
+   * @param[in] vapourPhaseMoleFraction the current vapour (gas) mole fraction
+   * @param[in] liquidComposition the current liquid phase composition
+   * @param[in] vapourComposition the current vapour phase composition
+   * @param[in] logLiquidFugacity the log fugacity coefficients of the liquid phase
+   * @param[in] logVapourFugacity the log fugacity coefficients of the vapour phase
+   * @param[in] fugacityRatios the log fugacity ratios (residuals)
+   * @param[in/out] kValues The vapour-liquid k-values
+   * @return @c true if the update has been applied, @c false if the Newton system could not be solved
+   */
+  template< integer USD1, integer USD2 >
+  GEOS_HOST_DEVICE
+  static bool applyNewtonUpdate( integer const numComps,
+                                 real64 const pressure,
+                                 real64 const temperature,
+                                 arraySlice1d< real64 const > const & composition,
+                                 ComponentProperties::KernelWrapper const & componentProperties,
+                                 EquationOfStateType const liquidEos,
+                                 EquationOfStateType const vapourEos,
+                                 arraySlice1d< integer const > const & presentComponents,
+                                 real64 const vapourPhaseMoleFraction,
+                                 arraySlice1d< real64 const, USD2 > const & liquidComposition,
+                                 arraySlice1d< real64 const, USD2 > const & vapourComposition,
+                                 arraySlice1d< real64 const > const & logLiquidFugacity,
+                                 arraySlice1d< real64 const > const & logVapourFugacity,
+                                 arraySlice1d< real64 const > const & fugacityRatios,
+                                 arraySlice1d< real64, USD1 > const & kValues );
+
   /**
    * @brief Solve the lineat system for the derivatives of the flash
    * @param[in/out] A the coefficient matrix. Destroyed after call
@@ -229,15 +378,45 @@ bool NegativeTwoPhaseFlash::compute( integer const numComps,
                                      real64 & vapourPhaseMoleFraction,
                                      arraySlice1d< real64, USD2 > const & liquidComposition,
                                      arraySlice1d< real64, USD2 > const & vapourComposition )
+{
+  Statistics statistics;
+  return compute( numComps,
+                  pressure,
+                  temperature,
+                  composition,
+                  componentProperties,
+                  liquidEos,
+                  vapourEos,
+                  kValues,
+                  vapourPhaseMoleFraction,
+                  liquidComposition,
+                  vapourComposition,
+                  statistics );
+}
+
+template< int USD1, int USD2 >
+GEOS_HOST_DEVICE
+bool NegativeTwoPhaseFlash::compute( integer const numComps,
+                                     real64 const pressure,
+                                     real64 const temperature,
+                                     arraySlice1d< real64 const > const & composition,
+                                     ComponentProperties::KernelWrapper const & componentProperties,
+                                     EquationOfStateType const liquidEos,
+                                     EquationOfStateType const vapourEos,
+                                     arraySlice2d< real64, USD1 > const & kValues,
+                                     real64 & vapourPhaseMoleFraction,
+                                     arraySlice1d< real64, USD2 > const & liquidComposition,
+                                     arraySlice1d< real64, USD2 > const & vapourComposition,
+                                     Statistics & statistics )
 {
   constexpr integer maxNumComps = MultiFluidConstants::MAX_NUM_COMPONENTS;
-  stackArray1d< real64, maxNumComps > logLiquidFugacity( numComps );
-  stackArray1d< real64, maxNumComps > logVapourFugacity( numComps );
-  stackArray1d< real64, maxNumComps > fugacityRatios( numComps );
   stackArray1d< integer, maxNumComps > componentIndices( numComps );
   auto const & kVapourLiquid = kValues[0];
 
   calculatePresentComponents( numComps, composition, componentIndices );
+  auto const presentComponents = componentIndices.toSliceConst();
+
+  statistics = Statistics();
 
   // Initialise compositions to feed composition
   for( integer ic = 0; ic < numComps; ++ic )
@@ -246,31 +425,108 @@ bool NegativeTwoPhaseFlash::compute( integer const numComps,
     vapourComposition[ic] = composition[ic];
   }
 
-  // Check if k-Values need to be initialised
-  bool needInitialisation = true;
-  for( integer ic = 0; ic < numComps; ++ic )
+  // Check if k-Values need to be initialised, otherwise warm-start from the given values
+  statistics.warmStarted = hasValidKValues( kVapourLiquid.toSliceConst(), presentComponents );
+
+  if( !statistics.warmStarted )
   {
-    if( kVapourLiquid[ic] < MultiFluidConstants::epsilon )
-    {
-      needInitialisation = true;
-      break;
-    }
+    KValueInitialization::computeWilsonGasLiquidKvalue( numComps,
+                                                        pressure,
+                                                        temperature,
+                                                        componentProperties,
+                                                        kVapourLiquid );
   }
 
-  if( needInitialisation )
+  bool converged = solveFugacityEquations( numComps,
+                                           pressure,
+                                           temperature,
+                                           composition,
+                                           componentProperties,
+                                           liquidEos,
+                                           vapourEos,
+                                           presentComponents,
+                                           kVapourLiquid,
+                                           vapourPhaseMoleFraction,
+                                           liquidComposition,
+                                           vapourComposition,
+                                           statistics );
+
+  if( !converged && statistics.warmStarted )
   {
+    // The stored k-values were too far from the solution: restart from the Wilson k-values
+    ++statistics.numRestarts;
     KValueInitialization::computeWilsonGasLiquidKvalue( numComps,
                                                         pressure,
                                                         temperature,
                                                         componentProperties,
                                                         kVapourLiquid );
+    converged = solveFugacityEquations( numComps,
+                                        pressure,
+                                        temperature,
+                                        composition,
+                                        componentProperties,
+                                        liquidEos,
+                                        vapourEos,
+                                        presentComponents,
+                                        kVapourLiquid,
+                                        vapourPhaseMoleFraction,
+                                        liquidComposition,
+                                        vapourComposition,
+                                        statistics );
   }
 
-  auto const presentComponents = componentIndices.toSliceConst();
+  // Retrieve physical bounds from negative flash values
+  if( vapourPhaseMoleFraction < MultiFluidConstants::epsilon )
+  {
+    vapourPhaseMoleFraction = 0.0;
+    for( integer ic = 0; ic < numComps; ++ic )
+    {
+      liquidComposition[ic] = composition[ic];
+      vapourComposition[ic] = composition[ic];
+    }
+  }
+  else if( 1.0 - vapourPhaseMoleFraction < MultiFluidConstants::epsilon )
+  {
+    vapourPhaseMoleFraction = 1.0;
+    for( integer ic = 0; ic < numComps; ++ic )
+    {
+      liquidComposition[ic] = composition[ic];
+      vapourComposition[ic] = composition[ic];
+    }
+  }
+
+  return converged;
+}
+
+template< integer USD1, integer USD2 >
+GEOS_HOST_DEVICE
+bool NegativeTwoPhaseFlash::solveFugacityEquations( integer const numComps,
+                                                    real64 const pressure,
+                                                    real64 const temperature,
+                                                    arraySlice1d< real64 const > const & composition,
+                                                    ComponentProperties::KernelWrapper const & componentProperties,
+                                                    EquationOfStateType const liquidEos,
+                                                    EquationOfStateType const vapourEos,
+                                                    arraySlice1d< integer const > const & presentComponents,
+                                                    arraySlice1d< real64, USD1 > const & kValues,
+                                                    real64 & vapourPhaseMoleFraction,
+                                                    arraySlice1d< real64, USD2 > const & liquidComposition,
+                                                    arraySlice1d< real64, USD2 > const & vapourComposition,
+                                                    Statistics & statistics )
+{
+  constexpr integer maxNumComps = MultiFluidConstants::MAX_NUM_COMPONENTS;
+  stackArray1d< real64, maxNumComps > logLiquidFugacity( numComps );
+  stackArray1d< real64, maxNumComps > logVapourFugacity( numComps );
+  stackArray1d< real64, maxNumComps > fugacityRatios( numComps );
+
+  integer numSSIIterations = 0;
+  bool useNewton = false;
+  bool newtonFailed = false;
+  real64 previousError = LvArray::NumericLimits< real64 >::max;
 
-  bool converged = false;
   for( localIndex iterationCount = 0; iterationCount < MultiFluidConstants::maxSSIIterations; ++iterationCount )
   {
+    // Compute fugacity ratios and check convergence
     real64 const error = computeFugacityRatio( numComps,
                                                pressure,
                                                temperature,
@@ -278,7 +534,7 @@ bool NegativeTwoPhaseFlash::compute( integer const numComps,
                                                componentProperties,
                                                liquidEos,
                                                vapourEos,
-                                               kVapourLiquid.toSliceConst(),
+                                               kValues.toSliceConst(),
                                                presentComponents,
                                                vapourPhaseMoleFraction,
                                                liquidComposition,
@@ -287,42 +543,178 @@ bool NegativeTwoPhaseFlash::compute( integer const numComps,
                                                logVapourFugacity.toSlice(),
                                                fugacityRatios.toSlice() );
 
-    // Compute fugacity ratios and check convergence
-    converged = (error < MultiFluidConstants::fugacityTolerance);
+    if( error < MultiFluidConstants::fugacityTolerance )
+    {
+      return true;
+    }
 
-    if( converged )
+    // Switch to Newton once successive substitution got close enough to the solution,
+    // and permanently back to successive substitution if a Newton step did not reduce the error
+    if( useNewton && previousError < error )
+    {
+      useNewton = false;
+      newtonFailed = true;
+    }
+    else if( !useNewton && !newtonFailed &&
+             ( error < newtonSwitchTolerance || numSSIIterationsBeforeNewton <= numSSIIterations ) )
     {
-      break;
+      useNewton = true;
     }
+    previousError = error;
 
-    // Update K-values
-    for( integer ic = 0; ic < numComps; ++ic )
+    if( useNewton )
+    {
+      useNewton = applyNewtonUpdate( numComps,
+                                     pressure,
+                                     temperature,
+                                     composition,
+                                     componentProperties,
+                                     liquidEos,
+                                     vapourEos,
+                                     presentComponents,
+                                     vapourPhaseMoleFraction,
+                                     liquidComposition.toSliceConst(),
+                                     vapourComposition.toSliceConst(),
+                                     logLiquidFugacity.toSliceConst(),
+                                     logVapourFugacity.toSliceConst(),
+                                     fugacityRatios.toSliceConst(),
+                                     kValues );
+      newtonFailed = !useNewton;
+    }
+
+    if( useNewton )
+    {
+      ++statistics.numNewtonIterations;
+    }
+    else
     {
-      kVapourLiquid[ic] *= exp( fugacityRatios[ic] );
+      // Successive substitution update of the K-values
+      for( integer ic = 0; ic < numComps; ++ic )
+      {
+        kValues[ic] *= exp( fugacityRatios[ic] );
+      }
+      ++numSSIIterations;
+      ++statistics.numSSIIterations;
     }
   }
 
-  // Retrieve physical bounds from negative flash values
-  if( vapourPhaseMoleFraction < MultiFluidConstants::epsilon )
+  return false;
+}
+
+template< integer USD1, integer USD2 >
+GEOS_HOST_DEVICE
+bool NegativeTwoPhaseFlash::applyNewtonUpdate( integer const numComps,
+                                               real64 const pressure,
+                                               real64 const temperature,
+                                               arraySlice1d< real64 const > const & composition,
+                                               ComponentProperties::KernelWrapper const & componentProperties,
+                                               EquationOfStateType const liquidEos,
+                                               EquationOfStateType const vapourEos,
+                                               arraySlice1d< integer const > const & presentComponents,
+                                               real64 const vapourPhaseMoleFraction,
+                                               arraySlice1d< real64 const, USD2 > const & liquidComposition,
+                                               arraySlice1d< real64 const, USD2 > const & vapourComposition,
+                                               arraySlice1d< real64 const > const & logLiquidFugacity,
+                                               arraySlice1d< real64 const > const & logVapourFugacity,
+                                               arraySlice1d< real64 const > const & fugacityRatios,
+                                               arraySlice1d< real64, USD1 > const & kValues )
+{
+  constexpr integer maxNumComps = MultiFluidConstants::MAX_NUM_COMPONENTS;
+  constexpr integer maxNumDofs = MultiFluidConstants::MAX_NUM_COMPONENTS + 2;
+
+  integer const numDofs = numComps + 2;
+  integer const numPresent = presentComponents.size();
+  real64 const V = vapourPhaseMoleFraction;
+
+  stackArray2d< real64, maxNumComps * maxNumDofs > logLiquidFugacityDerivs( numComps, numDofs );
+  stackArray2d< real64, maxNumComps * maxNumDofs > logVapourFugacityDerivs( numComps, numDofs );
+
+  FugacityCalculator::computeLogFugacityDerivatives( numComps,
+                                                     pressure,
+                                                     temperature,
+                                                     liquidComposition,
+                                                     componentProperties,
+                                                     liquidEos,
+                                                     logLiquidFugacity,
+                                                     logLiquidFugacityDerivs.toSlice() );
+  FugacityCalculator::computeLogFugacityDerivatives( numComps,
+                                                     pressure,
+                                                     temperature,
+                                                     vapourComposition,
+                                                     componentProperties,
+                                                     vapourEos,
+                                                     logVapourFugacity,
+                                                     logVapourFugacityDerivs.toSlice() );
+
+  // Derivatives of the vapour fraction from the Rachford-Rice equation
+  // sum_i z_i (K_i - 1) / t_i = 0 with t_i = 1 + V (K_i - 1)
+  stackArray1d< real64, maxNumComps > dVdLogK( numComps );
+  real64 dRRdV = 0.0;
+  for( integer const ic : presentComponents )
   {
-    vapourPhaseMoleFraction = 0.0;
-    for( integer ic = 0; ic < numComps; ++ic )
+    real64 const t = 1.0 + V * ( kValues[ic] - 1.0 );
+    dRRdV -= composition[ic] * ( kValues[ic] - 1.0 ) * ( kValues[ic] - 1.0 ) / ( t * t );
+    dVdLogK[ic] = composition[ic] * kValues[ic] / ( t * t );
+  }
+  if( LvArray::math::abs( dRRdV ) < MultiFluidConstants::epsilon )
+  {
+    return false;
+  }
+  for( integer const ic : presentComponents )
+  {
+    dVdLogK[ic] /= -dRRdV;
+  }
+
+  // Derivatives of the phase compositions x_i = z_i / t_i and y_i = K_i x_i
+  stackArray2d< real64, maxNumComps * maxNumComps > dxdLogK( numPresent, numPresent );
+  stackArray2d< real64, maxNumComps * maxNumComps > dydLogK( numPresent, numPresent );
+  for( integer i = 0; i < numPresent; ++i )
+  {
+    integer const ic = presentComponents[i];
+    real64 const t = 1.0 + V * ( kValues[ic] - 1.0 );
+    real64 const dxdt = -composition[ic] / ( t * t );
+    for( integer j = 0; j < numPresent; ++j )
     {
-      liquidComposition[ic] = composition[ic];
-      vapourComposition[ic] = composition[ic];
+      integer const jc = presentComponents[j];
+      real64 const dtdLogK = ( kValues[ic] - 1.0 ) * dVdLogK[jc] + ( i == j ? V * kValues[ic] : 0.0 );
+      dxdLogK( i, j ) = dxdt * dtdLogK;
+      dydLogK( i, j ) = kValues[ic] * dxdLogK( i, j );
     }
+    dydLogK( i, i ) += kValues[ic] * composition[ic] / t;
   }
-  else if( 1.0 - vapourPhaseMoleFraction < MultiFluidConstants::epsilon )
+
+  // Jacobian of the residuals r_i = ln phiL_i - ln phiV_i - ln K_i
+  constexpr integer maxNumVals = MultiFluidConstants::MAX_NUM_COMPONENTS;
+  StackArray< real64, 2, maxNumVals * maxNumVals, MatrixLayout::COL_MAJOR_PERM > A( numPresent, numPresent );
+  StackArray< real64, 2, maxNumVals, MatrixLayout::COL_MAJOR_PERM > X( numPresent, 1 );
+
+  for( integer i = 0; i < numPresent; ++i )
   {
-    vapourPhaseMoleFraction = 1.0;
-    for( integer ic = 0; ic < numComps; ++ic )
+    integer const ic = presentComponents[i];
+    for( integer j = 0; j < numPresent; ++j )
     {
-      liquidComposition[ic] = composition[ic];
-      vapourComposition[ic] = composition[ic];
+      real64 value = ( i == j ) ? -1.0 : 0.0;
+      for( integer k = 0; k < numPresent; ++k )
+      {
+        integer const kc = presentComponents[k];
+        value += logLiquidFugacityDerivs( ic, Deriv::dC + kc ) * dxdLogK( k, j )
+                 - logVapourFugacityDerivs( ic, Deriv::dC + kc ) * dydLogK( k, j );
+      }
+      A( i, j ) = value;
     }
+    X( i, 0 ) = -fugacityRatios[ic];
   }
 
-  return converged;
+  if( !solveLinearSystem( A.toSlice(), X.toSlice() ) )
+  {
+    return false;
+  }
+
+  for( integer i = 0; i < numPresent; ++i )
+  {
+    kValues[presentComponents[i]] *= exp( X( i, 0 ) );
+  }
+  return true;
 }
 
 template< integer USD1, integer USD2, integer USD3 >
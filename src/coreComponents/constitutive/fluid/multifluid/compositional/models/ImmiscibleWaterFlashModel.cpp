@@ -20,6 +20,7 @@
 #include "ImmiscibleWaterFlashModel.hpp"
 #include "ImmiscibleWaterParameters.hpp"
 #include "EquationOfState.hpp"
+#include "StabilityTestParameters.hpp"
 
 namespace geos
 {
@@ -56,6 +57,7 @@ ImmiscibleWaterFlashModel::createKernelWrapper() const
   EquationOfStateType const vapourEos =  EnumStrings< EquationOfStateType >::fromString( equationOfState->m_equationsOfStateNames[vapourIndex] );
 
   array1d< real64 > componentCriticalVolume( m_componentProperties.getNumberOfComponents());
+  StabilityTestParameters const * stabilityParameters = m_parameters.get< StabilityTestParameters >();
 
   return KernelWrapper( m_componentProperties.getNumberOfComponents(),
                         liquidIndex,
@@ -64,7 +66,8 @@ ImmiscibleWaterFlashModel::createKernelWrapper() const
                         m_waterComponentIndex,
                         liquidEos,
                         vapourEos,
-                        componentCriticalVolume );
+                        componentCriticalVolume,
+                        *stabilityParameters );
 }
 
 ImmiscibleWaterFlashModelUpdate::ImmiscibleWaterFlashModelUpdate(
@@ -75,13 +78,15 @@ ImmiscibleWaterFlashModelUpdate::ImmiscibleWaterFlashModelUpdate(
   integer const waterComponentIndex,
   EquationOfStateType const liquidEos,
   EquationOfStateType const vapourEos,
-  arrayView1d< real64 const > const componentCriticalVolume ):
+  arrayView1d< real64 const > const componentCriticalVolume,
+  StabilityTestParameters const & stabilityParameters ):
   m_twoPhaseModel( numComponents,
                    liquidIndex,
                    vapourIndex,
                    liquidEos,
                    vapourEos,
-                   componentCriticalVolume ),
+                   componentCriticalVolume,
+                   stabilityParameters ),
   m_numComponents( numComponents ),
   m_liquidIndex( liquidIndex ),
   m_vapourIndex( vapourIndex ),
@@ -55,7 +55,22 @@ public:
                                    integer const waterComponentIndex,
                                    EquationOfStateType const liquidEos,
                                    EquationOfStateType const vapourEos,
-                                   arrayView1d< real64 const > const componentCriticalVolume );
+                                   arrayView1d< real64 const > const componentCriticalVolume,
+                                   StabilityTestParameters const & stabilityParameters );
+
+  /**
+   * @brief Get the size of the per-cell stability test cache
+   * @param numComponents the number of components
+   * @return the number of cached values per cell
+   */
+  GEOS_HOST_DEVICE
+  static constexpr integer getStabilityCacheSize( integer const numComponents )
+  {
+    return NegativeTwoPhaseFlashModelUpdate::getStabilityCacheSize( numComponents );
+  }
+
+  /// Offsets into the per-cell iteration statistics of the flash calculations
+  using FlashStatistics = NegativeTwoPhaseFlashModelUpdate::FlashStatistics;
 
   // Mark as a 3-phase flash
   GEOS_HOST_DEVICE
@@ -71,6 +86,18 @@ public:
                 PhaseProp::SliceType const phaseFraction,
                 PhaseComp::SliceType const phaseCompFraction ) const;
 
+  template< int USD1, int USD2, int USD3, int USD4 >
+  GEOS_HOST_DEVICE
+  void compute( ComponentProperties::KernelWrapper const & componentProperties,
+                real64 const & pressure,
+                real64 const & temperature,
+                arraySlice1d< real64 const, USD1 > const & compFraction,
+                arraySlice2d< real64, USD2 > const & kValues,
+                arraySlice1d< real64, USD3 > const & stabilityCache,
+                arraySlice1d< integer, USD4 > const & flashStatistics,
+                PhaseProp::SliceType const phaseFraction,
+                PhaseComp::SliceType const phaseCompFraction ) const;
+
 private:
   template< int USD >
   GEOS_FORCE_INLINE
@@ -140,6 +167,33 @@ void ImmiscibleWaterFlashModelUpdate::compute( ComponentProperties::KernelWrappe
                                                arraySlice2d< real64, USD2 > const & kValues,
                                                PhaseProp::SliceType const phaseFraction,
                                                PhaseComp::SliceType const phaseCompFraction ) const
+{
+  // Without a persistent cache the stability test is always performed
+  stackArray1d< real64, getStabilityCacheSize( maxNumComps ) > stabilityCache( getStabilityCacheSize( m_numComponents ) );
+  LvArray::forValuesInSlice( stabilityCache.toSlice(), setZero );
+  stackArray1d< integer, FlashStatistics::SIZE > flashStatistics( FlashStatistics::SIZE );
+  compute( componentProperties,
+           pressure,
+           temperature,
+           compFraction,
+           kValues,
+           stabilityCache.toSlice(),
+           flashStatistics.toSlice(),
+           phaseFraction,
+           phaseCompFraction );
+}
+
+template< int USD1, int USD2, int USD3, int USD4 >
+GEOS_HOST_DEVICE
+void ImmiscibleWaterFlashModelUpdate::compute( ComponentProperties::KernelWrapper const & componentProperties,
+                                               real64 const & pressure,
+                                               real64 const & temperature,
+                                               arraySlice1d< real64 const, USD1 > const & compFraction,
+                                               arraySlice2d< real64, USD2 > const & kValues,
+                                               arraySlice1d< real64, USD3 > const & stabilityCache,
+                                               arraySlice1d< integer, USD4 > const & flashStatistics,
+                                               PhaseProp::SliceType const phaseFraction,
+                                               PhaseComp::SliceType const phaseCompFraction ) const
 {
   LvArray::forValuesInSlice( phaseFraction.value, setZero );
   LvArray::forValuesInSlice( phaseFraction.derivs, setZero );
@@ -184,6 +238,8 @@ void ImmiscibleWaterFlashModelUpdate::compute( ComponentProperties::KernelWrappe
                              temperature,
                              composition.toSliceConst(),
                              kValues,
+                             stabilityCache,
+                             flashStatistics,
                              phaseFraction,
                              phaseCompFraction );
 
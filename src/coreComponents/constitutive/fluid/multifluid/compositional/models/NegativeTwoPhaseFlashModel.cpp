@@ -20,6 +20,7 @@
 #include "NegativeTwoPhaseFlashModel.hpp"
 #include "EquationOfState.hpp"
 #include "CriticalVolume.hpp"
+#include "StabilityTestParameters.hpp"
 
 namespace geos
 {
@@ -53,13 +54,15 @@ NegativeTwoPhaseFlashModel::createKernelWrapper() const
   EquationOfStateType const vapourEos =  EnumStrings< EquationOfStateType >::fromString( equationOfState->m_equationsOfStateNames[vapourIndex] );
 
   CriticalVolume const * criticalVolume = m_parameters.get< CriticalVolume >();
+  StabilityTestParameters const * stabilityParameters = m_parameters.get< StabilityTestParameters >();
 
   return KernelWrapper( m_componentProperties.getNumberOfComponents(),
                         liquidIndex,
                         vapourIndex,
                         liquidEos,
                         vapourEos,
-                        criticalVolume->m_componentCriticalVolume );
+                        criticalVolume->m_componentCriticalVolume,
+                        *stabilityParameters );
 }
 
 NegativeTwoPhaseFlashModelUpdate::NegativeTwoPhaseFlashModelUpdate(
@@ -68,13 +71,19 @@ NegativeTwoPhaseFlashModelUpdate::NegativeTwoPhaseFlashModelUpdate(
   integer const vapourIndex,
   EquationOfStateType const liquidEos,
   EquationOfStateType const vapourEos,
-  arrayView1d< real64 const > const componentCriticalVolume ):
+  arrayView1d< real64 const > const componentCriticalVolume,
+  StabilityTestParameters const & stabilityParameters ):
   m_numComponents( numComponents ),
   m_liquidIndex( liquidIndex ),
   m_vapourIndex( vapourIndex ),
   m_liquidEos( liquidEos ),
   m_vapourEos( vapourEos ),
-  m_componentCriticalVolume( componentCriticalVolume )
+  m_componentCriticalVolume( componentCriticalVolume ),
+  m_skipStabilityTest( stabilityParameters.m_skipStabilityTest ),
+  m_minTangentPlaneDistance( stabilityParameters.m_minTangentPlaneDistance ),
+  m_pressureTolerance( stabilityParameters.m_pressureTolerance ),
+  m_temperatureTolerance( stabilityParameters.m_temperatureTolerance ),
+  m_compositionTolerance( stabilityParameters.m_compositionTolerance )
 {}
 
 std::unique_ptr< ModelParameters >
@@ -82,6 +91,7 @@ NegativeTwoPhaseFlashModel::createParameters( std::unique_ptr< ModelParameters >
 {
   std::unique_ptr< ModelParameters > params = EquationOfState::create( std::move( parameters ) );
   params = CriticalVolume::create( std::move( params ) );
+  params = StabilityTestParameters::create( std::move( params ) );
   return params;
 }
 
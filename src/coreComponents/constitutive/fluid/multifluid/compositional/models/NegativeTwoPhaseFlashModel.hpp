@@ -22,6 +22,7 @@
 
 #include "FunctionBase.hpp"
 #include "EquationOfState.hpp"
+#include "StabilityTestParameters.hpp"
 
 #include "constitutive/fluid/multifluid/Layouts.hpp"
 #include "constitutive/fluid/multifluid/MultiFluidUtils.hpp"
@@ -53,7 +54,46 @@ public:
                                     integer const vapourIndex,
                                     EquationOfStateType const liquidEos,
                                     EquationOfStateType const vapourEos,
-                                    arrayView1d< real64 const > const componentCriticalVolume );
+                                    arrayView1d< real64 const > const componentCriticalVolume,
+                                    StabilityTestParameters const & stabilityParameters );
+
+  /**
+   * @brief Offsets into the per-cell cache of the stability test result
+   * @details The cache stores the tangent plane distance computed by the last stability test,
+   *          followed by the pressure, temperature and composition at which the test was performed.
+   */
+  struct StabilityCache
+  {
+    static constexpr integer TANGENT_PLANE_DISTANCE = 0;
+    static constexpr integer PRESSURE = 1;
+    static constexpr integer TEMPERATURE = 2;
+    static constexpr integer COMPOSITION = 3;
+  };
+
+  /**
+   * @brief Get the size of the per-cell stability test cache
+   * @param numComponents the number of components
+   * @return the number of cached values per cell
+   */
+  GEOS_HOST_DEVICE
+  static constexpr integer getStabilityCacheSize( integer const numComponents )
+  {
+    return StabilityCache::COMPOSITION + numComponents;
+  }
+
+  /**
+   * @brief Offsets into the per-cell iteration statistics of the flash calculations
+   * @details The statistics are accumulated over the flash calculations of a fluid update
+   *          and must be zeroed by the caller before the update.
+   */
+  struct FlashStatistics
+  {
+    static constexpr integer NUM_FLASHES = 0;
+    static constexpr integer NUM_SSI_ITERATIONS = 1;
+    static constexpr integer NUM_NEWTON_ITERATIONS = 2;
+    static constexpr integer NUM_RESTARTS = 3;
+    static constexpr integer SIZE = 4;
+  };
 
   // Mark as a 2-phase flash
   GEOS_HOST_DEVICE
@@ -68,26 +108,76 @@ public:
                 arraySlice2d< real64, USD2 > const & kValues,
                 PhaseProp::SliceType const phaseFraction,
                 PhaseComp::SliceType const phaseCompFraction ) const
+  {
+    // Without a persistent cache the stability test is always performed
+    stackArray1d< real64, getStabilityCacheSize( MultiFluidConstants::MAX_NUM_COMPONENTS ) >
+    stabilityCache( getStabilityCacheSize( m_numComponents ) );
+    LvArray::forValuesInSlice( stabilityCache.toSlice(), setZero );
+    stackArray1d< integer, FlashStatistics::SIZE > flashStatistics( FlashStatistics::SIZE );
+    compute( componentProperties,
+             pressure,
+             temperature,
+             compFraction,
+             kValues,
+             stabilityCache.toSlice(),
+             flashStatistics.toSlice(),
+             phaseFraction,
+             phaseCompFraction );
+  }
+
+  template< int USD1, int USD2, int USD3, int USD4 >
+  GEOS_HOST_DEVICE
+  void compute( ComponentProperties::KernelWrapper const & componentProperties,
+                real64 const & pressure,
+                real64 const & temperature,
+                arraySlice1d< real64 const, USD1 > const & compFraction,
+                arraySlice2d< real64, USD2 > const & kValues,
+                arraySlice1d< real64, USD3 > const & stabilityCache,
+                arraySlice1d< integer, USD4 > const & flashStatistics,
+                PhaseProp::SliceType const phaseFraction,
+                PhaseComp::SliceType const phaseCompFraction ) const
   {
     integer const numDofs = 2 + m_numComponents;
 
-    // Perform stability test to check that we have 2 phases
     real64 tangentPlaneDistance = 0.0;
-    bool const stabilityStatus = StabilityTest::compute( m_numComponents,
-                                                         pressure,
-                                                         temperature,
-                                                         compFraction,
-                                                         componentProperties,
-                                                         m_liquidEos,
-                                                         tangentPlaneDistance,
-                                                         kValues[0] );
-    GEOS_ERROR_IF( !stabilityStatus,
-                   GEOS_FMT( "Stability test failed at pressure {:.5e} and temperature {:.3f}", pressure, temperature ));
+    if( !canSkipStabilityTest( pressure, temperature, compFraction, stabilityCache ) )
+    {
+      // Perform stability test to check that we have 2 phases
+      // The k-values estimated by the stability test are discarded so that the flash
+      // can be warm-started from the k-values stored from the previous call
+      stackArray1d< real64, MultiFluidConstants::MAX_NUM_COMPONENTS > stabilityKValues( m_numComponents );
+      bool const stabilityStatus = StabilityTest::compute( m_numComponents,
+                                                           pressure,
+                                                           temperature,
+                                                           compFraction,
+                                                           componentProperties,
+                                                           m_liquidEos,
+                                                           tangentPlaneDistance,
+                                                           stabilityKValues.toSlice() );
+      GEOS_ERROR_IF( !stabilityStatus,
+                     GEOS_FMT( "Stability test failed at pressure {:.5e} and temperature {:.3f}", pressure, temperature ));
+
+      if( m_skipStabilityTest )
+      {
+        stabilityCache[StabilityCache::TANGENT_PLANE_DISTANCE] = tangentPlaneDistance;
+        stabilityCache[StabilityCache::PRESSURE] = pressure;
+        stabilityCache[StabilityCache::TEMPERATURE] = temperature;
+        for( integer ic = 0; ic < m_numComponents; ++ic )
+        {
+          stabilityCache[StabilityCache::COMPOSITION + ic] = compFraction[ic];
+        }
+      }
+    }
+    else
+    {
+      tangentPlaneDistance = stabilityCache[StabilityCache::TANGENT_PLANE_DISTANCE];
+    }
 
     if( tangentPlaneDistance < -stabilityTolerance )
     {
       // Unstable mixture
       // Iterative solve to converge flash
+      NegativeTwoPhaseFlash::Statistics statistics;
       bool const flashStatus = NegativeTwoPhaseFlash::compute( m_numComponents,
                                                                pressure,
                                                                temperature,
@@ -98,7 +188,13 @@ public:
                                                                kValues,
                                                                phaseFraction.value[m_vapourIndex],
                                                                phaseCompFraction.value[m_liquidIndex],
-                                                               phaseCompFraction.value[m_vapourIndex] );
+                                                               phaseCompFraction.value[m_vapourIndex],
+                                                               statistics );
+
+      flashStatistics[FlashStatistics::NUM_FLASHES] += 1;
+      flashStatistics[FlashStatistics::NUM_SSI_ITERATIONS] += statistics.numSSIIterations;
+      flashStatistics[FlashStatistics::NUM_NEWTON_ITERATIONS] += statistics.numNewtonIterations;
+      flashStatistics[FlashStatistics::NUM_RESTARTS] += statistics.numRestarts;
 
       GEOS_ERROR_IF( !flashStatus,
                      GEOS_FMT( "Negative two phase flash failed to converge at pressure {:.5e} and temperature {:.3f}",
@@ -174,6 +270,43 @@ public:
     }
   }
 
+private:
+  /**
+   * @brief Check whether the result of the last stability test can be reused
+   * @details The test is skipped only if the mixture was found stable with a tangent plane distance
+   *          large enough to be far from the phase boundary and if the state has not moved significantly
+   *          since. A zero-initialized cache never allows skipping.
+   */
+  template< int USD1, int USD2 >
+  GEOS_HOST_DEVICE
+  bool canSkipStabilityTest( real64 const & pressure,
+                             real64 const & temperature,
+                             arraySlice1d< real64 const, USD1 > const & compFraction,
+                             arraySlice1d< real64, USD2 > const & stabilityCache ) const
+  {
+    if( !m_skipStabilityTest || stabilityCache[StabilityCache::TANGENT_PLANE_DISTANCE] < m_minTangentPlaneDistance )
+    {
+      return false;
+    }
+    real64 const cachedPressure = stabilityCache[StabilityCache::PRESSURE];
+    if( m_pressureTolerance * LvArray::math::abs( cachedPressure ) < LvArray::math::abs( pressure - cachedPressure ) )
+    {
+      return false;
+    }
+    if( m_temperatureTolerance < LvArray::math::abs( temperature - stabilityCache[StabilityCache::TEMPERATURE] ) )
+    {
+      return false;
+    }
+    for( integer ic = 0; ic < m_numComponents; ++ic )
+    {
+      if( m_compositionTolerance < LvArray::math::abs( compFraction[ic] - stabilityCache[StabilityCache::COMPOSITION + ic] ) )
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
 private:
   integer const m_numComponents;
   integer const m_liquidIndex;
@@ -181,6 +314,11 @@ private:
   EquationOfStateType const m_liquidEos;
   EquationOfStateType const m_vapourEos;
   arrayView1d< real64 const > const m_componentCriticalVolume;
+  integer const m_skipStabilityTest;
+  real64 const m_minTangentPlaneDistance;
+  real64 const m_pressureTolerance;
+  real64 const m_temperatureTolerance;
+  real64 const m_compositionTolerance;
 };
 
 class NegativeTwoPhaseFlashModel : public FunctionBase
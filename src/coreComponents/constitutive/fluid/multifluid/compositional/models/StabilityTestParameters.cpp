@@ -0,0 +1,96 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file StabilityTestParameters.cpp
+ */
+
+#include "StabilityTestParameters.hpp"
+
+#include "constitutive/fluid/multifluid/MultiFluidBase.hpp"
+
+namespace geos
+{
+
+namespace constitutive
+{
+
+namespace compositional
+{
+
+StabilityTestParameters::StabilityTestParameters( std::unique_ptr< ModelParameters > parameters ):
+  ModelParameters( std::move( parameters ) )
+{}
+
+std::unique_ptr< ModelParameters > StabilityTestParameters::create( std::unique_ptr< ModelParameters > parameters )
+{
+  if( parameters && parameters->get< StabilityTestParameters >() != nullptr )
+  {
+    return parameters;
+  }
+  return std::make_unique< StabilityTestParameters >( std::move( parameters ) );
+}
+
+void StabilityTestParameters::registerParametersImpl( MultiFluidBase * fluid )
+{
+  fluid->registerWrapper( viewKeyStruct::skipStabilityTestString(), &m_skipStabilityTest ).
+    setInputFlag( dataRepository::InputFlags::OPTIONAL ).
+    setApplyDefaultValue( m_skipStabilityTest ).
+    setDescription( "Flag to skip the stability test in cells that were found stable far from the phase boundary "
+                    "and whose state did not change significantly since the last stability test" );
+
+  fluid->registerWrapper( viewKeyStruct::stabilitySkipTangentPlaneDistanceString(), &m_minTangentPlaneDistance ).
+    setInputFlag( dataRepository::InputFlags::OPTIONAL ).
+    setApplyDefaultValue( m_minTangentPlaneDistance ).
+    setDescription( "Minimum tangent plane distance of a stable mixture for the stability test to be skipped" );
+
+  fluid->registerWrapper( viewKeyStruct::stabilitySkipPressureToleranceString(), &m_pressureTolerance ).
+    setInputFlag( dataRepository::InputFlags::OPTIONAL ).
+    setApplyDefaultValue( m_pressureTolerance ).
+    setDescription( "Maximum relative pressure change since the last stability test for the test to be skipped" );
+
+  fluid->registerWrapper( viewKeyStruct::stabilitySkipTemperatureToleranceString(), &m_temperatureTolerance ).
+    setInputFlag( dataRepository::InputFlags::OPTIONAL ).
+    setApplyDefaultValue( m_temperatureTolerance ).
+    setDescription( "Maximum temperature change since the last stability test for the test to be skipped" );
+
+  fluid->registerWrapper( viewKeyStruct::stabilitySkipCompositionToleranceString(), &m_compositionTolerance ).
+    setInputFlag( dataRepository::InputFlags::OPTIONAL ).
+    setApplyDefaultValue( m_compositionTolerance ).
+    setDescription( "Maximum change of any component fraction since the last stability test for the test to be skipped" );
+}
+
+void StabilityTestParameters::postInputInitializationImpl( MultiFluidBase const * fluid,
+                                                           ComponentProperties const & componentProperties )
+{
+  GEOS_UNUSED_VAR( componentProperties );
+
+  auto const checkPositive = [&]( real64 const value, string const & attribute )
+  {
+    GEOS_THROW_IF_LT_MSG( value, 0.0,
+                          GEOS_FMT( "{}: invalid value of attribute '{}'", fluid->getFullName(), attribute ),
+                          InputError );
+  };
+  checkPositive( m_minTangentPlaneDistance, viewKeyStruct::stabilitySkipTangentPlaneDistanceString() );
+  checkPositive( m_pressureTolerance, viewKeyStruct::stabilitySkipPressureToleranceString() );
+  checkPositive( m_temperatureTolerance, viewKeyStruct::stabilitySkipTemperatureToleranceString() );
+  checkPositive( m_compositionTolerance, viewKeyStruct::stabilitySkipCompositionToleranceString() );
+}
+
+} // end namespace compositional
+
+} // end namespace constitutive
+
+} // end namespace geos
@@ -0,0 +1,86 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file StabilityTestParameters.hpp
+ */
+
+#ifndef GEOS_CONSTITUTIVE_FLUID_MULTIFLUID_COMPOSITIONAL_MODELS_STABILITYTESTPARAMETERS_HPP_
+#define GEOS_CONSTITUTIVE_FLUID_MULTIFLUID_COMPOSITIONAL_MODELS_STABILITYTESTPARAMETERS_HPP_
+
+#include "ModelParameters.hpp"
+#include "common/DataTypes.hpp"
+
+namespace geos
+{
+
+namespace constitutive
+{
+
+namespace compositional
+{
+
+/**
+ * @brief Parameters controlling when the phase stability test can be skipped.
+ * @details A cell found stable with a tangent plane distance above a threshold (i.e. far from the
+ *          phase boundary) is labelled single-phase without running the stability test again, as long
+ *          as its pressure, temperature and composition stay within the given tolerances of the values
+ *          at which the stability test was last performed (shadow region method).
+ */
+class StabilityTestParameters : public ModelParameters
+{
+public:
+  StabilityTestParameters( std::unique_ptr< ModelParameters > parameters );
+  ~StabilityTestParameters() override = default;
+
+  static std::unique_ptr< ModelParameters > create( std::unique_ptr< ModelParameters > parameters );
+
+  /// Flag to enable skipping the stability test
+  integer m_skipStabilityTest{0};
+
+  /// Minimum tangent plane distance of a stable mixture for the stability test to be skipped
+  real64 m_minTangentPlaneDistance{1.0e-2};
+
+  /// Maximum relative pressure change since the last stability test
+  real64 m_pressureTolerance{1.0e-3};
+
+  /// Maximum temperature change since the last stability test
+  real64 m_temperatureTolerance{1.0e-1};
+
+  /// Maximum change of any component fraction since the last stability test
+  real64 m_compositionTolerance{1.0e-3};
+
+protected:
+  void registerParametersImpl( MultiFluidBase * fluid ) override;
+
+  void postInputInitializationImpl( MultiFluidBase const * fluid, ComponentProperties const & componentProperties ) override;
+
+  struct viewKeyStruct
+  {
+    static constexpr char const * skipStabilityTestString() { return "skipStabilityTest"; }
+    static constexpr char const * stabilitySkipTangentPlaneDistanceString() { return "stabilitySkipTangentPlaneDistance"; }
+    static constexpr char const * stabilitySkipPressureToleranceString() { return "stabilitySkipPressureTolerance"; }
+    static constexpr char const * stabilitySkipTemperatureToleranceString() { return "stabilitySkipTemperatureTolerance"; }
+    static constexpr char const * stabilitySkipCompositionToleranceString() { return "stabilitySkipCompositionTolerance"; }
+  };
+};
+
+} // end namespace compositional
+
+} // end namespace constitutive
+
+} // end namespace geos
+
+#endif //GEOS_CONSTITUTIVE_FLUID_MULTIFLUID_COMPOSITIONAL_MODELS_STABILITYTESTPARAMETERS_HPP_
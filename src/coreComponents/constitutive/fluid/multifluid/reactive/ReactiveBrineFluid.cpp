@@ -207,8 +207,9 @@ void ReactiveBrineFluid< PHASE > ::createPVTModels()
   };
 
   // then, we are ready to instantiate the phase models
+  // the property tables of the reactive brine models are not cached
   m_phase = std::make_unique< PHASE >( getName() + "_phaseModel1", phase1InputParams, m_componentNames, m_componentMolarWeight,
-                                       pvtOutputOpts );
+                                       pvtOutputOpts, string() );
 }
 
 template< typename PHASE >
@@ -36,6 +36,7 @@ TableRelativePermeabilityHelpers::validateRelativePermeabilityTable( TableFuncti
 {
   ArrayOfArraysView< real64 const > coords = relPermTable.getCoordinates();
 
+  relPermTable.checkValuesAccessible( fullConstitutiveName );
   GEOS_THROW_IF_NE_MSG( relPermTable.getInterpolationMethod(), TableFunction::InterpolationType::Linear,
                         GEOS_FMT( "{}: TableFunction '{}' interpolation method must be linear",
                                   fullConstitutiveName, relPermTable.getDataContext() ),
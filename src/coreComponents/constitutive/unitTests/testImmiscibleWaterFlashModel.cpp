@@ -18,6 +18,7 @@
 #include "constitutive/fluid/multifluid/MultiFluidUtils.hpp"
 #include "constitutive/fluid/multifluid/compositional/models/EquationOfState.hpp"
 #include "constitutive/fluid/multifluid/compositional/models/ImmiscibleWaterFlashModel.hpp"
+#include "constitutive/fluid/multifluid/compositional/models/ImmiscibleWaterParameters.hpp"
 #include "TestFluid.hpp"
 #include "TestFluidUtilities.hpp"
 
@@ -278,6 +279,75 @@ public:
     }
   }
 
+  void testFlashStabilitySkipping( FlashData< NC > const & data )
+  {
+    real64 const pressure = std::get< 0 >( data );
+    real64 const temperature = std::get< 1 >( data );
+    stackArray1d< real64, numComps > composition;
+    TestFluid< NC >::createArray( composition, std::get< 2 >( data ));
+
+    using StabilityCache = NegativeTwoPhaseFlashModelUpdate::StabilityCache;
+    integer constexpr cacheSize = ImmiscibleWaterFlashModelUpdate::getStabilityCacheSize( numComps );
+
+    auto * stabilityParameters = const_cast< StabilityTestParameters * >(m_parameters->get< StabilityTestParameters >());
+    stabilityParameters->m_skipStabilityTest = 1;
+
+    auto componentProperties = m_fluid->createKernelWrapper();
+    auto flashKernelWrapper = m_flash->createKernelWrapper();
+
+    stackArray1d< real64, cacheSize > stabilityCache( cacheSize );
+    LvArray::forValuesInSlice( stabilityCache.toSlice(), []( real64 & v ){ v = 0.0; } );
+
+    using FlashStatistics = ImmiscibleWaterFlashModelUpdate::FlashStatistics;
+    stackArray1d< integer, FlashStatistics::SIZE > flashStatistics( FlashStatistics::SIZE );
+    LvArray::forValuesInSlice( flashStatistics.toSlice(), []( integer & v ){ v = 0; } );
+
+    StackArray< real64, 3, 2*numPhases, multifluid::LAYOUT_PHASE > phaseFractionData( 2, 1, numPhases );
+    StackArray< real64, 4, 2*numPhases *numDofs, multifluid::LAYOUT_PHASE_DC > dPhaseFractionData( 2, 1, numPhases, numDofs );
+    StackArray< real64, 4, 2*numPhases *numComps, multifluid::LAYOUT_PHASE_COMP > phaseComponentFractionData( 2, 1, numPhases, numComps );
+    StackArray< real64, 5, 2*numPhases *numComps *numDofs, multifluid::LAYOUT_PHASE_COMP_DC > dPhaseComponentFractionData( 2, 1, numPhases, numComps, numDofs );
+
+    // First call always performs the stability test and fills the cache, second call may reuse it
+    for( integer iter = 0; iter < 2; ++iter )
+    {
+      stackArray2d< real64, (numPhases-1)*numComps > kValues( numPhases-1, numComps );
+      LvArray::forValuesInSlice( kValues.toSlice(), []( real64 & v ){ v = 0.0; } );
+
+      flashKernelWrapper.compute( componentProperties,
+                                  pressure,
+                                  temperature,
+                                  composition.toSliceConst(),
+                                  kValues.toSlice(),
+                                  stabilityCache.toSlice(),
+                                  flashStatistics.toSlice(),
+                                  PhasePropSlice( phaseFractionData[iter][0], dPhaseFractionData[iter][0] ),
+                                  PhaseCompSlice( phaseComponentFractionData[iter][0], dPhaseComponentFractionData[iter][0] ) );
+    }
+
+    // Every iterative flash is counted, and takes at least one iteration
+    integer const numFlashes = flashStatistics[FlashStatistics::NUM_FLASHES];
+    EXPECT_LE( numFlashes, 2 );
+    EXPECT_GE( flashStatistics[FlashStatistics::NUM_SSI_ITERATIONS] + flashStatistics[FlashStatistics::NUM_NEWTON_ITERATIONS], numFlashes );
+
+    // The stability test is only performed if hydrocarbons are present
+    integer const waterIndex = ImmiscibleWaterParameters::getWaterComponentIndex( m_fluid->getComponentProperties() );
+    if( MultiFluidConstants::minForSpeciesPresence < 1.0 - composition[waterIndex] )
+    {
+      checkRelativeError( stabilityCache[StabilityCache::PRESSURE], pressure, relTol, absTol );
+      checkRelativeError( stabilityCache[StabilityCache::TEMPERATURE], temperature, relTol, absTol );
+    }
+
+    // Results with and without the cached stability test must agree
+    for( integer ip = 0; ip < numPhases; ip++ )
+    {
+      checkRelativeError( phaseFractionData[1][0][ip], phaseFractionData[0][0][ip], relTol, absTol );
+      for( integer ic = 0; ic < numComps; ++ic )
+      {
+        checkRelativeError( phaseComponentFractionData[1][0][ip][ic], phaseComponentFractionData[0][0][ip][ic], relTol, absTol );
+      }
+    }
+  }
+
 protected:
   std::unique_ptr< TestFluid< NC > > m_fluid{};
   std::unique_ptr< ImmiscibleWaterFlashModel > m_flash{};
@@ -295,6 +365,10 @@ TEST_P( ImmiscibleWaterFlashModel3, testFlashDerivatives )
 {
   testFlashDerivatives( GetParam() );
 }
+TEST_P( ImmiscibleWaterFlashModel3, testFlashStabilitySkipping )
+{
+  testFlashStabilitySkipping( GetParam() );
+}
 
 TEST_P( ImmiscibleWaterFlashModel9, testFlash )
 {
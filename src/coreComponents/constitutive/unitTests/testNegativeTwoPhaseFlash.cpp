@@ -267,6 +267,92 @@ public:
     }
   }
 
+  void testFlashWarmStart( FlashData< NC > const & data )
+  {
+    auto componentProperties = this->m_fluid->createKernelWrapper();
+
+    bool const expectedStatus = std::get< 3 >( data );
+    if( !expectedStatus ) return;
+
+    real64 const pressure = std::get< 0 >( data );
+    real64 const temperature = std::get< 1 >( data );
+    stackArray1d< real64, numComps > composition;
+    TestFluid< NC >::createArray( composition, std::get< 2 >( data ));
+
+    real64 vapourFraction = -1.0;
+    stackArray1d< real64, numComps > liquidComposition( numComps );
+    stackArray1d< real64, numComps > vapourComposition( numComps );
+    stackArray2d< real64, numComps > kValues( 1, numComps );
+    kValues.zero();
+
+    auto const flash = [&]( real64 const p, NegativeTwoPhaseFlash::Statistics & statistics )
+    {
+      return NegativeTwoPhaseFlash::compute(
+        numComps,
+        p,
+        temperature,
+        composition.toSliceConst(),
+        componentProperties,
+        EOS_TYPE,
+        EOS_TYPE,
+        kValues.toSlice(),
+        vapourFraction,
+        liquidComposition.toSlice(),
+        vapourComposition.toSlice(),
+        statistics );
+    };
+
+    // Cold start
+    NegativeTwoPhaseFlash::Statistics coldStatistics;
+    ASSERT_TRUE( flash( pressure, coldStatistics ) );
+    EXPECT_FALSE( coldStatistics.warmStarted );
+
+    // Only meaningful if the flash produced non-trivial k-values
+    real64 maxLogK = 0.0;
+    for( integer ic = 0; ic < numComps; ++ic )
+    {
+      maxLogK = LvArray::math::max( maxLogK, LvArray::math::abs( LvArray::math::log( kValues( 0, ic ) ) ) );
+    }
+    if( maxLogK < 1.0e-2 ) return;
+
+    real64 const coldVapourFraction = vapourFraction;
+    stackArray1d< real64, numComps > coldLiquidComposition( liquidComposition );
+    stackArray1d< real64, numComps > coldVapourComposition( vapourComposition );
+
+    // Warm start from the converged k-values: no iteration is needed
+    NegativeTwoPhaseFlash::Statistics warmStatistics;
+    ASSERT_TRUE( flash( pressure, warmStatistics ) );
+    EXPECT_TRUE( warmStatistics.warmStarted );
+    EXPECT_EQ( warmStatistics.numRestarts, 0 );
+    EXPECT_EQ( warmStatistics.numSSIIterations + warmStatistics.numNewtonIterations, 0 );
+
+    checkRelativeError( coldVapourFraction, vapourFraction, relTol, absTol );
+    for( integer ic = 0; ic < numComps; ++ic )
+    {
+      checkRelativeError( coldLiquidComposition[ic], liquidComposition[ic], relTol, absTol );
+      checkRelativeError( coldVapourComposition[ic], vapourComposition[ic], relTol, absTol );
+    }
+
+    // Warm start at a slightly different pressure must give the same answer as a cold start
+    real64 const perturbedPressure = 1.001 * pressure;
+    NegativeTwoPhaseFlash::Statistics perturbedStatistics;
+    ASSERT_TRUE( flash( perturbedPressure, perturbedStatistics ) );
+    EXPECT_TRUE( perturbedStatistics.warmStarted );
+
+    real64 const warmVapourFraction = vapourFraction;
+    stackArray1d< real64, numComps > warmLiquidComposition( liquidComposition );
+    stackArray1d< real64, numComps > warmVapourComposition( vapourComposition );
+
+    kValues.zero();
+    ASSERT_TRUE( flash( perturbedPressure, coldStatistics ) );
+    checkRelativeError( vapourFraction, warmVapourFraction, relTol, absTol );
+    for( integer ic = 0; ic < numComps; ++ic )
+    {
+      checkRelativeError( liquidComposition[ic], warmLiquidComposition[ic], relTol, absTol );
+      checkRelativeError( vapourComposition[ic], warmVapourComposition[ic], relTol, absTol );
+    }
+  }
+
 protected:
   std::unique_ptr< TestFluid< NC > > m_fluid{};
 };
@@ -316,6 +402,16 @@ TEST_P( NegativeTwoPhaseFlash4CompSRK, testNegativeFlashDerivatives )
   testFlashDerivatives( GetParam() );
 }
 
+TEST_P( NegativeTwoPhaseFlash2CompPR, testNegativeFlashWarmStart )
+{
+  testFlashWarmStart( GetParam() );
+}
+
+TEST_P( NegativeTwoPhaseFlash4CompSRK, testNegativeFlashWarmStart )
+{
+  testFlashWarmStart( GetParam() );
+}
+
 //-------------------------------------------------------------------------------
 // Data generated by PVTPackage
 //-------------------------------------------------------------------------------
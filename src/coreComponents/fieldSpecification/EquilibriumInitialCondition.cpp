@@ -170,6 +170,7 @@ void EquilibriumInitialCondition::initializePreSubGroups()
     for( localIndex ic = 0; ic < m_componentNames.size(); ++ic )
     {
       TableFunction const & compFracTable = functionManager.getGroup< TableFunction >( m_componentFractionVsElevationTableNames[ic] );
+      compFracTable.checkValuesAccessible( GEOS_FMT( "{} {}", getCatalogName(), getDataContext() ) );
       arrayView1d< real64 const > compFracValues = compFracTable.getValues();
       GEOS_THROW_IF( compFracValues.size() <= 1,
                      getCatalogName() << " " << getDataContext() <<
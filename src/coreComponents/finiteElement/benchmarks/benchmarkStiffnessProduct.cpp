@@ -0,0 +1,139 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file benchmarkStiffnessProduct.cpp
+ *
+ * Compares the element stiffness product of the Gauss-Lobatto hexahedra computed by accumulating
+ * the entries returned by computeStiffnessTerm with the sum-factorized computeStiffnessProduct,
+ * for orders 1 to 5.
+ */
+
+#include "finiteElement/elementFormulations/Qk_Hexahedron_Lagrange_GaussLobatto.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+namespace geos
+{
+namespace finiteElement
+{
+namespace benchmarking
+{
+
+/// Number of elements processed per benchmark iteration
+constexpr localIndex numElems = 1024;
+
+/**
+ * @brief Element-local data of the benchmarks.
+ * @tparam FE_TYPE the finite element type
+ */
+template< typename FE_TYPE >
+struct Element
+{
+  /// Coordinates of the element corners
+  real64 X[8][3];
+  /// Nodal values
+  real64 u[FE_TYPE::numNodes];
+  /// Product of the stiffness matrix with the nodal values
+  real64 Ru[FE_TYPE::numNodes];
+};
+
+template< typename FE_TYPE >
+std::vector< Element< FE_TYPE > > createElements()
+{
+  std::vector< Element< FE_TYPE > > elements( numElems );
+  for( localIndex k = 0; k < numElems; ++k )
+  {
+    // slightly distorted unit cubes
+    for( int a = 0; a < 8; ++a )
+    {
+      for( int i = 0; i < 3; ++i )
+      {
+        elements[k].X[a][i] = ( ( a >> i ) & 1 ) + 0.05 * std::sin( 1.0 + k + 3 * a + i );
+      }
+    }
+    for( int a = 0; a < FE_TYPE::numNodes; ++a )
+    {
+      elements[k].u[a] = std::cos( 0.3 * a + k );
+    }
+  }
+  return elements;
+}
+
+template< typename FE_TYPE >
+void stiffnessTermCallback( benchmark::State & state )
+{
+  std::vector< Element< FE_TYPE > > elements = createElements< FE_TYPE >();
+  for( auto _ : state )
+  {
+    for( Element< FE_TYPE > & elem : elements )
+    {
+      for( int a = 0; a < FE_TYPE::numNodes; ++a )
+      {
+        elem.Ru[a] = 0.0;
+      }
+      for( int q = 0; q < FE_TYPE::numQuadraturePoints; ++q )
+      {
+        FE_TYPE::computeStiffnessTerm( q, elem.X, [&] ( int const i, int const j, real64 const val )
+        {
+          elem.Ru[i] += val * elem.u[j];
+        } );
+      }
+    }
+    benchmark::DoNotOptimize( elements.data() );
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed( state.iterations() * numElems );
+}
+
+template< typename FE_TYPE >
+void stiffnessProductSumFactorized( benchmark::State & state )
+{
+  std::vector< Element< FE_TYPE > > elements = createElements< FE_TYPE >();
+  for( auto _ : state )
+  {
+    for( Element< FE_TYPE > & elem : elements )
+    {
+      for( int a = 0; a < FE_TYPE::numNodes; ++a )
+      {
+        elem.Ru[a] = 0.0;
+      }
+      FE_TYPE::computeStiffnessProduct( elem.X, elem.u, elem.Ru );
+    }
+    benchmark::DoNotOptimize( elements.data() );
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed( state.iterations() * numElems );
+}
+
+BENCHMARK_TEMPLATE( stiffnessTermCallback, Q1_Hexahedron_Lagrange_GaussLobatto );
+BENCHMARK_TEMPLATE( stiffnessProductSumFactorized, Q1_Hexahedron_Lagrange_GaussLobatto );
+BENCHMARK_TEMPLATE( stiffnessTermCallback, Q2_Hexahedron_Lagrange_GaussLobatto );
+BENCHMARK_TEMPLATE( stiffnessProductSumFactorized, Q2_Hexahedron_Lagrange_GaussLobatto );
+BENCHMARK_TEMPLATE( stiffnessTermCallback, Q3_Hexahedron_Lagrange_GaussLobatto );
+BENCHMARK_TEMPLATE( stiffnessProductSumFactorized, Q3_Hexahedron_Lagrange_GaussLobatto );
+BENCHMARK_TEMPLATE( stiffnessTermCallback, Q4_Hexahedron_Lagrange_GaussLobatto );
+BENCHMARK_TEMPLATE( stiffnessProductSumFactorized, Q4_Hexahedron_Lagrange_GaussLobatto );
+BENCHMARK_TEMPLATE( stiffnessTermCallback, Q5_Hexahedron_Lagrange_GaussLobatto );
+BENCHMARK_TEMPLATE( stiffnessProductSumFactorized, Q5_Hexahedron_Lagrange_GaussLobatto );
+
+} // namespace benchmarking
+} // namespace finiteElement
+} // namespace geos
+
+BENCHMARK_MAIN();
@@ -640,6 +640,26 @@ public:
                                     real64 const (&X)[8][3],
                                     FUNC && func );
 
+  /**
+   * @brief computes the product of the stiffness matrix R (see computeStiffnessTerm) with a vector
+   *   of nodal values, using sum factorization.
+   * @details The parent gradients of the field at the quadrature points are obtained by
+   *   one-dimensional contractions (the shape functions are collocated with the quadrature points),
+   *   scaled by the matrix B and the quadrature weight, and contracted back with the 1D basis gradients.
+   *   The cost is O(p^4) per element, instead of O(p^5) when accumulating the non-zero entries
+   *   returned by computeStiffnessTerm. All loop bounds are compile-time constants of the basis.
+   * @tparam T the scalar type of the nodal values
+   * @param X Array containing the coordinates of the support points.
+   * @param u The nodal values
+   * @param Ru The array to which the product R*u is added
+   */
+  template< typename T >
+  GEOS_HOST_DEVICE
+  GEOS_FORCE_INLINE
+  static void computeStiffnessProduct( real64 const (&X)[8][3],
+                                       T const (&u)[numNodes],
+                                       T ( &Ru )[numNodes] );
+
   /**
    * @brief computes the matrix B in the case of quasi-stiffness (e.g. for pseudo-acoustic case), defined as J^{-T}A_xy J^{-1}/det(J), where
    * J is the Jacobian matrix, and A_xy is a zero matrix except on A_xy(1,1) = 1 and A_xy(2,2) = 1.
@@ -1417,6 +1437,75 @@ computeStiffnessTerm( localIndex const q,
   computeGradPhiBGradPhi( qa, qb, qc, B, func );
 }
 
+template< typename GL_BASIS >
+template< typename T >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+void
+Qk_Hexahedron_Lagrange_GaussLobatto< GL_BASIS >::
+computeStiffnessProduct( real64 const (&X)[8][3],
+                         T const (&u)[numNodes],
+                         T (& Ru)[numNodes] )
+{
+  // 1D derivative matrix, D[q][i] is the derivative of the i-th basis function at the q-th point
+  real64 D[num1dNodes][num1dNodes];
+  for( int q = 0; q < num1dNodes; ++q )
+  {
+    for( int i = 0; i < num1dNodes; ++i )
+    {
+      D[q][i] = basisGradientAt( i, q );
+    }
+  }
+
+  // weighted fluxes w * B * grad(u) at the quadrature points, in parent coordinates
+  real64 flux[3][numNodes];
+  for( int qc = 0; qc < num1dNodes; ++qc )
+  {
+    for( int qb = 0; qb < num1dNodes; ++qb )
+    {
+      for( int qa = 0; qa < num1dNodes; ++qa )
+      {
+        real64 gradU[3] = { 0.0, 0.0, 0.0 };
+        for( int i = 0; i < num1dNodes; ++i )
+        {
+          gradU[0] += D[qa][i] * u[ GL_BASIS::TensorProduct3D::linearIndex( i, qb, qc ) ];
+          gradU[1] += D[qb][i] * u[ GL_BASIS::TensorProduct3D::linearIndex( qa, i, qc ) ];
+          gradU[2] += D[qc][i] * u[ GL_BASIS::TensorProduct3D::linearIndex( qa, qb, i ) ];
+        }
+
+        real64 B[6] = {0};
+        real64 J[3][3] = {{0}};
+        computeBMatrix( qa, qb, qc, X, J, B );
+        real64 const w = GL_BASIS::weight( qa )*GL_BASIS::weight( qb )*GL_BASIS::weight( qc );
+
+        int const q = GL_BASIS::TensorProduct3D::linearIndex( qa, qb, qc );
+        flux[0][q] = w * ( B[0]*gradU[0] + B[5]*gradU[1] + B[4]*gradU[2] );
+        flux[1][q] = w * ( B[5]*gradU[0] + B[1]*gradU[1] + B[3]*gradU[2] );
+        flux[2][q] = w * ( B[4]*gradU[0] + B[3]*gradU[1] + B[2]*gradU[2] );
+      }
+    }
+  }
+
+  // contraction of the fluxes with the gradients of the test functions
+  for( int c = 0; c < num1dNodes; ++c )
+  {
+    for( int b = 0; b < num1dNodes; ++b )
+    {
+      for( int a = 0; a < num1dNodes; ++a )
+      {
+        real64 val = 0.0;
+        for( int q = 0; q < num1dNodes; ++q )
+        {
+          val += D[q][a] * flux[0][ GL_BASIS::TensorProduct3D::linearIndex( q, b, c ) ]
+                 + D[q][b] * flux[1][ GL_BASIS::TensorProduct3D::linearIndex( a, q, c ) ]
+                 + D[q][c] * flux[2][ GL_BASIS::TensorProduct3D::linearIndex( a, b, q ) ];
+        }
+        Ru[ GL_BASIS::TensorProduct3D::linearIndex( a, b, c ) ] += val;
+      }
+    }
+  }
+}
+
 template< typename GL_BASIS >
 template< typename FUNC >
 GEOS_HOST_DEVICE
@@ -14,6 +14,7 @@
  */
 
 #include "KernelBase.hpp"
+#include "common/AssemblyMap.hpp"
 
 /**
  * @file ImplicitKernelBase.hpp
@@ -208,6 +209,15 @@ public:
   }
 
 
+  /**
+   * @brief Set the assembly map used to add the element contributions to the Jacobian.
+   * @param assemblyMap the view of the map, whose items are the elements of the subregion
+   */
+  void setAssemblyMap( AssemblyMap::View const & assemblyMap )
+  {
+    m_assemblyMap = assemblyMap;
+  }
+
 protected:
   /// The global degree of freedom number
   arrayView1d< globalIndex const > const m_dofNumber;
@@ -227,6 +237,71 @@ protected:
   /// time increment
   real64 const m_dt; ///TODO: Consider moving to finite element kernel base?
 
+  /// Positions of the element contributions in the Jacobian (empty if not used)
+  AssemblyMap::View m_assemblyMap;
+
+};
+
+/**
+ * @class AssemblyMapKernelFactory
+ * @brief Decorator of a kernel factory attaching an assembly map to the kernels it creates.
+ * @tparam KERNEL_FACTORY The type of the decorated factory, typically an instantiation of @c KernelFactory
+ *
+ * One map is kept per element subregion and kernel type, so that the recorded positions are
+ * reused by the next assemblies of the same kernel.
+ */
+template< typename KERNEL_FACTORY >
+class AssemblyMapKernelFactory
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param kernelFactory The decorated factory.
+   * @param assemblyMaps The storage of the assembly maps, indexed by subregion and kernel type.
+   */
+  AssemblyMapKernelFactory( KERNEL_FACTORY & kernelFactory,
+                            std::map< string, AssemblyMap > & assemblyMaps ):
+    m_kernelFactory( kernelFactory ),
+    m_assemblyMaps( assemblyMaps )
+  {}
+
+  /**
+   * @copydoc KernelFactory::createKernel
+   */
+  template< typename SUBREGION_TYPE, typename CONSTITUTIVE_TYPE, typename FE_TYPE >
+  auto createKernel( NodeManager & nodeManager,
+                     EdgeManager const & edgeManager,
+                     FaceManager const & faceManager,
+                     localIndex const targetRegionIndex,
+                     SUBREGION_TYPE const & elementSubRegion,
+                     FE_TYPE const & finiteElementSpace,
+                     CONSTITUTIVE_TYPE & inputConstitutiveType )
+  {
+    auto kernel = m_kernelFactory.createKernel( nodeManager,
+                                                edgeManager,
+                                                faceManager,
+                                                targetRegionIndex,
+                                                elementSubRegion,
+                                                finiteElementSpace,
+                                                inputConstitutiveType );
+
+    using KERNEL_TYPE = decltype( kernel );
+    using STACK_VARIABLES = typename KERNEL_TYPE::StackVariables;
+
+    AssemblyMap & assemblyMap = m_assemblyMaps[ elementSubRegion.getPath() + "/" + LvArray::system::demangleType< KERNEL_TYPE >() ];
+    assemblyMap.setup( elementSubRegion.size(), STACK_VARIABLES::maxNumRows, STACK_VARIABLES::maxNumCols );
+    kernel.setAssemblyMap( assemblyMap.toView() );
+    return kernel;
+  }
+
+private:
+
+  /// The decorated factory
+  KERNEL_FACTORY & m_kernelFactory;
+
+  /// The storage of the assembly maps
+  std::map< string, AssemblyMap > & m_assemblyMaps;
 };
 
 }
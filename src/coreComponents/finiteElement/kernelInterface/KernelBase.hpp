@@ -252,7 +252,85 @@ public:
   }
   //END_kernelLauncher
 
+  /**
+   * @brief Kernel Launcher processing the elements one color at a time.
+   * @tparam POLICY The RAJA policy to use for the launch.
+   * @tparam KERNEL_TYPE The type of Kernel to execute.
+   * @param elementsByColor The elements to process, grouped by color (see
+   *                        ElementSubRegionBase::computeElementColoring()).
+   * @param kernelComponent The instantiation of KERNEL_TYPE to execute.
+   * @return The maximum residual contribution.
+   *
+   * Elements of the same color do not share any node, so that within a color
+   * the nodal scatter performed in complete() through assemblyAdd() is free of
+   * races and is done with plain additions. Colors are processed in sequence.
+   */
+  template< typename POLICY,
+            typename KERNEL_TYPE >
+  static
+  real64
+  kernelLaunchColored( ArrayOfArraysView< localIndex const > const & elementsByColor,
+                       KERNEL_TYPE const & kernelComponent )
+  {
+    GEOS_MARK_FUNCTION;
+
+    KERNEL_TYPE coloredKernel( kernelComponent );
+    coloredKernel.setAtomicFreeAssembly( true );
+
+    real64 maxResidual = 0;
+    for( localIndex color = 0; color < elementsByColor.size(); ++color )
+    {
+      RAJA::ReduceMax< ReducePolicy< POLICY >, real64 > colorMaxResidual( 0 );
+      forAll< POLICY >( elementsByColor.sizeOfArray( color ),
+                        [=] GEOS_HOST_DEVICE ( localIndex const i )
+      {
+        localIndex const k = elementsByColor( color, i );
+        typename KERNEL_TYPE::StackVariables stack;
+
+        coloredKernel.setup( k, stack );
+        for( integer q=0; q<numQuadraturePointsPerElem; ++q )
+        {
+          coloredKernel.quadraturePointKernel( k, q, stack );
+        }
+        colorMaxResidual.max( coloredKernel.complete( k, stack ) );
+      } );
+      maxResidual = LvArray::math::max( maxResidual, colorMaxResidual.get() );
+    }
+    return maxResidual;
+  }
+
+  /**
+   * @brief Select whether complete() may use plain additions for the nodal scatter.
+   * @param atomicFreeAssembly true if no two elements processed concurrently share a node
+   */
+  void setAtomicFreeAssembly( bool const atomicFreeAssembly )
+  { m_atomicFreeAssembly = atomicFreeAssembly; }
+
 protected:
+
+  /**
+   * @brief Add an element contribution to a nodal value.
+   * @tparam T The type of the value.
+   * @param dst The nodal value.
+   * @param value The element contribution.
+   *
+   * The addition is atomic unless the kernel is launched through kernelLaunchColored().
+   */
+  template< typename T >
+  GEOS_HOST_DEVICE
+  GEOS_FORCE_INLINE
+  void assemblyAdd( T & dst, T const value ) const
+  {
+    if( m_atomicFreeAssembly )
+    {
+      dst += value;
+    }
+    else
+    {
+      RAJA::atomicAdd< parallelDeviceAtomic >( &dst, value );
+    }
+  }
+
   /// The element to nodes map.
   traits::ViewTypeConst< typename SUBREGION_TYPE::NodeMapType::base_type > const m_elemsToNodes;
 
@@ -266,6 +344,9 @@ protected:
   /// The finite element space/discretization object for the element type in
   /// the SUBREGION_TYPE.
   FE_TYPE const m_finiteElementSpace;
+
+  /// Flag indicating that the nodal scatter does not need atomic operations.
+  bool m_atomicFreeAssembly = false;
 };
 
 /**
@@ -359,6 +440,8 @@ private:
  * @param finiteElementName The name of the finite element.
  * @param constitutiveStringName The key to the constitutive model name found on the Region.
  * @param kernelFactory The object used to construct the kernel.
+ * @param useElementColoring Flag to launch the kernel through
+ *   #::geos::finiteElement::KernelBase::kernelLaunchColored() on the subregions that hold an element coloring.
  * @return The maximum contribution to the residual, which may be used to scale the residual.
  *
  * @details Loops over all regions Applies/Launches a kernel specified by the @p KERNEL_TEMPLATE through
@@ -373,7 +456,8 @@ real64 regionBasedKernelApplication( MeshLevel & mesh,
                                      arrayView1d< string const > const & targetRegions,
                                      string const & finiteElementName,
                                      string const & constitutiveStringName,
-                                     KERNEL_FACTORY & kernelFactory )
+                                     KERNEL_FACTORY & kernelFactory,
+                                     bool const useElementColoring = false )
 {
   GEOS_MARK_FUNCTION;
   // save the maximum residual contribution for scaling residuals for convergence criteria.
@@ -392,7 +476,8 @@ real64 regionBasedKernelApplication( MeshLevel & mesh,
                                                                 &edgeManager,
                                                                 &faceManager,
                                                                 &kernelFactory,
-                                                                &finiteElementName]
+                                                                &finiteElementName,
+                                                                useElementColoring]
                                                                  ( localIndex const targetRegionIndex, auto & elementSubRegion )
   {
     localIndex const numElems = elementSubRegion.size();
@@ -422,7 +507,8 @@ real64 regionBasedKernelApplication( MeshLevel & mesh,
                                                                        &kernelFactory,
                                                                        &elementSubRegion,
                                                                        &finiteElementName,
-                                                                       numElems]
+                                                                       numElems,
+                                                                       useElementColoring]
                                                                         ( auto & castedConstitutiveRelation )
     {
       FiniteElementBase &
@@ -437,6 +523,7 @@ real64 regionBasedKernelApplication( MeshLevel & mesh,
                                                                                      &kernelFactory,
                                                                                      &elementSubRegion,
                                                                                      numElems,
+                                                                                     useElementColoring,
                                                                                      &castedConstitutiveRelation] ( auto const finiteElement )
       {
         auto kernel = kernelFactory.createKernel( nodeManager,
@@ -450,9 +537,18 @@ real64 regionBasedKernelApplication( MeshLevel & mesh,
         using KERNEL_TYPE = decltype( kernel );
 
         // Call the kernelLaunch function, and store the maximum contribution to the residual.
-        maxResidualContribution =
-          std::max( maxResidualContribution,
-                    KERNEL_TYPE::template kernelLaunch< POLICY, KERNEL_TYPE >( numElems, kernel ) );
+        if( useElementColoring && elementSubRegion.hasElementColoring() )
+        {
+          maxResidualContribution =
+            std::max( maxResidualContribution,
+                      KERNEL_TYPE::template kernelLaunchColored< POLICY, KERNEL_TYPE >( elementSubRegion.getElementsByColor(), kernel ) );
+        }
+        else
+        {
+          maxResidualContribution =
+            std::max( maxResidualContribution,
+                      KERNEL_TYPE::template kernelLaunch< POLICY, KERNEL_TYPE >( numElems, kernel ) );
+        }
       } );
     } );
 
@@ -136,14 +136,15 @@ public:
   /**
    * @brief Kernel Launcher.
    * @tparam POLICY The RAJA policy to use for the launch.
-   * @tparam NUM_QUADRATURE_POINTS The number of quadrature points per element.
    * @tparam KERNEL_TYPE The type of Kernel to execute.
    * @param numElems The number of elements to process in this launch.
    * @param kernelComponent The instantiation of KERNEL_TYPE to execute.
    * @return The maximum residual.
    *
-   * This is a generic launching function for all of the finite element kernels
-   * that follow the interface set by KernelBase.
+   * The pattern is filled in two passes, so that the elements can be processed concurrently:
+   * the rows and columns of each element are gathered first, along with the elements adjacent
+   * to each row, then the rows are filled independently of each other. The row capacities of
+   * the pattern are increased beforehand if they cannot hold the contributions of the elements.
    */
   template< typename POLICY,
             typename KERNEL_TYPE >
@@ -154,17 +155,95 @@ public:
   {
     GEOS_MARK_FUNCTION;
 
-    // launch the kernel
-    forAll< POLICY >( numElems,
-                      [=] ( localIndex const k )
+    using StackVariables = typename KERNEL_TYPE::StackVariables;
+    localIndex constexpr maxNumRows = StackVariables::maxNumRows;
+    localIndex constexpr maxNumCols = StackVariables::maxNumCols;
+
+    SparsityPattern< globalIndex > & sparsity = kernelComponent.m_sparsity;
+    localIndex const numRows = sparsity.numRows();
+    globalIndex const rankOffset = kernelComponent.m_dofRankOffset;
+
+    // Step 1. Gather the local rows and the columns of each element, and count the elements adjacent to each row
+    array2d< localIndex > elemRows( numElems, maxNumRows );
+    array1d< localIndex > elemNumRows( numElems );
+    array2d< globalIndex > elemCols( numElems, maxNumCols );
+    array1d< localIndex > elemNumCols( numElems );
+    array1d< localIndex > rowNumElems( numRows );
+    array1d< localIndex > rowNumNewCols( numRows );
+    forAll< POLICY >( numElems, [&] ( localIndex const k )
     {
-      // allocate the stack variables
-      typename KERNEL_TYPE::StackVariables stack;
-
+      StackVariables stack;
       kernelComponent.setup( k, stack );
 
-      kernelComponent.complete( k, stack );
+      localIndex numLocalRows = 0;
+      for( localIndex r = 0; r < stack.numRows; ++r )
+      {
+        localIndex const row = stack.localRowDofIndex[r] - rankOffset;
+        if( row < 0 || row >= numRows ) continue;
+        elemRows( k, numLocalRows++ ) = row;
+        RAJA::atomicInc< AtomicPolicy< POLICY > >( &rowNumElems[row] );
+        RAJA::atomicAdd( AtomicPolicy< POLICY >{}, &rowNumNewCols[row], stack.numCols );
+      }
+      elemNumRows[k] = numLocalRows;
+
+      for( localIndex c = 0; c < stack.numCols; ++c )
+      {
+        elemCols( k, c ) = stack.localColDofIndex[c];
+      }
+      elemNumCols[k] = stack.numCols;
+    } );
+
+    // Step 2. Make sure that every row can hold its new entries (an upper bound, as elements share columns)
+    array1d< localIndex > rowCapacities( numRows );
+    RAJA::ReduceSum< ReducePolicy< POLICY >, localIndex > numGrownRows( 0 );
+    {
+      arrayView1d< localIndex const > const rowNumNewColsView = rowNumNewCols.toViewConst();
+      arrayView1d< localIndex > const rowCapacitiesView = rowCapacities.toView();
+      SparsityPatternView< globalIndex const > const sparsityView = sparsity.toViewConst();
+      localIndex const numCols = LvArray::integerConversion< localIndex >( sparsity.numColumns() );
+      forAll< POLICY >( numRows, [=] ( localIndex const row )
+      {
+        localIndex const capacity = sparsityView.nonZeroCapacity( row );
+        localIndex const requiredCapacity = LvArray::math::min( sparsityView.numNonZeros( row ) + rowNumNewColsView[row], numCols );
+        rowCapacitiesView[row] = LvArray::math::max( capacity, requiredCapacity );
+        numGrownRows += ( requiredCapacity > capacity ) ? 1 : 0;
+      } );
+    }
+    if( numGrownRows.get() > 0 )
+    {
+      SparsityPattern< globalIndex > grownSparsity;
+      grownSparsity.resizeFromRowCapacities< POLICY >( numRows, sparsity.numColumns(), rowCapacities.data() );
+      SparsityPatternView< globalIndex > const grownSparsityView = grownSparsity.toView();
+      SparsityPatternView< globalIndex const > const sparsityView = sparsity.toViewConst();
+      forAll< POLICY >( numRows, [&] ( localIndex const row )
+      {
+        arraySlice1d< globalIndex const > const cols = sparsityView.getColumns( row );
+        grownSparsityView.insertNonZeros( row, cols.begin(), cols.end() );
+      } );
+      sparsity = std::move( grownSparsity );
+    }
+
+    // Step 3. Invert the element-to-row map
+    ArrayOfArrays< localIndex > rowElems;
+    rowElems.resizeFromCapacities< POLICY >( numRows, rowNumElems.data() );
+    ArrayOfArraysView< localIndex > const rowElemsView = rowElems.toView();
+    forAll< POLICY >( numElems, [&] ( localIndex const k )
+    {
+      for( localIndex r = 0; r < elemNumRows[k]; ++r )
+      {
+        rowElemsView.emplaceBackAtomic< AtomicPolicy< POLICY > >( elemRows( k, r ), k );
+      }
+    } );
 
+    // Step 4. Fill the pattern row by row, so that each row is only written by one thread
+    SparsityPatternView< globalIndex > const sparsityView = sparsity.toView();
+    forAll< POLICY >( numRows, [&] ( localIndex const row )
+    {
+      for( localIndex const k : rowElemsView[row] )
+      {
+        globalIndex const * const cols = &elemCols( k, 0 );
+        sparsityView.insertNonZeros( row, cols, cols + elemNumCols[k] );
+      }
     } );
     return 0;
   }
@@ -294,7 +373,7 @@ real64 fillSparsity( MeshLevel & mesh,
 
   SparsityKernelFactory< KERNEL_TEMPLATE > KernelFactory( inputDofNumber, rankOffset, inputSparsityPattern );
 
-  regionBasedKernelApplication< serialPolicy,
+  regionBasedKernelApplication< parallelHostPolicy,
                                 constitutive::NullModel,
                                 REGION_TYPE >( mesh,
                                                targetRegions,
@@ -279,6 +279,39 @@ TEST( FiniteElementShapeFunctions, testKernelHost )
   testKernelDriver< serialPolicy >();
 }
 
+TEST( FiniteElementShapeFunctions, testStiffnessProduct )
+{
+  using FE_TYPE = Q5_Hexahedron_Lagrange_GaussLobatto;
+  constexpr int numNodes = FE_TYPE::numNodes;
+
+  // distorted element
+  real64 const X[8][3] = { { 0.0, 0.0, 0.0 }, { 1.1, 0.1, 0.0 }, { 0.0, 0.9, 0.2 }, { 1.2, 1.0, 0.1 },
+    { 0.1, 0.0, 1.0 }, { 1.0, 0.2, 1.1 }, { 0.0, 1.1, 0.9 }, { 1.1, 1.2, 1.3 } };
+
+  real64 u[numNodes];
+  for( int a = 0; a < numNodes; ++a )
+  {
+    u[a] = std::sin( 0.7 * a ) + 0.1 * a;
+  }
+
+  real64 RuReference[numNodes] = {0};
+  for( int q = 0; q < FE_TYPE::numQuadraturePoints; ++q )
+  {
+    FE_TYPE::computeStiffnessTerm( q, X, [&] ( int const i, int const j, real64 const val )
+    {
+      RuReference[i] += val * u[j];
+    } );
+  }
+
+  real64 Ru[numNodes] = {0};
+  FE_TYPE::computeStiffnessProduct( X, u, Ru );
+
+  for( int a = 0; a < numNodes; ++a )
+  {
+    EXPECT_NEAR( RuReference[a], Ru[a], 1e-10 * ( 1.0 + std::abs( RuReference[a] ) ) );
+  }
+}
+
 
 
 using namespace geos;
@@ -49,6 +49,51 @@ integer FunctionBase::isFunctionOfTime() const
   return 0;
 }
 
+integer FunctionBase::getInputPointers( dataRepository::Group const & group,
+                                       real64 const & time,
+                                       real64 const * (&inputPtrs)[MAX_VARS],
+                                       localIndex (&varSize)[MAX_VARS],
+                                       localIndex (&varStride)[MAX_VARS][2] ) const
+{
+  integer const numVars = LvArray::integerConversion< integer >( m_inputVarNames.size() );
+  localIndex totalVarSize = 0;
+  for( integer varIndex = 0; varIndex < numVars; ++varIndex )
+  {
+    string const & varName = m_inputVarNames[varIndex];
+
+    if( varName == "time" )
+    {
+      inputPtrs[varIndex] = &time;
+      varSize[varIndex] = 1;
+    }
+    else
+    {
+      dataRepository::WrapperBase const & wrapper = group.getWrapperBase( varName );
+      varSize[varIndex] = wrapper.numArrayComp();
+
+      using Types = types::ListofTypeList< types::ArrayTypes< types::TypeList< real64 >, types::DimsUpTo< 2 > > >;
+      types::dispatch( Types{}, [&]( auto tupleOfTypes )
+      {
+        using ArrayType = camp::first< decltype( tupleOfTypes ) >;
+        auto const view = dataRepository::Wrapper< ArrayType >::cast( wrapper ).reference().toViewConst();
+        view.move( hostMemorySpace, false );
+        for( int dim = 0; dim < ArrayType::NDIM; ++dim )
+        {
+          varStride[varIndex][dim] = view.strides()[dim];
+        }
+        inputPtrs[varIndex] = view.data();
+      }, wrapper );
+    }
+    totalVarSize += varSize[varIndex];
+  }
+
+  // Make sure the inputs do not exceed the maximum length
+  GEOS_ERROR_IF_GT_MSG( totalVarSize, MAX_VARS,
+                        getDataContext() << ": Function input size exceeded" );
+
+  return numVars;
+}
+
 real64_array FunctionBase::evaluateStats( dataRepository::Group const & group,
                                           real64 const time,
                                           SortedArray< localIndex > const & set ) const
@@ -154,6 +154,37 @@ protected:
                   SortedArrayView< localIndex const > const & set,
                   arrayView1d< real64 > const & result ) const;
 
+  /**
+   * @brief Gather the inputs of the function on a target object into contiguous rows
+   * @tparam POLICY the execution policy used for the copy
+   * @param[in] group a pointer to the object holding the function arguments
+   * @param[in] time current time
+   * @param[in] set the subset of nodes to gather the inputs of
+   * @param[out] inputs the inputs, one row per input component and one column per set entry;
+   *             components beyond the number of rows are ignored, and rows beyond the number
+   *             of components are left untouched
+   */
+  template< typename POLICY = serialPolicy >
+  void gatherInputs( dataRepository::Group const & group,
+                     real64 const time,
+                     SortedArrayView< localIndex const > const & set,
+                     arrayView2d< real64 > const & inputs ) const;
+
+  /**
+   * @brief Get host pointers to the input variables of the function on a target object
+   * @param[in] group a pointer to the object holding the function arguments
+   * @param[in] time current time, must outlive the use of the pointers
+   * @param[out] inputPtrs the pointer to the data of each input variable
+   * @param[out] varSize the number of components of each input variable
+   * @param[out] varStride the strides of each input variable
+   * @return the number of input variables
+   */
+  integer getInputPointers( dataRepository::Group const & group,
+                            real64 const & time,
+                            real64 const * (&inputPtrs)[MAX_VARS],
+                            localIndex (&varSize)[MAX_VARS],
+                            localIndex (&varStride)[MAX_VARS][2] ) const;
+
   virtual void postInputInitialization() override { initializeFunction(); }
 
 };
@@ -168,41 +199,7 @@ void FunctionBase::evaluateT( dataRepository::Group const & group,
   localIndex varSize[MAX_VARS]{};
   localIndex varStride[MAX_VARS][2]{};
 
-  integer const numVars = LvArray::integerConversion< integer >( m_inputVarNames.size() );
-  localIndex totalVarSize = 0;
-  for( integer varIndex = 0; varIndex < numVars; ++varIndex )
-  {
-    string const & varName = m_inputVarNames[varIndex];
-
-    if( varName == "time" )
-    {
-      inputPtrs[varIndex] = &time;
-      varSize[varIndex] = 1;
-    }
-    else
-    {
-      dataRepository::WrapperBase const & wrapper = group.getWrapperBase( varName );
-      varSize[varIndex] = wrapper.numArrayComp();
-
-      using Types = types::ListofTypeList< types::ArrayTypes< types::TypeList< real64 >, types::DimsUpTo< 2 > > >;
-      types::dispatch( Types{}, [&]( auto tupleOfTypes )
-      {
-        using ArrayType = camp::first< decltype( tupleOfTypes ) >;
-        auto const view = dataRepository::Wrapper< ArrayType >::cast( wrapper ).reference().toViewConst();
-        view.move( hostMemorySpace, false );
-        for( int dim = 0; dim < ArrayType::NDIM; ++dim )
-        {
-          varStride[varIndex][dim] = view.strides()[dim];
-        }
-        inputPtrs[varIndex] = view.data();
-      }, wrapper );
-    }
-    totalVarSize += varSize[varIndex];
-  }
-
-  // Make sure the inputs do not exceed the maximum length
-  GEOS_ERROR_IF_GT_MSG( totalVarSize, MAX_VARS,
-                        getDataContext() << ": Function input size exceeded" );
+  integer const numVars = getInputPointers( group, time, inputPtrs, varSize, varStride );
 
   // Make sure the result / set size match
   GEOS_ERROR_IF_NE_MSG( result.size(), set.size(),
@@ -223,6 +220,39 @@ void FunctionBase::evaluateT( dataRepository::Group const & group,
     result[i] = static_cast< LEAF const * >( this )->evaluate( input );
   } );
 }
+
+template< typename POLICY >
+void FunctionBase::gatherInputs( dataRepository::Group const & group,
+                                 real64 const time,
+                                 SortedArrayView< localIndex const > const & set,
+                                 arrayView2d< real64 > const & inputs ) const
+{
+  real64 const * inputPtrs[MAX_VARS]{};
+  localIndex varSize[MAX_VARS]{};
+  localIndex varStride[MAX_VARS][2]{};
+
+  integer const numVars = getInputPointers( group, time, inputPtrs, varSize, varStride );
+
+  GEOS_ERROR_IF_NE_MSG( inputs.size( 1 ), set.size(),
+                        getDataContext() << ": To gather the inputs of a function on a set, the number of columns and the set size must match" );
+
+  // Copy each input component into its own contiguous row, skipping the components that do not fit
+  localIndex row = 0;
+  for( integer varIndex = 0; varIndex < numVars; ++varIndex )
+  {
+    for( localIndex compIndex = 0; compIndex < varSize[varIndex] && row < inputs.size( 0 ); ++compIndex, ++row )
+    {
+      real64 const * const inputPtr = inputPtrs[varIndex];
+      localIndex const varStride0 = varStride[varIndex][0];
+      localIndex const offset = compIndex * varStride[varIndex][1];
+      arraySlice1d< real64 > const inputRow = inputs[row];
+      forAll< POLICY >( set.size(), [=]( localIndex const i )
+      {
+        inputRow[i] = inputPtr[set[i] * varStride0 + offset];
+      } );
+    }
+  }
+}
 } /* namespace geos */
 
 #endif /* GEOS_FUNCTIONS_FUNCTIONBASE_HPP_ */
@@ -54,6 +54,10 @@ public:
   /// Compile time value for the number of hypercube vertices
   static constexpr integer numVerts = 1 << numDims;
 
+  /// Number of points processed together in computeBatch(), chosen to keep the workspace within 32 KB
+  static constexpr localIndex batchSize = ( numVerts * numOps >= 4096 ) ? 1 :
+                                          ( 4096 / ( numVerts * numOps ) > 64 ) ? 64 : 4096 / ( numVerts * numOps );
+
 
   /**
    * @brief Construct a new Multivariable Table Function Static Kernel object
@@ -150,6 +154,93 @@ public:
 
   }
 
+  /**
+   * @brief interpolate all operators at a set of points given by coordinate columns
+   *
+   * The points are processed in batches of batchSize: the hypercubes of all points of a batch
+   * are located first, then the interpolation is done in loops over the points of the batch,
+   * which the compiler can vectorize.
+   *
+   * @tparam POLICY host execution policy used to process the batches
+   * @param[in] coordinates point coordinates, one row per table dimension and one column per point
+   * @param[out] values interpolated operator values, one row per operator and one column per point
+   */
+  template< typename POLICY >
+  void
+  computeBatch( arrayView2d< real64 const > const & coordinates,
+                arrayView2d< real64 > const & values ) const
+  {
+    GEOS_ERROR_IF_NE( coordinates.size( 0 ), numDims );
+    GEOS_ERROR_IF_NE( values.size( 0 ), numOps );
+    GEOS_ERROR_IF_NE( coordinates.size( 1 ), values.size( 1 ) );
+
+    MultivariableTableFunctionStaticKernel const kernel = *this;
+    localIndex const numPoints = coordinates.size( 1 );
+    localIndex const numBatches = ( numPoints + batchSize - 1 ) / batchSize;
+
+    forAll< POLICY >( numBatches, [=]( localIndex const batch )
+    {
+      localIndex const first = batch * batchSize;
+      localIndex const numBatchPoints = LvArray::math::min( batchSize, numPoints - first );
+
+      globalIndex hypercubeIndex[batchSize]{};
+      real64 axisMults[numDims][batchSize];
+
+      for( integer i = 0; i < numDims; ++i )
+      {
+        arraySlice1d< real64 const > const x = coordinates[i];
+        for( localIndex p = 0; p < numBatchPoints; ++p )
+        {
+          real64 axisLow;
+          integer const axisIndex = kernel.getAxisIntervalIndexLowMult( x[first + p],
+                                                                        kernel.m_axisMinimums[i], kernel.m_axisMaximums[i],
+                                                                        kernel.m_axisSteps[i], kernel.m_axisStepInvs[i], kernel.m_axisPoints[i],
+                                                                        axisLow, axisMults[i][p] );
+          hypercubeIndex[p] += axisIndex * kernel.m_axisHypercubeMults[i];
+        }
+      }
+
+      // copy operator values for all vertices, with the points as the fastest index
+      real64 workspace[numVerts][numOps][batchSize];
+      for( localIndex p = 0; p < numBatchPoints; ++p )
+      {
+        real64 const * const hypercubeData = kernel.getHypercubeData( hypercubeIndex[p] );
+        for( integer j = 0; j < numVerts; ++j )
+        {
+          for( integer op = 0; op < numOps; ++op )
+          {
+            workspace[j][op][p] = hypercubeData[j * numOps + op];
+          }
+        }
+      }
+
+      // same reduction as interpolatePoint, one axis at a time
+      integer pwr = numVerts / 2;
+      for( integer i = 0; i < numDims; ++i )
+      {
+        for( integer j = 0; j < pwr; ++j )
+        {
+          for( integer op = 0; op < numOps; ++op )
+          {
+            for( localIndex p = 0; p < numBatchPoints; ++p )
+            {
+              workspace[j][op][p] += axisMults[i][p] * ( workspace[j + pwr][op][p] - workspace[j][op][p] );
+            }
+          }
+        }
+        pwr /= 2;
+      }
+
+      for( integer op = 0; op < numOps; ++op )
+      {
+        for( localIndex p = 0; p < numBatchPoints; ++p )
+        {
+          values[op][first + p] = workspace[0][op][p];
+        }
+      }
+    } );
+  }
+
 protected:
 
   /**
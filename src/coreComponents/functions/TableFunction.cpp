@@ -20,8 +20,10 @@
 #include "TableFunction.hpp"
 #include "codingUtilities/Parsing.hpp"
 #include "common/DataTypes.hpp"
+#include "common/MpiWrapper.hpp"
 
 #include <algorithm>
+#include <limits>
 
 namespace geos
 {
@@ -32,6 +34,7 @@ TableFunction::TableFunction( const string & name,
                               Group * const parent ):
   FunctionBase( name, parent ),
   m_interpolationMethod( InterpolationType::Linear ),
+  m_useNodeSharedMemory( 0 ),
   m_valueUnit( units::Unknown ),
   m_kernelWrapper( createKernelWrapper() )
 {
@@ -53,23 +56,93 @@ TableFunction::TableFunction( const string & name,
     setRestartFlags( RestartFlags::NO_WRITE ).
     setDescription( "Voxel file name for ND Table" );
 
+  registerWrapper( viewKeyStruct::useNodeSharedMemoryString(), &m_useNodeSharedMemory ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setRestartFlags( RestartFlags::NO_WRITE ).
+    setDescription( "Flag to store the values read from the voxel file once per compute node, in MPI shared memory, "
+                    "instead of once per rank. The table values can then only be used through table evaluation: the tables "
+                    "whose values are read directly (relative permeability, capillary pressure, black-oil, hydraulic aperture "
+                    "and equilibrium tables) reject this option." );
+
   registerWrapper( viewKeyStruct::interpolationString(), &m_interpolationMethod ).
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Interpolation method. Valid options:\n* " + EnumStrings< InterpolationType >::concat( "\n* " ) ).
     setApplyDefaultValue( m_interpolationMethod );
 }
 
-void TableFunction::readFile( string const & filename, array1d< real64 > & target )
+namespace
+{
+
+/**
+ * @brief Broadcast an array of values, in chunks small enough for the MPI count argument
+ * @param values the values, significant on the root rank
+ * @param numValues the number of values
+ * @param comm the communicator, whose rank 0 is the root
+ */
+void broadcastValues( real64 * const values, localIndex const numValues, MPI_Comm const comm )
+{
+  localIndex constexpr maxChunkSize = std::numeric_limits< int >::max();
+  for( localIndex offset = 0; offset < numValues; offset += maxChunkSize )
+  {
+    int const chunkSize = LvArray::integerConversion< int >( LvArray::math::min( maxChunkSize, numValues - offset ) );
+    MpiWrapper::bcast( values + offset, chunkSize, 0, comm );
+  }
+}
+
+}
+
+localIndex TableFunction::parseFileOnFirstRank( string const & filename, array1d< real64 > & target )
 {
-  auto const skipped = []( char const c ){ return std::isspace( c ) || c == ','; };
-  try
+  // Only the first rank reads the file, the errors and the number of values are broadcast to the other ranks
+  string errorMessage;
+  localIndex numValues = 0;
+  if( MpiWrapper::commRank() == 0 )
   {
-    parseFile( filename, target, skipped );
+    auto const skipped = []( char const c ){ return std::isspace( c ) || c == ','; };
+    try
+    {
+      parseFile( filename, target, skipped );
+    }
+    catch( std::runtime_error const & e )
+    {
+      errorMessage = e.what();
+    }
+    numValues = target.size();
   }
-  catch( std::runtime_error const & e )
+  MpiWrapper::broadcast( errorMessage );
+  GEOS_THROW_IF( !errorMessage.empty(),
+                 GEOS_FMT( "{} {}: {}", catalogName(), getDataContext(), errorMessage ),
+                 InputError );
+  MpiWrapper::broadcast( numValues );
+  return numValues;
+}
+
+void TableFunction::readFile( string const & filename, array1d< real64 > & target )
+{
+  localIndex const numValues = parseFileOnFirstRank( filename, target );
+  target.resize( numValues );
+  broadcastValues( target.data(), numValues, MPI_COMM_GEOS );
+}
+
+void TableFunction::readFileToNodeSharedMemory( string const & filename )
+{
+  array1d< real64 > values;
+  localIndex const numValues = parseFileOnFirstRank( filename, values );
+
+  // The first rank of each node receives the values in the shared memory of its node
+  m_sharedValues.allocate( numValues * sizeof( real64 ) );
+  real64 * const sharedValues = static_cast< real64 * >( m_sharedValues.data() );
+  if( m_sharedValues.isNodeRoot() )
   {
-    GEOS_THROW( GEOS_FMT( "{} {}: {}", catalogName(), getDataContext(), e.what() ), InputError );
+    if( MpiWrapper::commRank() == 0 )
+    {
+      std::copy( values.begin(), values.end(), sharedValues );
+    }
+    broadcastValues( sharedValues, numValues, m_sharedValues.nodeRootComm() );
   }
+  m_sharedValues.nodeBarrier();
+  m_values.clear();
 }
 
 void TableFunction::setInterpolationMethod( InterpolationType const method )
@@ -104,6 +177,15 @@ void TableFunction::setTableValues( real64_array values, units::Unit unit )
   reInitializeFunction();
 }
 
+void TableFunction::checkValuesAccessible( string const & consumerName ) const
+{
+  GEOS_THROW_IF( m_useNodeSharedMemory,
+                 GEOS_FMT( "{}: the values of table {} are read directly, so they cannot be stored in node-shared memory "
+                           "(set {} to 0)",
+                           consumerName, getDataContext(), viewKeyStruct::useNodeSharedMemoryString() ),
+                 InputError );
+}
+
 void TableFunction::initializeFunction()
 {
   // Read in data
@@ -115,6 +197,10 @@ void TableFunction::initializeFunction()
   else if( m_coordinateFiles.empty() )
   {
     // 1D Table
+    GEOS_THROW_IF( m_useNodeSharedMemory,
+                   GEOS_FMT( "{} {}: {} is only available for tables read from a voxel file",
+                             catalogName(), getDataContext(), viewKeyStruct::useNodeSharedMemoryString() ),
+                   InputError );
     m_coordinates.appendArray( m_tableCoordinates1D.begin(), m_tableCoordinates1D.end() );
     GEOS_THROW_IF_NE_MSG( m_tableCoordinates1D.size(), m_values.size(),
                           GEOS_FMT( "{} {}: 1D table function coordinates and values must have the same length",
@@ -133,17 +219,68 @@ void TableFunction::initializeFunction()
       numValues *= tmp.size();
     }
     // ND Table
-    m_values.reserve( numValues );
-    readFile( m_voxelFile, m_values );
+#if defined(GEOS_USE_DEVICE)
+    GEOS_WARNING_IF( m_useNodeSharedMemory,
+                     GEOS_FMT( "{} {}: node-shared memory is not available with device execution, the option is ignored",
+                               catalogName(), getDataContext() ) );
+    m_useNodeSharedMemory = 0;
+#endif
+    if( m_useNodeSharedMemory )
+    {
+      readFileToNodeSharedMemory( m_voxelFile );
+    }
+    else
+    {
+      m_values.reserve( numValues );
+      readFile( m_voxelFile, m_values );
+    }
   }
 
   reInitializeFunction();
 }
 
+namespace
+{
+
+/**
+ * @brief Compute the inverse of the spacing of an evenly spaced table axis
+ * @param coords the coordinates of the axis
+ * @return the inverse spacing, or zero if the axis is not evenly spaced
+ */
+real64 computeUniformInverseSpacing( arraySlice1d< real64 const > const & coords )
+{
+  // Relative tolerance on the position of each coordinate, only used to estimate the interval:
+  // the exact interval is recovered from the coordinates themselves
+  real64 constexpr relTol = 1.0e-6;
+
+  localIndex const numPoints = coords.size();
+  if( numPoints < 2 )
+  {
+    return 0.0;
+  }
+  real64 const dx = ( coords[numPoints - 1] - coords[0] ) / ( numPoints - 1 );
+  for( localIndex i = 1; i < numPoints - 1; ++i )
+  {
+    if( LvArray::math::abs( coords[i] - coords[0] - i * dx ) > relTol * dx )
+    {
+      return 0.0;
+    }
+  }
+  return 1.0 / dx;
+}
+
+}
+
 void TableFunction::reInitializeFunction()
 {
+  GEOS_THROW_IF_GT_MSG( m_coordinates.size(), maxDimensions,
+                        GEOS_FMT( "{} {}: the number of table dimensions is limited to {}",
+                                  catalogName(), getDataContext(), maxDimensions ),
+                        InputError );
+
   // Setup index increment (assume data is in Fortran array order)
   localIndex increment = 1;
+  std::fill( std::begin( m_uniformInverseSpacing ), std::end( m_uniformInverseSpacing ), 0.0 );
   for( localIndex ii = 0; ii < m_coordinates.size(); ++ii )
   {
     increment *= m_coordinates.sizeOfArray( ii );
@@ -154,10 +291,14 @@ void TableFunction::reInitializeFunction()
                                catalogName(), getDataContext(), ii ),
                      InputError );
     }
+    // Evenly spaced axes allow a direct computation of the interval during interpolation
+    m_uniformInverseSpacing[ii] = computeUniformInverseSpacing( m_coordinates[ii] );
   }
-  if( m_coordinates.size() > 0 && !m_values.empty() ) // coordinates and values have been set
+  localIndex const numValues = m_values.empty() ? LvArray::integerConversion< localIndex >( m_sharedValues.size() / sizeof( real64 ) )
+                                                : m_values.size();
+  if( m_coordinates.size() > 0 && numValues > 0 ) // coordinates and values have been set
   {
-    GEOS_THROW_IF_NE_MSG( increment, m_values.size(),
+    GEOS_THROW_IF_NE_MSG( increment, numValues,
                           GEOS_FMT( "{} {}: number of values does not match total number of table coordinates",
                                     catalogName(), getDataContext() ),
                           InputError );
@@ -188,7 +329,9 @@ TableFunction::KernelWrapper TableFunction::createKernelWrapper() const
 {
   return { m_interpolationMethod,
            m_coordinates.toViewConst(),
-           m_values.toViewConst() };
+           m_values.toViewConst(),
+           m_uniformInverseSpacing,
+           m_values.empty() ? static_cast< real64 const * >( m_sharedValues.data() ) : nullptr };
 }
 
 real64 TableFunction::evaluate( real64 const * const input ) const
@@ -196,14 +339,138 @@ real64 TableFunction::evaluate( real64 const * const input ) const
   return m_kernelWrapper.compute( input );
 }
 
+void TableFunction::evaluate( dataRepository::Group const & group,
+                              real64 const time,
+                              SortedArrayView< localIndex const > const & set,
+                              arrayView1d< real64 > const & result ) const
+{
+  // Gather the inputs into contiguous columns, then interpolate all the points at once
+  array2d< real64 > input( numDimensions(), set.size() );
+  gatherInputs< parallelHostPolicy >( group, time, set, input.toView() );
+  evaluateBatch( input.toViewConst(), result );
+}
+
+void TableFunction::evaluateBatch( arrayView2d< real64 const > const & input,
+                                   arrayView1d< real64 > const & result ) const
+{
+  integer const numDims = numDimensions();
+  localIndex const numPoints = result.size();
+
+  GEOS_ERROR_IF_LT_MSG( input.size( 0 ), numDims,
+                        getDataContext() << ": The number of input rows must be at least the number of table dimensions" );
+  GEOS_ERROR_IF_NE_MSG( input.size( 1 ), numPoints,
+                        getDataContext() << ": The number of input points and results must match" );
+
+  KernelWrapper const kernelWrapper = m_kernelWrapper;
+
+  if( m_interpolationMethod != InterpolationType::Linear )
+  {
+    // Rounding methods only read one table value per point, there is nothing to batch
+    forAll< parallelHostPolicy >( numPoints, [=]( localIndex const i )
+    {
+      real64 point[maxDimensions]{};
+      for( integer dim = 0; dim < numDims; ++dim )
+      {
+        point[dim] = input[dim][i];
+      }
+      result[i] = kernelWrapper.compute( point );
+    } );
+    return;
+  }
+
+  localIndex const numBatches = ( numPoints + batchSize - 1 ) / batchSize;
+  forAll< parallelHostPolicy >( numBatches, [=]( localIndex const batch )
+  {
+    localIndex const first = batch * batchSize;
+    localIndex const numBatchPoints = LvArray::math::min( batchSize, numPoints - first );
+
+    // Index of the lower corner of the table cell containing each point
+    localIndex lowerIndex[batchSize]{};
+    // Weight of the upper vertex along each axis for each point
+    real64 upperWeight[maxDimensions][batchSize];
+    // Distance between the lower and upper vertices along each axis (zero for single-point axes)
+    localIndex cornerStride[maxDimensions]{};
+
+    // Find the intervals one axis at a time, so that consecutive points reuse the interval of the previous one
+    for( integer dim = 0; dim < numDims; ++dim )
+    {
+      arraySlice1d< real64 const > const coords = kernelWrapper.m_coordinates[dim];
+      arraySlice1d< real64 const > const x = input[dim];
+      localIndex const last = coords.size() - 1;
+      localIndex const stride = kernelWrapper.m_strides[dim];
+      cornerStride[dim] = ( last > 0 ) ? stride : 0;
+
+      localIndex upper = 0;
+      for( localIndex p = 0; p < numBatchPoints; ++p )
+      {
+        real64 const coord = x[first + p];
+        if( last == 0 || coord <= coords[0] )
+        {
+          upperWeight[dim][p] = 0.0;
+        }
+        else if( coord >= coords[last] )
+        {
+          lowerIndex[p] += ( last - 1 ) * stride;
+          upperWeight[dim][p] = 1.0;
+        }
+        else
+        {
+          kernelWrapper.findInterval( dim, coord, upper );
+          lowerIndex[p] += ( upper - 1 ) * stride;
+          upperWeight[dim][p] = ( coord - coords[upper - 1] ) / ( coords[upper] - coords[upper - 1] );
+        }
+      }
+    }
+
+    // Accumulate the contribution of each cell corner for all the points of the batch
+    real64 value[batchSize]{};
+    integer const numCorners = 1 << numDims;
+    for( integer corner = 0; corner < numCorners; ++corner )
+    {
+      localIndex cornerOffset = 0;
+      for( integer dim = 0; dim < numDims; ++dim )
+      {
+        cornerOffset += ( ( corner >> dim ) & 1 ) * cornerStride[dim];
+      }
+      for( localIndex p = 0; p < numBatchPoints; ++p )
+      {
+        real64 cornerWeight = 1.0;
+        for( integer dim = 0; dim < numDims; ++dim )
+        {
+          cornerWeight *= ( ( corner >> dim ) & 1 ) ? upperWeight[dim][p] : 1.0 - upperWeight[dim][p];
+        }
+        value[p] += cornerWeight * kernelWrapper.getValue( lowerIndex[p] + cornerOffset );
+      }
+    }
+
+    for( localIndex p = 0; p < numBatchPoints; ++p )
+    {
+      result[first + p] = value[p];
+    }
+  } );
+}
+
 TableFunction::KernelWrapper::KernelWrapper( InterpolationType const interpolationMethod,
                                              ArrayOfArraysView< real64 const > const & coordinates,
-                                             arrayView1d< real64 const > const & values )
+                                             arrayView1d< real64 const > const & values,
+                                             real64 const (&uniformInverseSpacing)[maxDimensions],
+                                             real64 const * const sharedValues )
   :
   m_interpolationMethod( interpolationMethod ),
   m_coordinates( coordinates ),
-  m_values( values )
-{}
+  m_values( values ),
+  m_sharedValues( sharedValues ),
+  m_numDimensions( LvArray::integerConversion< integer >( coordinates.size() ) )
+{
+  // Precompute the strides (data is in Fortran array order)
+  localIndex stride = 1;
+  for( integer dim = 0; dim < LvArray::math::min( m_numDimensions, maxDimensions ); ++dim )
+  {
+    m_strides[dim] = stride;
+    stride *= coordinates.sizeOfArray( dim );
+    m_uniformInverseSpacing[dim] = uniformInverseSpacing[dim];
+  }
+}
 
 /**
  * @brief Retrieve all data headers from a table function
@@ -266,6 +533,7 @@ void collectValues( std::ostringstream & formatterStream,
 
 void TableFunction::outputPVTTableData( OutputOptions const pvtOutputOpts ) const
 {
+  checkValuesAccessible( getName() );
   if( pvtOutputOpts.writeInLog &&  this->numDimensions() <= 2 )
   {
     TableTextFormatter textFormatter;
@@ -26,6 +26,7 @@
 #include "LvArray/src/tensorOps.hpp"
 #include "common/format/table/TableFormatter.hpp"
 #include "common/Units.hpp"
+#include "common/NodeSharedBuffer.hpp"
 
 namespace geos
 {
@@ -60,6 +61,9 @@ public:
   /// maximum dimensions for the coordinates in the table
   static constexpr integer maxDimensions = 4;
 
+  /// number of points processed together in evaluateBatch()
+  static constexpr localIndex batchSize = 256;
+
   /**
    * @class KernelWrapper
    *
@@ -84,12 +88,32 @@ public:
     {
       m_coordinates = std::move( other.m_coordinates );
       m_values = std::move( other.m_values );
+      m_sharedValues = other.m_sharedValues;
       m_interpolationMethod = other.m_interpolationMethod;
+      m_numDimensions = other.m_numDimensions;
+      for( integer dim = 0; dim < maxDimensions; ++dim )
+      {
+        m_strides[dim] = other.m_strides[dim];
+        m_uniformInverseSpacing[dim] = other.m_uniformInverseSpacing[dim];
+      }
       return *this;
     }
 
     /// @endcond
 
+    /**
+     * @struct IntervalCache
+     * @brief Intervals found along each non-uniform axis during the last evaluation.
+     * @details Callers evaluating the table repeatedly at nearby points (e.g. the same cell over
+     *          Newton iterations) can keep an instance and pass it to computeCached() to avoid the
+     *          binary search when the point stays in the same or an adjacent interval.
+     */
+    struct IntervalCache
+    {
+      /// Index of the upper bound of the interval along each axis (0 if unknown)
+      localIndex upper[maxDimensions]{};
+    };
+
     /**
      * @brief Interpolate in the table.
      * @tparam IN_ARRAY type of input value array
@@ -110,6 +134,27 @@ public:
     GEOS_HOST_DEVICE
     real64 compute( IN_ARRAY const & input, OUT_ARRAY && derivatives ) const;
 
+    /**
+     * @brief Interpolate in the table, starting the interval search from a cache.
+     * @param[in] input vector of input value
+     * @param[in,out] cache intervals found at the previous evaluation, updated on return
+     * @return interpolated value
+     */
+    template< typename IN_ARRAY >
+    GEOS_HOST_DEVICE
+    real64 computeCached( IN_ARRAY const & input, IntervalCache & cache ) const;
+
+    /**
+     * @brief Interpolate in the table with derivatives, starting the interval search from a cache.
+     * @param[in] input vector of input value
+     * @param[out] derivatives vector of derivatives of interpolated value wrt the variables present in input
+     * @param[in,out] cache intervals found at the previous evaluation, updated on return
+     * @return interpolated value
+     */
+    template< typename IN_ARRAY, typename OUT_ARRAY >
+    GEOS_HOST_DEVICE
+    real64 computeCached( IN_ARRAY const & input, OUT_ARRAY && derivatives, IntervalCache & cache ) const;
+
     /**
      * @brief Move the KernelWrapper to the given execution space, optionally touching it.
      * @param space the space to move the KernelWrapper to
@@ -132,36 +177,63 @@ private:
      * @param[in] interpolationMethod table interpolation method
      * @param[in] coordinates array of table axes
      * @param[in] values table values (in fortran order)
-     * @param[in] dimensions number of active table dimensions
-     * @param[in] size size of the table
-     * @param[in] indexIncrement array used to locate values within ND tables
-     * @param[in] corners corners of the box that surround the value in N dimensions
-     * @param[in] numCorners number of active table corners
+     * @param[in] uniformInverseSpacing inverse of the spacing of each evenly spaced axis, zero for other axes
+     * @param[in] sharedValues table values held in node-shared memory, used instead of values if not null
      */
     KernelWrapper( InterpolationType interpolationMethod,
                    ArrayOfArraysView< real64 const > const & coordinates,
-                   arrayView1d< real64 const > const & values );
+                   arrayView1d< real64 const > const & values,
+                   real64 const (&uniformInverseSpacing)[maxDimensions],
+                   real64 const * sharedValues );
+
+    /**
+     * @brief Get a table value.
+     * @param[in] index the index of the value (in fortran order)
+     * @return the table value
+     */
+    GEOS_HOST_DEVICE
+    GEOS_FORCE_INLINE
+    real64 getValue( localIndex const index ) const
+    {
+      return ( m_sharedValues != nullptr ) ? m_sharedValues[index] : m_values[index];
+    }
+
+    /**
+     * @brief Find the interval containing a coordinate strictly inside an axis.
+     * @param[in] dim the axis
+     * @param[in] coord the coordinate, with coords[0] < coord < coords[size-1]
+     * @param[in,out] upper the index of the upper bound of the interval found at the previous
+     *                call, or 0 if unknown; on return, the index of the upper bound of the interval
+     * @details Uniform axes use a direct index computation. Other axes first check the given
+     *          interval and its neighbours, and fall back to a binary search.
+     */
+    GEOS_HOST_DEVICE
+    void findInterval( integer const dim, real64 const coord, localIndex & upper ) const;
 
     /**
      * @brief Interpolate in the table using linear method.
+     * @tparam NDIM number of table dimensions if known at compile time, 0 otherwise
      * @param[in] input vector of input value
+     * @param[in,out] cache intervals found at the previous evaluation
      * @return interpolated value
      */
-    template< typename IN_ARRAY >
+    template< integer NDIM, typename IN_ARRAY >
     GEOS_HOST_DEVICE
     real64
-    interpolateLinear( IN_ARRAY const & input ) const;
+    interpolateLinear( IN_ARRAY const & input, IntervalCache & cache ) const;
 
     /**
      * @brief Interpolate in the table with derivatives using linear method.
+     * @tparam NDIM number of table dimensions if known at compile time, 0 otherwise
      * @param[in] input vector of input value
      * @param[out] derivatives vector of derivatives of interpolated value wrt the variables present in input
+     * @param[in,out] cache intervals found at the previous evaluation
      * @return interpolated value
      */
-    template< typename IN_ARRAY, typename OUT_ARRAY >
+    template< integer NDIM, typename IN_ARRAY, typename OUT_ARRAY >
     GEOS_HOST_DEVICE
     real64
-    interpolateLinear( IN_ARRAY const & input, OUT_ARRAY && derivatives ) const;
+    interpolateLinear( IN_ARRAY const & input, OUT_ARRAY && derivatives, IntervalCache & cache ) const;
 
     /**
      * @brief Interpolate in the table by rounding to an exact point
@@ -192,6 +264,18 @@ private:
 
     /// Table values (in fortran order)
     arrayView1d< real64 const > m_values;
+
+    /// Table values held in node-shared host memory (in fortran order), or nullptr
+    real64 const * m_sharedValues = nullptr;
+
+    /// Number of table dimensions
+    integer m_numDimensions = 0;
+
+    /// Distance between consecutive values along each table axis
+    localIndex m_strides[maxDimensions]{};
+
+    /// Inverse of the spacing of each table axis if it is uniform, zero otherwise
+    real64 m_uniformInverseSpacing[maxDimensions]{};
   };
 
   /**
@@ -228,10 +312,7 @@ private:
   virtual void evaluate( dataRepository::Group const & group,
                          real64 const time,
                          SortedArrayView< localIndex const > const & set,
-                         arrayView1d< real64 > const & result ) const override final
-  {
-    FunctionBase::evaluateT< TableFunction, parallelHostPolicy >( group, time, set, result );
-  }
+                         arrayView1d< real64 > const & result ) const override final;
 
   /**
    * @brief Method to evaluate a function
@@ -240,6 +321,18 @@ private:
    */
   virtual real64 evaluate( real64 const * const input ) const override final;
 
+  /**
+   * @brief Evaluate the table at a set of points given by input columns
+   * @param[in] input the point coordinates, one row per table dimension and one column per point
+   * @param[out] result the interpolated value at each point
+   * @details The points are processed in batches of batchSize, in parallel on the host. For each
+   *          batch, the table intervals of all points are found first, along one axis at a time,
+   *          and the interpolation is then done in loops over the points of the batch, which the
+   *          compiler can vectorize. Rows of input beyond the number of dimensions are ignored.
+   */
+  void evaluateBatch( arrayView2d< real64 const > const & input,
+                      arrayView1d< real64 > const & result ) const;
+
   /**
    * @brief Check if the given coordinate is in the bounds of the table coordinates in the
    * specified dimension, throw an exception otherwise.
@@ -268,13 +361,31 @@ private:
   /**
    * @brief Get the table values
    * @return a reference to the 1d array of table values.  For ND arrays, values are stored in Fortran order.
+   * @note The values of a table stored in node-shared memory are not available (see checkValuesAccessible()).
    */
-  arrayView1d< real64 const > getValues() const { return m_values.toViewConst(); }
+  arrayView1d< real64 const > getValues() const
+  {
+    GEOS_ERROR_IF( m_sharedValues.size() > 0,
+                   GEOS_FMT( "{}: the values of a table stored in node-shared memory cannot be accessed", getDataContext() ) );
+    return m_values.toViewConst();
+  }
 
   /**
    * @copydoc getValues() const
    */
-  array1d< real64 > & getValues() { return m_values; }
+  array1d< real64 > & getValues()
+  {
+    GEOS_ERROR_IF( m_sharedValues.size() > 0,
+                   GEOS_FMT( "{}: the values of a table stored in node-shared memory cannot be accessed", getDataContext() ) );
+    return m_values;
+  }
+
+  /**
+   * @brief Check, at input time, that the table values can be accessed with getValues()
+   * @param consumerName the name of the object that reads the table values, for the error message
+   * @throw InputError if the table values are stored in node-shared memory
+   */
+  void checkValuesAccessible( string const & consumerName ) const;
 
   /**
    * @brief Get the interpolation method
@@ -361,6 +472,8 @@ private:
     static constexpr char const * coordinateFilesString() { return "coordinateFiles"; }
     /// @return Key for name of file containing table values
     static constexpr char const * voxelFileString() { return "voxelFile"; }
+    /// @return Key for the flag to store the values read from file in node-shared memory
+    static constexpr char const * useNodeSharedMemoryString() { return "useNodeSharedMemory"; }
   };
 
 private:
@@ -373,6 +486,20 @@ private:
    */
   void readFile( string const & filename, array1d< real64 > & target );
 
+  /**
+   * @brief Parse a table file on the first rank only.
+   * @param[in] filename The name of the file to read.
+   * @param[out] target The place to store values, only filled on the first rank.
+   * @return the number of values read, on all ranks
+   */
+  localIndex parseFileOnFirstRank( string const & filename, array1d< real64 > & target );
+
+  /**
+   * @brief Parse a table values file and store the values in node-shared memory.
+   * @param[in] filename The name of the file to read.
+   */
+  void readFileToNodeSharedMemory( string const & filename );
+
 
   /// Coordinates for 1D table
   array1d< real64 > m_tableCoordinates1D;
@@ -392,12 +519,21 @@ private:
   /// Table values (in fortran order)
   array1d< real64 > m_values;
 
+  /// Flag to store the values read from the voxel file once per node, in MPI shared memory
+  integer m_useNodeSharedMemory;
+
+  /// Table values read from the voxel file, stored in node-shared memory (in fortran order)
+  NodeSharedBuffer m_sharedValues;
+
   /// The units of each table coordinate axes
   std::vector< units::Unit > m_dimUnits;
 
   /// The unit of the table values
   units::Unit m_valueUnit;
 
+  /// Inverse of the spacing of each evenly spaced table axis, zero for other axes
+  real64 m_uniformInverseSpacing[maxDimensions]{};
+
   /// Kernel wrapper object used in evaluate() interface
   KernelWrapper m_kernelWrapper;
 
@@ -408,10 +544,27 @@ GEOS_HOST_DEVICE
 GEOS_FORCE_INLINE
 real64
 TableFunction::KernelWrapper::compute( IN_ARRAY const & input ) const
+{
+  IntervalCache cache;
+  return computeCached( input, cache );
+}
+
+template< typename IN_ARRAY >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+real64
+TableFunction::KernelWrapper::computeCached( IN_ARRAY const & input, IntervalCache & cache ) const
 {
   if( m_interpolationMethod == TableFunction::InterpolationType::Linear )
   {
-    return interpolateLinear( input );
+    // Dispatch the most common table sizes to kernels with a fixed number of dimensions
+    switch( m_numDimensions )
+    {
+      case 1: return interpolateLinear< 1 >( input, cache );
+      case 2: return interpolateLinear< 2 >( input, cache );
+      case 3: return interpolateLinear< 3 >( input, cache );
+      default: return interpolateLinear< 0 >( input, cache );
+    }
   }
   else // Nearest, Upper, Lower interpolation methods
   {
@@ -419,18 +572,64 @@ TableFunction::KernelWrapper::compute( IN_ARRAY const & input ) const
   }
 }
 
-template< typename IN_ARRAY >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+void
+TableFunction::KernelWrapper::findInterval( integer const dim, real64 const coord, localIndex & upper ) const
+{
+  arraySlice1d< real64 const > const coords = m_coordinates[dim];
+  localIndex const last = coords.size() - 1;
+
+  if( m_uniformInverseSpacing[dim] > 0.0 )
+  {
+    // Evenly spaced axis: compute the index directly
+    upper = static_cast< localIndex >( ( coord - coords[0] ) * m_uniformInverseSpacing[dim] ) + 1;
+    upper = LvArray::math::min( LvArray::math::max( upper, localIndex( 1 ) ), last );
+
+    // Correct for round-off so that coords[upper-1] < coord <= coords[upper], consistent with find()
+    while( upper > 1 && coord <= coords[upper - 1] )
+    {
+      --upper;
+    }
+    while( upper < last && coord > coords[upper] )
+    {
+      ++upper;
+    }
+  }
+  else if( upper >= 1 && upper <= last && coords[upper - 1] < coord && coord <= coords[upper] )
+  {
+    // Same interval as the previous evaluation
+  }
+  else if( upper >= 1 && upper < last && coords[upper] < coord && coord <= coords[upper + 1] )
+  {
+    // Next interval
+    ++upper;
+  }
+  else if( upper > 1 && upper <= last && coords[upper - 2] < coord && coord <= coords[upper - 1] )
+  {
+    // Previous interval
+    --upper;
+  }
+  else
+  {
+    // Note: find() uses a binary search and returns the index of the upper table vertex
+    auto const lower = LvArray::sortedArrayManipulation::find( coords.begin(), coords.size(), coord );
+    upper = LvArray::integerConversion< localIndex >( lower );
+  }
+}
+
+template< integer NDIM, typename IN_ARRAY >
 GEOS_HOST_DEVICE
 GEOS_FORCE_INLINE
 real64
-TableFunction::KernelWrapper::interpolateLinear( IN_ARRAY const & input ) const
+TableFunction::KernelWrapper::interpolateLinear( IN_ARRAY const & input, IntervalCache & cache ) const
 {
-  integer const numDimensions = LvArray::integerConversion< integer >( m_coordinates.size() );
+  integer const numDimensions = ( NDIM > 0 ) ? NDIM : m_numDimensions;
   localIndex bounds[maxDimensions][2]{};
   real64 weights[maxDimensions][2]{};
 
   // Determine position, weights
-  for( localIndex dim = 0; dim < numDimensions; ++dim )
+  for( integer dim = 0; dim < numDimensions; ++dim )
   {
     arraySlice1d< real64 const > const coords = m_coordinates[dim];
     if( input[dim] <= coords[0] )
@@ -452,11 +651,8 @@ TableFunction::KernelWrapper::interpolateLinear( IN_ARRAY const & input ) const
     else
     {
       // Find the coordinate index
-      ///TODO make this fast
-      // Note: find uses a binary search...  If we assume coordinates are
-      // evenly spaced, we can speed things up considerably
-      auto const lower = LvArray::sortedArrayManipulation::find( coords.begin(), coords.size(), input[dim] );
-      bounds[dim][1] = LvArray::integerConversion< localIndex >( lower );
+      findInterval( dim, input[dim], cache.upper[dim] );
+      bounds[dim][1] = cache.upper[dim];
       bounds[dim][0] = bounds[dim][1] - 1;
 
       real64 const dx = coords[bounds[dim][1]] - coords[bounds[dim][0]];
@@ -470,24 +666,16 @@ TableFunction::KernelWrapper::interpolateLinear( IN_ARRAY const & input ) const
   integer const numCorners = 1 << numDimensions;
   for( integer point = 0; point < numCorners; ++point )
   {
-    // Find array index
+    // Find array index and weight of the corner
     localIndex tableIndex = 0;
-    localIndex stride = 1;
-    for( integer dim = 0; dim < numDimensions; ++dim )
-    {
-      integer const corner = (point >> dim) & 1;
-      tableIndex += bounds[dim][corner] * stride;
-      stride *= m_coordinates.sizeOfArray( dim );
-    }
-
-    // Determine weighted value
-    real64 cornerValue = m_values[tableIndex];
+    real64 cornerWeight = 1.0;
     for( integer dim = 0; dim < numDimensions; ++dim )
     {
       integer const corner = (point >> dim) & 1;
-      cornerValue *= weights[dim][corner];
+      tableIndex += bounds[dim][corner] * m_strides[dim];
+      cornerWeight *= weights[dim][corner];
     }
-    value += cornerValue;
+    value += cornerWeight * getValue( tableIndex );
   }
   return value;
 }
@@ -498,16 +686,13 @@ GEOS_FORCE_INLINE
 real64
 TableFunction::KernelWrapper::interpolateRound( IN_ARRAY const & input ) const
 {
-  integer const numDimensions = LvArray::integerConversion< integer >( m_coordinates.size() );
-
   // Determine the index to the nearest table entry
   localIndex tableIndex = 0;
-  localIndex stride = 1;
-  for( integer dim = 0; dim < numDimensions; ++dim )
+  for( integer dim = 0; dim < m_numDimensions; ++dim )
   {
     arraySlice1d< real64 const > const coords = m_coordinates[dim];
     // Determine the index along each table axis
-    localIndex subIndex;
+    localIndex subIndex = 0;
     if( input[dim] <= coords[0] )
     {
       // Coordinate is to the left of the table axis
@@ -521,9 +706,8 @@ TableFunction::KernelWrapper::interpolateRound( IN_ARRAY const & input ) const
     else
     {
       // Coordinate is within the table axis
-      // Note: find() will return the index of the upper table vertex
-      auto const lower = LvArray::sortedArrayManipulation::find( coords.begin(), coords.size(), input[dim] );
-      subIndex = LvArray::integerConversion< localIndex >( lower );
+      // Note: findInterval() will return the index of the upper table vertex
+      findInterval( dim, input[dim], subIndex );
 
       // Interpolation types:
       //   - Nearest returns the value of the closest table vertex
@@ -546,12 +730,11 @@ TableFunction::KernelWrapper::interpolateRound( IN_ARRAY const & input ) const
     }
 
     // Increment the global table index
-    tableIndex += subIndex * stride;
-    stride *= coords.size();
+    tableIndex += subIndex * m_strides[dim];
   }
 
   // Retrieve the nearest value
-  return m_values[tableIndex];
+  return getValue( tableIndex );
 }
 
 template< typename IN_ARRAY, typename OUT_ARRAY >
@@ -559,11 +742,28 @@ GEOS_HOST_DEVICE
 GEOS_FORCE_INLINE
 real64
 TableFunction::KernelWrapper::compute( IN_ARRAY const & input, OUT_ARRAY && derivatives ) const
+{
+  IntervalCache cache;
+  return computeCached( input, derivatives, cache );
+}
+
+template< typename IN_ARRAY, typename OUT_ARRAY >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+real64
+TableFunction::KernelWrapper::computeCached( IN_ARRAY const & input, OUT_ARRAY && derivatives, IntervalCache & cache ) const
 {
   // Linear interpolation
   if( m_interpolationMethod == TableFunction::InterpolationType::Linear )
   {
-    return interpolateLinear( input, derivatives );
+    // Dispatch the most common table sizes to kernels with a fixed number of dimensions
+    switch( m_numDimensions )
+    {
+      case 1: return interpolateLinear< 1 >( input, derivatives, cache );
+      case 2: return interpolateLinear< 2 >( input, derivatives, cache );
+      case 3: return interpolateLinear< 3 >( input, derivatives, cache );
+      default: return interpolateLinear< 0 >( input, derivatives, cache );
+    }
   }
   // Nearest, Upper, Lower interpolation methods
   else
@@ -572,13 +772,13 @@ TableFunction::KernelWrapper::compute( IN_ARRAY const & input, OUT_ARRAY && deri
   }
 }
 
-template< typename IN_ARRAY, typename OUT_ARRAY >
+template< integer NDIM, typename IN_ARRAY, typename OUT_ARRAY >
 GEOS_HOST_DEVICE
 GEOS_FORCE_INLINE
 real64
-TableFunction::KernelWrapper::interpolateLinear( IN_ARRAY const & input, OUT_ARRAY && derivatives ) const
+TableFunction::KernelWrapper::interpolateLinear( IN_ARRAY const & input, OUT_ARRAY && derivatives, IntervalCache & cache ) const
 {
-  integer const numDimensions = LvArray::integerConversion< integer >( m_coordinates.size() );
+  integer const numDimensions = ( NDIM > 0 ) ? NDIM : m_numDimensions;
 
   localIndex bounds[maxDimensions][2]{};
   real64 weights[maxDimensions][2]{};
@@ -611,11 +811,8 @@ TableFunction::KernelWrapper::interpolateLinear( IN_ARRAY const & input, OUT_ARR
     else
     {
       // Find the coordinate index
-      ///TODO make this fast
-      // Note: find uses a binary search...  If we assume coordinates are
-      // evenly spaced, we can speed things up considerably
-      auto lower = LvArray::sortedArrayManipulation::find( coords.begin(), coords.size(), input[dim] );
-      bounds[dim][1] = LvArray::integerConversion< localIndex >( lower );
+      findInterval( dim, input[dim], cache.upper[dim] );
+      bounds[dim][1] = cache.upper[dim];
       bounds[dim][0] = bounds[dim][1] - 1;
 
       real64 const dx = coords[bounds[dim][1]] - coords[bounds[dim][0]];
@@ -638,16 +835,14 @@ TableFunction::KernelWrapper::interpolateLinear( IN_ARRAY const & input, OUT_ARR
   {
     // Find array index
     localIndex tableIndex = 0;
-    localIndex stride = 1;
     for( integer dim = 0; dim < numDimensions; ++dim )
     {
       integer const corner = (point >> dim) & 1;
-      tableIndex += bounds[dim][corner] * stride;
-      stride *= m_coordinates.sizeOfArray( dim );
+      tableIndex += bounds[dim][corner] * m_strides[dim];
     }
 
     // Determine weighted value
-    real64 cornerValue = m_values[tableIndex];
+    real64 cornerValue = getValue( tableIndex );
     real64 dCornerValue_dInput[maxDimensions]{};
     for( integer dim = 0; dim < numDimensions; ++dim )
     {
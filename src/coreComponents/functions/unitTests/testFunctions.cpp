@@ -297,6 +297,230 @@ TEST( FunctionTests, 2DTable )
 }
 
 
+TEST( FunctionTests, 2DTable_uniformAndCachedIntervals )
+{
+  FunctionManager * functionManager = &FunctionManager::getInstance();
+
+  // 2D table with an evenly spaced axis (x) and an unevenly spaced axis (y)
+  // f(x, y) = x^2 + x*y - y^2 is sampled at the table nodes
+  localIndex const Ndim = 2;
+  localIndex const Nx = 11;
+  localIndex const Ny = 5;
+  localIndex const Ntest = 100;
+
+  array1d< array1d< real64 > > coordinates;
+  coordinates.resize( Ndim );
+  coordinates[0].resize( Nx );
+  for( localIndex ii = 0; ii < Nx; ++ii )
+  {
+    coordinates[0][ii] = -1.0 + 0.3 * ii;
+  }
+  coordinates[1].resize( Ny );
+  coordinates[1][0] = -2.0;
+  coordinates[1][1] = -1.5;
+  coordinates[1][2] = 0.0;
+  coordinates[1][3] = 0.1;
+  coordinates[1][4] = 3.0;
+
+  auto const f = []( real64 const x, real64 const y ){ return x*x + x*y - y*y; };
+
+  array1d< real64 > values( Nx * Ny );
+  for( localIndex jj = 0; jj < Ny; ++jj )
+  {
+    for( localIndex ii = 0; ii < Nx; ++ii )
+    {
+      values[jj*Nx + ii] = f( coordinates[0][ii], coordinates[1][jj] );
+    }
+  }
+
+  TableFunction & table = dynamicCast< TableFunction & >( *functionManager->createChild( "TableFunction", "table_uniform" ) );
+  table.setTableCoordinates( coordinates, { units::Dimensionless, units::Dimensionless } );
+  table.setTableValues( values, units::Dimensionless );
+  table.setInterpolationMethod( TableFunction::InterpolationType::Linear );
+  table.reInitializeFunction();
+
+  TableFunction::KernelWrapper const kernelWrapper = table.createKernelWrapper();
+
+  // Reference bilinear interpolation with a linear search for the intervals
+  auto const findUpper = []( arraySlice1d< real64 const > const & coords, real64 const v )
+  {
+    localIndex upper = 1;
+    while( upper < coords.size() - 1 && v > coords[upper] )
+    {
+      ++upper;
+    }
+    return upper;
+  };
+  auto const reference = [&]( real64 const x, real64 const y, real64 (& derivs)[2] )
+  {
+    localIndex const i1 = findUpper( coordinates[0], x );
+    localIndex const j1 = findUpper( coordinates[1], y );
+    real64 const x0 = coordinates[0][i1-1], x1 = coordinates[0][i1];
+    real64 const y0 = coordinates[1][j1-1], y1 = coordinates[1][j1];
+    real64 const wx = ( x - x0 ) / ( x1 - x0 );
+    real64 const wy = ( y - y0 ) / ( y1 - y0 );
+    real64 const f00 = f( x0, y0 ), f10 = f( x1, y0 ), f01 = f( x0, y1 ), f11 = f( x1, y1 );
+    derivs[0] = ( ( 1.0 - wy ) * ( f10 - f00 ) + wy * ( f11 - f01 ) ) / ( x1 - x0 );
+    derivs[1] = ( ( 1.0 - wx ) * ( f01 - f00 ) + wx * ( f11 - f10 ) ) / ( y1 - y0 );
+    return ( 1.0 - wx ) * ( 1.0 - wy ) * f00 + wx * ( 1.0 - wy ) * f10 + ( 1.0 - wx ) * wy * f01 + wx * wy * f11;
+  };
+
+  std::default_random_engine generator;
+  std::uniform_real_distribution< double > distribution( 0.0, 1.0 );
+  TableFunction::KernelWrapper::IntervalCache cache;
+
+  for( localIndex ii = 0; ii < Ntest; ++ii )
+  {
+    // Walk through the table with small steps to exercise the cached intervals, and hit the
+    // table nodes exactly every few steps, where the interval must match the binary search
+    real64 input[2]{};
+    if( ii % 5 == 0 )
+    {
+      input[0] = coordinates[0][1 + ii % (Nx-2)];
+      input[1] = coordinates[1][1 + ii % (Ny-2)];
+    }
+    else
+    {
+      input[0] = -0.99 + 2.98 * ( ii + distribution( generator ) ) / Ntest;
+      input[1] = -1.99 + 4.98 * ( ii + distribution( generator ) ) / Ntest;
+    }
+
+    real64 expectedDerivatives[2]{};
+    real64 const expected = reference( input[0], input[1], expectedDerivatives );
+
+    real64 derivatives[2]{};
+    real64 const value = kernelWrapper.compute( input, derivatives );
+    ASSERT_NEAR( expected, value, 1e-12 );
+    ASSERT_NEAR( expectedDerivatives[0], derivatives[0], 1e-10 );
+    ASSERT_NEAR( expectedDerivatives[1], derivatives[1], 1e-10 );
+
+    real64 cachedDerivatives[2]{};
+    real64 const cachedValue = kernelWrapper.computeCached( input, cachedDerivatives, cache );
+    ASSERT_NEAR( expected, cachedValue, 1e-12 );
+    ASSERT_NEAR( expectedDerivatives[0], cachedDerivatives[0], 1e-10 );
+    ASSERT_NEAR( expectedDerivatives[1], cachedDerivatives[1], 1e-10 );
+    ASSERT_NEAR( expected, kernelWrapper.computeCached( input, cache ), 1e-12 );
+  }
+}
+
+
+TEST( FunctionTests, 2DTable_batchEvaluation )
+{
+  FunctionManager * functionManager = &FunctionManager::getInstance();
+
+  // 2D table with an evenly spaced axis (x) and an unevenly spaced axis (y)
+  localIndex const Ndim = 2;
+  localIndex const Nx = 7;
+  localIndex const Ny = 4;
+  localIndex const Ntest = 3 * TableFunction::batchSize + 17;
+
+  array1d< array1d< real64 > > coordinates;
+  coordinates.resize( Ndim );
+  coordinates[0].resize( Nx );
+  for( localIndex ii = 0; ii < Nx; ++ii )
+  {
+    coordinates[0][ii] = 0.5 * ii;
+  }
+  coordinates[1].resize( Ny );
+  coordinates[1][0] = -1.0;
+  coordinates[1][1] = 0.0;
+  coordinates[1][2] = 0.2;
+  coordinates[1][3] = 2.0;
+
+  array1d< real64 > values( Nx * Ny );
+  for( localIndex ii = 0; ii < values.size(); ++ii )
+  {
+    values[ii] = std::sin( 0.7 * ii );
+  }
+
+  TableFunction & table = dynamicCast< TableFunction & >( *functionManager->createChild( "TableFunction", "table_batch" ) );
+  table.setTableCoordinates( coordinates, { units::Dimensionless, units::Dimensionless } );
+  table.setTableValues( values, units::Dimensionless );
+
+  // Random points, partly outside of the table, in no particular order
+  std::default_random_engine generator;
+  std::uniform_real_distribution< double > distribution( -0.5, 1.5 );
+  array2d< real64 > input( Ndim, Ntest );
+  for( localIndex ii = 0; ii < Ntest; ++ii )
+  {
+    input[0][ii] = 3.0 * distribution( generator );
+    input[1][ii] = -1.0 + 3.0 * distribution( generator );
+  }
+  // Exact table nodes
+  input[0][0] = coordinates[0][2];
+  input[1][0] = coordinates[1][1];
+  input[0][1] = coordinates[0][Nx-1];
+  input[1][1] = coordinates[1][Ny-1];
+
+  for( TableFunction::InterpolationType const method : { TableFunction::InterpolationType::Linear,
+                                                         TableFunction::InterpolationType::Nearest } )
+  {
+    table.setInterpolationMethod( method );
+    table.reInitializeFunction();
+    TableFunction::KernelWrapper const kernelWrapper = table.createKernelWrapper();
+
+    array1d< real64 > result( Ntest );
+    table.evaluateBatch( input.toViewConst(), result.toView() );
+
+    for( localIndex ii = 0; ii < Ntest; ++ii )
+    {
+      real64 const point[2] = { input[0][ii], input[1][ii] };
+      ASSERT_NEAR( kernelWrapper.compute( point ), result[ii], 1e-12 );
+    }
+  }
+}
+
+
+TEST( FunctionTests, 2DTable_nodeSharedMemory )
+{
+  FunctionManager * functionManager = &FunctionManager::getInstance();
+
+  writeTableToFile( "sharedTable_x.txt", "0.0, 1.0, 2.0, 4.0\n" );
+  writeTableToFile( "sharedTable_y.txt", "-1.0, 1.0, 3.0\n" );
+  writeTableToFile( "sharedTable_values.txt", "1.0, 2.0, 3.0, 4.0\n5.0, 7.0, 11.0, 13.0\n-1.0, -2.0, -4.0, -8.0\n" );
+
+  // The same table read from files with and without node-shared storage of the values
+  auto const createTable = [&]( string const & name, integer const useNodeSharedMemory ) -> TableFunction &
+  {
+    TableFunction & table = dynamicCast< TableFunction & >( *functionManager->createChild( "TableFunction", name ) );
+    path_array & coordinateFiles = table.getReference< path_array >( TableFunction::viewKeyStruct::coordinateFilesString() );
+    coordinateFiles.resize( 2 );
+    coordinateFiles[0] = "sharedTable_x.txt";
+    coordinateFiles[1] = "sharedTable_y.txt";
+    table.getReference< Path >( TableFunction::viewKeyStruct::voxelFileString() ) = "sharedTable_values.txt";
+    table.getReference< integer >( TableFunction::viewKeyStruct::useNodeSharedMemoryString() ) = useNodeSharedMemory;
+    table.initializeFunction();
+    return table;
+  };
+  TableFunction const & localTable = createTable( "table_local", 0 );
+  TableFunction const & sharedTable = createTable( "table_shared", 1 );
+
+  removeFile( "sharedTable_x.txt" );
+  removeFile( "sharedTable_y.txt" );
+  removeFile( "sharedTable_values.txt" );
+
+  ASSERT_EQ( localTable.getValues().size(), 12 );
+
+  // the objects reading the table values directly reject the node-shared storage
+  EXPECT_NO_THROW( localTable.checkValuesAccessible( "consumer" ) );
+#if !defined(GEOS_USE_DEVICE)
+  EXPECT_THROW( sharedTable.checkValuesAccessible( "consumer" ), InputError );
+#endif
+
+  TableFunction::KernelWrapper const localWrapper = localTable.createKernelWrapper();
+  TableFunction::KernelWrapper const sharedWrapper = sharedTable.createKernelWrapper();
+  for( real64 const x : { -1.0, 0.0, 0.5, 1.7, 3.9, 4.0, 5.0 } )
+  {
+    for( real64 const y : { -2.0, -1.0, 0.3, 2.9, 3.5 } )
+    {
+      real64 const input[2] = { x, y };
+      ASSERT_DOUBLE_EQ( localWrapper.compute( input ), sharedWrapper.compute( input ) );
+      ASSERT_DOUBLE_EQ( localTable.evaluate( input ), sharedTable.evaluate( input ) );
+    }
+  }
+}
+
+
 TEST( FunctionTests, 4DTable_multipleInputs )
 {
   FunctionManager * functionManager = &FunctionManager::getInstance();
@@ -423,6 +647,99 @@ TEST( FunctionTests, 4DTable_multipleInputs )
   }
 }
 
+TEST( FunctionTests, 4DTable_groupEvaluation )
+{
+  FunctionManager * functionManager = &FunctionManager::getInstance();
+
+  // 4D table whose inputs are a scalar field, a two-component field and the time,
+  // with uneven axes and values that are not reproduced exactly by the interpolation
+  localIndex const Ndim = 4;
+  localIndex const Nobj = 2 * TableFunction::batchSize + 41;
+  string const scalarName = "scalarField";
+  string const vectorName = "vectorField";
+  string const timeName = "time";
+
+  array1d< array1d< real64 > > coordinates;
+  coordinates.resize( Ndim );
+  localIndex const axisSizes[Ndim] = { 4, 6, 3, 5 };
+  for( localIndex dim = 0; dim < Ndim; ++dim )
+  {
+    coordinates[dim].resize( axisSizes[dim] );
+    for( localIndex ii = 0; ii < axisSizes[dim]; ++ii )
+    {
+      coordinates[dim][ii] = ii * ( 1.0 + 0.1 * ii ) - 1.0;
+    }
+  }
+
+  array1d< real64 > values( axisSizes[0] * axisSizes[1] * axisSizes[2] * axisSizes[3] );
+  for( localIndex ii = 0; ii < values.size(); ++ii )
+  {
+    values[ii] = std::cos( 0.3 * ii ) + 0.01 * ii;
+  }
+
+  string_array inputVarNames( 3 );
+  inputVarNames[0] = scalarName;
+  inputVarNames[1] = vectorName;
+  inputVarNames[2] = timeName;
+
+  TableFunction & table = dynamicCast< TableFunction & >( *functionManager->createChild( "TableFunction", "table_group" ) );
+  table.setTableCoordinates( coordinates, { units::Dimensionless, units::Dimensionless, units::Dimensionless, units::Dimensionless } );
+  table.setTableValues( values, units::Dimensionless );
+  table.setInputVarNames( inputVarNames );
+
+  conduit::Node node;
+  dataRepository::Group testGroup( "testGroup", node );
+
+  array1d< real64 > scalarField;
+  testGroup.registerWrapper( scalarName, &scalarField ).
+    setSizedFromParent( 1 );
+  array2d< real64 > vectorField;
+  testGroup.registerWrapper( vectorName, &vectorField ).
+    setSizedFromParent( 1 ).
+    reference().resizeDimension< 1 >( 2 );
+  testGroup.resize( Nobj );
+
+  // Random inputs, partly outside of the table
+  std::default_random_engine generator;
+  std::uniform_real_distribution< double > distribution( -2.0, 5.0 );
+  for( localIndex ii = 0; ii < Nobj; ++ii )
+  {
+    scalarField[ii] = distribution( generator );
+    vectorField[ii][0] = distribution( generator );
+    vectorField[ii][1] = distribution( generator );
+  }
+
+  // A set with gaps, so that the set position and the object index differ
+  SortedArray< localIndex > set;
+  for( localIndex ii = 1; ii < Nobj; ii += 1 + ii % 3 )
+  {
+    set.insert( ii );
+  }
+  array1d< real64 > output( set.size() );
+
+  for( TableFunction::InterpolationType const method : { TableFunction::InterpolationType::Linear,
+                                                         TableFunction::InterpolationType::Nearest,
+                                                         TableFunction::InterpolationType::Lower } )
+  {
+    table.setInterpolationMethod( method );
+    table.reInitializeFunction();
+    TableFunction::KernelWrapper const kernelWrapper = table.createKernelWrapper();
+
+    // times inside the table, on a table node and outside of the table
+    for( real64 const time : { 0.37, coordinates[3][2], -3.0, 20.0 } )
+    {
+      table.evaluate( testGroup, time, set.toViewConst(), output.toView() );
+
+      for( localIndex ii = 0; ii < set.size(); ++ii )
+      {
+        localIndex const index = set[ii];
+        real64 const point[Ndim] = { scalarField[index], vectorField[index][0], vectorField[index][1], time };
+        ASSERT_NEAR( kernelWrapper.compute( point ), output[ii], 1e-12 ) << "object " << index << ", time " << time;
+      }
+    }
+  }
+}
+
 TEST( FunctionTests, 4DTable_derivatives )
 {
   FunctionManager * functionManager = &FunctionManager::getInstance();
@@ -690,6 +1007,24 @@ void testMutivariableFunction( MultivariableTableFunction & function,
     for( auto j = 0; j < NUM_DIMS; j++ )
       ASSERT_NEAR( expectedDerivatives[elemOpIndex * NUM_DIMS + j], evaluatedDerivativesView[elemOpIndex][j], derivativesTolerance );
   } );
+
+  // Finally - batched evaluation of values from coordinate columns
+  array2d< real64 > coordinates( NUM_DIMS, numElems );
+  array2d< real64 > batchValues( NUM_OPS, numElems );
+  arrayView2d< real64 > coordinatesView = coordinates.toView();
+  forAll< serialPolicy >( numElems, [=] ( localIndex const elemIndex )
+  {
+    for( auto j = 0; j < NUM_DIMS; j++ )
+      coordinatesView[j][elemIndex] = inputs[elemIndex * NUM_DIMS + j];
+  } );
+
+  kernel.template computeBatch< parallelHostPolicy >( coordinates.toViewConst(), batchValues.toView() );
+
+  arrayView2d< real64 const > batchValuesView = batchValues.toViewConst();
+  forAll< serialPolicy >( numElems * NUM_OPS, [=] ( localIndex const elemOpIndex )
+  {
+    ASSERT_NEAR( expectedValues[elemOpIndex], batchValuesView[elemOpIndex % NUM_OPS][elemOpIndex / NUM_OPS], valuesTolerance );
+  } );
 }
 
 TEST( FunctionTests, 1DMultivariableTable )
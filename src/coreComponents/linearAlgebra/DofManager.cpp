@@ -185,6 +185,33 @@ void fillTrivialPermutation( arrayView1d< localIndex > const permutation )
 
 } // namespace
 
+/**
+ * @brief Contributions of a coupling block to the sparsity pattern.
+ *
+ * Connector contributions couple all the row dofs of a connector (element, face, stencil connection...)
+ * with all its column dofs. They are inserted row by row, through the list of connectors of each local
+ * row, so that every row is filled by a single thread. Diagonal contributions couple the components
+ * of a location with each other; they are inserted location by location, since the rows of a location
+ * are not shared with any other location.
+ */
+struct DofManager::SparsityBlock
+{
+  /// Row dofs of each connector
+  SparsityPattern< globalIndex > connRows;
+
+  /// Column dofs of each connector
+  SparsityPattern< globalIndex > connCols;
+
+  /// First dof of each location receiving diagonal contributions
+  array1d< globalIndex > diagDofs;
+
+  /// Number of components of the locations receiving diagonal contributions
+  integer numComp = 0;
+
+  /// Components whose rows receive diagonal contributions
+  CompMask diagComps;
+};
+
 array1d< localIndex > DofManager::computePermutation( FieldDescription & field )
 {
   localIndex const fieldIndex = getFieldIndex( field.name );
@@ -246,17 +273,9 @@ void DofManager::computePermutation( FieldDescription const & field,
   // step 4: compute the local sparsity pattern for this field
 
   SparsityPattern< globalIndex > pattern;
-  array1d< localIndex > rowSizes( numLocalDofs( field.name ) );
-  // in a first pass, count the row lengths to allocate enough space
-  countRowLengthsOneBlock( rowSizes, fieldIndex, fieldIndex );
-
-  // resize the sparsity pattern now that we know the row sizes
-  pattern.resizeFromRowCapacities< parallelHostPolicy >( numLocalDofs( field.name ),
-                                                         numGlobalDofs( field.name ),
-                                                         rowSizes.data() );
-
-  // compute the sparsity pattern
-  setSparsityPatternOneBlock( pattern.toView(), fieldIndex, fieldIndex );
+  std::vector< SparsityBlock > blocks;
+  addSparsityBlocks( fieldIndex, fieldIndex, blocks );
+  setSparsityPatternFromBlocks( blocks, numLocalDofs( field.name ), numGlobalDofs( field.name ), pattern );
 
   // step 5: call the reordering function
   //         the goal of this step is to fill the permutation array
@@ -824,99 +843,113 @@ void makeConnLocPattern( MeshLevel const & mesh,
   }
 }
 
+/**
+ * @brief Gather the first dof of the locally owned locations of a field, in no particular order.
+ * @tparam LOC type of mesh locations
+ */
+template< FieldLocation LOC >
+void gatherLocationDofs( MeshLevel const & mesh,
+                         string const & key,
+                         std::set< string > const & regions,
+                         array1d< globalIndex > & dofs )
+{
+  using helper = ArrayHelper< globalIndex const, LOC >;
+  typename helper::Accessor dofIndexArray = helper::get( mesh, key );
+
+  dofs.resize( countMeshObjects< LOC, false >( mesh, regions ) );
+  arrayView1d< globalIndex > const dofsView = dofs.toView();
+
+  localIndex numLocations = 0;
+  forMeshLocation< LOC, false, parallelHostPolicy >( mesh, regions, [&]( auto const locIdx )
+  {
+    localIndex const k = RAJA::atomicInc< parallelHostAtomic >( &numLocations );
+    dofsView[k] = helper::value( dofIndexArray, locIdx );
+  } );
+}
+
 } // namespace
 
-void DofManager::setSparsityPatternFromStencil( SparsityPatternView< globalIndex > const & pattern,
-                                                localIndex const fieldIndex ) const
+void DofManager::addSparsityBlocksFromStencil( localIndex const fieldIndex,
+                                               std::vector< SparsityBlock > & blocks ) const
 {
   FieldDescription const & field = m_fields[fieldIndex];
   CouplingDescription const & coupling = m_coupling.at( {fieldIndex, fieldIndex} );
-  localIndex const numComp = field.numComponents;
-  globalIndex const rankDofOffset = rankOffset();
+  GEOS_ASSERT( coupling.connector == Connector::Stencil );
+  GEOS_ASSERT( coupling.stencils != nullptr );
+
+  integer const numComp = field.numComponents;
   CompMask const & globallyCoupledComps = field.globallyCoupledComponents;
+  globalIndex const numGlobalCols = numGlobalDofs();
 
   forMeshSupport( field.support, *m_domain, [&]( MeshBody const &, MeshLevel const & mesh, auto const & regions )
   {
     ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > > const dofNumber =
       mesh.getElemManager().constructArrayViewAccessor< globalIndex, 1 >( field.key );
 
-    array1d< globalIndex > rowDofIndices;
-    array1d< globalIndex > colDofIndices;
-
-    // 1. Assemble diagonal and off-diagonal blocks for elements in stencil
+    // 1. One connector per stencil connection, coupling all the elements of the connection
     coupling.stencils->forAllStencils( mesh, [&]( auto const & stencil )
     {
       using StenciType = typename std::decay< decltype( stencil ) >::type;
-      constexpr localIndex maxNumFluxElems = StenciType::maxNumPointsInFlux;
-      constexpr localIndex maxStencilSize = StenciType::maxStencilSize;
-
       typename StenciType::IndexContainerViewConstType const & seri = stencil.getElementRegionIndices();
       typename StenciType::IndexContainerViewConstType const & sesri = stencil.getElementSubRegionIndices();
       typename StenciType::IndexContainerViewConstType const & sei = stencil.getElementIndices();
 
-      rowDofIndices.reserve( maxNumFluxElems );
-      colDofIndices.reserve( maxStencilSize * numComp );
-
-      forAll< serialPolicy >( stencil.size(), [&]( localIndex const iconn )
+      localIndex const numConnectors = stencil.size();
+      array1d< localIndex > rowCapacities( numConnectors );
+      array1d< localIndex > colCapacities( numConnectors );
+      forAll< parallelHostPolicy >( numConnectors, [&]( localIndex const iconn )
       {
         // This weirdness is because of fracture stencils, which don't have separate
         // getters for num flux elems vs stencil size... it won't work for MPFA though
+        localIndex const stencilSize = stencil.stencilSize( iconn );
+        rowCapacities[iconn] = stencilSize * globallyCoupledComps.size();
+        colCapacities[iconn] = stencilSize * numComp;
+      } );
+
+      blocks.emplace_back();
+      SparsityBlock & block = blocks.back();
+      block.connRows.resizeFromRowCapacities< parallelHostPolicy >( numConnectors, numGlobalCols, rowCapacities.data() );
+      block.connCols.resizeFromRowCapacities< parallelHostPolicy >( numConnectors, numGlobalCols, colCapacities.data() );
+
+      SparsityPatternView< globalIndex > const connRows = block.connRows.toView();
+      SparsityPatternView< globalIndex > const connCols = block.connCols.toView();
+      forAll< parallelHostPolicy >( numConnectors, [&]( localIndex const iconn )
+      {
         localIndex const numFluxElems = stencil.stencilSize( iconn );
         localIndex const stencilSize = numFluxElems;
 
-        rowDofIndices.resize( numFluxElems );
         for( localIndex i = 0; i < numFluxElems; ++i )
         {
-          rowDofIndices[i] = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
-        }
-
-        colDofIndices.resize( stencilSize * numComp );
-        for( localIndex i = 0; i < stencilSize; ++i )
-        {
-          for( localIndex c = 0; c < numComp; ++c )
+          globalIndex const elemDof = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
+          for( integer const c : globallyCoupledComps ) // add a non-zero for globally coupled components only
           {
-            colDofIndices[i * numComp + c] = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )] + c;
+            connRows.insertNonZero( iconn, elemDof + c );
           }
         }
-
-        std::sort( colDofIndices.begin(), colDofIndices.end() );
-
-        for( localIndex i = 0; i < numFluxElems; ++i )
+        for( localIndex i = 0; i < stencilSize; ++i )
         {
-          localIndex const localDofNumber = rowDofIndices[i] - rankDofOffset;
-          if( localDofNumber >= 0 && localDofNumber < pattern.numRows() )
+          globalIndex const elemDof = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
+          for( integer c = 0; c < numComp; ++c )
           {
-            for( integer const c : globallyCoupledComps ) // add a non-zero for globally coupled components only
-            {
-              pattern.insertNonZeros( localDofNumber + c, colDofIndices.begin(), colDofIndices.end() );
-            }
+            connCols.insertNonZero( iconn, elemDof + c );
           }
         }
       } );
     } );
 
-    // 2. Insert diagonal blocks, in case there are elements not included in stencil
+    // 2. Diagonal blocks, in case there are elements not included in stencil
     // (e.g. a single fracture element not connected to any other)
-    auto dofNumberView = dofNumber.toNestedViewConst();
-    colDofIndices.resize( numComp );
-    forMeshLocation< FieldLocation::Elem, false, parallelHostPolicy >( mesh, regions, [=]( auto const & elemIdx )
-    {
-      globalIndex const elemDof = dofNumberView[elemIdx[0]][elemIdx[1]][elemIdx[2]];
-      for( localIndex c = 0; c < numComp; ++c )
-      {
-        colDofIndices[c] = elemDof + c;
-      }
-      for( localIndex c = 0; c < numComp; ++c )
-      {
-        pattern.insertNonZeros( elemDof - rankDofOffset + c, colDofIndices.begin(), colDofIndices.end() );
-      }
-    } );
+    blocks.emplace_back();
+    SparsityBlock & block = blocks.back();
+    block.numComp = numComp;
+    block.diagComps = CompMask( numComp, true );
+    gatherLocationDofs< FieldLocation::Elem >( mesh, field.key, regions, block.diagDofs );
   } );
 }
 
-void DofManager::setSparsityPatternOneBlock( SparsityPatternView< globalIndex > const & pattern,
-                                             localIndex const rowFieldIndex,
-                                             localIndex const colFieldIndex ) const
+void DofManager::addSparsityBlocks( localIndex const rowFieldIndex,
+                                    localIndex const colFieldIndex,
+                                    std::vector< SparsityBlock > & blocks ) const
 {
   GEOS_ASSERT( rowFieldIndex >= 0 );
   GEOS_ASSERT( colFieldIndex >= 0 );
@@ -933,13 +966,14 @@ void DofManager::setSparsityPatternOneBlock( SparsityPatternView< globalIndex >
   // Special treatment for stencil-based sparsity
   if( rowFieldIndex == colFieldIndex && coupling.connector == Connector::Stencil )
   {
-    setSparsityPatternFromStencil( pattern, rowFieldIndex );
+    addSparsityBlocksFromStencil( rowFieldIndex, blocks );
     return;
   }
 
   forMeshSupport( coupling.support, *m_domain, [&]( MeshBody const &, MeshLevel const & mesh, auto const & regions )
   {
-    SparsityPattern< globalIndex > connLocRow( 0, 0, 0 ), connLocCol( 0, 0, 0 );
+    blocks.emplace_back();
+    SparsityBlock & block = blocks.back();
 
     LocationSwitch( rowField.location, static_cast< FieldLocation >( coupling.connector ),
                     [&]( auto const locType, auto const connType )
@@ -953,7 +987,7 @@ void DofManager::setSparsityPatternOneBlock( SparsityPatternView< globalIndex >
                                        rowField.globallyCoupledComponents, // select only globally coupled components
                                        rowField.numGlobalDof,
                                        regions,
-                                       connLocRow );
+                                       block.connRows );
     } );
 
     // we create a temporary mask including all components
@@ -964,7 +998,7 @@ void DofManager::setSparsityPatternOneBlock( SparsityPatternView< globalIndex >
 
     if( colFieldIndex == rowFieldIndex && areAllComponentsCoupled )
     {
-      connLocCol = connLocRow; // TODO avoid copying
+      block.connCols = block.connRows; // TODO avoid copying
     }
     else
     {
@@ -985,283 +1019,158 @@ void DofManager::setSparsityPatternOneBlock( SparsityPatternView< globalIndex >
                                          allComponentsMask, // select all components
                                          colField.numGlobalDof,
                                          regions,
-                                         connLocCol );
+                                         block.connCols );
       } );
     }
-    GEOS_ASSERT_EQ( connLocRow.numRows(), connLocCol.numRows() );
-
-    // First, we perform assembly/multiply patterns (at this step, locally coupled equations are excluded by construction)
-    globalIndex const globalDofOffset = rankOffset();
-    forAll< serialPolicy >( connLocRow.numRows(), [&]( localIndex const irow )
-    {
-      arraySlice1d< globalIndex const > const dofIndicesRow = connLocRow.getColumns( irow );
-      arraySlice1d< globalIndex const > const dofIndicesCol = connLocCol.getColumns( irow );
-      for( globalIndex const globalRow : dofIndicesRow )
-      {
-        localIndex const localRow = globalRow - globalDofOffset;
-        if( localRow >= 0 && localRow < pattern.numRows() )
-        {
-          pattern.insertNonZeros( localRow, dofIndicesCol.begin(), dofIndicesCol.end() );
-        }
-      }
-    } );
+    GEOS_ASSERT_EQ( block.connRows.numRows(), block.connCols.numRows() );
 
     // Finally, we add the diagonal terms of the locally coupled equations to the sparsity pattern
     // Note: this is only needed if some components in the row field are not globally coupled,
-    // because the diagonal terms of the locally coupled components have not been added at the previous step
+    // because the diagonal terms of the locally coupled components are not covered by the connectors
     if( rowFieldIndex == colFieldIndex && !areAllComponentsCoupled )
     {
+      block.numComp = rowField.numComponents;
+      block.diagComps = rowField.globallyCoupledComponents;
+      block.diagComps.invert();
+
       LocationSwitch( rowField.location, [&]( auto const loc )
       {
         FieldLocation constexpr LOC = decltype(loc)::value;
-        using ArrayHelper = ArrayHelper< globalIndex const, LOC >;
-
-        typename ArrayHelper::Accessor dofIndexArray = ArrayHelper::get( mesh, rowField.key );
-
-        CompMask locallyCoupledComponents = rowField.globallyCoupledComponents;
-        locallyCoupledComponents.invert();
-
-        array1d< globalIndex > colDofIndices( rowField.numComponents );
-        globalIndex const rankDofOffset = rankOffset();
-        forMeshLocation< LOC, false, serialPolicy >( mesh, regions, [&]( auto const locIdx )
-        {
-          globalIndex const dofNumber = ArrayHelper::value( dofIndexArray, locIdx );
-          for( localIndex c = 0; c < rowField.numComponents; ++c )
-          {
-            colDofIndices[c] = dofNumber + c;
-          }
-          // add a non-zero for locally coupled components since diagonal terms for globally coupled components have been added already
-          for( integer const c : locallyCoupledComponents )
-          {
-            pattern.insertNonZeros( dofNumber - rankDofOffset + c, colDofIndices.begin(), colDofIndices.end() );
-          }
-        } );
+        gatherLocationDofs< LOC >( mesh, rowField.key, regions, block.diagDofs );
       } );
     }
   } );
 }
 
-void DofManager::countRowLengthsFromStencil( arrayView1d< localIndex > const & rowLengths,
-                                             localIndex const fieldIndex ) const
+void DofManager::setSparsityPatternFromBlocks( std::vector< SparsityBlock > const & blocks,
+                                               localIndex const numLocalRows,
+                                               globalIndex const numGlobalCols,
+                                               SparsityPattern< globalIndex > & pattern ) const
 {
-  FieldDescription const & field = m_fields[fieldIndex];
-  CouplingDescription const & coupling = m_coupling.at( {fieldIndex, fieldIndex} );
-  GEOS_ASSERT( coupling.connector == Connector::Stencil );
-  GEOS_ASSERT( coupling.stencils != nullptr );
-
-  localIndex const numComp = field.numComponents;
   globalIndex const rankDofOffset = rankOffset();
-  CompMask const & globallyCoupledComps = field.globallyCoupledComponents;
+  localIndex const numBlocks = LvArray::integerConversion< localIndex >( blocks.size() );
 
-  forMeshSupport( field.support, *m_domain, [&]( MeshBody const &, MeshLevel const & mesh, auto const & regions )
+  // Connectors of all blocks are numbered consecutively
+  array1d< localIndex > blockOffsets( numBlocks + 1 );
+  for( localIndex b = 0; b < numBlocks; ++b )
   {
-    ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > > const dofNumberAccessor =
-      mesh.getElemManager().constructArrayViewAccessor< globalIndex, 1 >( field.key );
+    blockOffsets[b + 1] = blockOffsets[b] + blocks[b].connRows.numRows();
+  }
 
-    // 1. Count row contributions from stencil
-    coupling.stencils->forAllStencils( mesh, [&]( auto const & stencil )
+  // Step 1. Count the connectors adjacent to each local row, and estimate the row lengths
+  array1d< localIndex > rowLengths( numLocalRows );
+  array1d< localIndex > rowNumConnectors( numLocalRows );
+  for( SparsityBlock const & block : blocks )
+  {
+    forAll< parallelHostPolicy >( block.connRows.numRows(), [&]( localIndex const iconn )
     {
-      using StenciType = typename std::decay< decltype( stencil ) >::type;
-      typename StenciType::IndexContainerViewConstType const & seri = stencil.getElementRegionIndices();
-      typename StenciType::IndexContainerViewConstType const & sesri = stencil.getElementSubRegionIndices();
-      typename StenciType::IndexContainerViewConstType const & sei = stencil.getElementIndices();
-
-      forAll< parallelHostPolicy >( stencil.size(), [&]( localIndex const iconn )
+      localIndex const numCols = block.connCols.numNonZeros( iconn );
+      for( globalIndex const globalRow : block.connRows.getColumns( iconn ) )
       {
-        // This weirdness is because of fracture stencils, which don't have separate
-        // getters for num flux elems vs stencil size... it won't work for MPFA though
-        localIndex const stencilSize = stencil.stencilSize( iconn );
-        localIndex const numFluxElems = stencilSize;
-
-        for( localIndex i = 0; i < numFluxElems; ++i )
+        localIndex const localRow = globalRow - rankDofOffset;
+        if( localRow >= 0 && localRow < numLocalRows )
         {
-          localIndex const localDofNumber = dofNumberAccessor[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )] - rankDofOffset;
-          if( localDofNumber >= 0 && localDofNumber < rowLengths.size() )
-          {
-            for( integer const c : globallyCoupledComps ) // add a non-zero for globally coupled components only
-            {
-              RAJA::atomicAdd( parallelHostAtomic{}, &rowLengths[localDofNumber + c], ( stencilSize - 1 ) * numComp );
-            }
-          }
+          RAJA::atomicInc< parallelHostAtomic >( &rowNumConnectors[localRow] );
+          RAJA::atomicAdd( parallelHostAtomic{}, &rowLengths[localRow], numCols );
         }
-      } );
+      }
     } );
 
-    // 2. Add diagonal contributions to account for elements not in stencil
-    mesh.getElemManager().forElementSubRegions( regions, [&]( localIndex const, ElementSubRegionBase const & subRegion )
+    forAll< parallelHostPolicy >( block.diagDofs.size(), [&]( localIndex const k )
     {
-      arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
-      arrayView1d< globalIndex const > const dofNumber = subRegion.getReference< array1d< globalIndex > >( field.key );
-      forAll< parallelHostPolicy >( subRegion.size(), [&]( localIndex const ei )
+      localIndex const localDof = block.diagDofs[k] - rankDofOffset;
+      if( localDof >= 0 && localDof < numLocalRows )
       {
-        if( ghostRank[ei] < 0 )
+        for( integer const c : block.diagComps )
         {
-          localIndex const localDofNumber = dofNumber[ei] - rankDofOffset;
-          for( localIndex c = 0; c < numComp; ++c )
-          {
-            rowLengths[localDofNumber + c] += numComp;
-          }
+          RAJA::atomicAdd( parallelHostAtomic{}, &rowLengths[localDof + c], block.numComp );
         }
-      } );
+      }
     } );
-  } );
-}
-
-void DofManager::countRowLengthsOneBlock( arrayView1d< localIndex > const & rowLengths,
-                                          localIndex const rowFieldIndex,
-                                          localIndex const colFieldIndex ) const
-{
-  GEOS_ASSERT( rowFieldIndex >= 0 );
-  GEOS_ASSERT( colFieldIndex >= 0 );
-
-  FieldDescription const & rowField = m_fields[rowFieldIndex];
-  FieldDescription const & colField = m_fields[colFieldIndex];
-
-  if( m_coupling.count( {rowFieldIndex, colFieldIndex} ) == 0 )
-  {
-    return;
-  }
-  CouplingDescription const & coupling = m_coupling.at( {rowFieldIndex, colFieldIndex} );
-
-  if( rowFieldIndex == colFieldIndex && coupling.connector == Connector::Stencil )
-  {
-    countRowLengthsFromStencil( rowLengths, rowFieldIndex );
-    return;
   }
 
-  forMeshSupport( coupling.support, *m_domain, [&]( MeshBody const &, MeshLevel const & mesh, auto const & regions )
+  // Step 2. Invert the connector-to-row maps of all blocks
+  ArrayOfArrays< localIndex > rowConnectors;
+  rowConnectors.resizeFromCapacities< parallelHostPolicy >( numLocalRows, rowNumConnectors.data() );
+  ArrayOfArraysView< localIndex > const rowConnectorsView = rowConnectors.toView();
+  for( localIndex b = 0; b < numBlocks; ++b )
   {
-    SparsityPattern< globalIndex > connLocRow( 0, 0, 0 ), connLocCol( 0, 0, 0 );
-
-    LocationSwitch( rowField.location, static_cast< FieldLocation >( coupling.connector ),
-                    [&]( auto const locType, auto const connType )
+    SparsityBlock const & block = blocks[b];
+    localIndex const blockOffset = blockOffsets[b];
+    forAll< parallelHostPolicy >( block.connRows.numRows(), [&]( localIndex const iconn )
     {
-      FieldLocation constexpr LOC  = decltype(locType)::value;
-      FieldLocation constexpr CONN = decltype(connType)::value;
-
-      makeConnLocPattern< LOC, CONN >( mesh,
-                                       rowField.key,
-                                       rowField.numComponents,
-                                       rowField.globallyCoupledComponents, // select only globally coupled components
-                                       rowField.numGlobalDof,
-                                       regions,
-                                       connLocRow );
+      for( globalIndex const globalRow : block.connRows.getColumns( iconn ) )
+      {
+        localIndex const localRow = globalRow - rankDofOffset;
+        if( localRow >= 0 && localRow < numLocalRows )
+        {
+          rowConnectorsView.emplaceBackAtomic< parallelHostAtomic >( localRow, blockOffset + iconn );
+        }
+      }
     } );
+  }
 
-    // we create a temporary mask including all components
-    // if the colFieldIndex is equal to the rowFieldIndex and all components are in the mask,
-    // we don't need to recomponent the connLocPattern
-    CompMask const allComponentsMask( colField.numComponents, true );
-    bool const areAllComponentsCoupled = colField.globallyCoupledComponents.begin() == allComponentsMask.begin();
+  // Step 3. Allocate enough capacity for all nonzero entries in each row
+  pattern.resizeFromRowCapacities< parallelHostPolicy >( numLocalRows, numGlobalCols, rowLengths.data() );
+  SparsityPatternView< globalIndex > const patternView = pattern.toView();
 
-    if( colFieldIndex == rowFieldIndex && areAllComponentsCoupled )
-    {
-      connLocCol = connLocRow;
-    }
-    else
+  // Step 4. Fill the connector contributions of all blocks row by row, so that each row is only written by one thread
+  forAll< parallelHostPolicy >( numLocalRows, [&]( localIndex const localRow )
+  {
+    for( localIndex const connIndex : rowConnectorsView[localRow] )
     {
-      LocationSwitch( colField.location, static_cast< FieldLocation >( coupling.connector ),
-                      [&]( auto const locType, auto const connType )
-      {
-        FieldLocation constexpr LOC = decltype(locType)::value;
-        FieldLocation constexpr CONN = decltype(connType)::value;
-
-        // note that below we activate all components using allComponentsMask and not colField.globallyCoupledComponents
-        // for the following reasons:
-        // - we want the **equation** in LOC to be decoupled from its neighbors (think volume balance constraint)
-        // - however, we want the corresponding dof to always be coupled (think last component density)
-
-        makeConnLocPattern< LOC, CONN >( mesh,
-                                         colField.key,
-                                         colField.numComponents,
-                                         allComponentsMask, // select all components
-                                         colField.numGlobalDof,
-                                         regions,
-                                         connLocCol );
-      } );
+      localIndex const b = LvArray::sortedArrayManipulation::find( blockOffsets.data() + 1, numBlocks, connIndex + 1 );
+      arraySlice1d< globalIndex const > const cols = blocks[b].connCols.getColumns( connIndex - blockOffsets[b] );
+      patternView.insertNonZeros( localRow, cols.begin(), cols.end() );
     }
+  } );
 
-    GEOS_ASSERT_EQ( connLocRow.numRows(), connLocCol.numRows() );
-
-    // Estimate an upper bound on row length by adding adjacent entries on a connector
-    globalIndex const rankDofOffset = rankOffset();
-    forAll< parallelHostPolicy >( connLocRow.numRows(), [&]( localIndex const iconn )
+  // Step 5. Fill the diagonal contributions location by location (locations do not share rows)
+  for( SparsityBlock const & block : blocks )
+  {
+    integer const numComp = block.numComp;
+    forAll< parallelHostPolicy >( block.diagDofs.size(), [&]( localIndex const k )
     {
-      arraySlice1d< globalIndex const > const dofIndicesRow = connLocRow.getColumns( iconn );
-      for( globalIndex const globalRow : dofIndicesRow )
+      globalIndex const dofNumber = block.diagDofs[k];
+      localIndex const localDof = dofNumber - rankDofOffset;
+      if( localDof >= 0 && localDof < numLocalRows )
       {
-        localIndex const localRow = globalRow - rankDofOffset;
-        if( localRow >= 0 && localRow < rowLengths.size() )
+        globalIndex colDofIndices[MAX_COMP];
+        for( integer c = 0; c < numComp; ++c )
         {
-          RAJA::atomicAdd( parallelHostAtomic{}, &rowLengths[localRow], connLocCol.numNonZeros( iconn ) );
+          colDofIndices[c] = dofNumber + c;
+        }
+        for( integer const c : block.diagComps )
+        {
+          patternView.insertNonZeros( localDof + c, colDofIndices, colDofIndices + numComp );
         }
       }
     } );
-
-    // Finally, we add the diagonal terms of the locally coupled equations to the sparsity pattern
-    // Note: this is only needed if some components in the row field are not globally coupled,
-    // because the diagonal terms of the locally coupled components have not been added at the previous step
-    if( rowFieldIndex == colFieldIndex && rowField.globallyCoupledComponents.begin() != allComponentsMask.begin() )
-    {
-      LocationSwitch( rowField.location, [&]( auto const loc )
-      {
-        FieldLocation constexpr LOC = decltype(loc)::value;
-        using ArrayHelper = ArrayHelper< globalIndex const, LOC >;
-
-        typename ArrayHelper::Accessor dofIndexArray = ArrayHelper::get( mesh, rowField.key );
-
-        CompMask locallyCoupledComponents = rowField.globallyCoupledComponents;
-        locallyCoupledComponents.invert();
-
-        forMeshLocation< LOC, false, serialPolicy >( mesh, regions, [&]( auto const locIdx )
-        {
-          globalIndex const dofNumber = ArrayHelper::value( dofIndexArray, locIdx );
-          localIndex const localDofNumber = dofNumber - rankDofOffset;
-          if( localDofNumber >= 0 && localDofNumber < rowLengths.size() )
-          {
-            // add a non-zero for locally coupled components since diagonal terms for globally coupled components have been added already
-            for( integer const c : locallyCoupledComponents )
-            {
-              RAJA::atomicAdd( parallelHostAtomic{}, &rowLengths[localDofNumber + c], rowField.numComponents );
-            }
-          }
-        } );
-      } );
-    }
-  } );
+  }
 }
 
 // Create the sparsity pattern (location-location). Low level interface
 void DofManager::setSparsityPattern( SparsityPattern< globalIndex > & pattern ) const
 {
+  GEOS_MARK_FUNCTION;
   GEOS_ERROR_IF( !m_reordered, "Cannot set monolithic sparsity pattern before reorderByRank() has been called." );
 
-  localIndex const numLocalRows = numLocalDofs();
   localIndex const numFields = LvArray::integerConversion< localIndex >( m_fields.size() );
 
-  // Step 1. Do a dry run of sparsity construction to get the total number of nonzeros in each row
-  array1d< localIndex > rowSizes( numLocalRows );
+  // Step 1. Collect the connector-to-dof patterns of all coupling blocks
+  std::vector< SparsityBlock > blocks;
   for( localIndex blockRow = 0; blockRow < numFields; ++blockRow )
   {
     for( localIndex blockCol = 0; blockCol < numFields; ++blockCol )
     {
-      countRowLengthsOneBlock( rowSizes, blockRow, blockCol );
+      addSparsityBlocks( blockRow, blockCol, blocks );
     }
   }
 
-  // Step 2. Allocate enough capacity for all nonzero entries in each row
-  pattern.resizeFromRowCapacities< parallelHostPolicy >( numLocalRows, numGlobalDofs(), rowSizes.data() );
-
-  // Step 3. Fill the sparsity block-by-block
-  for( localIndex blockRow = 0; blockRow < numFields; ++blockRow )
-  {
-    for( localIndex blockCol = 0; blockCol < numFields; ++blockCol )
-    {
-      setSparsityPatternOneBlock( pattern.toView(), blockRow, blockCol );
-    }
-  }
+  // Step 2. Count and fill all the blocks at once
+  setSparsityPatternFromBlocks( blocks, numLocalDofs(), numGlobalDofs(), pattern );
 
-  // Step 4. Compress to remove unused space between rows
+  // Step 3. Compress to remove unused space between rows
   pattern.compress();
 }
 
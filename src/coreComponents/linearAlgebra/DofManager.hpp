@@ -566,33 +566,40 @@ private:
                            arrayView1d< localIndex > const permutation );
 
 
+  /// Contributions of a coupling block to the sparsity pattern
+  struct SparsityBlock;
+
   /**
-   * @brief Calculate or estimate the number of nonzero entries in each local row
-   * @param rowLengths array of row lengths (values are be incremented, not overwritten)
+   * @brief Collect the contributions of a coupling block between given fields.
    * @param rowFieldIndex index of row field (must be non-negative)
    * @param colFieldIndex index of col field (must be non-negative)
+   * @param blocks the list of blocks to append to
    */
-  void countRowLengthsOneBlock( arrayView1d< localIndex > const & rowLengths,
-                                localIndex rowFieldIndex,
-                                localIndex colFieldIndex ) const;
+  void addSparsityBlocks( localIndex rowFieldIndex,
+                          localIndex colFieldIndex,
+                          std::vector< SparsityBlock > & blocks ) const;
 
-  void countRowLengthsFromStencil( arrayView1d< localIndex > const & rowLengths,
-                                   localIndex fieldIndex ) const;
+  /**
+   * @brief Collect the contributions of a stencil-based diagonal coupling block.
+   * @param fieldIndex index of the field (must be non-negative)
+   * @param blocks the list of blocks to append to
+   */
+  void addSparsityBlocksFromStencil( localIndex fieldIndex,
+                                     std::vector< SparsityBlock > & blocks ) const;
 
   /**
-   * @brief Populate the sparsity pattern for a coupling block between given fields.
-   * @param pattern the sparsity to be filled
-   * @param rowFieldIndex index of row field (must be non-negative)
-   * @param colFieldIndex index of col field (must be non-negative)
+   * @brief Size and fill a sparsity pattern from the contributions of coupling blocks.
+   * @param blocks the coupling blocks
+   * @param numLocalRows number of local rows of the pattern
+   * @param numGlobalCols number of global columns of the pattern
+   * @param pattern the sparsity pattern to be filled (not compressed)
    *
-   * This private function is used as a building block by higher-level SetSparsityPattern()
+   * Row lengths are counted in a first pass, then all rows are filled in parallel in a second pass.
    */
-  void setSparsityPatternOneBlock( SparsityPatternView< globalIndex > const & pattern,
-                                   localIndex rowFieldIndex,
-                                   localIndex colFieldIndex ) const;
-
-  void setSparsityPatternFromStencil( SparsityPatternView< globalIndex > const & pattern,
-                                      localIndex fieldIndex ) const;
+  void setSparsityPatternFromBlocks( std::vector< SparsityBlock > const & blocks,
+                                     localIndex numLocalRows,
+                                     globalIndex numGlobalCols,
+                                     SparsityPattern< globalIndex > & pattern ) const;
 
   template< int DIMS_PER_DOF >
   void setFiniteElementSparsityPattern( SparsityPattern< globalIndex > & pattern,
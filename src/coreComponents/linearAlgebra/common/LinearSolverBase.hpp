@@ -68,6 +68,41 @@ public:
     return m_params;
   }
 
+  /**
+   * @brief Update the relative tolerance of the Krylov method.
+   * @param relTolerance the new relative tolerance
+   *
+   * This allows reusing the same solver object across nonlinear iterations when
+   * an adaptive (inexact Newton) tolerance is used. The new value is taken into
+   * account in the next call to setup().
+   */
+  void setKrylovRelTolerance( real64 const relTolerance )
+  {
+    m_params.krylov.relTolerance = relTolerance;
+  }
+
+  /**
+   * @brief Request that the next call to setup() keeps the previously computed preconditioner.
+   * @param reuse whether the preconditioner should be reused
+   *
+   * When reuse is requested, setup() only associates the solver with the new matrix, which must
+   * have the same size and parallel distribution as the one used to compute the preconditioner.
+   * The request is ignored if no preconditioner has been computed yet, or if the implementation
+   * does not support reuse (see supportsPreconditionerReuse()).
+   */
+  void setPreconditionerReuse( bool const reuse )
+  {
+    m_reusePreconditioner = reuse;
+  }
+
+  /**
+   * @brief @return whether the implementation is able to reuse a previously computed preconditioner.
+   */
+  virtual bool supportsPreconditionerReuse() const
+  {
+    return false;
+  }
+
   /**
    * @brief @return result of the most recent solve.
    */
@@ -83,6 +118,9 @@ protected:
 
   /// Result of most recent solve (status, timings)
   mutable LinearSolverResult m_result;
+
+  /// Flag indicating whether the next setup should keep the existing preconditioner
+  bool m_reusePreconditioner = false;
 };
 
 }
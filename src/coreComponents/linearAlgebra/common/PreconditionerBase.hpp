@@ -57,6 +57,19 @@ public:
     m_mat = &mat;
   }
 
+  /**
+   * @brief Associate the preconditioner with a new matrix, keeping the previously computed setup if possible.
+   * @param mat the matrix to precondition
+   *
+   * The matrix must have the same size and parallel distribution as the one used in the last setup().
+   * The default implementation recomputes the preconditioner; derived classes that can be applied
+   * to a slowly varying matrix without a new setup should override this method.
+   */
+  virtual void reuse( Matrix const & mat )
+  {
+    setup( mat );
+  }
+
   /**
    * @brief Clean up the preconditioner setup.
    *
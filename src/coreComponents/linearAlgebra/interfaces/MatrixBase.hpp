@@ -272,6 +272,34 @@ protected:
     close();
   }
 
+  /**
+   * @brief Refresh the values of a matrix previously created from a local CRS matrix.
+   * @param localMatrix The input local matrix.
+   *
+   * Unlike create(), this does not rebuild the parallel data structures (row/column maps,
+   * communication pattern, etc.), but only overwrites the values of existing entries.
+   *
+   * @note The sparsity pattern of @p localMatrix must be identical to the one used
+   *       in the last call to create(). This is not checked for performance reasons.
+   * @note Copies values, so that @p localMatrix does not need to retain its values after the call.
+   */
+  virtual void updateValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix )
+  {
+    GEOS_LAI_ASSERT( ready() );
+    GEOS_LAI_ASSERT_EQ( localMatrix.numRows(), numLocalRows() );
+
+    localMatrix.move( hostMemorySpace, false );
+
+    globalIndex const rankOffset = ilower();
+
+    open();
+    for( localIndex localRow = 0; localRow < localMatrix.numRows(); ++localRow )
+    {
+      set( localRow + rankOffset, localMatrix.getColumns( localRow ), localMatrix.getEntries( localRow ) );
+    }
+    close();
+  }
+
   ///@}
 
   /**
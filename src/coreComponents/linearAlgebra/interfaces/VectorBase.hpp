@@ -215,6 +215,30 @@ protected:
    */
   virtual real64 dot( Vector const & vec ) const = 0;
 
+  /**
+   * @brief Local (rank-wise) contribution to the dot product with the vector vec.
+   * @param vec vector to dot-product with
+   * @return dot product of the locally owned parts of the two vectors
+   *
+   * No global reduction is performed, which allows callers to fuse several
+   * reductions into a single call to MpiWrapper::allReduce().
+   */
+  virtual real64 localDot( Vector const & vec ) const
+  {
+    GEOS_LAI_ASSERT( ready() );
+    GEOS_LAI_ASSERT( vec.ready() );
+    GEOS_LAI_ASSERT_EQ( localSize(), vec.localSize() );
+
+    arrayView1d< real64 const > const x = values();
+    arrayView1d< real64 const > const y = vec.values();
+    RAJA::ReduceSum< parallelHostReduce, real64 > result( 0.0 );
+    forAll< parallelHostPolicy >( localSize(), [result, x, y] ( localIndex const i )
+    {
+      result += x[i] * y[i];
+    } );
+    return result.get();
+  }
+
   /**
    * @brief Update vector <tt>y</tt> as <tt>y</tt> = <tt>x</tt>.
    * @param x vector to copy
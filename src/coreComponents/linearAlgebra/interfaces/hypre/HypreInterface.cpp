@@ -24,6 +24,8 @@
 #include "linearAlgebra/interfaces/hypre/HyprePreconditioner.hpp"
 #include "linearAlgebra/interfaces/hypre/HypreSolver.hpp"
 #include "linearAlgebra/interfaces/hypre/HypreUtils.hpp"
+#include "linearAlgebra/solvers/PreconditionerBlockILU.hpp"
+#include "linearAlgebra/solvers/PreconditionerBlockJacobi.hpp"
 
 #if defined(GEOS_USE_SUPERLU_DIST)
 #include "linearAlgebra/interfaces/direct/SuperLUDist.hpp"
@@ -104,6 +106,24 @@ HypreInterface::createSolver( LinearSolverParameters params )
 std::unique_ptr< PreconditionerBase< HypreInterface > >
 geos::HypreInterface::createPreconditioner( LinearSolverParameters params )
 {
+  if( params.preconditionerType == LinearSolverParameters::PreconditionerType::blockIlu )
+  {
+    // The block ILU(k) is implemented natively, in double or single precision
+    if( params.preconditionerPrecision == LinearSolverParameters::Precision::fp32 )
+    {
+      return std::make_unique< PreconditionerBlockILU< HypreInterface, float > >( params.dofsPerNode, params.ifact.fill );
+    }
+    return std::make_unique< PreconditionerBlockILU< HypreInterface > >( params.dofsPerNode, params.ifact.fill );
+  }
+  if( params.preconditionerPrecision == LinearSolverParameters::Precision::fp32 )
+  {
+    // Single precision preconditioning is implemented natively
+    if( params.preconditionerType == LinearSolverParameters::PreconditionerType::iluk )
+    {
+      return std::make_unique< PreconditionerBlockILU< HypreInterface, float > >( params.dofsPerNode, params.ifact.fill );
+    }
+    return std::make_unique< PreconditionerBlockJacobi< HypreInterface > >( params.dofsPerNode, params.preconditionerPrecision );
+  }
   return std::make_unique< HyprePreconditioner >( std::move( params ) );
 }
 
@@ -58,6 +58,60 @@ static void initialize( MPI_Comm const & comm,
   GEOS_LAI_CHECK_ERROR( HYPRE_IJMatrixInitialize( ij_matrix ) );
 }
 
+// Helper function that inserts the rows of a local CSR matrix into an open IJMatrix,
+// either adding to the existing entries or overwriting them.
+static void insertLocalRows( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                             globalIndex const rankOffset,
+                             bool const overwrite,
+                             HYPRE_IJMatrix const & ij_matrix )
+{
+  array1d< HYPRE_BigInt > rows;
+  rows.resizeWithoutInitializationOrDestruction( hypre::memorySpace, localMatrix.numRows() );
+
+  array1d< HYPRE_Int > sizes;
+  sizes.resizeWithoutInitializationOrDestruction( hypre::memorySpace, localMatrix.numRows() );
+
+  array1d< HYPRE_Int > offsets;
+  offsets.resizeWithoutInitializationOrDestruction( hypre::memorySpace, localMatrix.numRows() );
+
+  forAll< hypre::execPolicy >( localMatrix.numRows(),
+                               [localMatrix, rankOffset,
+                                rowsView = rows.toView(),
+                                sizesView = sizes.toView(),
+                                offsetsView = offsets.toView()] GEOS_HYPRE_DEVICE ( localIndex const row )
+  {
+    rowsView[row] = LvArray::integerConversion< HYPRE_BigInt >( row + rankOffset );
+    sizesView[row] = LvArray::integerConversion< HYPRE_Int >( localMatrix.numNonZeros( row ) );
+    offsetsView[row] = LvArray::integerConversion< HYPRE_Int >( localMatrix.getOffsets()[row] );
+  } );
+
+  // This is necessary so that localMatrix.getColumns() and localMatrix.getEntries() return device pointers
+  localMatrix.move( hypre::memorySpace, false );
+
+  if( overwrite )
+  {
+    GEOS_HYPRE_CHECK_DEVICE_ERRORS( "before HYPRE_IJMatrixSetValues2" );
+    GEOS_LAI_CHECK_ERROR( HYPRE_IJMatrixSetValues2( ij_matrix,
+                                                    localMatrix.numRows(),
+                                                    sizes.data(),
+                                                    rows.data(),
+                                                    offsets.data(),
+                                                    localMatrix.getColumns(),
+                                                    localMatrix.getEntries() ) );
+  }
+  else
+  {
+    GEOS_HYPRE_CHECK_DEVICE_ERRORS( "before HYPRE_IJMatrixAddToValues2" );
+    GEOS_LAI_CHECK_ERROR( HYPRE_IJMatrixAddToValues2( ij_matrix,
+                                                      localMatrix.numRows(),
+                                                      sizes.data(),
+                                                      rows.data(),
+                                                      offsets.data(),
+                                                      localMatrix.getColumns(),
+                                                      localMatrix.getEntries() ) );
+  }
+}
+
 HypreMatrix::HypreMatrix()
   : LinearOperator(),
   MatrixBase()
@@ -161,40 +215,23 @@ void HypreMatrix::create( CRSMatrixView< real64 const, globalIndex const > const
   } );
 
   createWithLocalSize( localMatrix.numRows(), numLocalColumns, maxRowEntries.get(), comm );
-  globalIndex const rankOffset = ilower();
-
-  array1d< HYPRE_BigInt > rows;
-  rows.resizeWithoutInitializationOrDestruction( hypre::memorySpace, localMatrix.numRows() );
 
-  array1d< HYPRE_Int > sizes;
-  sizes.resizeWithoutInitializationOrDestruction( hypre::memorySpace, localMatrix.numRows() );
-
-  array1d< HYPRE_Int > offsets;
-  offsets.resizeWithoutInitializationOrDestruction( hypre::memorySpace, localMatrix.numRows() );
+  open();
+  insertLocalRows( localMatrix, ilower(), false, m_ij_mat );
+  close();
+}
 
-  forAll< hypre::execPolicy >( localMatrix.numRows(),
-                               [localMatrix, rankOffset,
-                                rowsView = rows.toView(),
-                                sizesView = sizes.toView(),
-                                offsetsView = offsets.toView()] GEOS_HYPRE_DEVICE ( localIndex const row )
-  {
-    rowsView[row] = LvArray::integerConversion< HYPRE_BigInt >( row + rankOffset );
-    sizesView[row] = LvArray::integerConversion< HYPRE_Int >( localMatrix.numNonZeros( row ) );
-    offsetsView[row] = LvArray::integerConversion< HYPRE_Int >( localMatrix.getOffsets()[row] );
-  } );
+void HypreMatrix::updateValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix )
+{
+  GEOS_MARK_FUNCTION;
 
-  // This is necessary so that localMatrix.getColumns() and localMatrix.getEntries() return device pointers
-  localMatrix.move( hypre::memorySpace, false );
+  GEOS_LAI_ASSERT( ready() );
+  GEOS_LAI_ASSERT_EQ( localMatrix.numRows(), numLocalRows() );
 
+  // The matrix is already assembled, so this only overwrites existing entries of the ParCSR
+  // object without rebuilding column maps and the communication package.
   open();
-  GEOS_HYPRE_CHECK_DEVICE_ERRORS( "before HYPRE_IJMatrixAddToValues2" );
-  GEOS_LAI_CHECK_ERROR( HYPRE_IJMatrixAddToValues2( m_ij_mat,
-                                                    localMatrix.numRows(),
-                                                    sizes.data(),
-                                                    rows.data(),
-                                                    offsets.data(),
-                                                    localMatrix.getColumns(),
-                                                    localMatrix.getEntries() ) );
+  insertLocalRows( localMatrix, ilower(), true, m_ij_mat );
   close();
 }
 
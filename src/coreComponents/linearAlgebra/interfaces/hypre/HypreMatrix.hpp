@@ -134,6 +134,8 @@ public:
                        localIndex const numLocalColumns,
                        MPI_Comm const & comm ) override;
 
+  virtual void updateValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix ) override;
+
   virtual void createWithLocalSize( localIndex const localRows,
                                     localIndex const localCols,
                                     localIndex const maxEntriesPerRow,
@@ -408,6 +408,22 @@ void HyprePreconditioner::apply( Vector const & src,
   dst.touch();
 }
 
+void HyprePreconditioner::reuse( Matrix const & mat )
+{
+  if( !m_precond || !ready() )
+  {
+    setup( mat );
+    return;
+  }
+
+  GEOS_LAI_ASSERT_EQ( mat.numGlobalRows(), numGlobalRows() );
+  GEOS_LAI_ASSERT_EQ( mat.numLocalRows(), numLocalRows() );
+
+  // Hypre preconditioners pick the (fine level) operator up from the arguments of their solve function,
+  // so we only need to update the matrix used in apply()
+  Base::setup( setupPreconditioningMatrix( mat ) );
+}
+
 void HyprePreconditioner::clear()
 {
   Base::clear();
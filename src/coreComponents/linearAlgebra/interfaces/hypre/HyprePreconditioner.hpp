@@ -76,6 +76,16 @@ public:
    */
   virtual void setup( Matrix const & mat ) override;
 
+  /**
+   * @brief Associate the preconditioner with a new matrix, keeping the previously computed setup.
+   * @param mat the matrix to precondition
+   *
+   * The matrix must have the same size and parallel distribution as the one used in the last setup().
+   * This allows to amortize expensive setups (e.g., AMG or MGR hierarchies) over several solves
+   * with slowly varying matrices. Falls back to a full setup() if the preconditioner is not ready.
+   */
+  virtual void reuse( Matrix const & mat ) override;
+
   /**
    * @brief Apply operator to a vector
    * @param src Input vector (x).
@@ -201,7 +201,14 @@ void HypreSolver::setup( HypreMatrix const & mat )
   clear();
   Base::setup( mat );
   Stopwatch timer( m_result.setupTime );
-  m_precond.setup( mat );
+  if( m_reusePreconditioner && m_precond.ready() )
+  {
+    m_precond.reuse( mat );
+  }
+  else
+  {
+    m_precond.setup( mat );
+  }
 
   m_solver = std::make_unique< HypreSolverWrapper >();
   createHypreKrylovSolver( m_params, mat.comm(), *m_solver );
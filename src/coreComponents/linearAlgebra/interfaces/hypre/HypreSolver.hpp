@@ -75,6 +75,14 @@ public:
    */
   virtual void clear() override;
 
+  /**
+   * @copydoc LinearSolverBase<HypreInterface>::supportsPreconditionerReuse
+   */
+  virtual bool supportsPreconditionerReuse() const override
+  {
+    return true;
+  }
+
 private:
 
   /**
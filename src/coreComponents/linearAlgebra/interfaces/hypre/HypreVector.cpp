@@ -179,6 +179,22 @@ real64 HypreVector::dot( HypreVector const & vec ) const
   return result;
 }
 
+real64 HypreVector::localDot( HypreVector const & vec ) const
+{
+  GEOS_LAI_ASSERT( ready() );
+  GEOS_LAI_ASSERT( vec.ready() );
+  GEOS_LAI_ASSERT_EQ( localSize(), vec.localSize() );
+
+  arrayView1d< real64 const > const x = m_values.toViewConst();
+  arrayView1d< real64 const > const y = vec.m_values.toViewConst();
+  RAJA::ReduceSum< ReducePolicy< hypre::execPolicy >, real64 > result( 0.0 );
+  forAll< hypre::execPolicy >( localSize(), [result, x, y] GEOS_HYPRE_DEVICE ( localIndex const i )
+  {
+    result += x[i] * y[i];
+  } );
+  return result.get();
+}
+
 void HypreVector::copy( HypreVector const & x )
 {
   GEOS_LAI_ASSERT( ready() );
@@ -131,6 +131,11 @@ public:
 
   virtual real64 dot( HypreVector const & vec ) const override;
 
+  /**
+   * @copydoc VectorBase<HypreVector>::localDot
+   */
+  virtual real64 localDot( HypreVector const & vec ) const override;
+
   virtual void copy( HypreVector const & x ) override;
 
   virtual void axpy( real64 const alpha,
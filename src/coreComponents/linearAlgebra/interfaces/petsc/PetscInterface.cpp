@@ -23,6 +23,8 @@
 #include "linearAlgebra/interfaces/direct/SuperLUDist.hpp"
 #include "linearAlgebra/interfaces/petsc/PetscPreconditioner.hpp"
 #include "linearAlgebra/interfaces/petsc/PetscSolver.hpp"
+#include "linearAlgebra/solvers/PreconditionerBlockILU.hpp"
+#include "linearAlgebra/solvers/PreconditionerBlockJacobi.hpp"
 
 #include <petscsys.h>
 
@@ -65,6 +67,24 @@ PetscInterface::createSolver( LinearSolverParameters params )
 std::unique_ptr< PreconditionerBase< PetscInterface > >
 PetscInterface::createPreconditioner( LinearSolverParameters params )
 {
+  if( params.preconditionerType == LinearSolverParameters::PreconditionerType::blockIlu )
+  {
+    // The block ILU(k) is implemented natively, in double or single precision
+    if( params.preconditionerPrecision == LinearSolverParameters::Precision::fp32 )
+    {
+      return std::make_unique< PreconditionerBlockILU< PetscInterface, float > >( params.dofsPerNode, params.ifact.fill );
+    }
+    return std::make_unique< PreconditionerBlockILU< PetscInterface > >( params.dofsPerNode, params.ifact.fill );
+  }
+  if( params.preconditionerPrecision == LinearSolverParameters::Precision::fp32 )
+  {
+    // Single precision preconditioning is implemented natively
+    if( params.preconditionerType == LinearSolverParameters::PreconditionerType::iluk )
+    {
+      return std::make_unique< PreconditionerBlockILU< PetscInterface, float > >( params.dofsPerNode, params.ifact.fill );
+    }
+    return std::make_unique< PreconditionerBlockJacobi< PetscInterface > >( params.dofsPerNode, params.preconditionerPrecision );
+  }
   return std::make_unique< PetscPreconditioner >( params );
 }
 
@@ -23,6 +23,8 @@
 #include "linearAlgebra/interfaces/direct/SuperLUDist.hpp"
 #include "linearAlgebra/interfaces/trilinos/TrilinosPreconditioner.hpp"
 #include "linearAlgebra/interfaces/trilinos/TrilinosSolver.hpp"
+#include "linearAlgebra/solvers/PreconditionerBlockILU.hpp"
+#include "linearAlgebra/solvers/PreconditionerBlockJacobi.hpp"
 
 namespace geos
 {
@@ -56,6 +58,24 @@ TrilinosInterface::createSolver( LinearSolverParameters params )
 std::unique_ptr< PreconditionerBase< TrilinosInterface > >
 TrilinosInterface::createPreconditioner( LinearSolverParameters params )
 {
+  if( params.preconditionerType == LinearSolverParameters::PreconditionerType::blockIlu )
+  {
+    // The block ILU(k) is implemented natively, in double or single precision
+    if( params.preconditionerPrecision == LinearSolverParameters::Precision::fp32 )
+    {
+      return std::make_unique< PreconditionerBlockILU< TrilinosInterface, float > >( params.dofsPerNode, params.ifact.fill );
+    }
+    return std::make_unique< PreconditionerBlockILU< TrilinosInterface > >( params.dofsPerNode, params.ifact.fill );
+  }
+  if( params.preconditionerPrecision == LinearSolverParameters::Precision::fp32 )
+  {
+    // Single precision preconditioning is implemented natively
+    if( params.preconditionerType == LinearSolverParameters::PreconditionerType::iluk )
+    {
+      return std::make_unique< PreconditionerBlockILU< TrilinosInterface, float > >( params.dofsPerNode, params.ifact.fill );
+    }
+    return std::make_unique< PreconditionerBlockJacobi< TrilinosInterface > >( params.dofsPerNode, params.preconditionerPrecision );
+  }
   return std::make_unique< TrilinosPreconditioner >( params );
 }
 
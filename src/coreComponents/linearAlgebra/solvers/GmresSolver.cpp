@@ -22,7 +22,6 @@
 #include "common/Stopwatch.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
 #include "linearAlgebra/solvers/KrylovUtils.hpp"
-#include "denseLinearAlgebra/common/layouts.hpp"
 
 namespace geos
 {
@@ -33,59 +32,13 @@ GmresSolver< VECTOR >::GmresSolver( LinearSolverParameters params,
                                     LinearOperator< Vector > const & M )
   : KrylovSolver< VECTOR >( std::move( params ), A, M ),
   m_kspace( m_params.krylov.maxRestart + 1 ),
-  m_kspaceInitialized( false )
+  m_zspace( m_params.solverType == LinearSolverParameters::SolverType::fgmres ? m_params.krylov.maxRestart : 0 ),
+  m_kspaceInitialized( false ),
+  m_flexible( m_params.solverType == LinearSolverParameters::SolverType::fgmres )
 {
   GEOS_ERROR_IF_LE_MSG( m_params.krylov.maxRestart, 0, "GMRES: max number of iterations until restart must be positive." );
 }
 
-namespace
-{
-
-void ComputeGivensRotation( real64 const x, real64 const y, real64 & c, real64 & s )
-{
-  if( isZero( y ) )
-  {
-    c = 1.0;
-    s = 0.0;
-  }
-  else if( std::fabs( y ) > std::fabs( x ) )
-  {
-    real64 const nu = x / y;
-    s = 1.0 / std::sqrt( 1.0 + nu * nu );
-    c = nu * s;
-  }
-  else
-  {
-    real64 const nu = y / x;
-    c = 1.0 / std::sqrt( 1.0 + nu * nu );
-    s = nu * c;
-  }
-}
-
-void ApplyGivensRotation( real64 const c, real64 const s, real64 & dx, real64 & dy )
-{
-  real64 const temp = c * dx + s * dy;
-  dy = -s * dx + c * dy;
-  dx = temp;
-}
-
-void Backsolve( integer const k,
-                arraySlice2d< real64 const, MatrixLayout::COL_MAJOR > const & H,
-                arraySlice1d< real64 > const & g )
-{
-  for( integer j = k - 1; j >= 0; --j )
-  {
-    g[j] /= H( j, j );
-    for( integer i = j - 1; i >= 0; --i )
-    {
-      g[i] -= H( i, j ) * g[j];
-    }
-  }
-
-}
-
-} // namespace
-
 template< typename VECTOR >
 void GmresSolver< VECTOR >::solve( Vector const & b,
                                    Vector & x ) const
@@ -98,6 +51,10 @@ void GmresSolver< VECTOR >::solve( Vector const & b,
     {
       kv = createTempVector( b );
     }
+    for( VectorTemp & zv : m_zspace )
+    {
+      zv = createTempVector( b );
+    }
     m_kspaceInitialized = true;
   }
 
@@ -155,8 +112,9 @@ void GmresSolver< VECTOR >::solve( Vector const & b,
       }
 
       // Compute the new vector
-      m_precond.apply( m_kspace[j], z );
-      m_operator.apply( z, w );
+      VectorTemp & zj = m_flexible ? m_zspace[j] : z;
+      m_precond.apply( m_kspace[j], zj );
+      m_operator.apply( zj, w );
 
       // Orthogonalization
       for( integer i = 0; i <= j; ++i )
@@ -172,23 +130,34 @@ void GmresSolver< VECTOR >::solve( Vector const & b,
       // Apply all previous rotations to the new column
       for( integer i = 0; i < j; ++i )
       {
-        ApplyGivensRotation( c[i], s[i], H( i, j ), H( i+1, j ) );
+        krylov::ApplyGivensRotation( c[i], s[i], H( i, j ), H( i+1, j ) );
       }
 
       // Compute and apply the new rotation to eliminate subdiagonal element
-      ComputeGivensRotation( H( j, j ), H( j+1, j ), c[j], s[j] );
-      ApplyGivensRotation( c[j], s[j], H( j, j ), H( j+1, j ) );
-      ApplyGivensRotation( c[j], s[j], g[j], g[j+1] );
+      krylov::ComputeGivensRotation( H( j, j ), H( j+1, j ), c[j], s[j] );
+      krylov::ApplyGivensRotation( c[j], s[j], H( j, j ), H( j+1, j ) );
+      krylov::ApplyGivensRotation( c[j], s[j], g[j], g[j+1] );
     }
 
     // Regardless of how we quit out of inner loop, j is the actual size of H
-    Backsolve( j, H, g );
-    w.zero();
-    for( integer i = 0; i < j; ++i )
+    krylov::Backsolve( j, H, g );
+    if( m_flexible )
     {
-      w.axpy( g[i], m_kspace[i] );
+      z.zero();
+      for( integer i = 0; i < j; ++i )
+      {
+        z.axpy( g[i], m_zspace[i] );
+      }
+    }
+    else
+    {
+      w.zero();
+      for( integer i = 0; i < j; ++i )
+      {
+        w.axpy( g[i], m_kspace[i] );
+      }
+      m_precond.apply( w, z );
     }
-    m_precond.apply( w, z );
 
     // Update the solution vector and recompute residual
     x.axpy( 1.0, z );
@@ -29,6 +29,10 @@ namespace geos
  * @brief This class implements Generalized Minimized RESidual method
  *        (right-preconditioned) for monolithic and block linear operators.
  * @tparam VECTOR type of vectors this solver operates on.
+ *
+ * When the solver type is LinearSolverParameters::SolverType::fgmres, the flexible variant
+ * is used: preconditioned basis vectors are stored, which allows the preconditioner to change
+ * between iterations (e.g. inexact or reduced precision inner solves).
  * @note  The notation is consistent with "Iterative Methods for
  *        Linear and Non-Linear Equations" from C.T. Kelley (1995)
  *        and "Iterative Methods for Sparse Linear Systems"
@@ -76,7 +80,7 @@ public:
 
   virtual string methodName() const override final
   {
-    return "GMRES";
+    return m_flexible ? "FGMRES" : "GMRES";
   };
 
   ///@}
@@ -98,8 +102,14 @@ protected:
   /// Storage for Krylov subspace vectors
   array1d< VectorTemp > m_kspace;
 
+  /// Storage for preconditioned Krylov subspace vectors (flexible variant only)
+  array1d< VectorTemp > m_zspace;
+
   /// Flag indicating whether kspace vectors have been created
   bool mutable m_kspaceInitialized;
+
+  /// Flag indicating whether the flexible variant is used
+  bool const m_flexible;
 };
 
 } // namespace geos
@@ -21,6 +21,8 @@
 #include "linearAlgebra/solvers/BicgstabSolver.hpp"
 #include "linearAlgebra/solvers/CgSolver.hpp"
 #include "linearAlgebra/solvers/GmresSolver.hpp"
+#include "linearAlgebra/solvers/PipelinedCgSolver.hpp"
+#include "linearAlgebra/solvers/SStepGmresSolver.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
 
 namespace geos
@@ -63,11 +65,24 @@ KrylovSolver< VECTOR >::create( LinearSolverParameters const & parameters,
                                                            precond );
     }
     case LinearSolverParameters::SolverType::gmres:
+    case LinearSolverParameters::SolverType::fgmres:
     {
       return std::make_unique< GmresSolver< Vector > >( parameters,
                                                         matrix,
                                                         precond );
     }
+    case LinearSolverParameters::SolverType::pipelinedCg:
+    {
+      return std::make_unique< PipelinedCgSolver< Vector > >( parameters,
+                                                              matrix,
+                                                              precond );
+    }
+    case LinearSolverParameters::SolverType::sstepGmres:
+    {
+      return std::make_unique< SStepGmresSolver< Vector > >( parameters,
+                                                             matrix,
+                                                             precond );
+    }
     default:
     {
       GEOS_ERROR( "Unsupported linear solver type: " << parameters.solverType );
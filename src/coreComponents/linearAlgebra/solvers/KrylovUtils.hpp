@@ -20,6 +20,7 @@
 #define GEOS_LINEARALGEBRA_SOLVERS_KRYLOVUTILS_HPP_
 
 #include "codingUtilities/Utilities.hpp"
+#include "denseLinearAlgebra/common/layouts.hpp"
 
 /**
  * @brief Exit solver iteration and report a breakdown if value too close to zero.
@@ -36,4 +37,76 @@
     break;                                  \
   }                                         \
 
+namespace geos
+{
+
+namespace krylov
+{
+
+/**
+ * @brief Compute a Givens rotation that eliminates the second component of a vector.
+ * @param[in] x first component
+ * @param[in] y second component (to be eliminated)
+ * @param[out] c cosine of the rotation
+ * @param[out] s sine of the rotation
+ */
+inline void ComputeGivensRotation( real64 const x, real64 const y, real64 & c, real64 & s )
+{
+  if( isZero( y ) )
+  {
+    c = 1.0;
+    s = 0.0;
+  }
+  else if( std::fabs( y ) > std::fabs( x ) )
+  {
+    real64 const nu = x / y;
+    s = 1.0 / std::sqrt( 1.0 + nu * nu );
+    c = nu * s;
+  }
+  else
+  {
+    real64 const nu = y / x;
+    c = 1.0 / std::sqrt( 1.0 + nu * nu );
+    s = nu * c;
+  }
+}
+
+/**
+ * @brief Apply a Givens rotation to a pair of values.
+ * @param[in] c cosine of the rotation
+ * @param[in] s sine of the rotation
+ * @param[inout] dx first component
+ * @param[inout] dy second component
+ */
+inline void ApplyGivensRotation( real64 const c, real64 const s, real64 & dx, real64 & dy )
+{
+  real64 const temp = c * dx + s * dy;
+  dy = -s * dx + c * dy;
+  dx = temp;
+}
+
+/**
+ * @brief Solve an upper triangular system in place.
+ * @param[in] k size of the system
+ * @param[in] H the upper triangular (rotated Hessenberg) matrix
+ * @param[inout] g the right-hand side on input, the solution on output
+ */
+inline void Backsolve( integer const k,
+                       arraySlice2d< real64 const, MatrixLayout::COL_MAJOR > const & H,
+                       arraySlice1d< real64 > const & g )
+{
+  for( integer j = k - 1; j >= 0; --j )
+  {
+    g[j] /= H( j, j );
+    for( integer i = j - 1; i >= 0; --i )
+    {
+      g[i] -= H( i, j ) * g[j];
+    }
+  }
+}
+
+} // namespace krylov
+
+} // namespace geos
+
 #endif //GEOS_LINEARALGEBRA_SOLVERS_KRYLOVUTILS_HPP_
@@ -0,0 +1,157 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file PipelinedCgSolver.cpp
+ */
+
+#include "PipelinedCgSolver.hpp"
+
+#include "common/MpiWrapper.hpp"
+#include "common/Stopwatch.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "common/LinearOperator.hpp"
+#include "linearAlgebra/utilities/BlockVectorView.hpp"
+#include "linearAlgebra/solvers/KrylovUtils.hpp"
+
+namespace geos
+{
+
+template< typename VECTOR >
+PipelinedCgSolver< VECTOR >::PipelinedCgSolver( LinearSolverParameters params,
+                                                LinearOperator< Vector > const & A,
+                                                LinearOperator< Vector > const & M )
+  : KrylovSolver< VECTOR >( std::move( params ), A, M )
+{
+  GEOS_ERROR_IF( !m_params.isSymmetric, "Cannot use pipelined CG solver with a non-symmetric system" );
+}
+
+template< typename VECTOR >
+void PipelinedCgSolver< VECTOR >::solve( Vector const & b, Vector & x ) const
+{
+  Stopwatch watch;
+
+  // Residual r = b - Ax, preconditioned residual u = Mr and w = Au
+  VectorTemp r = createTempVector( b );
+  VectorTemp u = createTempVector( b );
+  VectorTemp w = createTempVector( b );
+  m_operator.residual( x, b, r );
+  m_precond.apply( r, u );
+  m_operator.apply( u, w );
+
+  // Auxiliary vectors m = Mw and n = Am, computed while the reduction is in flight
+  VectorTemp m = createTempVector( b );
+  VectorTemp n = createTempVector( b );
+
+  // Search direction p and its recurrences s = Ap, q = Ms, z = Aq
+  VectorTemp p = createTempVector( b );
+  VectorTemp s = createTempVector( b );
+  VectorTemp q = createTempVector( b );
+  VectorTemp z = createTempVector( b );
+  p.zero();
+  s.zero();
+  q.zero();
+  z.zero();
+
+  real64 gamma_old = 0.0;
+  real64 alpha_old = 0.0;
+  real64 rnorm0 = 0.0;
+  real64 absTol = 0.0;
+
+  // Initialize iteration state
+  m_result.status = LinearSolverResult::Status::NotConverged;
+  m_residualNorms.clear();
+
+  integer & k = m_result.numIterations;
+  for( k = 0; k <= m_params.krylov.maxIterations; ++k )
+  {
+    // Start the fused reduction of (r,u), (w,u) and (r,r)
+    real64 const localDots[3] = { r.localDot( u ), w.localDot( u ), r.localDot( r ) };
+    real64 dots[3]{};
+    MPI_Request request;
+    MpiWrapper::iAllReduce( localDots, dots, 3, MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ), b.comm(), &request );
+
+    // Overlap the reduction with m = Mw and n = Am
+    m_precond.apply( w, m );
+    m_operator.apply( m, n );
+
+    MpiWrapper::wait( &request, MPI_STATUS_IGNORE );
+    real64 const gamma = dots[0];
+    real64 const delta = dots[1];
+    real64 const rnorm = std::sqrt( std::max( dots[2], 0.0 ) );
+
+    // Compute the target absolute tolerance
+    if( k == 0 )
+    {
+      rnorm0 = rnorm;
+      absTol = rnorm0 * m_params.krylov.relTolerance;
+    }
+
+    m_residualNorms.emplace_back( rnorm );
+    logProgress();
+
+    // Convergence check on ||rk||/||b||
+    if( rnorm <= absTol )
+    {
+      m_result.status = LinearSolverResult::Status::Success;
+      break;
+    }
+
+    // Compute beta and alpha
+    real64 const beta = k > 0 ? gamma / gamma_old : 0.0;
+    real64 const denom = k > 0 ? delta - beta * gamma / alpha_old : delta;
+    GEOS_KRYLOV_BREAKDOWN_IF_ZERO( denom )
+    real64 const alpha = gamma / denom;
+
+    // Update the search direction and its recurrences
+    z.axpby( 1.0, n, beta );
+    q.axpby( 1.0, m, beta );
+    s.axpby( 1.0, w, beta );
+    p.axpby( 1.0, u, beta );
+
+    // Update the solution, the residual and the auxiliary vectors
+    x.axpy( alpha, p );
+    r.axpy( -alpha, s );
+    u.axpy( -alpha, q );
+    w.axpy( -alpha, z );
+
+    gamma_old = gamma;
+    alpha_old = alpha;
+  }
+
+  m_result.residualReduction = rnorm0 > 0.0 ? m_residualNorms.back() / rnorm0 : 0.0;
+  m_result.solveTime = watch.elapsedTime();
+  logResult();
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOS_USE_TRILINOS
+template class PipelinedCgSolver< TrilinosInterface::ParallelVector >;
+template class PipelinedCgSolver< BlockVectorView< TrilinosInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOS_USE_HYPRE
+template class PipelinedCgSolver< HypreInterface::ParallelVector >;
+template class PipelinedCgSolver< BlockVectorView< HypreInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOS_USE_PETSC
+template class PipelinedCgSolver< PetscInterface::ParallelVector >;
+template class PipelinedCgSolver< BlockVectorView< PetscInterface::ParallelVector > >;
+#endif
+
+} // namespace geos
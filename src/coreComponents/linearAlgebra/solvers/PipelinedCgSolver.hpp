@@ -0,0 +1,108 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file PipelinedCgSolver.hpp
+ */
+
+#ifndef GEOS_LINEARALGEBRA_SOLVERS_PIPELINEDCGSOLVER_HPP_
+#define GEOS_LINEARALGEBRA_SOLVERS_PIPELINEDCGSOLVER_HPP_
+
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+
+namespace geos
+{
+
+/**
+ * @brief This class implements the pipelined Preconditioned Conjugate Gradient method
+ *        for monolithic and block linear operators.
+ * @tparam VECTOR type of vectors this solver operates on.
+ *
+ * The three inner products required by each iteration are fused into a single
+ * non-blocking global reduction, which is overlapped with the application of the
+ * preconditioner and the operator. This trades a few additional vector updates
+ * for one synchronization point per iteration instead of two.
+ *
+ * @note The algorithm follows "Hiding global synchronization latency in the
+ *       preconditioned Conjugate Gradient algorithm" from P. Ghysels and
+ *       W. Vanroose (2014). The recursively updated residual may drift from the
+ *       true residual for very tight tolerances.
+ */
+template< typename VECTOR >
+class PipelinedCgSolver : public KrylovSolver< VECTOR >
+{
+public:
+
+  /// Alias for base type
+  using Base = KrylovSolver< VECTOR >;
+
+  /// Alias for template parameter
+  using Vector = typename Base::Vector;
+
+  /**
+   * @name Constructor/Destructor Methods
+   */
+  ///@{
+
+  /**
+   * @brief Constructor.
+   * @param [in] params parameters for the solver
+   * @param [in] A reference to the system matrix.
+   * @param [in] M reference to the preconditioning operator.
+   */
+  PipelinedCgSolver( LinearSolverParameters params,
+                     LinearOperator< Vector > const & A,
+                     LinearOperator< Vector > const & M );
+
+  ///@}
+
+  /**
+   * @name KrylovSolver interface
+   */
+  ///@{
+
+  /**
+   * @brief Solve preconditioned system
+   * @param [in] b system right hand side.
+   * @param [inout] x system solution (input = initial guess, output = solution).
+   */
+  virtual void solve( Vector const & b, Vector & x ) const override final;
+
+  virtual string methodName() const override final
+  {
+    return "pipelined CG";
+  };
+
+  ///@}
+
+protected:
+
+  /// Alias for vector type that can be used for temporaries
+  using VectorTemp = typename KrylovSolver< VECTOR >::VectorTemp;
+
+  using Base::m_params;
+  using Base::m_operator;
+  using Base::m_precond;
+  using Base::m_result;
+  using Base::m_residualNorms;
+  using Base::createTempVector;
+  using Base::logProgress;
+  using Base::logResult;
+
+};
+
+} // namespace geos
+
+#endif /*GEOS_LINEARALGEBRA_SOLVERS_PIPELINEDCGSOLVER_HPP_*/
@@ -0,0 +1,673 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#ifndef GEOS_LINEARALGEBRA_SOLVERS_PRECONDITIONERBLOCKILU_HPP_
+#define GEOS_LINEARALGEBRA_SOLVERS_PRECONDITIONERBLOCKILU_HPP_
+
+#include "linearAlgebra/common/PreconditionerBase.hpp"
+
+namespace geos
+{
+
+/**
+ * @brief Native block incomplete LU preconditioner
+ * @tparam LAI linear algebra interface providing vectors, matrices and solvers
+ * @tparam FACTOR the floating-point type used to store the factors
+ *
+ * The local rows of the matrix are grouped in dense blocks of size @p blockSize (the number of
+ * dofs per cell/node, numbered consecutively by DofManager), and an ILU(k) factorization is
+ * computed on the block graph. Couplings with off-rank columns are dropped, so that in parallel
+ * the preconditioner is a block Jacobi across ranks with a block ILU(k) solve on each rank.
+ *
+ * The rows are grouped in levels (wavefronts) of the dependency graphs of the lower and upper
+ * factors: the rows of a level only depend on rows of previous levels, and are factored and
+ * solved concurrently. Factors are stored in @p FACTOR precision, all the arithmetic is done
+ * in double precision.
+ */
+template< typename LAI, typename FACTOR = real64 >
+class PreconditionerBlockILU : public PreconditionerBase< LAI >
+{
+public:
+
+  /// Alias for base type
+  using Base = PreconditionerBase< LAI >;
+
+  /// Alias for vector type
+  using Vector = typename Base::Vector;
+
+  /// Alias for matrix type
+  using Matrix = typename Base::Matrix;
+
+  /// Maximum supported block size
+  static constexpr integer MAX_BLOCK_SIZE = 32;
+
+  /**
+   * @brief Constructor.
+   * @param blockSize the size of the dense blocks
+   * @param fillLevel the level of fill of the incomplete factorization
+   */
+  PreconditionerBlockILU( integer const blockSize = 1,
+                          integer const fillLevel = 0 )
+    : m_blockSize( blockSize ),
+    m_fillLevel( fillLevel )
+  {
+    GEOS_ERROR_IF( blockSize <= 0 || blockSize > MAX_BLOCK_SIZE,
+                   GEOS_FMT( "Block ILU: block size must be between 1 and {}, got {}", MAX_BLOCK_SIZE, blockSize ) );
+    GEOS_ERROR_IF_LT_MSG( fillLevel, 0, "Block ILU: invalid fill level" );
+  }
+
+  /**
+   * @brief Compute the preconditioner from a matrix.
+   * @param mat the matrix to precondition.
+   */
+  virtual void setup( Matrix const & mat ) override
+  {
+    GEOS_MARK_FUNCTION;
+
+    GEOS_LAI_ASSERT( mat.ready() );
+    GEOS_ERROR_IF_NE_MSG( mat.numLocalRows() % m_blockSize, 0,
+                          "Block ILU: the number of local rows must be a multiple of the block size " << m_blockSize );
+
+    Base::setup( mat );
+
+    array1d< localIndex > rowOffsets;
+    array1d< localIndex > localColumns;
+    array1d< real64 > localValues;
+    extractLocalRows( mat, rowOffsets, localColumns, localValues );
+
+    computeSymbolicFactorization( rowOffsets.toViewConst(), localColumns.toViewConst() );
+    computeLevelSchedules();
+    computeNumericFactorization( rowOffsets.toViewConst(), localColumns.toViewConst(), localValues.toViewConst() );
+  }
+
+  /**
+   * @brief Associate the preconditioner with a new matrix, keeping the previously computed factors.
+   * @param mat the matrix to precondition
+   *
+   * Falls back to a full setup() if the preconditioner is not ready.
+   */
+  virtual void reuse( Matrix const & mat ) override
+  {
+    if( !this->ready() )
+    {
+      setup( mat );
+      return;
+    }
+    GEOS_LAI_ASSERT_EQ( mat.numGlobalRows(), this->numGlobalRows() );
+    GEOS_LAI_ASSERT_EQ( mat.numLocalRows(), this->numLocalRows() );
+
+    // the factors are stored independently of the matrix
+    Base::setup( mat );
+  }
+
+  /**
+   * @brief Clean up the preconditioner setup.
+   */
+  virtual void clear() override
+  {
+    Base::clear();
+    m_offsets.clear();
+    m_columns.clear();
+    m_diagPositions.clear();
+    m_values.clear();
+    m_lowerLevelOffsets.clear();
+    m_lowerLevelRows.clear();
+    m_upperLevelOffsets.clear();
+    m_upperLevelRows.clear();
+  }
+
+  /**
+   * @brief Apply operator to a vector.
+   *
+   * @param src Input vector (src).
+   * @param dst Output vector (dst).
+   */
+  virtual void apply( Vector const & src,
+                      Vector & dst ) const override
+  {
+    GEOS_LAI_ASSERT( this->ready() );
+    GEOS_LAI_ASSERT_EQ( this->numGlobalRows(), dst.globalSize() );
+    GEOS_LAI_ASSERT_EQ( this->numGlobalCols(), src.globalSize() );
+
+    integer const blockSize = m_blockSize;
+    arrayView1d< localIndex const > const offsets = m_offsets.toViewConst();
+    arrayView1d< localIndex const > const columns = m_columns.toViewConst();
+    arrayView1d< localIndex const > const diagPositions = m_diagPositions.toViewConst();
+    arrayView1d< FACTOR const > const values = m_values.toViewConst();
+
+    arrayView1d< real64 const > const srcValues = src.values();
+    arrayView1d< real64 > const dstValues = dst.open();
+    forAll< parallelHostPolicy >( dstValues.size(), [=]( localIndex const i )
+    {
+      dstValues[i] = srcValues[i];
+    } );
+
+    // Forward substitution with the unit lower factor
+    forEachLevel( m_lowerLevelOffsets, m_lowerLevelRows, [=]( localIndex const blockRow )
+    {
+      real64 sum[MAX_BLOCK_SIZE];
+      for( integer i = 0; i < blockSize; ++i )
+      {
+        sum[i] = dstValues[blockRow * blockSize + i];
+      }
+      for( localIndex k = offsets[blockRow]; k < diagPositions[blockRow]; ++k )
+      {
+        multiplySubtract( blockSize, &values[k * blockSize * blockSize], &dstValues[columns[k] * blockSize], sum );
+      }
+      for( integer i = 0; i < blockSize; ++i )
+      {
+        dstValues[blockRow * blockSize + i] = sum[i];
+      }
+    } );
+
+    // Backward substitution with the upper factor (whose diagonal blocks are stored inverted)
+    forEachLevel( m_upperLevelOffsets, m_upperLevelRows, [=]( localIndex const blockRow )
+    {
+      real64 sum[MAX_BLOCK_SIZE];
+      for( integer i = 0; i < blockSize; ++i )
+      {
+        sum[i] = dstValues[blockRow * blockSize + i];
+      }
+      for( localIndex k = diagPositions[blockRow] + 1; k < offsets[blockRow + 1]; ++k )
+      {
+        multiplySubtract( blockSize, &values[k * blockSize * blockSize], &dstValues[columns[k] * blockSize], sum );
+      }
+      FACTOR const * const diagInv = &values[diagPositions[blockRow] * blockSize * blockSize];
+      for( integer i = 0; i < blockSize; ++i )
+      {
+        real64 result = 0.0;
+        for( integer j = 0; j < blockSize; ++j )
+        {
+          result += diagInv[i * blockSize + j] * sum[j];
+        }
+        dstValues[blockRow * blockSize + i] = result;
+      }
+    } );
+
+    dst.close();
+  }
+
+  /**
+   * @return the number of levels of the lower triangular solve
+   */
+  localIndex numLowerLevels() const
+  {
+    return m_lowerLevelOffsets.empty() ? 0 : m_lowerLevelOffsets.size() - 1;
+  }
+
+  /**
+   * @return the number of nonzero blocks of the factors
+   */
+  localIndex numFactorBlocks() const
+  {
+    return m_columns.size();
+  }
+
+private:
+
+  /**
+   * @brief Copy the on-rank entries of the local rows.
+   * @param mat the matrix
+   * @param rowOffsets the offsets of the rows in @p columns and @p values
+   * @param columns the local column indices
+   * @param values the values
+   */
+  void extractLocalRows( Matrix const & mat,
+                         array1d< localIndex > & rowOffsets,
+                         array1d< localIndex > & columns,
+                         array1d< real64 > & values ) const
+  {
+    localIndex const numLocalRows = mat.numLocalRows();
+    globalIndex const rankOffset = mat.ilower();
+
+    rowOffsets.resize( numLocalRows + 1 );
+    columns.reserve( mat.numLocalNonzeros() );
+    values.reserve( mat.numLocalNonzeros() );
+
+    array1d< globalIndex > rowColumns;
+    array1d< real64 > rowValues;
+    for( localIndex i = 0; i < numLocalRows; ++i )
+    {
+      localIndex const rowLength = mat.rowLength( rankOffset + i );
+      rowColumns.resize( rowLength );
+      rowValues.resize( rowLength );
+      mat.getRowCopy( rankOffset + i, rowColumns, rowValues );
+      for( localIndex k = 0; k < rowLength; ++k )
+      {
+        if( rowColumns[k] >= rankOffset && rowColumns[k] < rankOffset + numLocalRows )
+        {
+          columns.emplace_back( LvArray::integerConversion< localIndex >( rowColumns[k] - rankOffset ) );
+          values.emplace_back( rowValues[k] );
+        }
+      }
+      rowOffsets[i + 1] = columns.size();
+    }
+  }
+
+  /**
+   * @brief Compute the block pattern of the ILU(k) factors.
+   * @param rowOffsets the offsets of the scalar rows
+   * @param localColumns the local scalar column indices
+   *
+   * A fill-in block (i,j) created by the elimination of the block (i,k) has level
+   * level(i,k) + level(k,j) + 1, and is kept if its level does not exceed the fill level.
+   */
+  void computeSymbolicFactorization( arrayView1d< localIndex const > const & rowOffsets,
+                                     arrayView1d< localIndex const > const & localColumns )
+  {
+    integer const blockSize = m_blockSize;
+    localIndex const numBlockRows = ( rowOffsets.size() - 1 ) / blockSize;
+
+    m_offsets.resize( numBlockRows + 1 );
+    m_offsets[0] = 0;
+    m_columns.clear();
+    m_diagPositions.resize( numBlockRows );
+
+    // Fill levels of the factored blocks, and of the blocks of the current row (-1 if not present)
+    array1d< integer > levels;
+    array1d< integer > rowLevels( numBlockRows );
+    rowLevels.setValues< serialPolicy >( -1 );
+    array1d< localIndex > rowColumns;
+
+    for( localIndex blockRow = 0; blockRow < numBlockRows; ++blockRow )
+    {
+      // Blocks of the matrix have level 0, the diagonal block is always present
+      rowColumns.clear();
+      rowColumns.emplace_back( blockRow );
+      for( localIndex k = rowOffsets[blockRow * blockSize]; k < rowOffsets[( blockRow + 1 ) * blockSize]; ++k )
+      {
+        rowColumns.emplace_back( localColumns[k] / blockSize );
+      }
+      localIndex numRowBlocks = LvArray::sortedArrayManipulation::makeSortedUnique( rowColumns.begin(), rowColumns.end() );
+      rowColumns.resize( numRowBlocks );
+      for( localIndex const blockCol : rowColumns )
+      {
+        rowLevels[blockCol] = 0;
+      }
+
+      // Eliminate the lower blocks in increasing order, including the fill-in blocks
+      for( localIndex p = 0; m_fillLevel > 0 && rowColumns[p] < blockRow; ++p )
+      {
+        localIndex const k = rowColumns[p];
+        for( localIndex q = m_diagPositions[k] + 1; q < m_offsets[k + 1]; ++q )
+        {
+          localIndex const j = m_columns[q];
+          integer const level = rowLevels[k] + levels[q] + 1;
+          if( level > m_fillLevel )
+          {
+            continue;
+          }
+          if( rowLevels[j] < 0 )
+          {
+            rowColumns.emplace( LvArray::sortedArrayManipulation::find( rowColumns.data(), rowColumns.size(), j ), j );
+            rowLevels[j] = level;
+          }
+          else
+          {
+            rowLevels[j] = LvArray::math::min( rowLevels[j], level );
+          }
+        }
+      }
+
+      for( localIndex const blockCol : rowColumns )
+      {
+        if( blockCol == blockRow )
+        {
+          m_diagPositions[blockRow] = m_columns.size();
+        }
+        m_columns.emplace_back( blockCol );
+        levels.emplace_back( rowLevels[blockCol] );
+        rowLevels[blockCol] = -1;
+      }
+      m_offsets[blockRow + 1] = m_columns.size();
+    }
+  }
+
+  /**
+   * @brief Group the block rows in levels for the lower and upper triangular solves.
+   *
+   * The level of a row is one more than the maximum level of the rows it depends on.
+   */
+  void computeLevelSchedules()
+  {
+    localIndex const numBlockRows = m_diagPositions.size();
+    array1d< localIndex > rowLevels( numBlockRows );
+
+    for( localIndex blockRow = 0; blockRow < numBlockRows; ++blockRow )
+    {
+      localIndex level = 0;
+      for( localIndex k = m_offsets[blockRow]; k < m_diagPositions[blockRow]; ++k )
+      {
+        level = LvArray::math::max( level, rowLevels[m_columns[k]] + 1 );
+      }
+      rowLevels[blockRow] = level;
+    }
+    groupByLevel( rowLevels.toViewConst(), m_lowerLevelOffsets, m_lowerLevelRows );
+
+    for( localIndex blockRow = numBlockRows - 1; blockRow >= 0; --blockRow )
+    {
+      localIndex level = 0;
+      for( localIndex k = m_diagPositions[blockRow] + 1; k < m_offsets[blockRow + 1]; ++k )
+      {
+        level = LvArray::math::max( level, rowLevels[m_columns[k]] + 1 );
+      }
+      rowLevels[blockRow] = level;
+    }
+    groupByLevel( rowLevels.toViewConst(), m_upperLevelOffsets, m_upperLevelRows );
+  }
+
+  /**
+   * @brief Compute the values of the factors.
+   * @param rowOffsets the offsets of the scalar rows
+   * @param localColumns the local scalar column indices
+   * @param localValues the scalar values
+   *
+   * The lower factor has unit diagonal blocks, which are not stored. The diagonal blocks of the upper
+   * factor are stored inverted.
+   */
+  void computeNumericFactorization( arrayView1d< localIndex const > const & rowOffsets,
+                                    arrayView1d< localIndex const > const & localColumns,
+                                    arrayView1d< real64 const > const & localValues )
+  {
+    integer const blockSize = m_blockSize;
+    localIndex const blockSize2 = blockSize * blockSize;
+    arrayView1d< localIndex const > const offsets = m_offsets.toViewConst();
+    arrayView1d< localIndex const > const columns = m_columns.toViewConst();
+    arrayView1d< localIndex const > const diagPositions = m_diagPositions.toViewConst();
+
+    m_values.resize( m_columns.size() * blockSize2 );
+    arrayView1d< FACTOR > const values = m_values.toView();
+
+    // Scatter the scalar entries into the blocks
+    forAll< parallelHostPolicy >( diagPositions.size(), [=]( localIndex const blockRow )
+    {
+      for( localIndex k = offsets[blockRow] * blockSize2; k < offsets[blockRow + 1] * blockSize2; ++k )
+      {
+        values[k] = 0.0;
+      }
+      localIndex const numRowBlocks = offsets[blockRow + 1] - offsets[blockRow];
+      for( integer i = 0; i < blockSize; ++i )
+      {
+        localIndex const row = blockRow * blockSize + i;
+        for( localIndex k = rowOffsets[row]; k < rowOffsets[row + 1]; ++k )
+        {
+          localIndex const pos = offsets[blockRow] +
+                                 LvArray::sortedArrayManipulation::find( &columns[offsets[blockRow]], numRowBlocks, localColumns[k] / blockSize );
+          values[pos * blockSize2 + i * blockSize + localColumns[k] % blockSize] += localValues[k];
+        }
+      }
+    } );
+
+    // Factor the rows level by level
+    array1d< integer > singularPivot( 1 );
+    arrayView1d< integer > const singular = singularPivot.toView();
+    forEachLevel( m_lowerLevelOffsets, m_lowerLevelRows, [=]( localIndex const blockRow )
+    {
+      real64 lower[MAX_BLOCK_SIZE * MAX_BLOCK_SIZE];
+      real64 block[MAX_BLOCK_SIZE * MAX_BLOCK_SIZE];
+
+      for( localIndex p = offsets[blockRow]; p < diagPositions[blockRow]; ++p )
+      {
+        // L(i,k) = A(i,k) * U(k,k)^{-1}
+        localIndex const k = columns[p];
+        FACTOR const * const diagInv = &values[diagPositions[k] * blockSize2];
+        for( integer i = 0; i < blockSize; ++i )
+        {
+          for( integer j = 0; j < blockSize; ++j )
+          {
+            real64 sum = 0.0;
+            for( integer l = 0; l < blockSize; ++l )
+            {
+              sum += values[p * blockSize2 + i * blockSize + l] * diagInv[l * blockSize + j];
+            }
+            lower[i * blockSize + j] = sum;
+          }
+        }
+        for( localIndex l = 0; l < blockSize2; ++l )
+        {
+          values[p * blockSize2 + l] = lower[l];
+        }
+
+        // A(i,j) -= L(i,k) * U(k,j) for the blocks (i,j) of the pattern
+        localIndex pos = p + 1;
+        for( localIndex q = diagPositions[k] + 1; q < offsets[k + 1]; ++q )
+        {
+          while( pos < offsets[blockRow + 1] && columns[pos] < columns[q] )
+          {
+            ++pos;
+          }
+          if( pos == offsets[blockRow + 1] )
+          {
+            break;
+          }
+          if( columns[pos] != columns[q] )
+          {
+            continue;
+          }
+          for( integer i = 0; i < blockSize; ++i )
+          {
+            for( integer j = 0; j < blockSize; ++j )
+            {
+              real64 sum = 0.0;
+              for( integer l = 0; l < blockSize; ++l )
+              {
+                sum += lower[i * blockSize + l] * values[q * blockSize2 + l * blockSize + j];
+              }
+              values[pos * blockSize2 + i * blockSize + j] -= sum;
+            }
+          }
+        }
+      }
+
+      // Invert the diagonal block of U
+      FACTOR * const diag = &values[diagPositions[blockRow] * blockSize2];
+      for( localIndex l = 0; l < blockSize2; ++l )
+      {
+        block[l] = diag[l];
+      }
+      if( !invertBlock( blockSize, block, lower ) )
+      {
+        RAJA::atomicMax( parallelHostAtomic{}, &singular[0], 1 );
+      }
+      for( localIndex l = 0; l < blockSize2; ++l )
+      {
+        diag[l] = lower[l];
+      }
+    } );
+
+    GEOS_ERROR_IF( singularPivot[0] > 0, "Block ILU: zero pivot in the factorization of a diagonal block" );
+  }
+
+  /**
+   * @brief Sort the rows by level.
+   * @param rowLevels the level of each row
+   * @param levelOffsets the offsets of the levels in @p levelRows
+   * @param levelRows the rows sorted by level
+   */
+  static void groupByLevel( arrayView1d< localIndex const > const & rowLevels,
+                            array1d< localIndex > & levelOffsets,
+                            array1d< localIndex > & levelRows )
+  {
+    localIndex numLevels = 0;
+    for( localIndex row = 0; row < rowLevels.size(); ++row )
+    {
+      numLevels = LvArray::math::max( numLevels, rowLevels[row] + 1 );
+    }
+
+    levelOffsets.resize( numLevels + 1 );
+    levelOffsets.zero();
+    for( localIndex row = 0; row < rowLevels.size(); ++row )
+    {
+      ++levelOffsets[rowLevels[row] + 1];
+    }
+    for( localIndex level = 0; level < numLevels; ++level )
+    {
+      levelOffsets[level + 1] += levelOffsets[level];
+    }
+
+    levelRows.resize( rowLevels.size() );
+    array1d< localIndex > positions( numLevels );
+    for( localIndex level = 0; level < numLevels; ++level )
+    {
+      positions[level] = levelOffsets[level];
+    }
+    for( localIndex row = 0; row < rowLevels.size(); ++row )
+    {
+      levelRows[positions[rowLevels[row]]++] = row;
+    }
+  }
+
+  /**
+   * @brief Call a function on all the rows, level by level, in parallel within a level.
+   * @param levelOffsets the offsets of the levels
+   * @param levelRows the rows sorted by level
+   * @param func the function called with each row
+   */
+  template< typename FUNC >
+  static void forEachLevel( array1d< localIndex > const & levelOffsets,
+                            array1d< localIndex > const & levelRows,
+                            FUNC && func )
+  {
+    arrayView1d< localIndex const > const rows = levelRows.toViewConst();
+    for( localIndex level = 0; level + 1 < levelOffsets.size(); ++level )
+    {
+      localIndex const first = levelOffsets[level];
+      forAll< parallelHostPolicy >( levelOffsets[level + 1] - first, [=]( localIndex const k )
+      {
+        func( rows[first + k] );
+      } );
+    }
+  }
+
+  /**
+   * @brief Compute sum -= block * x for a dense block.
+   * @param blockSize the block size
+   * @param block the block, in row-major order
+   * @param x the vector
+   * @param sum the result
+   */
+  static void multiplySubtract( integer const blockSize,
+                                FACTOR const * const block,
+                                real64 const * const x,
+                                real64 * const sum )
+  {
+    for( integer i = 0; i < blockSize; ++i )
+    {
+      for( integer j = 0; j < blockSize; ++j )
+      {
+        sum[i] -= block[i * blockSize + j] * x[j];
+      }
+    }
+  }
+
+  /**
+   * @brief Invert a dense block with Gauss-Jordan elimination and partial pivoting.
+   * @param blockSize the block size
+   * @param block the block, in row-major order, overwritten
+   * @param inverse the inverse, in row-major order
+   * @return false if the block is singular
+   */
+  static bool invertBlock( integer const blockSize,
+                           real64 * const block,
+                           real64 * const inverse )
+  {
+    for( integer i = 0; i < blockSize; ++i )
+    {
+      for( integer j = 0; j < blockSize; ++j )
+      {
+        inverse[i * blockSize + j] = ( i == j ) ? 1.0 : 0.0;
+      }
+    }
+
+    for( integer c = 0; c < blockSize; ++c )
+    {
+      integer pivot = c;
+      for( integer r = c + 1; r < blockSize; ++r )
+      {
+        if( LvArray::math::abs( block[r * blockSize + c] ) > LvArray::math::abs( block[pivot * blockSize + c] ) )
+        {
+          pivot = r;
+        }
+      }
+      if( block[pivot * blockSize + c] == 0.0 )
+      {
+        return false;
+      }
+      if( pivot != c )
+      {
+        for( integer j = 0; j < blockSize; ++j )
+        {
+          std::swap( block[pivot * blockSize + j], block[c * blockSize + j] );
+          std::swap( inverse[pivot * blockSize + j], inverse[c * blockSize + j] );
+        }
+      }
+
+      real64 const scale = 1.0 / block[c * blockSize + c];
+      for( integer j = 0; j < blockSize; ++j )
+      {
+        block[c * blockSize + j] *= scale;
+        inverse[c * blockSize + j] *= scale;
+      }
+      for( integer r = 0; r < blockSize; ++r )
+      {
+        real64 const factor = block[r * blockSize + c];
+        if( r == c || factor == 0.0 )
+        {
+          continue;
+        }
+        for( integer j = 0; j < blockSize; ++j )
+        {
+          block[r * blockSize + j] -= factor * block[c * blockSize + j];
+          inverse[r * blockSize + j] -= factor * inverse[c * blockSize + j];
+        }
+      }
+    }
+    return true;
+  }
+
+  /// Size of the dense blocks
+  integer m_blockSize;
+
+  /// Level of fill of the factorization
+  integer m_fillLevel;
+
+  /// Offsets of the block rows of the factors
+  array1d< localIndex > m_offsets;
+
+  /// Local block column indices of the factors (sorted within each row)
+  array1d< localIndex > m_columns;
+
+  /// Positions of the diagonal blocks in each row
+  array1d< localIndex > m_diagPositions;
+
+  /// Values of the blocks of the factors (row-major), the diagonal blocks of U are inverted
+  array1d< FACTOR > m_values;
+
+  /// Offsets of the levels of the lower triangular solve
+  array1d< localIndex > m_lowerLevelOffsets;
+
+  /// Rows sorted by level of the lower triangular solve
+  array1d< localIndex > m_lowerLevelRows;
+
+  /// Offsets of the levels of the upper triangular solve
+  array1d< localIndex > m_upperLevelOffsets;
+
+  /// Rows sorted by level of the upper triangular solve
+  array1d< localIndex > m_upperLevelRows;
+};
+
+}
+
+#endif //GEOS_LINEARALGEBRA_SOLVERS_PRECONDITIONERBLOCKILU_HPP_
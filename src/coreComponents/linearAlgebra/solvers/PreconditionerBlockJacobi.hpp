@@ -18,14 +18,20 @@
 
 #include "linearAlgebra/common/LinearOperator.hpp"
 #include "linearAlgebra/common/PreconditionerBase.hpp"
+#include "linearAlgebra/utilities/LinearSolverParameters.hpp"
 #include "denseLinearAlgebra/interfaces/blaslapack/BlasLapackLA.hpp"
 
 namespace geos
 {
 
 /**
- * @brief Common interface for identity preconditioning operator
+ * @brief Common interface for block Jacobi preconditioning operator
  * @tparam LAI linear algebra interface providing vectors, matrices and solvers
+ *
+ * In double precision the inverted diagonal blocks are stored as a (block diagonal) parallel matrix.
+ * In single precision they are stored locally as dense blocks of floats and applied natively,
+ * which halves the memory footprint and the memory traffic of the preconditioner application;
+ * the result is accumulated in double precision.
  */
 template< typename LAI >
 class PreconditionerBlockJacobi : public PreconditionerBase< LAI >
@@ -44,9 +50,12 @@ public:
   /**
    * @brief Constructor.
    * @param blockSize the size of block diagonal matrices.
+   * @param precision the precision used to store and apply the inverted blocks
    */
-  PreconditionerBlockJacobi( localIndex const & blockSize = 0 )
-    : m_blockDiag{}
+  PreconditionerBlockJacobi( localIndex const & blockSize = 0,
+                             LinearSolverParameters::Precision const precision = LinearSolverParameters::Precision::fp64 )
+    : m_blockDiag{},
+    m_precision( precision )
   {
     m_blockSize = blockSize;
   }
@@ -64,8 +73,18 @@ public:
 
     PreconditionerBase< LAI >::setup( mat );
 
-    m_blockDiag.createWithLocalSize( mat.numLocalRows(), mat.numLocalCols(), m_blockSize, mat.comm() );
-    m_blockDiag.open();
+    bool const singlePrecision = m_precision == LinearSolverParameters::Precision::fp32;
+    if( singlePrecision )
+    {
+      GEOS_ERROR_IF_NE_MSG( mat.numLocalRows() % m_blockSize, 0,
+                            "Block Jacobi: the number of local rows must be a multiple of the block size " << m_blockSize );
+      m_blockValues.resize( mat.numLocalRows() * m_blockSize );
+    }
+    else
+    {
+      m_blockDiag.createWithLocalSize( mat.numLocalRows(), mat.numLocalCols(), m_blockSize, mat.comm() );
+      m_blockDiag.open();
+    }
 
     array1d< globalIndex > idxBlk( m_blockSize );
     array2d< real64 > values( m_blockSize, m_blockSize );
@@ -93,9 +112,46 @@ public:
         }
       }
       BlasLapackLA::matrixInverse( values, valuesInv );
-      m_blockDiag.insert( idxBlk, idxBlk, valuesInv );
+      if( singlePrecision )
+      {
+        localIndex const offset = LvArray::integerConversion< localIndex >( i - mat.ilower() );
+        for( localIndex j = 0; j < m_blockSize; ++j )
+        {
+          for( localIndex k = 0; k < m_blockSize; ++k )
+          {
+            m_blockValues[( offset + j ) * m_blockSize + k] = static_cast< float >( valuesInv( j, k ) );
+          }
+        }
+      }
+      else
+      {
+        m_blockDiag.insert( idxBlk, idxBlk, valuesInv );
+      }
+    }
+    if( !singlePrecision )
+    {
+      m_blockDiag.close();
     }
-    m_blockDiag.close();
+  }
+
+  /**
+   * @brief Associate the preconditioner with a new matrix, keeping the previously inverted blocks.
+   * @param mat the matrix to precondition
+   *
+   * Falls back to a full setup() if the preconditioner is not ready.
+   */
+  virtual void reuse( Matrix const & mat ) override
+  {
+    if( !this->ready() )
+    {
+      setup( mat );
+      return;
+    }
+    GEOS_LAI_ASSERT_EQ( mat.numGlobalRows(), this->numGlobalRows() );
+    GEOS_LAI_ASSERT_EQ( mat.numLocalRows(), this->numLocalRows() );
+
+    // the inverted blocks are stored independently of the matrix
+    PreconditionerBase< LAI >::setup( mat );
   }
 
   /**
@@ -111,7 +167,9 @@ public:
    */
   virtual void clear() override
   {
+    PreconditionerBase< LAI >::clear();
     m_blockDiag.reset();
+    m_blockValues.clear();
   }
 
   /**
@@ -123,21 +181,44 @@ public:
   virtual void apply( Vector const & src,
                       Vector & dst ) const override
   {
-    GEOS_LAI_ASSERT( m_blockDiag.ready() );
+    GEOS_LAI_ASSERT( this->ready() );
     GEOS_LAI_ASSERT_EQ( this->numGlobalRows(), dst.globalSize() );
     GEOS_LAI_ASSERT_EQ( this->numGlobalCols(), src.globalSize() );
 
-    m_blockDiag.apply( src, dst );
+    if( m_precision == LinearSolverParameters::Precision::fp64 )
+    {
+      m_blockDiag.apply( src, dst );
+      return;
+    }
+
+    localIndex const blockSize = m_blockSize;
+    arrayView1d< float const > const blockValues = m_blockValues.toViewConst();
+    arrayView1d< real64 const > const srcValues = src.values();
+    arrayView1d< real64 > const dstValues = dst.open();
+    forAll< parallelHostPolicy >( src.localSize() / blockSize, [=] ( localIndex const blockIndex )
+    {
+      localIndex const offset = blockIndex * blockSize;
+      for( localIndex j = 0; j < blockSize; ++j )
+      {
+        real64 sum = 0.0;
+        for( localIndex k = 0; k < blockSize; ++k )
+        {
+          sum += blockValues[( offset + j ) * blockSize + k] * srcValues[offset + k];
+        }
+        dstValues[offset + j] = sum;
+      }
+    } );
+    dst.close();
   }
 
   /**
    * @brief Whether the preconditioner is available in matrix form
-   * @return true: explicit form is available
+   * @return true if the inverted blocks are stored in double precision
    */
   virtual bool hasPreconditionerMatrix() const override
   {
-    GEOS_LAI_ASSERT( m_blockDiag.ready() );
-    return true;
+    GEOS_LAI_ASSERT( this->ready() );
+    return m_precision == LinearSolverParameters::Precision::fp64;
   }
 
   /**
@@ -157,6 +238,12 @@ private:
 
   /// Block size
   localIndex m_blockSize = 0;
+
+  /// Precision used to store the inverted blocks
+  LinearSolverParameters::Precision m_precision;
+
+  /// Inverted diagonal blocks (row-major, local rows only), used in single precision
+  array1d< float > m_blockValues;
 };
 
 }
@@ -0,0 +1,238 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file PreconditionerChebyshev.hpp
+ */
+
+#ifndef GEOS_LINEARALGEBRA_SOLVERS_PRECONDITIONERCHEBYSHEV_HPP_
+#define GEOS_LINEARALGEBRA_SOLVERS_PRECONDITIONERCHEBYSHEV_HPP_
+
+#include "linearAlgebra/common/LinearOperator.hpp"
+#include "linearAlgebra/utilities/Arnoldi.hpp"
+#include "linearAlgebra/utilities/LinearSolverParameters.hpp"
+
+namespace geos
+{
+
+/**
+ * @brief Chebyshev-Jacobi polynomial preconditioner.
+ * @tparam VECTOR type of vectors the operator applies to
+ *
+ * The preconditioner performs a fixed number of Jacobi-preconditioned Chebyshev
+ * iterations on the operator with a zero initial guess. It only requires the
+ * action of the operator and its diagonal, and can therefore be combined with
+ * operators that are never assembled. The upper bound of the spectrum of
+ * D^{-1}A is estimated with a few Arnoldi iterations; the lower bound is
+ * a fixed fraction of it.
+ *
+ * Since the result is a fixed polynomial in D^{-1}A, the preconditioner is
+ * symmetric for symmetric operators and can be used with CG.
+ */
+template< typename VECTOR >
+class PreconditionerChebyshev : public LinearOperator< VECTOR >
+{
+public:
+
+  /// Alias for base type
+  using Base = LinearOperator< VECTOR >;
+
+  /// Alias for vector type
+  using Vector = typename Base::Vector;
+
+  /**
+   * @brief Constructor.
+   * @param op the operator to precondition (must outlive the preconditioner)
+   * @param diagonal the diagonal of the operator
+   * @param params the Chebyshev parameters
+   */
+  PreconditionerChebyshev( LinearOperator< Vector > const & op,
+                           Vector const & diagonal,
+                           LinearSolverParameters::Chebyshev const & params )
+    : Base(),
+    m_operator( op ),
+    m_degree( params.degree )
+  {
+    GEOS_ERROR_IF_LT_MSG( params.degree, 1, "Chebyshev: the polynomial degree must be positive" );
+    GEOS_ERROR_IF_LE_MSG( params.eigenvalueRatio, 1.0, "Chebyshev: the eigenvalue ratio must be larger than 1" );
+
+    m_diagInv.create( diagonal.localSize(), diagonal.comm() );
+    m_diagInv.copy( diagonal );
+    m_diagInv.reciprocal();
+
+    m_residual.create( diagonal.localSize(), diagonal.comm() );
+    m_scaledResidual.create( diagonal.localSize(), diagonal.comm() );
+    m_update.create( diagonal.localSize(), diagonal.comm() );
+
+    // The Arnoldi estimate approaches the largest eigenvalue from below, hence the safety factor
+    JacobiScaledOperator const scaledOperator( m_operator, m_diagInv, m_residual );
+    m_lambdaMax = 1.1 * ArnoldiLargestEigenvalue( scaledOperator, params.numEigenvalueIterations );
+    m_lambdaMin = m_lambdaMax / params.eigenvalueRatio;
+  }
+
+  /**
+   * @brief Apply operator to a vector.
+   * @param src Input vector (src).
+   * @param dst Output vector (dst).
+   */
+  virtual void apply( Vector const & src,
+                      Vector & dst ) const override
+  {
+    GEOS_LAI_ASSERT_EQ( this->numGlobalRows(), dst.globalSize() );
+    GEOS_LAI_ASSERT_EQ( this->numGlobalCols(), src.globalSize() );
+
+    // Chebyshev acceleration (Saad, Iterative Methods for Sparse Linear Systems, Alg. 12.1)
+    real64 const theta = 0.5 * ( m_lambdaMax + m_lambdaMin );
+    real64 const delta = 0.5 * ( m_lambdaMax - m_lambdaMin );
+    real64 const sigma = theta / delta;
+    real64 rho = 1.0 / sigma;
+
+    m_diagInv.pointwiseProduct( src, m_update );
+    m_update.scale( 1.0 / theta );
+    dst.copy( m_update );
+
+    for( integer k = 1; k < m_degree; ++k )
+    {
+      m_operator.residual( dst, src, m_residual );
+      m_diagInv.pointwiseProduct( m_residual, m_scaledResidual );
+
+      real64 const rhoNew = 1.0 / ( 2.0 * sigma - rho );
+      m_update.axpby( 2.0 * rhoNew / delta, m_scaledResidual, rhoNew * rho );
+      dst.axpy( 1.0, m_update );
+      rho = rhoNew;
+    }
+  }
+
+  /**
+   * @brief Get the number of global rows.
+   * @return Number of global rows in the operator.
+   */
+  virtual globalIndex numGlobalRows() const override final
+  {
+    return m_operator.numGlobalRows();
+  }
+
+  /**
+   * @brief Get the number of global columns.
+   * @return Number of global columns in the operator.
+   */
+  virtual globalIndex numGlobalCols() const override final
+  {
+    return m_operator.numGlobalCols();
+  }
+
+  /**
+   * @brief Get the number of local rows.
+   * @return Number of local rows in the operator.
+   */
+  virtual localIndex numLocalRows() const override final
+  {
+    return m_operator.numLocalRows();
+  }
+
+  /**
+   * @brief Get the number of local columns.
+   * @return Number of local columns in the operator.
+   */
+  virtual localIndex numLocalCols() const override final
+  {
+    return m_operator.numLocalCols();
+  }
+
+  /**
+   * @brief Get the MPI communicator.
+   * @return the communicator of the preconditioned operator
+   */
+  virtual MPI_Comm comm() const override final
+  {
+    return m_operator.comm();
+  }
+
+  /**
+   * @brief @return the upper bound of the spectrum of D^{-1}A targeted by the polynomial
+   */
+  real64 lambdaMax() const
+  {
+    return m_lambdaMax;
+  }
+
+private:
+
+  /**
+   * @brief Diagonally scaled operator D^{-1}A used to estimate the spectrum.
+   */
+  class JacobiScaledOperator : public LinearOperator< Vector >
+  {
+public:
+
+    JacobiScaledOperator( LinearOperator< Vector > const & op,
+                          Vector const & diagInv,
+                          Vector & temp )
+      : m_op( op ),
+      m_diagInv( diagInv ),
+      m_temp( temp )
+    {}
+
+    virtual void apply( Vector const & src, Vector & dst ) const override
+    {
+      m_op.apply( src, m_temp );
+      m_diagInv.pointwiseProduct( m_temp, dst );
+    }
+
+    virtual globalIndex numGlobalRows() const override { return m_op.numGlobalRows(); }
+
+    virtual globalIndex numGlobalCols() const override { return m_op.numGlobalCols(); }
+
+    virtual localIndex numLocalRows() const override { return m_op.numLocalRows(); }
+
+    virtual localIndex numLocalCols() const override { return m_op.numLocalCols(); }
+
+    virtual MPI_Comm comm() const override { return m_op.comm(); }
+
+private:
+
+    LinearOperator< Vector > const & m_op;
+    Vector const & m_diagInv;
+    Vector & m_temp;
+  };
+
+  /// The preconditioned operator
+  LinearOperator< Vector > const & m_operator;
+
+  /// Number of Chebyshev iterations per application
+  integer const m_degree;
+
+  /// Inverse of the diagonal of the operator
+  Vector m_diagInv;
+
+  /// Upper bound of the targeted spectrum
+  real64 m_lambdaMax = 0.0;
+
+  /// Lower bound of the targeted spectrum
+  real64 m_lambdaMin = 0.0;
+
+  /// Residual of the current iterate
+  mutable Vector m_residual;
+
+  /// Jacobi-scaled residual of the current iterate
+  mutable Vector m_scaledResidual;
+
+  /// Chebyshev update direction
+  mutable Vector m_update;
+};
+
+} // namespace geos
+
+#endif //GEOS_LINEARALGEBRA_SOLVERS_PRECONDITIONERCHEBYSHEV_HPP_
@@ -0,0 +1,425 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SStepGmresSolver.cpp
+ */
+
+#include "SStepGmresSolver.hpp"
+
+#include "common/MpiWrapper.hpp"
+#include "common/Stopwatch.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/solvers/KrylovUtils.hpp"
+
+namespace geos
+{
+
+namespace
+{
+
+/// Minimum fraction of the squared norm a basis vector must retain in the first orthogonalization pass
+constexpr real64 cholQrTolerance = 1.0e-12;
+
+/// Fraction of the squared norm below which a second orthogonalization pass is performed ("twice is enough")
+constexpr real64 reorthTolerance = 0.5;
+
+} // namespace
+
+template< typename VECTOR >
+SStepGmresSolver< VECTOR >::SStepGmresSolver( LinearSolverParameters params,
+                                              LinearOperator< Vector > const & A,
+                                              LinearOperator< Vector > const & M )
+  : KrylovSolver< VECTOR >( std::move( params ), A, M ),
+  m_kspace( m_params.krylov.maxRestart + 1 ),
+  m_kspaceInitialized( false )
+{
+  GEOS_ERROR_IF_LE_MSG( m_params.krylov.maxRestart, 0, "s-step GMRES: max number of iterations until restart must be positive." );
+  GEOS_ERROR_IF_LE_MSG( m_params.krylov.sStep, 0, "s-step GMRES: number of steps per block must be positive." );
+}
+
+template< typename VECTOR >
+integer SStepGmresSolver< VECTOR >::orthonormalizeBlock( MPI_Comm const comm,
+                                                         integer const j,
+                                                         integer const numVectors,
+                                                         real64 const tol,
+                                                         arraySlice2d< real64 > const & C,
+                                                         arraySlice2d< real64 > const & R,
+                                                         real64 & minRatio ) const
+{
+  integer const numBasis = j + 1;
+  integer const stride = numBasis + numVectors;
+
+  // Local contributions to [ V^T Y ; Y^T Y ], reduced with a single call
+  array1d< real64 > localProducts( numVectors * stride );
+  array1d< real64 > products( numVectors * stride );
+  for( integer c = 0; c < numVectors; ++c )
+  {
+    Vector const & y = m_kspace[j+1+c];
+    for( integer row = 0; row < numBasis; ++row )
+    {
+      localProducts[c * stride + row] = m_kspace[row].localDot( y );
+    }
+    for( integer a = 0; a <= c; ++a )
+    {
+      localProducts[c * stride + numBasis + a] = m_kspace[j+1+a].localDot( y );
+    }
+  }
+  MpiWrapper::allReduce( localProducts.data(),
+                         products.data(),
+                         LvArray::integerConversion< int >( products.size() ),
+                         MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ),
+                         comm );
+
+  for( integer c = 0; c < numVectors; ++c )
+  {
+    for( integer row = 0; row < numBasis; ++row )
+    {
+      C( row, c ) = products[c * stride + row];
+    }
+    for( integer a = 0; a < numVectors; ++a )
+    {
+      R( a, c ) = 0.0;
+    }
+  }
+
+  // Cholesky factorization of Y^T Y - C^T C, truncated at the first (numerically) dependent vector
+  minRatio = 1.0;
+  integer numAccepted = 0;
+  for( integer i = 0; i < numVectors; ++i )
+  {
+    real64 const norm2 = products[i * stride + numBasis + i];
+    real64 pivot = norm2;
+    for( integer row = 0; row < numBasis; ++row )
+    {
+      pivot -= C( row, i ) * C( row, i );
+    }
+    for( integer l = 0; l < i; ++l )
+    {
+      pivot -= R( l, i ) * R( l, i );
+    }
+    if( !( pivot > tol * norm2 ) )
+    {
+      break;
+    }
+
+    R( i, i ) = std::sqrt( pivot );
+    for( integer c = i + 1; c < numVectors; ++c )
+    {
+      real64 value = products[c * stride + numBasis + i];
+      for( integer row = 0; row < numBasis; ++row )
+      {
+        value -= C( row, i ) * C( row, c );
+      }
+      for( integer l = 0; l < i; ++l )
+      {
+        value -= R( l, i ) * R( l, c );
+      }
+      R( i, c ) = value / R( i, i );
+    }
+    minRatio = std::min( minRatio, pivot / norm2 );
+    ++numAccepted;
+  }
+
+  // Project out the current basis and apply R^{-1} in place
+  for( integer i = 0; i < numAccepted; ++i )
+  {
+    VectorTemp & y = m_kspace[j+1+i];
+    for( integer row = 0; row < numBasis; ++row )
+    {
+      y.axpy( -C( row, i ), m_kspace[row] );
+    }
+    for( integer l = 0; l < i; ++l )
+    {
+      y.axpy( -R( l, i ), m_kspace[j+1+l] );
+    }
+    y.scale( 1.0 / R( i, i ) );
+  }
+
+  return numAccepted;
+}
+
+template< typename VECTOR >
+void SStepGmresSolver< VECTOR >::solve( Vector const & b,
+                                        Vector & x ) const
+{
+  // We create Krylov subspace vectors once using the size and partitioning of b.
+  // On repeated calls to solve() input vectors must have the same size and partitioning.
+  if( !m_kspaceInitialized )
+  {
+    for( VectorTemp & kv : m_kspace )
+    {
+      kv = createTempVector( b );
+    }
+    m_kspaceInitialized = true;
+  }
+
+  Stopwatch watch;
+
+  // Define vectors
+  VectorTemp r = createTempVector( b );
+  VectorTemp w = createTempVector( b );
+  VectorTemp z = createTempVector( b );
+
+  // Compute initial rk
+  m_operator.residual( x, b, r );
+
+  // Compute the target absolute tolerance
+  real64 const rnorm0 = r.norm2();
+  real64 const absTol = rnorm0 * m_params.krylov.relTolerance;
+
+  integer const maxRestart = m_params.krylov.maxRestart;
+  integer const sStep = std::min( m_params.krylov.sStep, maxRestart );
+
+  // Create upper Hessenberg matrix, both rotated and as recovered from the block factorizations
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > H( maxRestart + 1, maxRestart );
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > Hraw( maxRestart + 1, maxRestart );
+
+  // Create block factorization storage for the first and the (optional) second orthogonalization pass
+  array2d< real64 > C( maxRestart + 1, sStep );
+  array2d< real64 > R( sStep, sStep );
+  array2d< real64 > C2( maxRestart + 1, sStep );
+  array2d< real64 > R2( sStep, sStep );
+
+  // Create plane rotation storage
+  array1d< real64 > c( maxRestart + 1 );
+  array1d< real64 > s( maxRestart + 1 );
+  array1d< real64 > g( maxRestart + 1 );
+
+  // Initialize iteration state
+  m_result.status = LinearSolverResult::Status::NotConverged;
+  m_residualNorms.clear();
+
+  integer & k = m_result.numIterations;
+  while( k <= m_params.krylov.maxIterations && m_result.status == LinearSolverResult::Status::NotConverged )
+  {
+    // Re-initialize Krylov subspace
+    g.zero();
+    g[0] = k > 0 ? r.norm2() : rnorm0;
+    m_kspace[0].copy( r );
+    if( g[0] > 0 )
+    {
+      m_kspace[0].scale( 1.0 / g[0] );
+    }
+    Hraw.zero();
+
+    // Scaling of the monomial basis, updated with the norm of the latest operator application
+    real64 sigma = 1.0;
+    integer blockEnd = 0;
+    bool isBreakdown = false;
+
+    integer j = 0;
+    for(; j < maxRestart && k <= m_params.krylov.maxIterations; ++j, ++k )
+    {
+      // Record iteration progress
+      real64 const rnorm = std::fabs( g[j] );
+      m_residualNorms.emplace_back( rnorm );
+      logProgress();
+
+      // Convergence check
+      if( rnorm <= absTol )
+      {
+        m_result.status = LinearSolverResult::Status::Success;
+        break;
+      }
+
+      if( j == blockEnd )
+      {
+        // Generate the scaled monomial basis Y_{i+1} = A M Y_i / sigma, with Y_0 = v_j
+        integer const blockSize = std::min( sStep, maxRestart - j );
+        for( integer i = 0; i < blockSize; ++i )
+        {
+          m_precond.apply( m_kspace[j+i], z );
+          m_operator.apply( z, m_kspace[j+i+1] );
+          m_kspace[j+i+1].scale( 1.0 / sigma );
+        }
+
+        // Block orthogonalization, followed by a reorthogonalization pass if needed
+        real64 minRatio;
+        integer numAccepted = orthonormalizeBlock( b.comm(), j, blockSize, cholQrTolerance, C.toSlice(), R.toSlice(), minRatio );
+        if( numAccepted > 0 && minRatio < reorthTolerance )
+        {
+          real64 const firstPivot = R( 0, 0 );
+          numAccepted = orthonormalizeBlock( b.comm(), j, numAccepted, reorthTolerance, C2.toSlice(), R2.toSlice(), minRatio );
+          if( numAccepted == 0 )
+          {
+            // keep the full projection of the first vector, needed for the last Hessenberg column
+            for( integer row = 0; row <= j; ++row )
+            {
+              C( row, 0 ) += C2( row, 0 ) * firstPivot;
+            }
+          }
+
+          // Combine both passes: C <- C + C2 R, R <- R2 R
+          for( integer col = 0; col < numAccepted; ++col )
+          {
+            for( integer row = 0; row <= j; ++row )
+            {
+              for( integer l = 0; l <= col; ++l )
+              {
+                C( row, col ) += C2( row, l ) * R( l, col );
+              }
+            }
+            for( integer row = 0; row <= col; ++row )
+            {
+              real64 value = 0.0;
+              for( integer l = row; l <= col; ++l )
+              {
+                value += R2( row, l ) * R( l, col );
+              }
+              R( row, col ) = value;
+            }
+          }
+        }
+
+        if( numAccepted == 0 )
+        {
+          // A M v_j lies in the span of the current basis: the last Hessenberg column has no subdiagonal entry.
+          // The update is still computed, and the true residual decides between convergence and breakdown.
+          for( integer row = 0; row <= j; ++row )
+          {
+            Hraw( row, j ) = sigma * C( row, 0 );
+          }
+          Hraw( j+1, j ) = 0.0;
+          isBreakdown = true;
+        }
+
+        // Recover the Hessenberg columns from A M Y_i = sigma Y_{i+1}, where
+        // Y_{i+1} = V C(:,i) + Q R(:,i) and Y_i = C(j,i-1) v_j + sum_l R(l,i-1) v_{j+1+l} + V_{0:j-1} C(0:j-1,i-1)
+        for( integer i = 0; i < numAccepted; ++i )
+        {
+          integer const col = j + i;
+          for( integer row = 0; row <= j; ++row )
+          {
+            Hraw( row, col ) = sigma * C( row, i );
+          }
+          for( integer l = 0; l <= i; ++l )
+          {
+            Hraw( j+1+l, col ) = sigma * R( l, i );
+          }
+          if( i > 0 )
+          {
+            for( integer prev = 0; prev < j; ++prev )
+            {
+              for( integer row = 0; row <= prev + 1; ++row )
+              {
+                Hraw( row, col ) -= C( prev, i-1 ) * Hraw( row, prev );
+              }
+            }
+            for( integer row = 0; row <= j + 1; ++row )
+            {
+              Hraw( row, col ) -= C( j, i-1 ) * Hraw( row, j );
+            }
+            for( integer l = 0; l < i - 1; ++l )
+            {
+              for( integer row = 0; row <= j + l + 2; ++row )
+              {
+                Hraw( row, col ) -= R( l, i-1 ) * Hraw( row, j+1+l );
+              }
+            }
+            for( integer row = 0; row <= col + 1; ++row )
+            {
+              Hraw( row, col ) /= R( i-1, i-1 );
+            }
+          }
+        }
+
+        real64 norm2 = R( 0, 0 ) * R( 0, 0 );
+        for( integer row = 0; row <= j; ++row )
+        {
+          norm2 += C( row, 0 ) * C( row, 0 );
+        }
+        sigma *= std::sqrt( norm2 );
+        blockEnd = j + numAccepted;
+      }
+
+      for( integer row = 0; row <= j + 1; ++row )
+      {
+        H( row, j ) = Hraw( row, j );
+      }
+
+      // Apply all previous rotations to the new column
+      for( integer i = 0; i < j; ++i )
+      {
+        krylov::ApplyGivensRotation( c[i], s[i], H( i, j ), H( i+1, j ) );
+      }
+
+      // Compute and apply the new rotation to eliminate subdiagonal element
+      krylov::ComputeGivensRotation( H( j, j ), H( j+1, j ), c[j], s[j] );
+      krylov::ApplyGivensRotation( c[j], s[j], H( j, j ), H( j+1, j ) );
+      krylov::ApplyGivensRotation( c[j], s[j], g[j], g[j+1] );
+
+      if( isBreakdown )
+      {
+        ++j;
+        ++k;
+        break;
+      }
+    }
+
+    // Regardless of how we quit out of inner loop, j is the actual size of H
+    krylov::Backsolve( j, H, g );
+    w.zero();
+    for( integer i = 0; i < j; ++i )
+    {
+      w.axpy( g[i], m_kspace[i] );
+    }
+    m_precond.apply( w, z );
+
+    // Update the solution vector and recompute residual
+    x.axpy( 1.0, z );
+    m_operator.residual( x, b, r );
+
+    if( isBreakdown )
+    {
+      real64 const rnorm = r.norm2();
+      m_residualNorms.emplace_back( rnorm );
+      if( rnorm <= absTol )
+      {
+        m_result.status = LinearSolverResult::Status::Success;
+      }
+      else
+      {
+        GEOS_LOG_RANK_0_IF( m_params.logLevel >= 1,
+                            "Breakdown in " << methodName() << ": no linearly independent basis vector at iteration " << k );
+        m_result.status = LinearSolverResult::Status::Breakdown;
+      }
+    }
+  }
+
+  m_result.residualReduction = rnorm0 > 0.0 ? m_residualNorms.back() / rnorm0 : 0.0;
+  m_result.solveTime = watch.elapsedTime();
+  logResult();
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOS_USE_TRILINOS
+template class SStepGmresSolver< TrilinosInterface::ParallelVector >;
+template class SStepGmresSolver< BlockVectorView< TrilinosInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOS_USE_HYPRE
+template class SStepGmresSolver< HypreInterface::ParallelVector >;
+template class SStepGmresSolver< BlockVectorView< HypreInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOS_USE_PETSC
+template class SStepGmresSolver< PetscInterface::ParallelVector >;
+template class SStepGmresSolver< BlockVectorView< PetscInterface::ParallelVector > >;
+#endif
+
+} // namespace geos
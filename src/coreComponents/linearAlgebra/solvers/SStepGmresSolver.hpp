@@ -0,0 +1,138 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SStepGmresSolver.hpp
+ */
+
+#ifndef GEOS_LINEARALGEBRA_SOLVERS_SSTEPGMRESSOLVER_HPP_
+#define GEOS_LINEARALGEBRA_SOLVERS_SSTEPGMRESSOLVER_HPP_
+
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+
+namespace geos
+{
+
+/**
+ * @brief This class implements the s-step (communication-avoiding) variant of the
+ *        right-preconditioned GMRES method for monolithic and block linear operators.
+ * @tparam VECTOR type of vectors this solver operates on.
+ *
+ * Instead of orthogonalizing each new Krylov vector as soon as it is generated,
+ * blocks of s vectors of a scaled monomial basis are generated with s consecutive
+ * preconditioner and operator applications, and orthogonalized together by a block
+ * Gram-Schmidt step followed by a Cholesky QR factorization. All inner products of
+ * a block are fused into a single global reduction. A second, reorthogonalization pass
+ * (one more fused reduction) is only performed when the first one loses too much accuracy.
+ * The Arnoldi relation is then recovered from the block factorization, so that the
+ * least-squares problem, the residual estimate and the convergence history are the same
+ * as in GmresSolver.
+ *
+ * @note The notation is consistent with "Communication-avoiding Krylov subspace
+ *       methods" from M. Hoemmen (2010).
+ */
+template< typename VECTOR >
+class SStepGmresSolver : public KrylovSolver< VECTOR >
+{
+public:
+
+  /// Alias for the base type
+  using Base = KrylovSolver< VECTOR >;
+
+  /// Alias for the vector type
+  using Vector = typename Base::Vector;
+
+  /**
+   * @name Constructor/Destructor Methods
+   */
+  ///@{
+
+  /**
+   * @brief Solver object constructor.
+   * @param[in] params  parameters for the solver
+   * @param[in] matrix  reference to the system matrix
+   * @param[in] precond reference to the preconditioning operator
+   */
+  SStepGmresSolver( LinearSolverParameters params,
+                    LinearOperator< Vector > const & matrix,
+                    LinearOperator< Vector > const & precond );
+
+  ///@}
+
+  /**
+   * @name KrylovSolver interface
+   */
+  ///@{
+
+  /**
+   * @brief Solve preconditioned system
+   * @param [in] b system right hand side.
+   * @param [inout] x system solution (input = initial guess, output = solution).
+   */
+  virtual void solve( Vector const & b, Vector & x ) const override final;
+
+  virtual string methodName() const override final
+  {
+    return "s-step GMRES";
+  };
+
+  ///@}
+
+protected:
+
+  /// Alias for vector type that can be used for temporaries
+  using VectorTemp = typename KrylovSolver< VECTOR >::VectorTemp;
+
+  using Base::m_params;
+  using Base::m_operator;
+  using Base::m_precond;
+  using Base::m_residualNorms;
+  using Base::m_result;
+  using Base::createTempVector;
+  using Base::logProgress;
+  using Base::logResult;
+
+  /**
+   * @brief Orthonormalize a block of Krylov vectors against the current basis and among themselves.
+   * @param[in] comm the communicator used for the fused reduction
+   * @param[in] j index of the last orthonormal basis vector
+   * @param[in] numVectors number of vectors to orthonormalize, stored in m_kspace[j+1:j+numVectors]
+   * @param[in] tol relative tolerance on the squared norm retained after projection,
+   *                below which a vector is considered linearly dependent
+   * @param[out] C projection coefficients onto m_kspace[0:j]
+   * @param[out] R upper triangular Cholesky QR factor
+   * @param[out] minRatio smallest ratio of squared norms after and before orthogonalization
+   * @return the number of leading vectors that have been orthonormalized
+   *
+   * All inner products are computed with a single fused global reduction.
+   */
+  integer orthonormalizeBlock( MPI_Comm const comm,
+                               integer const j,
+                               integer const numVectors,
+                               real64 const tol,
+                               arraySlice2d< real64 > const & C,
+                               arraySlice2d< real64 > const & R,
+                               real64 & minRatio ) const;
+
+  /// Storage for Krylov subspace vectors
+  array1d< VectorTemp > m_kspace;
+
+  /// Flag indicating whether kspace vectors have been created
+  bool mutable m_kspaceInitialized;
+};
+
+} // namespace geos
+
+#endif //GEOS_LINEARALGEBRA_SOLVERS_SSTEPGMRESSOLVER_HPP_
@@ -18,6 +18,9 @@
  */
 
 #include "common/DataTypes.hpp"
+#include "linearAlgebra/solvers/PreconditionerBlockILU.hpp"
+#include "linearAlgebra/solvers/PreconditionerBlockJacobi.hpp"
+#include "linearAlgebra/solvers/PreconditionerChebyshev.hpp"
 #include "linearAlgebra/solvers/PreconditionerIdentity.hpp"
 #include "linearAlgebra/solvers/KrylovSolver.hpp"
 #include "linearAlgebra/unitTests/testLinearAlgebraUtils.hpp"
@@ -56,6 +59,37 @@ LinearSolverParameters params_GMRES()
   return parameters;
 }
 
+LinearSolverParameters params_FGMRES()
+{
+  LinearSolverParameters parameters;
+  parameters.krylov.relTolerance = 1e-8;
+  parameters.krylov.maxIterations = 500;
+  parameters.krylov.maxRestart = 100;
+  parameters.solverType = geos::LinearSolverParameters::SolverType::fgmres;
+  return parameters;
+}
+
+LinearSolverParameters params_PipelinedCG()
+{
+  LinearSolverParameters parameters;
+  parameters.krylov.relTolerance = 1e-8;
+  parameters.krylov.maxIterations = 500;
+  parameters.solverType = geos::LinearSolverParameters::SolverType::pipelinedCg;
+  parameters.isSymmetric = true;
+  return parameters;
+}
+
+LinearSolverParameters params_SStepGMRES()
+{
+  LinearSolverParameters parameters;
+  parameters.krylov.relTolerance = 1e-8;
+  parameters.krylov.maxIterations = 500;
+  parameters.krylov.maxRestart = 100;
+  parameters.krylov.sStep = 3;
+  parameters.solverType = geos::LinearSolverParameters::SolverType::sstepGmres;
+  return parameters;
+}
+
 template< typename OPERATOR, typename PRECOND, typename VECTOR >
 class KrylovSolverTestBase : public ::testing::Test
 {
@@ -82,6 +116,12 @@ protected:
   real64 cond_est = 1.0;
 
   void test( LinearSolverParameters const & params )
+  {
+    test( params, precond );
+  }
+
+  void test( LinearSolverParameters const & params,
+             LinearOperator< typename OPERATOR::Vector > const & prec )
   {
     sol_true.rand( 1984 );
     sol_comp.zero();
@@ -89,7 +129,7 @@ protected:
 
     // Create the solver and solve the system
     using Vector = typename OPERATOR::Vector;
-    std::unique_ptr< KrylovSolver< Vector > > const solver = KrylovSolver< Vector >::create( params, matrix, precond );
+    std::unique_ptr< KrylovSolver< Vector > > const solver = KrylovSolver< Vector >::create( params, matrix, prec );
     solver->solve( rhs_true, sol_comp );
     EXPECT_TRUE( solver->result().success() );
 
@@ -155,10 +195,219 @@ TYPED_TEST_P( KrylovSolverTest, GMRES )
   this->test( params_GMRES() );
 }
 
+TYPED_TEST_P( KrylovSolverTest, FGMRES )
+{
+  this->test( params_FGMRES() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, MixedPrecisionFGMRES )
+{
+  LinearSolverParameters params = params_FGMRES();
+  params.preconditionerPrecision = LinearSolverParameters::Precision::fp32;
+  PreconditionerBlockJacobi< TypeParam > precond( params.dofsPerNode, params.preconditionerPrecision );
+  precond.setup( this->matrix );
+  EXPECT_FALSE( precond.hasPreconditionerMatrix() );
+  this->test( params, precond );
+}
+
+TYPED_TEST_P( KrylovSolverTest, MixedPrecisionBlockJacobi )
+{
+  using Matrix = typename TypeParam::ParallelMatrix;
+  using Vector = typename TypeParam::ParallelVector;
+
+  // Operator with two dofs per node, so that the inverted blocks are not scalars
+  Matrix elasticity;
+  geos::testing::compute2DElasticityOperator( MPI_COMM_GEOS, 1.0, 1.0, 20, 20, 10000., 0.2, elasticity );
+
+  LinearSolverParameters params = params_FGMRES();
+  params.dofsPerNode = 2;
+  PreconditionerBlockJacobi< TypeParam > precondDouble( params.dofsPerNode );
+  precondDouble.setup( elasticity );
+  params.preconditionerPrecision = LinearSolverParameters::Precision::fp32;
+  PreconditionerBlockJacobi< TypeParam > precondSingle( params.dofsPerNode, params.preconditionerPrecision );
+  precondSingle.setup( elasticity );
+
+  Vector src;
+  src.create( elasticity.numLocalCols(), MPI_COMM_GEOS );
+  src.rand( 1984 );
+  Vector dstDouble;
+  dstDouble.create( elasticity.numLocalRows(), MPI_COMM_GEOS );
+  Vector dstSingle;
+  dstSingle.create( elasticity.numLocalRows(), MPI_COMM_GEOS );
+
+  // The single precision blocks only differ from the double precision ones by rounding
+  precondDouble.apply( src, dstDouble );
+  precondSingle.apply( src, dstSingle );
+  dstSingle.axpy( -1.0, dstDouble );
+  EXPECT_LT( dstSingle.norm2(), 1e-5 * dstDouble.norm2() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, BlockILUGMRES )
+{
+  LinearSolverParameters const params = params_GMRES();
+  PreconditionerBlockILU< TypeParam > ilu0( 1, 0 );
+  ilu0.setup( this->matrix );
+  this->test( params, ilu0 );
+
+  // Fill-in adds blocks, the lower solve of the five-point stencil has one level per anti-diagonal
+  PreconditionerBlockILU< TypeParam > ilu1( 1, 1 );
+  ilu1.setup( this->matrix );
+  EXPECT_GT( ilu1.numFactorBlocks(), ilu0.numFactorBlocks() );
+  EXPECT_LT( ilu1.numLowerLevels(), this->matrix.numLocalRows() );
+  this->test( params, ilu1 );
+}
+
+TYPED_TEST_P( KrylovSolverTest, MultiDofBlockILUGMRES )
+{
+  using Matrix = typename TypeParam::ParallelMatrix;
+  using Vector = typename TypeParam::ParallelVector;
+
+  LinearSolverParameters const params = params_GMRES();
+
+  for( integer const blockSize : { 2, 3 } )
+  {
+    // Components coupled within each node, so that the factored blocks are dense
+    Matrix coupled;
+    computeCoupledLaplaceOperator( MPI_COMM_GEOS, 30, blockSize, 1.0, coupled );
+
+    PreconditionerBlockILU< TypeParam > ilu0( blockSize, 0 );
+    ilu0.setup( coupled );
+
+    Vector solTrue;
+    solTrue.create( coupled.numLocalCols(), MPI_COMM_GEOS );
+    solTrue.rand( 1984 );
+    Vector rhs;
+    rhs.create( coupled.numLocalRows(), MPI_COMM_GEOS );
+    coupled.apply( solTrue, rhs );
+    Vector sol;
+    sol.create( coupled.numLocalCols(), MPI_COMM_GEOS );
+    sol.zero();
+
+    std::unique_ptr< KrylovSolver< Vector > > const solver = KrylovSolver< Vector >::create( params, coupled, ilu0 );
+    solver->solve( rhs, sol );
+    EXPECT_TRUE( solver->result().success() );
+
+    sol.axpy( -1.0, solTrue );
+    EXPECT_LT( sol.norm2() / solTrue.norm2(), 1e2 * params.krylov.relTolerance );
+  }
+}
+
+TYPED_TEST_P( KrylovSolverTest, BlockILUBlockDiagonal )
+{
+  using Matrix = typename TypeParam::ParallelMatrix;
+  using Vector = typename TypeParam::ParallelVector;
+
+  integer constexpr blockSize = 3;
+
+  // Without coupling the components are independent: the block factorization only holds
+  // diagonal blocks and must reproduce the scalar factorization of the interleaved matrix
+  Matrix uncoupled;
+  computeCoupledLaplaceOperator( MPI_COMM_GEOS, 30, blockSize, 0.0, uncoupled );
+
+  PreconditionerBlockILU< TypeParam > scalarILU( 1, 0 );
+  scalarILU.setup( uncoupled );
+  PreconditionerBlockILU< TypeParam > blockILU( blockSize, 0 );
+  blockILU.setup( uncoupled );
+  EXPECT_EQ( scalarILU.numFactorBlocks(), blockSize * blockILU.numFactorBlocks() );
+
+  Vector src;
+  src.create( uncoupled.numLocalCols(), MPI_COMM_GEOS );
+  src.rand( 1984 );
+  Vector dstScalar;
+  dstScalar.create( uncoupled.numLocalRows(), MPI_COMM_GEOS );
+  Vector dstBlock;
+  dstBlock.create( uncoupled.numLocalRows(), MPI_COMM_GEOS );
+
+  scalarILU.apply( src, dstScalar );
+  blockILU.apply( src, dstBlock );
+  dstBlock.axpy( -1.0, dstScalar );
+  EXPECT_LT( dstBlock.norm2(), 1e-12 * dstScalar.norm2() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, MixedPrecisionBlockILUFGMRES )
+{
+  LinearSolverParameters params = params_FGMRES();
+  params.preconditionerPrecision = LinearSolverParameters::Precision::fp32;
+  params.preconditionerType = LinearSolverParameters::PreconditionerType::iluk;
+  params.ifact.fill = 1;
+  std::unique_ptr< PreconditionerBase< TypeParam > > precond = TypeParam::createPreconditioner( params );
+  precond->setup( this->matrix );
+  EXPECT_FALSE( precond->hasPreconditionerMatrix() );
+  this->test( params, *precond );
+}
+
+TYPED_TEST_P( KrylovSolverTest, DoublePrecisionBlockILUGMRES )
+{
+  // The native block ILU is selected explicitly, without going through single precision
+  LinearSolverParameters params = params_GMRES();
+  params.preconditionerType = LinearSolverParameters::PreconditionerType::blockIlu;
+  params.ifact.fill = 1;
+  std::unique_ptr< PreconditionerBase< TypeParam > > precond = TypeParam::createPreconditioner( params );
+  ASSERT_NE( dynamic_cast< PreconditionerBlockILU< TypeParam > * >( precond.get() ), nullptr );
+  precond->setup( this->matrix );
+  this->test( params, *precond );
+}
+
+TYPED_TEST_P( KrylovSolverTest, PipelinedCG )
+{
+  this->test( params_PipelinedCG() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, SStepGMRES )
+{
+  this->test( params_SStepGMRES() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, SStepGMRESLuckyBreakdown )
+{
+  using Vector = typename TypeParam::ParallelVector;
+
+  // With the identity as operator, the first block has no new direction: the Krylov space already contains the solution
+  Vector rhs;
+  rhs.create( this->matrix.numLocalRows(), MPI_COMM_GEOS );
+  rhs.rand( 1984 );
+  Vector sol;
+  sol.create( this->matrix.numLocalCols(), MPI_COMM_GEOS );
+  sol.zero();
+
+  std::unique_ptr< KrylovSolver< Vector > > const solver = KrylovSolver< Vector >::create( params_SStepGMRES(), this->precond, this->precond );
+  solver->solve( rhs, sol );
+  EXPECT_EQ( solver->result().status, LinearSolverResult::Status::Success );
+
+  sol.axpy( -1.0, rhs );
+  EXPECT_LT( sol.norm2(), 1e-12 * rhs.norm2() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, ChebyshevCG )
+{
+  using Vector = typename TypeParam::ParallelVector;
+  LinearSolverParameters const params = params_CG();
+
+  Vector diagonal;
+  diagonal.create( this->matrix.numLocalRows(), MPI_COMM_GEOS );
+  this->matrix.extractDiagonal( diagonal );
+
+  PreconditionerChebyshev< Vector > precond( this->matrix, diagonal, params.chebyshev );
+  EXPECT_GT( precond.lambdaMax(), 0.0 );
+  this->test( params, precond );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( KrylovSolverTest,
                              CG,
                              BiCGSTAB,
-                             GMRES );
+                             GMRES,
+                             FGMRES,
+                             MixedPrecisionFGMRES,
+                             MixedPrecisionBlockJacobi,
+                             BlockILUGMRES,
+                             MultiDofBlockILUGMRES,
+                             BlockILUBlockDiagonal,
+                             MixedPrecisionBlockILUFGMRES,
+                             DoublePrecisionBlockILUGMRES,
+                             PipelinedCG,
+                             SStepGMRES,
+                             SStepGMRESLuckyBreakdown,
+                             ChebyshevCG );
 
 #ifdef GEOS_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, KrylovSolverTest, TrilinosInterface, );
@@ -245,10 +494,22 @@ TYPED_TEST_P( KrylovSolverBlockTest, GMRES )
   this->test( params_GMRES() );
 }
 
+TYPED_TEST_P( KrylovSolverBlockTest, PipelinedCG )
+{
+  this->test( params_PipelinedCG() );
+}
+
+TYPED_TEST_P( KrylovSolverBlockTest, SStepGMRES )
+{
+  this->test( params_SStepGMRES() );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( KrylovSolverBlockTest,
                              CG,
                              BiCGSTAB,
-                             GMRES );
+                             GMRES,
+                             PipelinedCG,
+                             SStepGMRES );
 
 #ifdef GEOS_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, KrylovSolverBlockTest, TrilinosInterface, );
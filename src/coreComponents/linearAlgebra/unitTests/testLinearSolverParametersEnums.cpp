@@ -35,6 +35,8 @@ TEST( LinearSolverParametersEnums, SolverType )
   ASSERT_EQ( "fgmres", toString( EnumType::fgmres ) );
   ASSERT_EQ( "bicgstab", toString( EnumType::bicgstab ) );
   ASSERT_EQ( "preconditioner", toString( EnumType::preconditioner ) );
+  ASSERT_EQ( "pipelinedCg", toString( EnumType::pipelinedCg ) );
+  ASSERT_EQ( "sstepGmres", toString( EnumType::sstepGmres ) );
 }
 
 
@@ -58,6 +60,16 @@ TEST( LinearSolverParametersEnums, PreconditionerType )
   ASSERT_EQ( "block", toString( EnumType::block ) );
   ASSERT_EQ( "direct", toString( EnumType::direct ) );
   ASSERT_EQ( "bgs", toString( EnumType::bgs ) );
+  ASSERT_EQ( "blockIlu", toString( EnumType::blockIlu ) );
+}
+
+
+TEST( LinearSolverParametersEnums, Precision )
+{
+  using EnumType = LinearSolverParameters::Precision;
+
+  ASSERT_EQ( "fp64", toString( EnumType::fp64 ) );
+  ASSERT_EQ( "fp32", toString( EnumType::fp32 ) );
 }
 
 
@@ -131,6 +143,7 @@ TEST( LinearSolverParametersEnums, AMGSmootherType )
   ASSERT_EQ( "l1jacobi", toString( EnumType::l1jacobi ) );
   ASSERT_EQ( "fgs", toString( EnumType::fgs ) );
   ASSERT_EQ( "bgs", toString( EnumType::bgs ) );
+  ASSERT_EQ( "blockIlu", toString( EnumType::blockIlu ) );
   ASSERT_EQ( "sgs", toString( EnumType::sgs ) );
   ASSERT_EQ( "l1sgs", toString( EnumType::l1sgs ) );
   ASSERT_EQ( "chebyshev", toString( EnumType::chebyshev ) );
@@ -149,6 +162,29 @@ TEST( LinearSolverParametersEnums, AMGNullSpaceType )
   ASSERT_EQ( "rigidBodyModes", toString( EnumType::rigidBodyModes ) );
 }
 
+TEST( LinearSolverParameters, Equality )
+{
+  LinearSolverParameters const reference;
+  EXPECT_TRUE( reference == LinearSolverParameters() );
+
+  // a change in any of the nested parameter structs is detected
+  LinearSolverParameters params;
+  params.krylov.relTolerance = 1e-3;
+  EXPECT_FALSE( params == reference );
+
+  params = reference;
+  params.amg.numSweeps = 2;
+  EXPECT_FALSE( params == reference );
+
+  params = reference;
+  params.ifact.fill = 1;
+  EXPECT_FALSE( params == reference );
+
+  params = reference;
+  params.dd.overlap = 1;
+  EXPECT_FALSE( params == reference );
+}
+
 int main( int argc, char * * argv )
 {
   geos::testing::LinearAlgebraTestScope scope( argc, argv );
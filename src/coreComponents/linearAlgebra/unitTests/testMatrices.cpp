@@ -279,9 +279,58 @@ TYPED_TEST_P( MatrixTest, RectangularMatrixOperations )
   EXPECT_DOUBLE_EQ( c, std::sqrt( static_cast< real64 >( nRows * ( nRows + 1 ) * ( 2 * nRows + 1 ) ) / 3.0 ) );
 }
 
+TYPED_TEST_P( MatrixTest, UpdateValues )
+{
+  using Matrix = typename TypeParam::ParallelMatrix;
+
+  int const mpiSize = MpiWrapper::commSize( MPI_COMM_GEOS );
+  int const mpiRank = MpiWrapper::commRank( MPI_COMM_GEOS );
+
+  // Build a local tridiagonal matrix with a known sparsity pattern
+  localIndex const nLocalRows = 10;
+  globalIndex const nGlobalRows = nLocalRows * mpiSize;
+  globalIndex const rankOffset = nLocalRows * mpiRank;
+
+  CRSMatrix< real64, globalIndex > localMatrix( nLocalRows, nGlobalRows, 3 );
+  for( localIndex i = 0; i < nLocalRows; ++i )
+  {
+    globalIndex const row = rankOffset + i;
+    localMatrix.insertNonZero( i, row, 2.0 );
+    if( row > 0 )
+    {
+      localMatrix.insertNonZero( i, row - 1, -1.0 );
+    }
+    if( row < nGlobalRows - 1 )
+    {
+      localMatrix.insertNonZero( i, row + 1, -1.0 );
+    }
+  }
+
+  Matrix A;
+  A.create( localMatrix.toViewConst(), nLocalRows, MPI_COMM_GEOS );
+  EXPECT_DOUBLE_EQ( A.normInf(), 4.0 );
+
+  // Scale the values without touching the pattern and refresh the parallel matrix
+  forAll< serialPolicy >( nLocalRows, [localMatrix = localMatrix.toViewConstSizes()]( localIndex const i )
+  {
+    arraySlice1d< real64 > const entries = localMatrix.getEntries( i );
+    for( localIndex k = 0; k < entries.size(); ++k )
+    {
+      entries[k] *= 3.0;
+    }
+  } );
+  A.updateValues( localMatrix.toViewConst() );
+
+  EXPECT_EQ( A.numGlobalRows(), nGlobalRows );
+  EXPECT_EQ( A.numGlobalNonzeros(), 3 * nGlobalRows - 2 );
+  EXPECT_DOUBLE_EQ( A.normInf(), 12.0 );
+  EXPECT_DOUBLE_EQ( A.normMax(), 6.0 );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( MatrixTest,
                              MatrixMatrixOperations,
-                             RectangularMatrixOperations );
+                             RectangularMatrixOperations,
+                             UpdateValues );
 
 #ifdef GEOS_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, MatrixTest, TrilinosInterface, );
@@ -0,0 +1,276 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file testPreconditionerReuse.cpp
+ */
+
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/unitTests/testLinearAlgebraUtils.hpp"
+#include "linearAlgebra/utilities/LinearSolverParameters.hpp"
+#include "linearAlgebra/utilities/PreconditionerReuseTracker.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geos;
+
+using Reuse = LinearSolverParameters::Reuse;
+
+///////////////////////////////////////////////////////////////////////////////////////
+
+Reuse reuseParams( Reuse::Policy const policy )
+{
+  Reuse params;
+  params.policy = policy;
+  params.iterationGrowthFactor = 2.0;
+  return params;
+}
+
+TEST( PreconditionerReuseTracker, none )
+{
+  Reuse const params = reuseParams( Reuse::Policy::none );
+  PreconditionerReuseTracker tracker;
+
+  for( integer newtonIter = 0; newtonIter < 3; ++newtonIter )
+  {
+    tracker.update( params, 0.0, 1.0, newtonIter );
+    EXPECT_TRUE( tracker.isStale() );
+    EXPECT_FALSE( tracker.canReuse( params ) );
+    EXPECT_FALSE( tracker.recordSolve( params, false, 10 ) );
+  }
+}
+
+TEST( PreconditionerReuseTracker, newton )
+{
+  Reuse const params = reuseParams( Reuse::Policy::newton );
+  PreconditionerReuseTracker tracker;
+
+  // stale before the first setup
+  tracker.update( params, 0.0, 1.0, 0 );
+  EXPECT_FALSE( tracker.canReuse( params ) );
+  tracker.recordSolve( params, false, 10 );
+
+  // reused within the Newton loop
+  for( integer newtonIter = 1; newtonIter < 3; ++newtonIter )
+  {
+    tracker.update( params, 0.0, 1.0, newtonIter );
+    EXPECT_TRUE( tracker.canReuse( params ) );
+    EXPECT_FALSE( tracker.recordSolve( params, true, 12 ) );
+  }
+
+  // recomputed at the beginning of the next Newton loop, even within the same time step
+  tracker.update( params, 0.0, 1.0, 0 );
+  EXPECT_FALSE( tracker.canReuse( params ) );
+}
+
+TEST( PreconditionerReuseTracker, timeStep )
+{
+  Reuse const params = reuseParams( Reuse::Policy::timeStep );
+  PreconditionerReuseTracker tracker;
+
+  tracker.update( params, 0.0, 1.0, 0 );
+  EXPECT_FALSE( tracker.canReuse( params ) );
+  tracker.recordSolve( params, false, 10 );
+
+  // reused across the Newton iterations of the step
+  tracker.update( params, 0.0, 1.0, 1 );
+  EXPECT_TRUE( tracker.canReuse( params ) );
+  tracker.recordSolve( params, true, 10 );
+
+  // a time step cut is a new step
+  tracker.update( params, 0.0, 0.5, 0 );
+  EXPECT_FALSE( tracker.canReuse( params ) );
+  tracker.recordSolve( params, false, 10 );
+  tracker.update( params, 0.0, 0.5, 1 );
+  EXPECT_TRUE( tracker.canReuse( params ) );
+  tracker.recordSolve( params, true, 10 );
+
+  // and so is the next step
+  tracker.update( params, 0.5, 0.5, 0 );
+  EXPECT_FALSE( tracker.canReuse( params ) );
+
+  // one setup per step
+  EXPECT_EQ( tracker.numSetups(), 2 );
+}
+
+TEST( PreconditionerReuseTracker, adaptive )
+{
+  Reuse const params = reuseParams( Reuse::Policy::adaptive );
+  PreconditionerReuseTracker tracker;
+
+  tracker.update( params, 0.0, 1.0, 0 );
+  EXPECT_FALSE( tracker.canReuse( params ) );
+  EXPECT_FALSE( tracker.recordSolve( params, false, 10 ) );
+  EXPECT_EQ( tracker.numIterationsAfterSetup(), 10 );
+
+  // reused across Newton iterations and time steps as long as the iterations do not grow too much
+  for( integer step = 1; step < 4; ++step )
+  {
+    tracker.update( params, step * 1.0, 1.0, 0 );
+    EXPECT_TRUE( tracker.canReuse( params ) );
+    EXPECT_FALSE( tracker.recordSolve( params, true, 20 ) );
+  }
+
+  // the iteration growth threshold is exceeded (more than twice the iterations after the setup)
+  tracker.update( params, 4.0, 1.0, 0 );
+  EXPECT_TRUE( tracker.canReuse( params ) );
+  EXPECT_TRUE( tracker.recordSolve( params, true, 21 ) );
+  tracker.update( params, 4.0, 1.0, 1 );
+  EXPECT_FALSE( tracker.canReuse( params ) );
+
+  // the new setup resets the reference number of iterations
+  EXPECT_FALSE( tracker.recordSolve( params, false, 30 ) );
+  EXPECT_EQ( tracker.numIterationsAfterSetup(), 30 );
+  tracker.update( params, 4.0, 1.0, 2 );
+  EXPECT_TRUE( tracker.canReuse( params ) );
+  EXPECT_FALSE( tracker.recordSolve( params, true, 60 ) );
+}
+
+TEST( PreconditionerReuseTracker, markStale )
+{
+  Reuse const params = reuseParams( Reuse::Policy::adaptive );
+  PreconditionerReuseTracker tracker;
+
+  tracker.update( params, 0.0, 1.0, 0 );
+  tracker.recordSolve( params, false, 10 );
+  tracker.update( params, 0.0, 1.0, 1 );
+  EXPECT_TRUE( tracker.canReuse( params ) );
+
+  tracker.markStale();
+  EXPECT_FALSE( tracker.canReuse( params ) );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+
+#ifdef GEOS_USE_HYPRE
+
+LinearSolverParameters params_CG_AMG()
+{
+  LinearSolverParameters parameters;
+  parameters.krylov.relTolerance = 1e-8;
+  parameters.krylov.maxIterations = 30;
+  parameters.isSymmetric = true;
+  parameters.solverType = LinearSolverParameters::SolverType::cg;
+  parameters.preconditionerType = LinearSolverParameters::PreconditionerType::amg;
+  parameters.amg.smootherType = LinearSolverParameters::AMG::SmootherType::sgs;
+  parameters.amg.coarseType = LinearSolverParameters::AMG::CoarseType::direct;
+  return parameters;
+}
+
+class HypreSolverReuseTest : public ::testing::Test
+{
+protected:
+
+  using Matrix = HypreInterface::ParallelMatrix;
+  using Vector = HypreInterface::ParallelVector;
+
+  static globalIndex constexpr n = 50;
+
+  void SetUp() override
+  {
+    geos::testing::compute2DLaplaceOperator( MPI_COMM_GEOS, n, matrix );
+  }
+
+  /// Solve with a random exact solution, and return the relative error
+  real64 solve( LinearSolverBase< HypreInterface > & solver )
+  {
+    Vector solTrue;
+    solTrue.create( matrix.numLocalCols(), matrix.comm() );
+    solTrue.rand( 1984 );
+
+    Vector rhs;
+    rhs.create( matrix.numLocalRows(), matrix.comm() );
+    matrix.apply( solTrue, rhs );
+
+    Vector sol;
+    sol.create( solTrue.localSize(), solTrue.comm() );
+    sol.zero();
+
+    solver.solve( rhs, sol );
+
+    sol.axpy( -1.0, solTrue );
+    return sol.norm2() / solTrue.norm2();
+  }
+
+  Matrix matrix;
+};
+
+TEST_F( HypreSolverReuseTest, perturbedMatrix )
+{
+  LinearSolverParameters const params = params_CG_AMG();
+  std::unique_ptr< LinearSolverBase< HypreInterface > > solver = HypreInterface::createSolver( params );
+  ASSERT_TRUE( solver->supportsPreconditionerReuse() );
+
+  solver->setPreconditionerReuse( false );
+  solver->setup( matrix );
+  solve( *solver );
+  ASSERT_TRUE( solver->result().success() );
+  integer const numIterFresh = solver->result().numIterations;
+
+  // Perturb the values of the matrix in place, as done between Newton iterations
+  matrix.scale( 1.1 );
+
+  solver->setPreconditionerReuse( true );
+  solver->setup( matrix );
+  real64 const error = solve( *solver );
+
+  // The reused preconditioner is still effective, and the solve uses the updated operator
+  EXPECT_TRUE( solver->result().success() );
+  EXPECT_LE( solver->result().numIterations, numIterFresh + 2 );
+  EXPECT_LT( error, 1e4 * params.krylov.relTolerance );
+}
+
+TEST_F( HypreSolverReuseTest, retryWithFreshSetup )
+{
+  LinearSolverParameters const params = params_CG_AMG();
+  std::unique_ptr< LinearSolverBase< HypreInterface > > solver = HypreInterface::createSolver( params );
+
+  // Preconditioner computed on a very different matrix (identity)
+  Matrix identity;
+  geos::testing::computeIdentity( MPI_COMM_GEOS, n * n, identity );
+  solver->setPreconditionerReuse( false );
+  solver->setup( identity );
+
+  PreconditionerReuseTracker tracker;
+  Reuse reuse;
+  reuse.policy = Reuse::Policy::adaptive;
+  tracker.update( reuse, 0.0, 1.0, 0 );
+  tracker.recordSolve( reuse, false, 1 );
+  tracker.update( reuse, 0.0, 1.0, 1 );
+  ASSERT_TRUE( tracker.canReuse( reuse ) );
+
+  // The reused preconditioner is too far off: the solve fails within the iteration limit
+  solver->setPreconditionerReuse( true );
+  solver->setup( matrix );
+  solve( *solver );
+  EXPECT_FALSE( solver->result().success() );
+
+  // Retry with a fresh setup, as done in PhysicsSolverBase::solveLinearSystem
+  solver->setPreconditionerReuse( false );
+  solver->setup( matrix );
+  real64 const error = solve( *solver );
+  EXPECT_TRUE( solver->result().success() );
+  EXPECT_LT( error, 1e4 * params.krylov.relTolerance );
+  EXPECT_FALSE( tracker.recordSolve( reuse, false, solver->result().numIterations ) );
+  EXPECT_FALSE( tracker.isStale() );
+}
+
+#endif
+
+int main( int argc, char * * argv )
+{
+  geos::testing::LinearAlgebraTestScope scope( argc, argv );
+  return RUN_ALL_TESTS();
+}
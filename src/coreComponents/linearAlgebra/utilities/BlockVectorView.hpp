@@ -21,6 +21,7 @@
 #define GEOS_LINEARALGEBRA_UTILITIES_BLOCKVECTORVIEW_HPP_
 
 #include "common/common.hpp"
+#include "common/MpiWrapper.hpp"
 #include "linearAlgebra/common/common.hpp"
 
 namespace geos
@@ -103,6 +104,13 @@ public:
    */
   real64 dot( BlockVectorView const & x ) const;
 
+  /**
+   * @brief Local (rank-wise) contribution to the dot product, without global reduction.
+   * @param x the block vector to compute product with
+   * @return the local part of the dot product
+   */
+  real64 localDot( BlockVectorView const & x ) const;
+
   /**
    * @brief 2-norm of the block vector.
    * @return 2-norm of the block vector
@@ -159,6 +167,15 @@ public:
    */
   localIndex localSize() const;
 
+  /**
+   * @brief Get the communicator used by the sub-vectors.
+   * @return the MPI communicator of the first block
+   */
+  MPI_Comm comm() const
+  {
+    return block( 0 ).comm();
+  }
+
   /**
    * @brief Print the block vector.
    * @param os the stream to print to
@@ -307,6 +324,18 @@ real64 BlockVectorView< VECTOR >::dot( BlockVectorView const & src ) const
   return accum;
 }
 
+template< typename VECTOR >
+real64 BlockVectorView< VECTOR >::localDot( BlockVectorView const & src ) const
+{
+  GEOS_LAI_ASSERT_EQ( blockSize(), src.blockSize() );
+  real64 accum = 0;
+  for( localIndex i = 0; i < blockSize(); i++ )
+  {
+    accum += block( i ).localDot( src.block( i ) );
+  }
+  return accum;
+}
+
 template< typename VECTOR >
 real64 BlockVectorView< VECTOR >::norm2() const
 {
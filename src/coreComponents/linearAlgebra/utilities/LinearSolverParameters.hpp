@@ -22,6 +22,8 @@
 
 #include "common/format/EnumStrings.hpp"
 
+#include <tuple>
+
 namespace geos
 {
 
@@ -43,7 +45,9 @@ struct LinearSolverParameters
     gmres,         ///< GMRES
     fgmres,        ///< Flexible GMRES
     bicgstab,      ///< BiCGStab
-    preconditioner ///< Preconditioner only
+    preconditioner, ///< Preconditioner only
+    pipelinedCg,   ///< Pipelined CG (single fused non-blocking reduction per iteration)
+    sstepGmres     ///< s-step GMRES (fused reductions per block of s iterations)
   };
 
   /**
@@ -67,6 +71,16 @@ struct LinearSolverParameters
     block,     ///< Block preconditioner
     direct,    ///< Direct solver as preconditioner
     bgs,       ///< Gauss-Seidel smoothing (backward sweep)
+    blockIlu,  ///< Native block ILU(k) with block size dofsPerNode
+  };
+
+  /**
+   * @brief Floating-point precision used to store and apply the preconditioner.
+   */
+  enum class Precision : integer
+  {
+    fp64, ///< Double precision
+    fp32  ///< Single precision (natively implemented preconditioners only)
   };
 
   integer logLevel = 0;     ///< Output level [0=none, 1=basic, 2=everything]
@@ -76,6 +90,7 @@ struct LinearSolverParameters
 
   SolverType solverType = SolverType::direct;          ///< Solver type
   PreconditionerType preconditionerType = PreconditionerType::iluk;  ///< Preconditioner type
+  Precision preconditionerPrecision = Precision::fp64;              ///< Preconditioner precision
 
   /// Direct solver parameters: used for SuperLU_Dist interface through hypre and PETSc
   struct Direct
@@ -109,6 +124,21 @@ struct LinearSolverParameters
     integer replaceTinyPivot = 1;     ///< Whether to replace tiny pivots by sqrt(epsilon)*norm(A)
     integer iterativeRefine = 1;      ///< Whether to perform iterative refinement
     integer parallel = 1;             ///< Whether to use a parallel solver (instead of a serial one)
+
+    /// @return references to all the parameters, to be extended when a parameter is added
+    auto tie() const
+    {
+      return std::tie( checkResidual, equilibrate, colPerm, rowPerm, replaceTinyPivot, iterativeRefine, parallel );
+    }
+
+    /**
+     * @param other the parameters to compare with
+     * @return true if all the parameters are equal
+     */
+    bool operator==( Direct const & other ) const
+    {
+      return tie() == other.tie();
+    }
   }
   direct;                             ///< direct solver parameter struct
 
@@ -122,11 +152,28 @@ struct LinearSolverParameters
 #else
     integer maxRestart = 200;         ///< Max number of vectors in Krylov basis before restarting (CPUs)
 #endif
+    integer sStep = 4;                ///< Number of Krylov vectors generated per block in s-step methods
     integer useAdaptiveTol = false;   ///< Use Eisenstat-Walker adaptive tolerance
     real64 weakestTol = 1e-3;         ///< Weakest allowed tolerance when using adaptive method
     real64 strongestTol = 1e-8;       ///< Strongest allowed tolerance when using adaptive method
     real64 adaptiveGamma = 0.1;       ///< Gamma parameter for adaptive method
     real64 adaptiveExponent = 1.0;    ///< Exponent parameter for adaptive method
+
+    /// @return references to all the parameters, to be extended when a parameter is added
+    auto tie() const
+    {
+      return std::tie( relTolerance, maxIterations, maxRestart, sStep, useAdaptiveTol,
+                       weakestTol, strongestTol, adaptiveGamma, adaptiveExponent );
+    }
+
+    /**
+     * @param other the parameters to compare with
+     * @return true if all the parameters are equal
+     */
+    bool operator==( Krylov const & other ) const
+    {
+      return tie() == other.tie();
+    }
   }
   krylov;                             ///< Krylov-method parameter struct
 
@@ -135,9 +182,82 @@ struct LinearSolverParameters
   {
     integer useRowScaling = false;    ///< Apply row scaling
     integer useRowColScaling = false; ///< Apply row and column scaling (not yet implemented)
+
+    /// @return references to all the parameters, to be extended when a parameter is added
+    auto tie() const
+    {
+      return std::tie( useRowScaling, useRowColScaling );
+    }
+
+    /**
+     * @param other the parameters to compare with
+     * @return true if all the parameters are equal
+     */
+    bool operator==( Scaling const & other ) const
+    {
+      return tie() == other.tie();
+    }
   }
   scaling;                            ///< Matrix-scaling parameter struct
 
+  /// Preconditioner reuse parameters
+  struct Reuse
+  {
+    /**
+     * @brief Policy controlling when the preconditioner is recomputed.
+     */
+    enum class Policy : integer
+    {
+      none,     ///< Recompute the preconditioner for every linear solve
+      newton,   ///< Recompute at the first iteration of each Newton loop, reuse for the subsequent iterations
+      timeStep, ///< Recompute once per time step (and after each time step cut)
+      adaptive  ///< Keep the preconditioner as long as the Krylov convergence does not degrade
+    };
+
+    Policy policy = Policy::none;       ///< Preconditioner reuse policy
+    real64 iterationGrowthFactor = 2.0; ///< Recompute when iterations exceed this factor times those after the last setup
+
+    /// @return references to all the parameters, to be extended when a parameter is added
+    auto tie() const
+    {
+      return std::tie( policy, iterationGrowthFactor );
+    }
+
+    /**
+     * @param other the parameters to compare with
+     * @return true if all the parameters are equal
+     */
+    bool operator==( Reuse const & other ) const
+    {
+      return tie() == other.tie();
+    }
+  }
+  reuse;                                ///< Preconditioner reuse parameter struct
+
+  /// Chebyshev-Jacobi polynomial preconditioner parameters (native matrix-free solvers)
+  struct Chebyshev
+  {
+    integer degree = 4;                  ///< Number of Chebyshev iterations per application
+    real64 eigenvalueRatio = 30.0;       ///< Ratio between the upper and lower bounds of the targeted spectrum
+    integer numEigenvalueIterations = 10; ///< Number of Arnoldi iterations to estimate the largest eigenvalue
+
+    /// @return references to all the parameters, to be extended when a parameter is added
+    auto tie() const
+    {
+      return std::tie( degree, eigenvalueRatio, numEigenvalueIterations );
+    }
+
+    /**
+     * @param other the parameters to compare with
+     * @return true if all the parameters are equal
+     */
+    bool operator==( Chebyshev const & other ) const
+    {
+      return tie() == other.tie();
+    }
+  }
+  chebyshev;                            ///< Chebyshev preconditioner parameter struct
+
   /// Algebraic multigrid parameters
   struct AMG
   {
@@ -262,6 +382,25 @@ struct LinearSolverParameters
                                                                     ///< and smoothed-aggregation AMG)
     integer separateComponents = false;                             ///< Apply a separate component filter before AMG construction
     NullSpaceType nullSpaceType = NullSpaceType::constantModes;     ///< Null space type [constantModes,rigidBodyModes]
+
+    /// @return references to all the parameters, to be extended when a parameter is added
+    auto tie() const
+    {
+      return std::tie( coarseningType, smootherType, maxLevels, cycleType, coarseType,
+                       interpolationType, interpolationMaxNonZeros, relaxWeight, numSweeps,
+                       numFunctions, aggressiveNumPaths, aggressiveNumLevels, aggressiveInterpType,
+                       aggressiveInterpMaxNonZeros, preOrPostSmoothing, threshold,
+                       separateComponents, nullSpaceType );
+    }
+
+    /**
+     * @param other the parameters to compare with
+     * @return true if all the parameters are equal
+     */
+    bool operator==( AMG const & other ) const
+    {
+      return tie() == other.tie();
+    }
   }
   amg;                                                              ///< Algebraic Multigrid (AMG) parameters
 
@@ -302,6 +441,21 @@ struct LinearSolverParameters
     integer separateComponents = false;            ///< Apply a separate displacement component (SDC) filter before AMG construction
     integer areWellsShut = false;                  ///< Flag to let MGR know that wells are shut, and that jacobi can be applied to the
                                                    ///< well block
+
+    /// @return references to all the parameters, to be extended when a parameter is added
+    auto tie() const
+    {
+      return std::tie( strategy, separateComponents, areWellsShut );
+    }
+
+    /**
+     * @param other the parameters to compare with
+     * @return true if all the parameters are equal
+     */
+    bool operator==( MGR const & other ) const
+    {
+      return tie() == other.tie();
+    }
   }
   mgr;                                             ///< Multigrid reduction (MGR) parameters
 
@@ -310,6 +464,21 @@ struct LinearSolverParameters
   {
     integer fill = 0;        ///< Fill level
     real64 threshold = 0.0;  ///< Dropping threshold
+
+    /// @return references to all the parameters, to be extended when a parameter is added
+    auto tie() const
+    {
+      return std::tie( fill, threshold );
+    }
+
+    /**
+     * @param other the parameters to compare with
+     * @return true if all the parameters are equal
+     */
+    bool operator==( IFact const & other ) const
+    {
+      return tie() == other.tie();
+    }
   }
   ifact;                       ///< Incomplete factorization parameter struct
 
@@ -317,8 +486,39 @@ struct LinearSolverParameters
   struct DD
   {
     integer overlap = 0;   ///< Ghost overlap
+
+    /// @return references to all the parameters, to be extended when a parameter is added
+    auto tie() const
+    {
+      return std::tie( overlap );
+    }
+
+    /**
+     * @param other the parameters to compare with
+     * @return true if all the parameters are equal
+     */
+    bool operator==( DD const & other ) const
+    {
+      return tie() == other.tie();
+    }
   }
   dd;                      ///< Domain decomposition parameter struct
+
+  /// @return references to all the parameters, to be extended when a parameter or a parameter struct is added
+  auto tie() const
+  {
+    return std::tie( logLevel, dofsPerNode, isSymmetric, stopIfError, solverType, preconditionerType, preconditionerPrecision,
+                     direct, krylov, scaling, reuse, chebyshev, amg, mgr, ifact, dd );
+  }
+
+  /**
+   * @param other the parameters to compare with
+   * @return true if all the parameters, including the nested ones, are equal
+   */
+  bool operator==( LinearSolverParameters const & other ) const
+  {
+    return tie() == other.tie();
+  }
 };
 
 /// Declare strings associated with enumeration values.
@@ -328,7 +528,9 @@ ENUM_STRINGS( LinearSolverParameters::SolverType,
               "gmres",
               "fgmres",
               "bicgstab",
-              "preconditioner" );
+              "preconditioner",
+              "pipelinedCg",
+              "sstepGmres" );
 
 /// Declare strings associated with enumeration values.
 ENUM_STRINGS( LinearSolverParameters::PreconditionerType,
@@ -347,7 +549,20 @@ ENUM_STRINGS( LinearSolverParameters::PreconditionerType,
               "mgr",
               "block",
               "direct",
-              "bgs" );
+              "bgs",
+              "blockIlu" );
+
+/// Declare strings associated with enumeration values.
+ENUM_STRINGS( LinearSolverParameters::Precision,
+              "fp64",
+              "fp32" );
+
+/// Declare strings associated with enumeration values.
+ENUM_STRINGS( LinearSolverParameters::Reuse::Policy,
+              "none",
+              "newton",
+              "timeStep",
+              "adaptive" );
 
 /// Declare strings associated with enumeration values.
 ENUM_STRINGS( LinearSolverParameters::Direct::ColPerm,
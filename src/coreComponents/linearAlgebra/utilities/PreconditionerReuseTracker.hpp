@@ -0,0 +1,178 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file PreconditionerReuseTracker.hpp
+ */
+
+#ifndef GEOS_LINEARALGEBRA_UTILITIES_PRECONDITIONERREUSETRACKER_HPP_
+#define GEOS_LINEARALGEBRA_UTILITIES_PRECONDITIONERREUSETRACKER_HPP_
+
+#include "codingUtilities/Utilities.hpp"
+#include "common/DataTypes.hpp"
+#include "linearAlgebra/utilities/LinearSolverParameters.hpp"
+
+namespace geos
+{
+
+/**
+ * @class PreconditionerReuseTracker
+ * @brief Decide when a preconditioner must be recomputed, according to a reuse policy.
+ *
+ * The preconditioner becomes stale at the events defined by the policy (every solve, every Newton
+ * loop, every time step), and independently of the policy when the number of Krylov iterations grows
+ * beyond LinearSolverParameters::Reuse::iterationGrowthFactor times the number of iterations of the
+ * first solve following the last setup.
+ */
+class PreconditionerReuseTracker
+{
+public:
+
+  /// Alias for the reuse parameters
+  using Reuse = LinearSolverParameters::Reuse;
+
+  /**
+   * @brief Flag the preconditioner as stale according to the reuse policy.
+   * @param params the reuse parameters
+   * @param time_n the time at the beginning of the step
+   * @param dt the size of the time step
+   * @param newtonIter the current Newton iteration
+   */
+  void update( Reuse const & params,
+               real64 const & time_n,
+               real64 const & dt,
+               integer const newtonIter )
+  {
+    switch( params.policy )
+    {
+      case Reuse::Policy::none:
+      {
+        m_isStale = true;
+        break;
+      }
+      case Reuse::Policy::newton:
+      {
+        m_isStale = m_isStale || newtonIter == 0;
+        break;
+      }
+      case Reuse::Policy::timeStep:
+      {
+        // a time step cut is treated as a new time step
+        bool const isNewStep = !isZero( time_n - m_setupTime ) || !isZero( dt - m_setupDt );
+        m_isStale = m_isStale || isNewStep;
+        break;
+      }
+      case Reuse::Policy::adaptive:
+      {
+        // only recomputed when the convergence degrades
+        break;
+      }
+    }
+
+    if( m_isStale )
+    {
+      m_setupTime = time_n;
+      m_setupDt = dt;
+    }
+  }
+
+  /**
+   * @brief Force the recomputation of the preconditioner at the next solve.
+   */
+  void markStale()
+  {
+    m_isStale = true;
+  }
+
+  /**
+   * @return true if the preconditioner must be recomputed at the next solve
+   */
+  bool isStale() const
+  {
+    return m_isStale;
+  }
+
+  /**
+   * @param params the reuse parameters
+   * @return true if the next solve can reuse the current preconditioner
+   */
+  bool canReuse( Reuse const & params ) const
+  {
+    return params.policy != Reuse::Policy::none && !m_isStale;
+  }
+
+  /**
+   * @brief Record the outcome of a linear solve.
+   * @param params the reuse parameters
+   * @param isReused whether the solve reused the preconditioner
+   * @param numIterations the number of Krylov iterations of the solve
+   * @return true if the convergence degraded enough for the preconditioner to become stale
+   */
+  bool recordSolve( Reuse const & params,
+                    bool const isReused,
+                    integer const numIterations )
+  {
+    if( !isReused )
+    {
+      ++m_numSetups;
+      m_isStale = false;
+      m_numIterationsAfterSetup = numIterations;
+      return false;
+    }
+    if( numIterations > params.iterationGrowthFactor * LvArray::math::max( m_numIterationsAfterSetup, 1 ) )
+    {
+      m_isStale = true;
+      return true;
+    }
+    return false;
+  }
+
+  /**
+   * @return the number of Krylov iterations of the first solve following the last setup
+   */
+  integer numIterationsAfterSetup() const
+  {
+    return m_numIterationsAfterSetup;
+  }
+
+  /**
+   * @return the number of solves recorded with a recomputed preconditioner
+   */
+  integer numSetups() const
+  {
+    return m_numSetups;
+  }
+
+private:
+
+  /// Flag indicating that the preconditioner must be recomputed at the next solve
+  bool m_isStale = true;
+
+  /// Number of Krylov iterations of the first solve following the last setup
+  integer m_numIterationsAfterSetup = 0;
+
+  /// Number of solves recorded with a recomputed preconditioner
+  integer m_numSetups = 0;
+
+  /// Time at the beginning of the step during which the preconditioner was last recomputed
+  real64 m_setupTime = -1.0;
+
+  /// Time step size for which the preconditioner was last recomputed
+  real64 m_setupDt = -1.0;
+};
+
+} // namespace geos
+
+#endif // GEOS_LINEARALGEBRA_UTILITIES_PRECONDITIONERREUSETRACKER_HPP_
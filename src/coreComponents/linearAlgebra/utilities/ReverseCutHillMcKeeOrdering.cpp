@@ -32,6 +32,9 @@ namespace reverseCutHillMcKeeOrdering
  * @param[in] degree the degree array
  * @param[in] marker the marker array for unvisited node
  * @param[out] rootRef reference to the root (= node with the minimum degree)
+ *
+ * The search is threaded. The degree and the index are combined in a single key,
+ * so that ties are broken by the lowest index, as in a sequential search.
  */
 static void
 findNodeWithMinDegree( localIndex const numRows,
@@ -39,16 +42,16 @@ findNodeWithMinDegree( localIndex const numRows,
                        arrayView1d< localIndex > const marker,
                        localIndex & rootRef )
 {
-  RAJA::ReduceMinLoc< serialReduce, localIndex > minDegree( LvArray::NumericLimits< localIndex >::max, -1 );
+  RAJA::ReduceMin< parallelHostReduce, globalIndex > minKey( LvArray::NumericLimits< globalIndex >::max );
 
-  forAll< serialPolicy >( numRows, [=] ( localIndex const i )
+  forAll< parallelHostPolicy >( numRows, [=] ( localIndex const i )
   {
     if( marker[i] < 0 )
     {
-      minDegree.minloc( degree[i], i );
+      minKey.min( static_cast< globalIndex >( degree[i] ) * numRows + i );
     }
   } );
-  rootRef = minDegree.getLoc();
+  rootRef = LvArray::integerConversion< localIndex >( minKey.get() % numRows );
 }
 
 /**
@@ -341,10 +344,12 @@ computePermutation( localIndex const * const offsets,
   // at most numRows levels
   array1d< localIndex > level_i( numRows+1 );
   array1d< localIndex > level_j( numRows );
-  forAll< parallelHostPolicy >( numRows, [&] ( localIndex const i )
+  arrayView1d< localIndex > const degreeView = degree.toView();
+  arrayView1d< localIndex > const markerView = marker.toView();
+  forAll< parallelHostPolicy >( numRows, [=] ( localIndex const i )
   {
-    degree[i] = offsets[i + 1] - offsets[i];
-    marker[i] = -1;
+    degreeView[i] = offsets[i + 1] - offsets[i];
+    markerView[i] = -1;
   } );
 
   // start RCM loop
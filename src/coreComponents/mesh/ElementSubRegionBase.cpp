@@ -61,5 +61,11 @@ void ElementSubRegionBase::resizePerElementValues( localIndex const newNumNodesP
   m_numFacesPerElement = newNumFacesPerElement;
 }
 
+void ElementSubRegionBase::clearElementColoring()
+{
+  m_elementColor.clear();
+  m_elementsByColor.resize( 0 );
+}
+
 
 } /* namespace geos */
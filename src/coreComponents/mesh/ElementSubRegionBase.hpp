@@ -205,6 +205,78 @@ public:
   { m_elementType = elemType; }
 
 
+  ///@}
+
+  /**
+   * @name Element coloring
+   *
+   * An element coloring partitions the elements of the subregion such that two elements of the
+   * same color never share a node. Kernels that scatter element contributions to nodes can then
+   * process one color at a time and use plain additions instead of atomic ones.
+   */
+  ///@{
+
+  /// Maximum number of colors of an element coloring
+  static constexpr integer maxNumElementColors = 64;
+
+  /**
+   * @brief Compute a greedy node-sharing coloring of the elements of this subregion.
+   * @tparam NODE_MAP Type of the element to node mapping.
+   * @param toNodesRelation Element to node mapping
+   * @param numNodes The number of nodes in the node manager
+   * @return true if a coloring with at most maxNumElementColors colors has been found
+   *
+   * If more than maxNumElementColors colors would be needed, the coloring is cleared and the
+   * subregion is left uncolored.
+   */
+  template< class NODE_MAP >
+  bool computeElementColoring( NODE_MAP const & toNodesRelation,
+                               localIndex const numNodes );
+
+  /**
+   * @brief Remove the element coloring of this subregion.
+   */
+  void clearElementColoring();
+
+  /**
+   * @brief @return true if the subregion holds a coloring that is consistent with its current size
+   */
+  bool hasElementColoring() const
+  { return m_elementsByColor.size() > 0 && m_elementColor.size() == size(); }
+
+  /**
+   * @brief @return the number of colors of the element coloring (zero if there is none)
+   */
+  integer numElementColors() const
+  { return hasElementColoring() ? LvArray::integerConversion< integer >( m_elementsByColor.size() ) : 0; }
+
+  /**
+   * @brief Get the color of each element in this subregion.
+   * @return an arrayView1d of const element colors
+   */
+  arrayView1d< integer const > getElementColor() const
+  { return m_elementColor; }
+
+  /**
+   * @brief Get the elements of this subregion grouped by color.
+   * @return an ArrayOfArraysView in which array c holds the (sorted) elements of color c
+   */
+  ArrayOfArraysView< localIndex const > getElementsByColor() const
+  { return m_elementsByColor.toViewConst(); }
+
+  /**
+   * @brief Group a subset of the elements of this subregion by color.
+   * @tparam LIST Type of the list of elements (e.g. arrayView1d or SortedArrayView)
+   * @param elementList The list of elements
+   * @param elementsByColor The elements of @p elementList grouped by color
+   *
+   * The output has one array per color of the subregion coloring, some of which may be empty.
+   * It is left empty if the subregion has no coloring.
+   */
+  template< typename LIST >
+  void groupElementsByColor( LIST const & elementList,
+                             ArrayOfArrays< localIndex > & elementsByColor ) const;
+
   ///@}
 
   /**
@@ -264,6 +336,12 @@ protected:
   /// Type of element in this subregion.
   ElementType m_elementType;
 
+  /// Color of each element, or empty if the subregion is not colored.
+  array1d< integer > m_elementColor;
+
+  /// Elements grouped by color.
+  ArrayOfArrays< localIndex > m_elementsByColor;
+
   /**
    * @brief Compute the center of each element in the subregion.
    * @tparam NODE_MAP Type of the element to node mapping.
@@ -291,6 +369,86 @@ protected:
   }
 };
 
+template< class NODE_MAP >
+bool ElementSubRegionBase::computeElementColoring( NODE_MAP const & toNodesRelation,
+                                                   localIndex const numNodes )
+{
+  auto const e2n = toNodesRelation.toViewConst();
+  localIndex const numElems = size();
+
+  // bit c of nodeColors[a] is set if an element of color c is attached to node a
+  std::vector< std::uint64_t > nodeColors( numNodes, 0 );
+  std::vector< localIndex > colorSizes;
+
+  clearElementColoring();
+  m_elementColor.resize( numElems );
+
+  for( localIndex k = 0; k < numElems; ++k )
+  {
+    localIndex const numElemNodes = this->numNodesPerElement( k );
+    std::uint64_t usedColors = 0;
+    for( localIndex a = 0; a < numElemNodes; ++a )
+    {
+      usedColors |= nodeColors[ e2n( k, a ) ];
+    }
+
+    integer color = 0;
+    while( color < maxNumElementColors && ( usedColors & ( std::uint64_t( 1 ) << color ) ) )
+    {
+      ++color;
+    }
+    if( color == maxNumElementColors )
+    {
+      clearElementColoring();
+      return false;
+    }
+
+    for( localIndex a = 0; a < numElemNodes; ++a )
+    {
+      nodeColors[ e2n( k, a ) ] |= std::uint64_t( 1 ) << color;
+    }
+    m_elementColor[k] = color;
+    if( color >= LvArray::integerConversion< integer >( colorSizes.size() ) )
+    {
+      colorSizes.resize( color + 1, 0 );
+    }
+    ++colorSizes[ color ];
+  }
+
+  m_elementsByColor.resize( 0 );
+  for( localIndex const colorSize : colorSizes )
+  {
+    m_elementsByColor.appendArray( 0 );
+    m_elementsByColor.setCapacityOfArray( m_elementsByColor.size() - 1, colorSize );
+  }
+  for( localIndex k = 0; k < numElems; ++k )
+  {
+    m_elementsByColor.emplaceBack( m_elementColor[k], k );
+  }
+  return true;
+}
+
+template< typename LIST >
+void ElementSubRegionBase::groupElementsByColor( LIST const & elementList,
+                                                 ArrayOfArrays< localIndex > & elementsByColor ) const
+{
+  elementsByColor.resize( 0 );
+  if( !hasElementColoring() )
+  {
+    return;
+  }
+
+  for( localIndex c = 0; c < m_elementsByColor.size(); ++c )
+  {
+    elementsByColor.appendArray( 0 );
+  }
+  for( localIndex i = 0; i < elementList.size(); ++i )
+  {
+    localIndex const k = elementList[ i ];
+    elementsByColor.emplaceBack( m_elementColor[k], k );
+  }
+}
+
 } /* namespace geos */
 
 #endif /* GEOS_MESH_ELEMENTSUBREGIONBASE_HPP_ */
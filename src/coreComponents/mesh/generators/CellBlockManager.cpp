@@ -18,6 +18,7 @@
 #include "mesh/generators/CellBlockUtilities.hpp"
 #include "mesh/generators/LineBlock.hpp"
 #include "mesh/utilities/MeshMapUtilities.hpp"
+#include "LvArray/src/tensorOps.hpp"
 
 #include <algorithm>
 
@@ -670,6 +671,183 @@ void CellBlockManager::buildMaps()
   fillElementToEdgesOfCellBlocks( m_faceToEdges.toViewConst(), this->getCellBlocks() );
 }
 
+namespace
+{
+
+/**
+ * @brief Computes the Morton (Z-order) code of a point.
+ * @param x The coordinates of the point.
+ * @param boxMin The lower corner of the bounding box of all the points.
+ * @param scale The scaling of the coordinates to the integer grid in each direction.
+ * @return The interleaved bits of the integer coordinates of the point (21 bits per direction).
+ */
+globalIndex mortonCode( real64 const ( &x )[3],
+                        real64 const ( &boxMin )[3],
+                        real64 const ( &scale )[3] )
+{
+  globalIndex gridCoords[3];
+  for( integer d = 0; d < 3; ++d )
+  {
+    gridCoords[d] = static_cast< globalIndex >( ( x[d] - boxMin[d] ) * scale[d] );
+  }
+  globalIndex code = 0;
+  for( integer bit = 20; bit >= 0; --bit )
+  {
+    for( integer d = 0; d < 3; ++d )
+    {
+      code = ( code << 1 ) | ( ( gridCoords[d] >> bit ) & 1 );
+    }
+  }
+  return code;
+}
+
+/**
+ * @brief Sorts objects along the Morton curve.
+ * @tparam FUNC The type of @p getPoint.
+ * @param numObjects The number of objects.
+ * @param boxMin The lower corner of the bounding box of the objects.
+ * @param boxMax The upper corner of the bounding box of the objects.
+ * @param getPoint Function filling the coordinates of the representative point of an object.
+ * @return The previous index of each object in the new order.
+ */
+template< typename FUNC >
+array1d< localIndex > computeMortonOrder( localIndex const numObjects,
+                                          real64 const ( &boxMin )[3],
+                                          real64 const ( &boxMax )[3],
+                                          FUNC && getPoint )
+{
+  real64 const gridSize = ( 1 << 21 ) - 1;
+  real64 scale[3];
+  for( integer d = 0; d < 3; ++d )
+  {
+    scale[d] = boxMax[d] > boxMin[d] ? gridSize / ( boxMax[d] - boxMin[d] ) : 0.0;
+  }
+
+  array1d< globalIndex > codes( numObjects );
+  array1d< localIndex > newToOld( numObjects );
+  arrayView1d< globalIndex > const codesView = codes.toView();
+  arrayView1d< localIndex > const newToOldView = newToOld.toView();
+  forAll< parallelHostPolicy >( numObjects, [=]( localIndex const i )
+  {
+    real64 x[3];
+    getPoint( i, x );
+    codesView[i] = mortonCode( x, boxMin, scale );
+    newToOldView[i] = i;
+  } );
+
+  // A stable sort keeps the generator order of objects sharing a code
+  RAJA::stable_sort_pairs< parallelHostPolicy >( codesView, newToOldView );
+  return newToOld;
+}
+
+}
+
+std::map< string, array1d< localIndex > > CellBlockManager::reorderForLocality( LocalityReordering const reordering )
+{
+  GEOS_MARK_FUNCTION;
+
+  std::map< string, array1d< localIndex > > cellNewToOld;
+  if( reordering == LocalityReordering::none || m_numNodes == 0 )
+  {
+    return cellNewToOld;
+  }
+
+  // Bounding box of the nodes (which also contains the cell centers)
+  arrayView2d< real64, nodes::REFERENCE_POSITION_USD > const X = m_nodesPositions.toView();
+  real64 boxMin[3];
+  real64 boxMax[3];
+  for( integer d = 0; d < 3; ++d )
+  {
+    RAJA::ReduceMin< parallelHostReduce, real64 > dimMin( LvArray::NumericLimits< real64 >::max );
+    RAJA::ReduceMax< parallelHostReduce, real64 > dimMax( LvArray::NumericLimits< real64 >::lowest );
+    forAll< parallelHostPolicy >( m_numNodes, [=]( localIndex const a )
+    {
+      dimMin.min( X( a, d ) );
+      dimMax.max( X( a, d ) );
+    } );
+    boxMin[d] = dimMin.get();
+    boxMax[d] = dimMax.get();
+  }
+
+  // 1. Nodes
+  array1d< localIndex > const nodeNewToOld =
+    computeMortonOrder( m_numNodes, boxMin, boxMax, [=]( localIndex const a, real64 ( & x )[3] )
+  {
+    LvArray::tensorOps::copy< 3 >( x, X[a] );
+  } );
+
+  array1d< localIndex > nodeOldToNew( m_numNodes );
+  arrayView1d< localIndex > const nodeOldToNewView = nodeOldToNew.toView();
+  arrayView1d< localIndex const > const nodeNewToOldView = nodeNewToOld.toViewConst();
+  forAll< parallelHostPolicy >( m_numNodes, [=]( localIndex const a )
+  {
+    nodeOldToNewView[nodeNewToOldView[a]] = a;
+  } );
+
+  array2d< real64, nodes::REFERENCE_POSITION_PERM > const oldPositions = m_nodesPositions;
+  array1d< globalIndex > const oldNodeLocalToGlobal = m_nodeLocalToGlobal;
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const oldX = oldPositions.toViewConst();
+  arrayView1d< globalIndex const > const oldNodeL2G = oldNodeLocalToGlobal.toViewConst();
+  arrayView1d< globalIndex > const nodeL2G = m_nodeLocalToGlobal.toView();
+  forAll< parallelHostPolicy >( m_numNodes, [=]( localIndex const a )
+  {
+    LvArray::tensorOps::copy< 3 >( X[a], oldX[nodeNewToOldView[a]] );
+    nodeL2G[a] = oldNodeL2G[nodeNewToOldView[a]];
+  } );
+
+  for( auto & nameAndSet : m_nodeSets )
+  {
+    SortedArray< localIndex > & nodeSet = nameAndSet.second;
+    array1d< localIndex > newNodes( nodeSet.size() );
+    for( localIndex i = 0; i < nodeSet.size(); ++i )
+    {
+      newNodes[i] = nodeOldToNew[nodeSet[i]];
+    }
+    std::sort( newNodes.begin(), newNodes.end() );
+    nodeSet.clear();
+    nodeSet.insert( newNodes.begin(), newNodes.end() );
+  }
+
+  // 2. Cells of each block, ordered by their center
+  forElementSubRegions( [&]( CellBlock & cellBlock )
+  {
+    CellBlock const & oldCellBlock = cellBlock;
+    localIndex const numCells = cellBlock.numElements();
+    localIndex const numNodesPerCell = cellBlock.numNodesPerElement();
+    array2d< localIndex, cells::NODE_MAP_PERMUTATION > const oldElemToNodes = oldCellBlock.getElemToNodes();
+    array1d< globalIndex > const oldCellLocalToGlobal = oldCellBlock.localToGlobalMap();
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const oldE2N = oldElemToNodes.toViewConst();
+    arrayView1d< globalIndex const > const oldCellL2G = oldCellLocalToGlobal.toViewConst();
+
+    array1d< localIndex > newToOld =
+      computeMortonOrder( numCells, boxMin, boxMax, [=]( localIndex const k, real64 ( & x )[3] )
+    {
+      LvArray::tensorOps::fill< 3 >( x, 0.0 );
+      for( localIndex a = 0; a < numNodesPerCell; ++a )
+      {
+        LvArray::tensorOps::add< 3 >( x, X[nodeOldToNewView[oldE2N( k, a )]] );
+      }
+      LvArray::tensorOps::scale< 3 >( x, 1.0 / numNodesPerCell );
+    } );
+
+    arrayView1d< localIndex const > const newToOldView = newToOld.toViewConst();
+    arrayView2d< localIndex, cells::NODE_MAP_USD > const elemToNodes = cellBlock.getElemToNode();
+    arrayView1d< globalIndex > const cellL2G = cellBlock.localToGlobalMap();
+    forAll< parallelHostPolicy >( numCells, [=]( localIndex const k )
+    {
+      for( localIndex a = 0; a < numNodesPerCell; ++a )
+      {
+        elemToNodes( k, a ) = nodeOldToNewView[oldE2N( newToOldView[k], a )];
+      }
+      cellL2G[k] = oldCellL2G[newToOldView[k]];
+    } );
+
+    cellNewToOld.emplace( cellBlock.getName(), std::move( newToOld ) );
+  } );
+
+  return cellNewToOld;
+}
+
 ArrayOfArrays< localIndex > CellBlockManager::getFaceToNodes() const
 {
   return m_faceToNodes;
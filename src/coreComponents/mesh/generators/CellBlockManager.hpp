@@ -46,6 +46,15 @@ public:
    */
   CellBlockManager( string const & name, Group * const parent );
 
+  /**
+   * @brief Renumbering of the nodes and cells for data locality.
+   */
+  enum struct LocalityReordering : integer
+  {
+    none,   ///< Keep the numbering of the mesh generator
+    morton, ///< Sort nodes and cells along a Morton (Z-order) space-filling curve
+  };
+
   virtual Group * createChild( string const & childKey, string const & childName ) override;
 
   /**
@@ -144,6 +153,19 @@ public:
    */
   void buildMaps();
 
+  /**
+   * @brief Renumber the nodes and the cells of each cell block for data locality.
+   * @param[in] reordering The type of reordering.
+   * @return For each cell block name, the previous index of each cell (empty if nothing was reordered).
+   *
+   * Nodes and cells that are close in space get close indices, so that all the kernels looping over
+   * cells or nodes access their neighbors' data in nearby memory. Node positions, node local to global map,
+   * node sets and the cells (element to nodes and local to global maps) are permuted consistently.
+   * This must be called before buildMaps(): faces and edges are numbered from their lowest node, and thus
+   * follow the new node order.
+   */
+  std::map< string, array1d< localIndex > > reorderForLocality( LocalityReordering const reordering );
+
   /**
    * @brief Get cell block by name.
    * @param[in] name Name of the cell block.
@@ -292,5 +314,10 @@ private:
   localIndex m_numEdges;
 };
 
+/// Strings for CellBlockManager::LocalityReordering enumeration
+ENUM_STRINGS( CellBlockManager::LocalityReordering,
+              "none",
+              "morton" );
+
 }
 #endif /* GEOS_MESH_CELLBLOCKMANAGER_H_ */
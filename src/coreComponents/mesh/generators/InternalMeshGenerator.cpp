@@ -109,6 +109,12 @@ InternalMeshGenerator::InternalMeshGenerator( string const & name, Group * const
     setInputFlag( InputFlags::OPTIONAL ).
     setRestartFlags( RestartFlags::NO_WRITE ).
     setDescription( "A position tolerance to verify if a node belong to a nodeset" );
+
+  registerWrapper( viewKeyStruct::localityReorderingString(), &m_localityReordering ).
+    setApplyDefaultValue( m_localityReordering ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Renumbering of the nodes and cells of each rank for data locality, applied before faces and edges are built. "
+                    "Available options are: ``" + EnumStrings< CellBlockManager::LocalityReordering >::concat( "|" ) + "``" );
 }
 
 static int getNumElemPerBox( ElementType const elementType )
@@ -964,6 +970,7 @@ void InternalMeshGenerator::fillCellBlockManager( CellBlockManager & cellBlockMa
 
   coordinateTransformation( X, nodeSets );
 
+  cellBlockManager.reorderForLocality( m_localityReordering );
   cellBlockManager.buildMaps();
 
   GEOS_LOG_RANK_0( GEOS_FMT( "{}: total number of nodes = {}", getName(),
@@ -160,6 +160,7 @@ protected:
     constexpr static char const * trianglePatternString() { return "trianglePattern"; }
     constexpr static char const * meshTypeString() { return "meshType"; }
     constexpr static char const * positionToleranceString() { return "positionTolerance"; }
+    constexpr static char const * localityReorderingString() { return "localityReordering"; }
   };
   /// @endcond
 
@@ -211,6 +212,9 @@ private:
   /// Array of number of element per box
   array1d< integer > m_numElePerBox;
 
+  /// Renumbering of the nodes and cells for data locality
+  CellBlockManager::LocalityReordering m_localityReordering = CellBlockManager::LocalityReordering::none;
+
   /**
    * @brief Member variable for triangle pattern seletion.
    * @note In Pattern 0, half nodes have 4 edges and the other half have 8; for Pattern 1, every node has 6.
@@ -76,6 +76,13 @@ VTKMeshGenerator::VTKMeshGenerator( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Method (library) used to partition the mesh" );
 
+  registerWrapper( viewKeyStruct::localityReorderingString(), &m_localityReordering ).
+    setApplyDefaultValue( m_localityReordering ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Renumbering of the nodes and cells of each rank for data locality, applied before faces and edges are built "
+                    "(not available with face blocks). "
+                    "Available options are: ``" + EnumStrings< CellBlockManager::LocalityReordering >::concat( "|" ) + "``" );
+
   registerWrapper( viewKeyStruct::useGlobalIdsString(), &m_useGlobalIds ).
     setInputFlag( InputFlags::OPTIONAL ).
     setApplyDefaultValue( 0 ).
@@ -209,6 +216,33 @@ void VTKMeshGenerator::fillCellBlockManager( CellBlockManager & cellBlockManager
   GEOS_LOG_LEVEL_RANK_0( 2, "  writing surfaces..." );
   writeSurfaces( getLogLevel(), *m_vtkMesh, m_cellMap, cellBlockManager );
 
+  if( m_localityReordering != CellBlockManager::LocalityReordering::none )
+  {
+    GEOS_ERROR_IF( !m_faceBlockMeshes.empty(),
+                   getWrapperDataContext( viewKeyStruct::localityReorderingString() ) <<
+                   ": locality reordering is not available with face blocks" );
+    GEOS_LOG_LEVEL_RANK_0( 2, "  reordering nodes and cells..." );
+    std::map< string, array1d< localIndex > > const cellNewToOld = cellBlockManager.reorderForLocality( m_localityReordering );
+
+    // Keep the VTK cell lists in the order of the cell blocks, for the import of the fields
+    for( auto & typeRegions : m_cellMap )
+    {
+      for( auto & regionCells : typeRegions.second )
+      {
+        auto const it = cellNewToOld.find( vtk::buildCellBlockName( typeRegions.first, regionCells.first ) );
+        if( it == cellNewToOld.end() )
+        {
+          continue;
+        }
+        std::vector< vtkIdType > const oldCellIds = regionCells.second;
+        for( std::size_t i = 0; i < oldCellIds.size(); ++i )
+        {
+          regionCells.second[i] = oldCellIds[it->second[i]];
+        }
+      }
+    }
+  }
+
   GEOS_LOG_LEVEL_RANK_0( 2, "  building connectivity maps..." );
   cellBlockManager.buildMaps();
 
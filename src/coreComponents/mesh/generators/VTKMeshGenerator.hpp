@@ -112,6 +112,7 @@ private:
     constexpr static char const * nodesetNamesString() { return "nodesetNames"; }
     constexpr static char const * partitionRefinementString() { return "partitionRefinement"; }
     constexpr static char const * partitionMethodString() { return "partitionMethod"; }
+    constexpr static char const * localityReorderingString() { return "localityReordering"; }
     constexpr static char const * useGlobalIdsString() { return "useGlobalIds"; }
     constexpr static char const * dataSourceString() { return "dataSourceName"; }
     constexpr static char const * meshPathString() { return "meshPath"; }
@@ -163,6 +164,9 @@ private:
   /// Method (library) used to partition the mesh
   vtk::PartitionMethod m_partitionMethod = vtk::PartitionMethod::parmetis;
 
+  /// Renumbering of the nodes and cells for data locality
+  CellBlockManager::LocalityReordering m_localityReordering = CellBlockManager::LocalityReordering::none;
+
   /// Lists of VTK cell ids, organized by element type, then by region
   vtk::CellMapType m_cellMap;
 
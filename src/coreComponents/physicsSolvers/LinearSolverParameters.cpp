@@ -42,7 +42,18 @@ LinearSolverParametersInput::LinearSolverParametersInput( string const & name,
     setApplyDefaultValue( m_parameters.preconditionerType ).
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Preconditioner type. Available options are: "
-                    "``" + EnumStrings< LinearSolverParameters::PreconditionerType >::concat( "|" ) + "``" );
+                    "``" + EnumStrings< LinearSolverParameters::PreconditionerType >::concat( "|" ) + "``. "
+                    "``blockIlu`` is a native block ILU(k) (level-scheduled, block size ``dofsPerNode``, fill ``iluFill``) "
+                    "used within the native Krylov solvers, in the precision given by ``preconditionerPrecision``" );
+
+  registerWrapper( viewKeyStruct::preconditionerPrecisionString(), &m_parameters.preconditionerPrecision ).
+    setApplyDefaultValue( m_parameters.preconditionerPrecision ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Floating-point precision used to store and apply the preconditioner. Available options are: "
+                    "``" + EnumStrings< LinearSolverParameters::Precision >::concat( "|" ) + "``. "
+                    "With ``fp32``, a native block Jacobi (``jacobi``) or block ILU(k) (``iluk`` or ``blockIlu``, level-scheduled) preconditioner "
+                    "with block size ``dofsPerNode`` is built in single precision "
+                    "and used within the native double precision Krylov solvers (``fgmres`` for mixed-precision iterative refinement)" );
 
   registerWrapper( viewKeyStruct::stopIfErrorString(), &m_parameters.stopIfError ).
     setApplyDefaultValue( m_parameters.stopIfError ).
@@ -96,6 +107,12 @@ LinearSolverParametersInput::LinearSolverParametersInput( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Maximum iterations before restart (GMRES only)" );
 
+  registerWrapper( viewKeyStruct::krylovSStepString(), &m_parameters.krylov.sStep ).
+    setApplyDefaultValue( m_parameters.krylov.sStep ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Number of Krylov vectors generated and orthogonalized together, "
+                    "with a single fused global reduction (s-step GMRES only)" );
+
   registerWrapper( viewKeyStruct::krylovTolString(), &m_parameters.krylov.relTolerance ).
     setApplyDefaultValue( m_parameters.krylov.relTolerance ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -108,7 +125,8 @@ LinearSolverParametersInput::LinearSolverParametersInput( string const & name,
   registerWrapper( viewKeyStruct::krylovAdaptiveTolString(), &m_parameters.krylov.useAdaptiveTol ).
     setApplyDefaultValue( m_parameters.krylov.useAdaptiveTol ).
     setInputFlag( InputFlags::OPTIONAL ).
-    setDescription( "Use Eisenstat-Walker adaptive linear tolerance" );
+    setDescription( "Use Eisenstat-Walker adaptive linear tolerance "
+                    "(also enabled by the ``inexactNewtonType`` option of the nonlinear solver parameters)" );
 
   registerWrapper( viewKeyStruct::krylovWeakTolString(), &m_parameters.krylov.weakestTol ).
     setApplyDefaultValue( m_parameters.krylov.weakestTol ).
@@ -130,6 +148,32 @@ LinearSolverParametersInput::LinearSolverParametersInput( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Exponent parameter for adaptive method" );
 
+  registerWrapper( viewKeyStruct::preconditionerReuseString(), &m_parameters.reuse.policy ).
+    setApplyDefaultValue( m_parameters.reuse.policy ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Policy for reusing the preconditioner across linear solves. The hypre preconditioners and the native "
+                    "block Jacobi and block ILU preconditioners are reused; the other preconditioners are recomputed at "
+                    "every solve. Available options are: "
+                    "``" + EnumStrings< LinearSolverParameters::Reuse::Policy >::concat( "|" ) + "``" );
+
+  registerWrapper( viewKeyStruct::preconditionerReuseFactorString(), &m_parameters.reuse.iterationGrowthFactor ).
+    setApplyDefaultValue( m_parameters.reuse.iterationGrowthFactor ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "When reusing the preconditioner, it is recomputed as soon as the number of Krylov iterations "
+                    "exceeds this factor times the number of iterations obtained after the last setup" );
+
+  registerWrapper( viewKeyStruct::chebyshevDegreeString(), &m_parameters.chebyshev.degree ).
+    setApplyDefaultValue( m_parameters.chebyshev.degree ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Number of Chebyshev iterations per application of the native Chebyshev-Jacobi preconditioner "
+                    "(used by matrix-free solvers)" );
+
+  registerWrapper( viewKeyStruct::chebyshevEigenvalueRatioString(), &m_parameters.chebyshev.eigenvalueRatio ).
+    setApplyDefaultValue( m_parameters.chebyshev.eigenvalueRatio ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Ratio between the estimated largest eigenvalue of the Jacobi-scaled operator and the lower bound "
+                    "of the spectrum targeted by the native Chebyshev-Jacobi preconditioner" );
+
   registerWrapper( viewKeyStruct::amgNumSweepsString(), &m_parameters.amg.numSweeps ).
     setApplyDefaultValue( m_parameters.amg.numSweeps ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -242,12 +286,32 @@ void LinearSolverParametersInput::postInputInitialization()
                  getWrapperDataContext( viewKeyStruct::directParallelString() ) <<
                  ": option can be either 0 (false) or 1 (true)" );
 
+  GEOS_ERROR_IF( m_parameters.preconditionerPrecision == LinearSolverParameters::Precision::fp32 &&
+                 m_parameters.preconditionerType != LinearSolverParameters::PreconditionerType::jacobi &&
+                 m_parameters.preconditionerType != LinearSolverParameters::PreconditionerType::iluk &&
+                 m_parameters.preconditionerType != LinearSolverParameters::PreconditionerType::blockIlu,
+                 getWrapperDataContext( viewKeyStruct::preconditionerPrecisionString() ) <<
+                 ": single precision is only available with the jacobi, iluk and blockIlu preconditioners" );
+  GEOS_ERROR_IF( m_parameters.preconditionerPrecision == LinearSolverParameters::Precision::fp32 &&
+                 ( m_parameters.solverType == LinearSolverParameters::SolverType::direct ||
+                   m_parameters.solverType == LinearSolverParameters::SolverType::preconditioner ),
+                 getWrapperDataContext( viewKeyStruct::preconditionerPrecisionString() ) <<
+                 ": single precision preconditioning requires an iterative solver" );
+  GEOS_ERROR_IF( m_parameters.preconditionerType == LinearSolverParameters::PreconditionerType::blockIlu &&
+                 ( m_parameters.solverType == LinearSolverParameters::SolverType::direct ||
+                   m_parameters.solverType == LinearSolverParameters::SolverType::preconditioner ),
+                 getWrapperDataContext( viewKeyStruct::preconditionerTypeString() ) <<
+                 ": the native block ILU(k) preconditioner requires an iterative solver" );
+
   GEOS_ERROR_IF_LT_MSG( m_parameters.krylov.maxIterations, 0,
                         getWrapperDataContext( viewKeyStruct::krylovMaxIterString() ) <<
                         ": Invalid value." );
   GEOS_ERROR_IF_LT_MSG( m_parameters.krylov.maxRestart, 0,
                         getWrapperDataContext( viewKeyStruct::krylovMaxRestartString() ) <<
                         ": Invalid value." );
+  GEOS_ERROR_IF_LT_MSG( m_parameters.krylov.sStep, 1,
+                        getWrapperDataContext( viewKeyStruct::krylovSStepString() ) <<
+                        ": Invalid value." );
 
   GEOS_ERROR_IF_LT_MSG( m_parameters.krylov.relTolerance, 0.0,
                         getWrapperDataContext( viewKeyStruct::krylovTolString() ) <<
@@ -256,6 +320,17 @@ void LinearSolverParametersInput::postInputInitialization()
                         getWrapperDataContext( viewKeyStruct::krylovTolString() ) <<
                         ": Invalid value." );
 
+  GEOS_ERROR_IF_LT_MSG( m_parameters.reuse.iterationGrowthFactor, 1.0,
+                        getWrapperDataContext( viewKeyStruct::preconditionerReuseFactorString() ) <<
+                        ": Invalid value." );
+
+  GEOS_ERROR_IF_LT_MSG( m_parameters.chebyshev.degree, 1,
+                        getWrapperDataContext( viewKeyStruct::chebyshevDegreeString() ) <<
+                        ": Invalid value." );
+  GEOS_ERROR_IF_LE_MSG( m_parameters.chebyshev.eigenvalueRatio, 1.0,
+                        getWrapperDataContext( viewKeyStruct::chebyshevEigenvalueRatioString() ) <<
+                        ": Invalid value." );
+
   GEOS_ERROR_IF_LT_MSG( m_parameters.ifact.fill, 0,
                         getWrapperDataContext( viewKeyStruct::iluFillString() ) <<
                         ": Invalid value." );
@@ -285,6 +360,7 @@ void LinearSolverParametersInput::print()
   tableData.addRow( "Log level", getLogLevel());
   tableData.addRow( "Linear solver type", m_parameters.solverType );
   tableData.addRow( "Preconditioner type", m_parameters.preconditionerType );
+  tableData.addRow( "Preconditioner precision", m_parameters.preconditionerPrecision );
   tableData.addRow( "Stop if error", m_parameters.stopIfError );
   if( m_parameters.solverType == LinearSolverParameters::SolverType::direct )
   {
@@ -300,10 +376,15 @@ void LinearSolverParametersInput::print()
   {
     tableData.addRow( "Maximum iterations", m_parameters.krylov.maxIterations );
     if( m_parameters.solverType == LinearSolverParameters::SolverType::gmres ||
-        m_parameters.solverType == LinearSolverParameters::SolverType::fgmres )
+        m_parameters.solverType == LinearSolverParameters::SolverType::fgmres ||
+        m_parameters.solverType == LinearSolverParameters::SolverType::sstepGmres )
     {
       tableData.addRow( "Maximum iterations before restart", m_parameters.krylov.maxRestart );
     }
+    if( m_parameters.solverType == LinearSolverParameters::SolverType::sstepGmres )
+    {
+      tableData.addRow( "Krylov vectors per block", m_parameters.krylov.sStep );
+    }
     tableData.addRow( "Use adaptive tolerance", m_parameters.krylov.useAdaptiveTol );
     if( m_parameters.krylov.useAdaptiveTol )
     {
@@ -314,6 +395,11 @@ void LinearSolverParametersInput::print()
       tableData.addRow( "Relative convergence tolerance", m_parameters.krylov.relTolerance );
     }
   }
+  tableData.addRow( "Preconditioner reuse", m_parameters.reuse.policy );
+  if( m_parameters.reuse.policy != LinearSolverParameters::Reuse::Policy::none )
+  {
+    tableData.addRow( "Preconditioner reuse iteration growth factor", m_parameters.reuse.iterationGrowthFactor );
+  }
   if( m_parameters.preconditionerType == LinearSolverParameters::PreconditionerType::amg )
   {
     tableData.addRow( "AMG", "" );
@@ -332,8 +418,14 @@ void LinearSolverParametersInput::print()
     tableData.addRow( "  Apply separate component filter for multi-variable problems", m_parameters.amg.separateComponents );
     tableData.addRow( "  Near null space approximation", m_parameters.amg.nullSpaceType );
   }
+  else if( m_parameters.preconditionerType == LinearSolverParameters::PreconditionerType::chebyshev )
+  {
+    tableData.addRow( "Chebyshev iterations", m_parameters.chebyshev.degree );
+    tableData.addRow( "Chebyshev eigenvalue ratio", m_parameters.chebyshev.eigenvalueRatio );
+  }
   else if( m_parameters.preconditionerType == LinearSolverParameters::PreconditionerType::iluk ||
-           m_parameters.preconditionerType == LinearSolverParameters::PreconditionerType::ilut )
+           m_parameters.preconditionerType == LinearSolverParameters::PreconditionerType::ilut ||
+           m_parameters.preconditionerType == LinearSolverParameters::PreconditionerType::blockIlu )
   {
     tableData.addRow( "ILU(K) fill factor", m_parameters.ifact.fill );
     if( m_parameters.preconditionerType == LinearSolverParameters::PreconditionerType::ilut )
@@ -75,6 +75,8 @@ public:
     static constexpr char const * solverTypeString() { return "solverType"; }
     /// Preconditioner type key
     static constexpr char const * preconditionerTypeString() { return "preconditionerType"; }
+    /// Preconditioner precision key
+    static constexpr char const * preconditionerPrecisionString() { return "preconditionerPrecision"; }
     /// stop if error key
     static constexpr char const * stopIfErrorString() { return "stopIfError"; }
 
@@ -97,6 +99,8 @@ public:
     static constexpr char const * krylovMaxIterString() { return "krylovMaxIter"; }
     /// Krylov max iterations key
     static constexpr char const * krylovMaxRestartString() { return "krylovMaxRestart"; }
+    /// Krylov s-step block size key
+    static constexpr char const * krylovSStepString() { return "krylovSStep"; }
     /// Krylov tolerance key
     static constexpr char const * krylovTolString() { return "krylovTol"; }
     /// Krylov adaptive tolerance key
@@ -110,6 +114,16 @@ public:
     /// Adaptive exponent parameter key
     static constexpr char const * adaptiveExponentString() { return "adaptiveExponent"; }
 
+    /// Preconditioner reuse policy key
+    static constexpr char const * preconditionerReuseString() { return "preconditionerReuse"; }
+    /// Preconditioner reuse iteration growth factor key
+    static constexpr char const * preconditionerReuseFactorString() { return "preconditionerReuseIterationFactor"; }
+
+    /// Chebyshev polynomial degree key
+    static constexpr char const * chebyshevDegreeString() { return "chebyshevDegree"; }
+    /// Chebyshev eigenvalue ratio key
+    static constexpr char const * chebyshevEigenvalueRatioString() { return "chebyshevEigenvalueRatio"; }
+
     /// AMG number of sweeps key
     static constexpr char const * amgNumSweepsString() { return "amgNumSweeps"; }
     /// AMG smoother type key
@@ -97,6 +97,39 @@ NonlinearSolverParameters::NonlinearSolverParameters( string const & name,
     setApplyDefaultValue( 0 ).
     setDescription( "Number of Newton's iterations." );
 
+  registerWrapper( viewKeysStruct::inexactNewtonTypeString(), &m_inexactNewtonType ).
+    setApplyDefaultValue( InexactNewtonType::None ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Strategy used to choose the relative tolerance of iterative linear solvers in the Newton loop. "
+                    "Valid options:\n"
+                    "* None - Solve every linear system to the relative tolerance of the linear solver.\n"
+                    "* EisenstatWalker - Inexact Newton method: loose tolerance in the first iterations, tightened "
+                    "as the nonlinear residual decreases (Eisenstat-Walker forcing terms, "
+                    "bounded by the adaptive tolerance parameters of the linear solver)." );
+
+  registerWrapper( viewKeysStruct::nonlinearPreconditionerTypeString(), &m_nonlinearPreconditionerType ).
+    setApplyDefaultValue( NonlinearPreconditionerType::None ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Nonlinear preconditioning applied before each global Newton update. Valid options:\n"
+                    "* None - Plain Newton iterations.\n"
+                    "* LocalNewton - Local Newton iterations on the rows with the largest residuals on each rank, "
+                    "with the couplings to the other rows and ranks frozen (additive Schwarz preconditioned inexact Newton). "
+                    "Each local iteration costs a full assembly and a GMRES solve of the restricted system preconditioned by "
+                    "a rank-local block ILU, whose setup is repeated at every local iteration. "
+                    "The preconditioner of the global system is left untouched. "
+                    "The primary variables are saved before each local update, which is rejected if it increases the residual norm." );
+
+  registerWrapper( viewKeysStruct::localNewtonMaxIterString(), &m_localNewtonMaxIter ).
+    setApplyDefaultValue( 3 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Maximum number of local Newton iterations before each global Newton update." );
+
+  registerWrapper( viewKeysStruct::localNewtonResidualThresholdString(), &m_localNewtonResidualThreshold ).
+    setApplyDefaultValue( 0.1 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Fraction of the largest residual on a rank above which the rows are included in the local Newton subproblems. "
+                    "With a value of 0, the local subproblems are the full rank subdomains." );
+
   registerWrapper( viewKeysStruct::maxAllowedResidualNormString(), &m_maxAllowedResidualNorm ).
     setApplyDefaultValue( 1e9 ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -134,6 +167,37 @@ NonlinearSolverParameters::NonlinearSolverParameters( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Minimum number of cycles since the last time-step cut for increasing the time-step again." );
 
+  registerWrapper( viewKeysStruct::timeStepControllerTypeString(), &m_timeStepControllerType ).
+    setApplyDefaultValue( TimeStepControllerType::NewtonIterations ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Strategy used to choose the size of the next time step. Valid options:\n"
+                    "* NewtonIterations - Increase or decrease the time step based on the number of Newton iterations.\n"
+                    "* PID - The Newton loop starts from a linear extrapolation of the last time step, and the next time step "
+                    "is chosen by a PID controller to keep the truncation error (estimated from the difference between the "
+                    "converged and the predicted solution) close to the prescribed tolerance. The time step is still decreased "
+                    "when the number of Newton iterations is large." );
+
+  registerWrapper( viewKeysStruct::timeStepTruncationErrorTolString(), &m_timeStepTruncationErrorTol ).
+    setApplyDefaultValue( 0.1 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Target value of the truncation error estimate of the PID time-step controller, "
+                    "relative to the change of the primary variables over the time step." );
+
+  registerWrapper( viewKeysStruct::timeStepControllerProportionalGainString(), &m_timeStepControllerProportionalGain ).
+    setApplyDefaultValue( 0.075 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Proportional gain of the PID time-step controller." );
+
+  registerWrapper( viewKeysStruct::timeStepControllerIntegralGainString(), &m_timeStepControllerIntegralGain ).
+    setApplyDefaultValue( 0.175 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Integral gain of the PID time-step controller." );
+
+  registerWrapper( viewKeysStruct::timeStepControllerDerivativeGainString(), &m_timeStepControllerDerivativeGain ).
+    setApplyDefaultValue( 0.01 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Derivative gain of the PID time-step controller." );
+
   registerWrapper( viewKeysStruct::timeStepCutFactorString(), &m_timeStepCutFactor ).
     setApplyDefaultValue( 0.5 ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -180,7 +244,13 @@ NonlinearSolverParameters::NonlinearSolverParameters( string const & name,
   registerWrapper( viewKeysStruct::nonlinearAccelerationTypeString(), &m_nonlinearAccelerationType ).
     setApplyDefaultValue( NonlinearAccelerationType::None ).
     setInputFlag( dataRepository::InputFlags::OPTIONAL ).
-    setDescription( "Nonlinear acceleration type for sequential solver." );
+    setDescription( "Nonlinear acceleration type for sequential solver. "
+                    "Valid options:\n* " + EnumStrings< NonlinearAccelerationType >::concat( "\n* " ) );
+
+  registerWrapper( viewKeysStruct::nonlinearAccelerationDepthString(), &m_nonlinearAccelerationDepth ).
+    setApplyDefaultValue( 5 ).
+    setInputFlag( dataRepository::InputFlags::OPTIONAL ).
+    setDescription( "Number of previous outer iterations used by the Anderson acceleration of sequential solvers." );
 
 }
 
@@ -193,6 +263,21 @@ void NonlinearSolverParameters::postInputInitialization()
   GEOS_ERROR_IF_LE_MSG( m_lineSearchResidualFactor, 0.0,
                         getWrapperDataContext( viewKeysStruct::lineSearchResidualFactorString() ) << ": should be positive" );
 
+  GEOS_ERROR_IF( m_localNewtonResidualThreshold < 0.0 || m_localNewtonResidualThreshold > 1.0,
+                 getWrapperDataContext( viewKeysStruct::localNewtonResidualThresholdString() ) << ": should be between 0 and 1" );
+
+  GEOS_ERROR_IF_LE_MSG( m_timeStepTruncationErrorTol, 0.0,
+                        getWrapperDataContext( viewKeysStruct::timeStepTruncationErrorTolString() ) << ": should be positive" );
+
+  GEOS_ERROR_IF_LE_MSG( m_timeStepControllerIntegralGain, 0.0,
+                        getWrapperDataContext( viewKeysStruct::timeStepControllerIntegralGainString() ) << ": should be positive" );
+
+  GEOS_ERROR_IF( m_timeStepControllerProportionalGain < 0.0 || m_timeStepControllerDerivativeGain < 0.0,
+                 getDataContext() << ": the gains of the time-step controller should be non-negative" );
+
+  GEOS_ERROR_IF_LT_MSG( m_nonlinearAccelerationDepth, 1,
+                        getWrapperDataContext( viewKeysStruct::nonlinearAccelerationDepthString() ) << ": should be at least 1" );
+
   if( getLogLevel() > 0 )
   {
     print();
@@ -218,6 +303,13 @@ void NonlinearSolverParameters::print() const
   tableData.addRow( "Convergence tolerance", m_newtonTol );
   tableData.addRow( "Maximum iterations", m_maxIterNewton );
   tableData.addRow( "Minimum iterations", m_minIterNewton );
+  tableData.addRow( "Inexact Newton", m_inexactNewtonType );
+  tableData.addRow( "Nonlinear preconditioner", m_nonlinearPreconditionerType );
+  if( m_nonlinearPreconditionerType == NonlinearPreconditionerType::LocalNewton )
+  {
+    tableData.addRow( "  Maximum local iterations", m_localNewtonMaxIter );
+    tableData.addRow( "  Residual threshold", m_localNewtonResidualThreshold );
+  }
   tableData.addRow( "Maximum allowed residual norm", m_maxAllowedResidualNorm );
   tableData.addRow( "Allow non-converged", m_allowNonConverged );
   tableData.addRow( "Time-step decrease iterations limit", m_timeStepDecreaseIterLimit );
@@ -226,6 +318,14 @@ void NonlinearSolverParameters::print() const
   tableData.addRow( "Time-step increase factor", m_timeStepDecreaseFactor );
   tableData.addRow( "Time-step cut factor", m_timeStepCutFactor );
   tableData.addRow( "Minimum time-step increase interval", m_minTimeStepIncreaseInterval );
+  tableData.addRow( "Time-step controller", m_timeStepControllerType );
+  if( m_timeStepControllerType == TimeStepControllerType::PID )
+  {
+    tableData.addRow( "  Truncation error tolerance", m_timeStepTruncationErrorTol );
+    tableData.addRow( "  Proportional gain", m_timeStepControllerProportionalGain );
+    tableData.addRow( "  Integral gain", m_timeStepControllerIntegralGain );
+    tableData.addRow( "  Derivative gain", m_timeStepControllerDerivativeGain );
+  }
   tableData.addRow( "Maximum time-step cuts", m_maxTimeStepCuts );
   tableData.addRow( "Maximum sub time-steps", m_maxSubSteps );
   tableData.addRow( "Maximum number of configuration attempts", m_maxNumConfigurationAttempts );
@@ -234,6 +334,11 @@ void NonlinearSolverParameters::print() const
   {
     tableData.addRow( "Sequential convergence criterion", m_sequentialConvergenceCriterion );
     tableData.addRow( "Subcycling", m_subcyclingOption );
+    tableData.addRow( "Nonlinear acceleration", m_nonlinearAccelerationType );
+    if( m_nonlinearAccelerationType == NonlinearAccelerationType::Anderson )
+    {
+      tableData.addRow( "  Depth", m_nonlinearAccelerationDepth );
+    }
   }
   TableLayout const tableLayout = TableLayout( {
       TableLayout::ColumnParam{"Parameter", TableLayout::Alignment::left},
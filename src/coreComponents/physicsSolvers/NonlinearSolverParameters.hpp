@@ -72,6 +72,12 @@ public:
     m_minIterNewton = params.m_minIterNewton;
     m_numNewtonIterations = params.m_numNewtonIterations;
 
+    m_inexactNewtonType = params.m_inexactNewtonType;
+
+    m_nonlinearPreconditionerType = params.m_nonlinearPreconditionerType;
+    m_localNewtonMaxIter = params.m_localNewtonMaxIter;
+    m_localNewtonResidualThreshold = params.m_localNewtonResidualThreshold;
+
     m_maxAllowedResidualNorm = params.m_maxAllowedResidualNorm;
     m_allowNonConverged = params.m_allowNonConverged;
 
@@ -120,6 +126,10 @@ public:
     static constexpr char const * newtonMinIterString()           { return "newtonMinIter"; }
     static constexpr char const * newtonNumIterationsString()     { return "newtonNumberOfIterations"; }
     static constexpr char const * newtonSplitOperMaxIterString()  { return "newtonSplitOperMaxIter"; }
+    static constexpr char const * inexactNewtonTypeString()       { return "inexactNewtonType"; }
+    static constexpr char const * nonlinearPreconditionerTypeString() { return "nonlinearPreconditionerType"; }
+    static constexpr char const * localNewtonMaxIterString()      { return "localNewtonMaxIter"; }
+    static constexpr char const * localNewtonResidualThresholdString() { return "localNewtonResidualThreshold"; }
 
     static constexpr char const * allowNonConvergedString()       { return "allowNonConverged"; }
     static constexpr char const * timeStepDecreaseIterLimString() { return "timeStepDecreaseIterLimit"; }
@@ -127,6 +137,11 @@ public:
     static constexpr char const * timeStepDecreaseFactorString()  { return "timeStepDecreaseFactor"; }
     static constexpr char const * timeStepIncreaseFactorString()  { return "timeStepIncreaseFactor"; }
     static constexpr char const * minTimeStepIncreaseIntervalString()  { return "minTimeStepIncreaseInterval"; }
+    static constexpr char const * timeStepControllerTypeString()  { return "timeStepControllerType"; }
+    static constexpr char const * timeStepTruncationErrorTolString() { return "timeStepTruncationErrorTolerance"; }
+    static constexpr char const * timeStepControllerProportionalGainString() { return "timeStepControllerProportionalGain"; }
+    static constexpr char const * timeStepControllerIntegralGainString() { return "timeStepControllerIntegralGain"; }
+    static constexpr char const * timeStepControllerDerivativeGainString() { return "timeStepControllerDerivativeGain"; }
 
     static constexpr char const * maxSubStepsString()             { return "maxSubSteps"; }
     static constexpr char const * maxTimeStepCutsString()         { return "maxTimeStepCuts"; }
@@ -140,6 +155,7 @@ public:
     static constexpr char const * sequentialConvergenceCriterionString() { return "sequentialConvergenceCriterion"; }
     static constexpr char const * subcyclingOptionString()               { return "subcycling"; }
     static constexpr char const * nonlinearAccelerationTypeString() { return "nonlinearAccelerationType"; }
+    static constexpr char const * nonlinearAccelerationDepthString() { return "nonlinearAccelerationDepth"; }
   } viewKeys;
 
   /**
@@ -161,6 +177,33 @@ public:
     Parabolic, ///< use parabolic interpolation to define line search scaling factor.
   };
 
+  /**
+   * @brief Strategy used to choose the linear solver tolerance in a Newton loop.
+   */
+  enum class InexactNewtonType : integer
+  {
+    None,           ///< Solve every Newton linear system to the relative tolerance of the linear solver
+    EisenstatWalker ///< Drive the relative tolerance from the residual history (Eisenstat-Walker forcing terms)
+  };
+
+  /**
+   * @brief Nonlinear preconditioning applied before each global Newton update.
+   */
+  enum class NonlinearPreconditionerType : integer
+  {
+    None,       ///< Plain (global) Newton iterations
+    LocalNewton ///< Local Newton iterations on the strongly nonlinear rows of each rank (additive Schwarz)
+  };
+
+  /**
+   * @brief Strategy used to choose the size of the next time step.
+   */
+  enum class TimeStepControllerType : integer
+  {
+    NewtonIterations, ///< Increase or decrease the time step based on the number of Newton iterations
+    PID               ///< PID control of the truncation error estimated with a linear extrapolation predictor
+  };
+
   /**
    * @brief Coupling type.
    */
@@ -186,7 +229,8 @@ public:
   enum class NonlinearAccelerationType : integer
   {
     None, ///< no acceleration
-    Aitken ///< Aitken acceleration
+    Aitken, ///< Aitken acceleration
+    Anderson ///< Anderson acceleration
   };
 
   /**
@@ -228,6 +272,15 @@ public:
     return m_timeStepIncreaseFactor;
   }
 
+  /**
+   * @brief Getter for the strategy used to choose the size of the next time step
+   * @return the time-step controller type
+   */
+  TimeStepControllerType timeStepControllerType() const
+  {
+    return m_timeStepControllerType;
+  }
+
   /**
    * @brief Getter for the minimum interval for increasing the time-step
    * @return the minimum interval for increasing the time-step
@@ -246,6 +299,15 @@ public:
     return m_normType;
   }
 
+  /**
+   * @brief Getter for the inexact Newton strategy
+   * @return the inexact Newton strategy
+   */
+  InexactNewtonType inexactNewtonType() const
+  {
+    return m_inexactNewtonType;
+  }
+
   /**
    * @brief Getter for the coupling type
    * @return the coupling type
@@ -297,6 +359,18 @@ public:
   /// The number of nonlinear iterations that have been exectued.
   integer m_numNewtonIterations;
 
+  /// Strategy used to choose the linear solver tolerance in the Newton loop
+  InexactNewtonType m_inexactNewtonType;
+
+  /// Nonlinear preconditioning applied before each global Newton update
+  NonlinearPreconditionerType m_nonlinearPreconditionerType;
+
+  /// The maximum number of local Newton iterations before each global Newton update
+  integer m_localNewtonMaxIter;
+
+  /// Fraction of the largest residual on a rank above which rows are included in the local Newton subproblems
+  real64 m_localNewtonResidualThreshold;
+
   /// The maximum value of residual norm that we allow (otherwise, we cut the time step)
   real64 m_maxAllowedResidualNorm;
 
@@ -318,6 +392,21 @@ public:
   /// Minimum interval, since the last time-step cut, for increasing the time-step
   integer m_minTimeStepIncreaseInterval;
 
+  /// Strategy used to choose the size of the next time step
+  TimeStepControllerType m_timeStepControllerType;
+
+  /// Target value of the (relative) truncation error estimate for the PID time-step controller
+  real64 m_timeStepTruncationErrorTol;
+
+  /// Proportional gain of the PID time-step controller
+  real64 m_timeStepControllerProportionalGain;
+
+  /// Integral gain of the PID time-step controller
+  real64 m_timeStepControllerIntegralGain;
+
+  /// Derivative gain of the PID time-step controller
+  real64 m_timeStepControllerDerivativeGain;
+
   /// Maximum number of time sub-steps allowed for the solver
   integer m_maxSubSteps;
 
@@ -351,6 +440,9 @@ public:
   /// Type of nonlinear acceleration for sequential solver
   NonlinearAccelerationType m_nonlinearAccelerationType;
 
+  /// Number of previous outer iterations used by the Anderson acceleration
+  integer m_nonlinearAccelerationDepth;
+
   /// Value used to make sure that residual normalizers are not too small when computing residual norm
   real64 m_minNormalizer = 1e-12;
 };
@@ -364,6 +456,18 @@ ENUM_STRINGS( NonlinearSolverParameters::LineSearchInterpolationType,
               "Linear",
               "Parabolic" );
 
+ENUM_STRINGS( NonlinearSolverParameters::InexactNewtonType,
+              "None",
+              "EisenstatWalker" );
+
+ENUM_STRINGS( NonlinearSolverParameters::NonlinearPreconditionerType,
+              "None",
+              "LocalNewton" );
+
+ENUM_STRINGS( NonlinearSolverParameters::TimeStepControllerType,
+              "NewtonIterations",
+              "PID" );
+
 ENUM_STRINGS( NonlinearSolverParameters::CouplingType,
               "FullyImplicit",
               "Sequential" );
@@ -375,7 +479,8 @@ ENUM_STRINGS( NonlinearSolverParameters::SequentialConvergenceCriterion,
 
 ENUM_STRINGS( NonlinearSolverParameters::NonlinearAccelerationType,
               "None",
-              "Aitken" );
+              "Aitken",
+              "Anderson" );
 
 } /* namespace geos */
 
@@ -16,8 +16,10 @@
 #include "PhysicsSolverBase.hpp"
 #include "PhysicsSolverManager.hpp"
 
+#include "codingUtilities/Utilities.hpp"
 #include "common/TimingMacros.hpp"
 #include "linearAlgebra/solvers/KrylovSolver.hpp"
+#include "linearAlgebra/solvers/PreconditionerBlockILU.hpp"
 #include "mesh/DomainPartition.hpp"
 #include "math/interpolation/Interpolation.hpp"
 #include "common/Timer.hpp"
@@ -28,6 +30,8 @@
 #include "python/PySolverType.hpp"
 #endif
 
+#include <tuple>
+
 namespace geos
 {
 
@@ -41,7 +45,13 @@ PhysicsSolverBase::PhysicsSolverBase( string const & name,
   m_maxStableDt{ 1e99 },
   m_nextDt( 1e99 ),
   m_numTimestepsSinceLastDtCut( -1 ),
+  m_lastStepDt( 0.0 ),
+  m_isPredictorApplied( false ),
+  m_truncationErrors{},
+  m_numTruncationErrors( 0 ),
   m_dofManager( name ),
+  m_isSparsityPatternModified( true ),
+  m_useAssemblyMaps( 0 ),
   m_linearSolverParameters( groupKeyStruct::linearSolverParametersString(), this ),
   m_nonlinearSolverParameters( groupKeyStruct::nonlinearSolverParametersString(), this ),
   m_solverStatistics( groupKeyStruct::solverStatisticsString(), this ),
@@ -235,6 +245,10 @@ real64 PhysicsSolverBase::solverStep( real64 const & time_n,
     setupSystem( domain, m_dofManager, m_localMatrix, m_rhs, m_solution );
     setSystemSetupTimestamp( meshModificationTimestamp );
 
+    // the degrees of freedom changed, the update of the last step cannot be extrapolated
+    m_lastStepDt = 0.0;
+    m_numTruncationErrors = 0;
+
     std::ostringstream oss;
     m_dofManager.printFieldInfo( oss );
     GEOS_LOG_LEVEL_INFO( logInfo::Fields, oss.str())
@@ -367,9 +381,19 @@ real64 PhysicsSolverBase::setNextDt( real64 const & currentDt,
                                      DomainPartition & domain )
 {
   integer const minTimeStepIncreaseInterval = m_nonlinearSolverParameters.minTimeStepIncreaseInterval();
-  real64 const nextDtNewton = setNextDtBasedOnNewtonIter( currentDt );
+  real64 nextDtNewton = setNextDtBasedOnNewtonIter( currentDt );
   if( m_nonlinearSolverParameters.getLogLevel() > 0 )
     GEOS_LOG_RANK_0( GEOS_FMT( "{}: next time step based on Newton iterations = {}", getName(), nextDtNewton ));
+  char const * convergenceCriterion = "number of iterations";
+  if( m_nonlinearSolverParameters.timeStepControllerType() == NonlinearSolverParameters::TimeStepControllerType::PID )
+  {
+    real64 const nextDtTruncationError = setNextDtBasedOnTruncationError( currentDt );
+    if( m_nonlinearSolverParameters.getLogLevel() > 0 )
+      GEOS_LOG_RANK_0( GEOS_FMT( "{}: next time step based on truncation error = {}", getName(), nextDtTruncationError ));
+    // the time step is still decreased when the Newton loop struggles
+    nextDtNewton = nextDtNewton < currentDt ? std::min( nextDtNewton, nextDtTruncationError ) : nextDtTruncationError;
+    convergenceCriterion = "truncation error";
+  }
   real64 const nextDtStateChange = setNextDtBasedOnStateChange( currentDt, domain );
   if( m_nonlinearSolverParameters.getLogLevel() > 0 )
     GEOS_LOG_RANK_0( GEOS_FMT( "{}: next time step based on state change = {}", getName(), nextDtStateChange ));
@@ -385,18 +409,18 @@ real64 PhysicsSolverBase::setNextDt( real64 const & currentDt,
   {
     if( nextDtNewton > currentDt )
     {
-      GEOS_LOG_LEVEL_INFO_RANK_0( logInfo::TimeStep, GEOS_FMT( "{}: time-step required will be increased based on number of iterations.",
-                                                               getName() ) );
+      GEOS_LOG_LEVEL_INFO_RANK_0( logInfo::TimeStep, GEOS_FMT( "{}: time-step required will be increased based on {}.",
+                                                               getName(), convergenceCriterion ) );
     }
     else if( nextDtNewton < currentDt )
     {
-      GEOS_LOG_LEVEL_INFO_RANK_0( logInfo::TimeStep, GEOS_FMT( "{}: time-step required will be decreased based on number of iterations.",
-                                                               getName() ) );
+      GEOS_LOG_LEVEL_INFO_RANK_0( logInfo::TimeStep, GEOS_FMT( "{}: time-step required will be decreased based on {}.",
+                                                               getName(), convergenceCriterion ) );
     }
     else
     {
-      GEOS_LOG_LEVEL_INFO_RANK_0( logInfo::TimeStep, GEOS_FMT( "{}: time-step required will be kept the same based on number of iterations.",
-                                                               getName() ) );
+      GEOS_LOG_LEVEL_INFO_RANK_0( logInfo::TimeStep, GEOS_FMT( "{}: time-step required will be kept the same based on {}.",
+                                                               getName(), convergenceCriterion ) );
     }
   }
   else         // time step size decided based on state change
@@ -458,6 +482,40 @@ real64 PhysicsSolverBase::setNextDtBasedOnNewtonIter( real64 const & currentDt )
   return nextDt;
 }
 
+real64 PhysicsSolverBase::setNextDtBasedOnTruncationError( real64 const & currentDt )
+{
+  if( m_numTruncationErrors == 0 )
+  {
+    // no estimate yet, e.g. at the first time step
+    return setNextDtBasedOnNewtonIter( currentDt );
+  }
+
+  NonlinearSolverParameters const & params = m_nonlinearSolverParameters;
+
+  // errors relative to the tolerance, bounded away from zero for (nearly) linear evolutions
+  real64 const minError = 1e-8;
+  real64 const e0 = std::max( m_truncationErrors[0], minError );
+  real64 const e1 = std::max( m_truncationErrors[1], minError );
+  real64 const e2 = std::max( m_truncationErrors[2], minError );
+
+  // PID controller (Valli et al., 2005): the terms requiring a longer history are added when it is available
+  real64 factor = std::pow( 1.0 / e0, params.m_timeStepControllerIntegralGain );
+  if( m_numTruncationErrors > 1 )
+  {
+    factor *= std::pow( e1 / e0, params.m_timeStepControllerProportionalGain );
+  }
+  if( m_numTruncationErrors > 2 )
+  {
+    factor *= std::pow( e1 * e1 / ( e0 * e2 ), params.m_timeStepControllerDerivativeGain );
+  }
+  factor = std::min( std::max( factor, params.timeStepDecreaseFactor() ), params.timeStepIncreaseFactor() );
+
+  real64 const nextDt = currentDt * factor;
+  if( params.getLogLevel() > 0 )
+    GEOS_LOG_RANK_0( GEOS_FMT( "{}: truncation error = {:4.2e} x tolerance, next time step = {} (factor {:4.2f})", getName(), e0, nextDt, factor ));
+  return nextDt;
+}
+
 
 real64 PhysicsSolverBase::setNextDtBasedOnCFL( const geos::real64 & currentDt, geos::DomainPartition & domain )
 {
@@ -515,17 +573,14 @@ real64 PhysicsSolverBase::linearImplicitStep( real64 const & time_n,
   {
     Timer timer( m_timers["linear solver total"] );
 
-    // TODO: Trilinos currently requires this, re-evaluate after moving to Tpetra-based solvers
-    if( m_precond )
-    {
-      m_precond->clear();
-    }
+    // Decide whether the preconditioner can be reused for this solve
+    updatePreconditionerReuse( time_n, dt, 0 );
 
     {
       Timer timer_create( m_timers["linear solver create"] );
 
       // Compose parallel LA matrix out of local matrix
-      m_matrix.create( m_localMatrix.toViewConst(), m_dofManager.numLocalDofs(), MPI_COMM_GEOS );
+      composeParallelMatrix();
     }
 
     // Output the linear system matrix/rhs for debugging purposes
@@ -605,6 +660,7 @@ bool PhysicsSolverBase::lineSearch( real64 const & time_n,
     }
 
     applySystemSolution( dofManager, solution.values(), localScaleFactor, dt, domain );
+    recordSolutionUpdate( solution.values(), localScaleFactor );
 
     // update non-primary variables (constitutive models)
     updateState( domain );
@@ -694,6 +750,7 @@ bool PhysicsSolverBase::lineSearchWithParabolicInterpolation( real64 const & tim
     }
 
     applySystemSolution( dofManager, solution.values(), deltaLocalScaleFactor, dt, domain );
+    recordSolutionUpdate( solution.values(), deltaLocalScaleFactor );
 
     updateState( domain );
 
@@ -739,6 +796,338 @@ bool PhysicsSolverBase::lineSearchWithParabolicInterpolation( real64 const & tim
 }
 
 
+void PhysicsSolverBase::flagLocalNewtonRows( DomainPartition const & GEOS_UNUSED_PARAM( domain ),
+                                             DofManager const & GEOS_UNUSED_PARAM( dofManager ),
+                                             arrayView1d< real64 const > const & localRhs,
+                                             real64 const threshold,
+                                             arrayView1d< integer > const & isFlagged ) const
+{
+  RAJA::ReduceMax< parallelDeviceReduce, real64 > maxResidual( 0.0 );
+  forAll< parallelDevicePolicy<> >( localRhs.size(), [=] GEOS_HOST_DEVICE ( localIndex const row )
+  {
+    maxResidual.max( LvArray::math::abs( localRhs[row] ) );
+  } );
+
+  real64 const minResidual = threshold * maxResidual.get();
+  forAll< parallelDevicePolicy<> >( localRhs.size(), [=] GEOS_HOST_DEVICE ( localIndex const row )
+  {
+    isFlagged[row] = LvArray::math::abs( localRhs[row] ) >= minResidual;
+  } );
+}
+
+void PhysicsSolverBase::localNewtonIterations( real64 const & time_n,
+                                               real64 const & dt,
+                                               DomainPartition & domain,
+                                               real64 & residualNorm )
+{
+  GEOS_MARK_FUNCTION;
+
+  Timer timer( m_timers["local Newton iterations"] );
+
+  // re-assemble the (full) system at the current state and return its residual norm
+  auto const assemble = [&]()
+  {
+    m_localMatrix.zero();
+    m_rhs.zero();
+
+    arrayView1d< real64 > const localRhs = m_rhs.open();
+    assembleSystem( time_n, dt, domain, m_dofManager, m_localMatrix.toViewConstSizes(), localRhs );
+    applyBoundaryConditions( time_n, dt, domain, m_dofManager, m_localMatrix.toViewConstSizes(), localRhs );
+    m_rhs.close();
+
+    return calculateResidualNorm( time_n, dt, domain, m_dofManager, m_rhs.values() );
+  };
+
+  NonlinearSolverParameters const & params = m_nonlinearSolverParameters;
+  globalIndex const rankOffset = m_dofManager.rankOffset();
+  localIndex const numLocalRows = m_localMatrix.numRows();
+  array1d< integer > isFlagged( numLocalRows );
+
+  for( integer localIter = 0; localIter < params.m_localNewtonMaxIter; ++localIter )
+  {
+    // 1. Flag the rows of the local subproblems
+    flagLocalNewtonRows( domain, m_dofManager, m_rhs.values(), params.m_localNewtonResidualThreshold, isFlagged.toView() );
+
+    arrayView1d< integer const > const flagged = isFlagged.toViewConst();
+    RAJA::ReduceSum< parallelDeviceReduce, globalIndex > numFlaggedLocal( 0 );
+    forAll< parallelDevicePolicy<> >( numLocalRows, [=] GEOS_HOST_DEVICE ( localIndex const row )
+    {
+      numFlaggedLocal += flagged[row];
+    } );
+    globalIndex const numFlagged = MpiWrapper::sum( numFlaggedLocal.get() );
+    if( numFlagged == 0 )
+    {
+      break;
+    }
+
+    // 2. Restrict the system: the other rows are replaced by identity rows with a zero right-hand side,
+    //    and the couplings to these rows and to the other ranks are dropped. The restriction is applied to a copy,
+    //    so that the global matrix (and the preconditioner set up on it) is left untouched
+    CRSMatrix< real64, globalIndex > restrictedLocalMatrix( m_localMatrix );
+    {
+      CRSMatrixView< real64, globalIndex const > const localMatrix = restrictedLocalMatrix.toViewConstSizes();
+      arrayView1d< real64 > const localRhs = m_rhs.open();
+      forAll< parallelDevicePolicy<> >( numLocalRows, [=] GEOS_HOST_DEVICE ( localIndex const row )
+      {
+        globalIndex const globalRow = rankOffset + row;
+        arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( row );
+        arraySlice1d< real64 > const entries = localMatrix.getEntries( row );
+        for( localIndex k = 0; k < columns.size(); ++k )
+        {
+          if( !flagged[row] )
+          {
+            entries[k] = ( columns[k] == globalRow ) ? 1.0 : 0.0;
+          }
+          else
+          {
+            localIndex const localCol = static_cast< localIndex >( columns[k] - rankOffset );
+            if( localCol < 0 || localCol >= numLocalRows || !flagged[localCol] )
+            {
+              entries[k] = 0.0;
+            }
+          }
+        }
+        if( !flagged[row] )
+        {
+          localRhs[row] = 0.0;
+        }
+      } );
+      m_rhs.close();
+    }
+
+    // 3. Solve the local subproblems. Without couplings between ranks the restricted matrix is block diagonal by rank,
+    //    so it is preconditioned by a rank-local block ILU. The global matrix, linear solver and preconditioner are
+    //    not touched, and the global preconditioner remains available for reuse by the next global solve
+    ParallelMatrix restrictedMatrix;
+    restrictedMatrix.create( restrictedLocalMatrix.toViewConst(), m_dofManager.numLocalDofs(), MPI_COMM_GEOS );
+    m_rhs.scale( -1.0 );
+    m_solution.zero();
+    {
+      LinearSolverParameters localParams = m_linearSolverParameters.get();
+      localParams.solverType = LinearSolverParameters::SolverType::gmres;
+      integer const blockSize = numLocalRows % localParams.dofsPerNode == 0 ? localParams.dofsPerNode : 1;
+      PreconditionerBlockILU< LAInterface > localPrecond( blockSize, localParams.ifact.fill );
+      {
+        Timer timer_setup( m_timers["local Newton linear solver setup"] );
+        localPrecond.setup( restrictedMatrix );
+      }
+      std::unique_ptr< KrylovSolver< ParallelVector > > const localSolver =
+        KrylovSolver< ParallelVector >::create( localParams, restrictedMatrix, localPrecond );
+      localSolver->solve( m_rhs, m_solution );
+      m_solverStatistics.logLocalNewtonIteration( localSolver->result().numIterations );
+      GEOS_WARNING_IF( !localSolver->result().success(), getDataContext() << ": Local Newton linear solution failed" );
+    }
+
+    real64 const scaleFactor = scalingForSystemSolution( domain, m_dofManager, m_solution.values() );
+    if( !checkSystemSolution( domain, m_dofManager, m_solution.values(), scaleFactor ) )
+    {
+      GEOS_LOG_LEVEL_INFO_RANK_0( logInfo::NonlinearSolver, GEOS_FMT( "        Local Newton {}: solution check failed", localIter ) );
+      residualNorm = assemble();
+      break;
+    }
+    saveNonlinearIterationState( domain );
+    applySystemSolution( m_dofManager, m_solution.values(), scaleFactor, dt, domain );
+    recordSolutionUpdate( m_solution.values(), scaleFactor );
+    updateState( domain );
+
+    // 4. Check the global residual, and restore the previous iterate if it increased
+    //    (the update applied may differ from the scaled solution, e.g. with chopping)
+    real64 const newResidualNorm = assemble();
+    GEOS_LOG_LEVEL_INFO_RANK_0( logInfo::NonlinearSolver,
+                                GEOS_FMT( "        Local Newton {}: {} flagged rows, ( R ) = ( {:4.2e} )", localIter, numFlagged, newResidualNorm ) );
+    if( newResidualNorm > residualNorm )
+    {
+      restoreNonlinearIterationState( domain );
+      recordSolutionUpdate( m_solution.values(), -scaleFactor );
+      updateState( domain );
+      residualNorm = assemble();
+      break;
+    }
+    residualNorm = newResidualNorm;
+
+    if( residualNorm < params.m_newtonTol )
+    {
+      break;
+    }
+  }
+}
+
+void PhysicsSolverBase::applyTimeStepPredictor( real64 const & dt,
+                                                DomainPartition & domain )
+{
+  m_isPredictorApplied = false;
+  if( m_nonlinearSolverParameters.timeStepControllerType() != NonlinearSolverParameters::TimeStepControllerType::PID )
+  {
+    return;
+  }
+
+  GEOS_MARK_FUNCTION;
+
+  localIndex const numLocalDofs = m_dofManager.numLocalDofs();
+  m_stepIncrement.resize( numLocalDofs );
+  m_stepIncrement.zero();
+  m_predictedIncrement.resize( numLocalDofs );
+  m_predictedIncrement.zero();
+
+  // the update of the last step can only be extrapolated if the degrees of freedom did not change
+  integer const canPredict = m_lastStepDt > 0.0 && m_lastStepIncrement.size() == numLocalDofs;
+  if( MpiWrapper::min( canPredict ) == 0 )
+  {
+    return;
+  }
+
+  // linear extrapolation of the primary variables
+  real64 const dtRatio = dt / m_lastStepDt;
+  arrayView1d< real64 const > const lastStepIncrement = m_lastStepIncrement.toViewConst();
+  arrayView1d< real64 > const predictedIncrement = m_predictedIncrement.toView();
+  forAll< parallelDevicePolicy<> >( numLocalDofs, [=] GEOS_HOST_DEVICE ( localIndex const i )
+  {
+    predictedIncrement[i] = dtRatio * lastStepIncrement[i];
+  } );
+
+  real64 const scaleFactor = scalingForSystemSolution( domain, m_dofManager, m_predictedIncrement.toViewConst() );
+  if( !checkSystemSolution( domain, m_dofManager, m_predictedIncrement.toViewConst(), scaleFactor ) )
+  {
+    GEOS_LOG_LEVEL_INFO_RANK_0( logInfo::TimeStep, GEOS_FMT( "{}: time-step predictor skipped (solution check failed)", getName() ) );
+    m_predictedIncrement.zero();
+    return;
+  }
+  applySystemSolution( m_dofManager, m_predictedIncrement.toViewConst(), scaleFactor, dt, domain );
+  updateState( domain );
+
+  // keep the books on the update actually applied
+  forAll< parallelDevicePolicy<> >( numLocalDofs, [=] GEOS_HOST_DEVICE ( localIndex const i )
+  {
+    predictedIncrement[i] *= scaleFactor;
+  } );
+  m_stepIncrement = m_predictedIncrement;
+  m_isPredictorApplied = true;
+
+  GEOS_LOG_LEVEL_INFO_RANK_0( logInfo::TimeStep, GEOS_FMT( "{}: time-step predictor applied (dt ratio = {:4.2f}, scaling factor = {:4.2f})",
+                                                           getName(), dtRatio, scaleFactor ) );
+}
+
+void PhysicsSolverBase::recordSolutionUpdate( arrayView1d< real64 const > const & localSolution,
+                                              real64 const scalingFactor )
+{
+  if( m_nonlinearSolverParameters.timeStepControllerType() != NonlinearSolverParameters::TimeStepControllerType::PID ||
+      m_stepIncrement.size() != localSolution.size() )
+  {
+    return;
+  }
+
+  // note: the chopping of the primary variables done by some solvers in applySystemSolution is not recorded
+  arrayView1d< real64 > const stepIncrement = m_stepIncrement.toView();
+  forAll< parallelDevicePolicy<> >( localSolution.size(), [=] GEOS_HOST_DEVICE ( localIndex const i )
+  {
+    stepIncrement[i] += scalingFactor * localSolution[i];
+  } );
+}
+
+void PhysicsSolverBase::estimateTruncationError( real64 const & dt )
+{
+  if( m_nonlinearSolverParameters.timeStepControllerType() != NonlinearSolverParameters::TimeStepControllerType::PID )
+  {
+    return;
+  }
+
+  GEOS_MARK_FUNCTION;
+
+  if( m_isPredictorApplied )
+  {
+    array1d< integer > labels;
+    m_dofManager.getLocalDofComponentLabels( labels );
+    array1d< integer > const numComponentsPerField = m_dofManager.numComponentsPerField();
+    integer numLabels = 0;
+    for( localIndex f = 0; f < numComponentsPerField.size(); ++f )
+    {
+      numLabels += numComponentsPerField[f];
+    }
+
+    // largest difference between the converged and the predicted update, and largest converged update, per component
+    array1d< real64 > localMax( 2 * numLabels );
+    arrayView1d< integer const > const labelsView = labels.toViewConst();
+    arrayView1d< real64 const > const stepIncrement = m_stepIncrement.toViewConst();
+    arrayView1d< real64 const > const predictedIncrement = m_predictedIncrement.toViewConst();
+    for( integer c = 0; c < numLabels; ++c )
+    {
+      RAJA::ReduceMax< parallelDeviceReduce, real64 > maxDifference( 0.0 );
+      RAJA::ReduceMax< parallelDeviceReduce, real64 > maxIncrement( 0.0 );
+      forAll< parallelDevicePolicy<> >( stepIncrement.size(), [=] GEOS_HOST_DEVICE ( localIndex const i )
+      {
+        if( labelsView[i] == c )
+        {
+          maxDifference.max( LvArray::math::abs( stepIncrement[i] - predictedIncrement[i] ) );
+          maxIncrement.max( LvArray::math::abs( stepIncrement[i] ) );
+        }
+      } );
+      localMax[c] = maxDifference.get();
+      localMax[numLabels + c] = maxIncrement.get();
+    }
+    array1d< real64 > globalMax( 2 * numLabels );
+    MpiWrapper::allReduce( localMax.data(),
+                           globalMax.data(),
+                           LvArray::integerConversion< int >( localMax.size() ),
+                           MPI_MAX,
+                           MPI_COMM_GEOS );
+
+    real64 error = 0.0;
+    for( integer c = 0; c < numLabels; ++c )
+    {
+      if( globalMax[numLabels + c] > m_nonlinearSolverParameters.m_minNormalizer )
+      {
+        error = std::max( error, globalMax[c] / globalMax[numLabels + c] );
+      }
+    }
+    real64 const relativeError = error / m_nonlinearSolverParameters.m_timeStepTruncationErrorTol;
+
+    m_truncationErrors[2] = m_truncationErrors[1];
+    m_truncationErrors[1] = m_truncationErrors[0];
+    m_truncationErrors[0] = relativeError;
+    m_numTruncationErrors = std::min( m_numTruncationErrors + 1, 3 );
+
+    GEOS_LOG_LEVEL_INFO_RANK_0( logInfo::TimeStep, GEOS_FMT( "{}: truncation error estimate = {:4.2e} (tolerance = {:4.2e})",
+                                                             getName(), error, m_nonlinearSolverParameters.m_timeStepTruncationErrorTol ) );
+    if( relativeError > 1.0 )
+    {
+      m_solverStatistics.logTimeStepAboveErrorTolerance();
+    }
+  }
+  else
+  {
+    m_numTruncationErrors = 0;
+  }
+
+  m_lastStepIncrement = m_stepIncrement;
+  m_lastStepDt = dt;
+}
+
+namespace
+{
+
+/**
+ * @brief Estimate the number of Krylov iterations saved by solving to a looser tolerance than the nominal one
+ * @param result the result of the linear solve
+ * @param nominalTol the nominal relative tolerance of the linear solver
+ * @return the estimated number of iterations saved (negative if the solve was tighter than the nominal tolerance)
+ *
+ * The convergence rate is assumed constant: reaching @p nominalTol would have taken
+ * numIterations * log( nominalTol ) / log( residualReduction ) iterations.
+ */
+integer estimateLinearIterationsSaved( LinearSolverResult const & result,
+                                       real64 const nominalTol )
+{
+  if( !result.success() || result.numIterations == 0 ||
+      result.residualReduction <= 0.0 || result.residualReduction >= 1.0 )
+  {
+    return 0;
+  }
+  real64 const numIterationsAtNominalTol = result.numIterations * std::log( nominalTol ) / std::log( result.residualReduction );
+  return LvArray::integerConversion< integer >( std::lround( numIterationsAtNominalTol ) ) - result.numIterations;
+}
+
+}
+
 real64 PhysicsSolverBase::eisenstatWalker( real64 const newNewtonNorm,
                                            real64 const oldNewtonNorm,
                                            LinearSolverParameters::Krylov const & krylovParams )
@@ -794,6 +1183,9 @@ real64 PhysicsSolverBase::nonlinearImplicitStep( real64 const & time_n,
       resetConfigurationToBeginningOfStep( domain );
     }
 
+    // initial guess of the Newton loop
+    applyTimeStepPredictor( stepDt, domain );
+
     // it's the simplest configuration that can be attempted whenever Newton's fails as a last resource.
     bool attemptedSimplestConfiguration = false;
 
@@ -832,6 +1224,7 @@ real64 PhysicsSolverBase::nonlinearImplicitStep( real64 const & time_n,
         {
           break;
         }
+        applyTimeStepPredictor( stepDt, domain );
       }
       else
       {
@@ -857,13 +1250,22 @@ real64 PhysicsSolverBase::nonlinearImplicitStep( real64 const & time_n,
     }
   } // end of outer loop (dt chopping strategy)
 
-  if( !isConfigurationLoopConverged )
+  if( isConfigurationLoopConverged )
+  {
+    estimateTruncationError( stepDt );
+  }
+  else
   {
     GEOS_LOG_RANK_0( "Convergence not achieved." );
 
     if( allowNonConverged )
     {
       GEOS_LOG_RANK_0( "The accepted solution may be inaccurate." );
+      m_solverStatistics.logNonConvergedTimeStep();
+
+      // the update of this step is not extrapolated by the predictor
+      m_lastStepDt = 0.0;
+      m_numTruncationErrors = 0;
     }
     else
     {
@@ -893,6 +1295,15 @@ bool PhysicsSolverBase::solveNonlinearSystem( real64 const & time_n,
 
   bool isNewtonConverged = false;
 
+  // with an inexact Newton method, the Krylov tolerance is driven by the residual history;
+  // the nominal tolerance is restored at the end of the loop and serves as a reference for the statistics
+  LinearSolverParameters & linearSolverParams = m_linearSolverParameters.get();
+  real64 const nominalKrylovTol = linearSolverParams.krylov.relTolerance;
+  bool const useAdaptiveKrylovTol =
+    linearSolverParams.solverType != LinearSolverParameters::SolverType::direct &&
+    ( linearSolverParams.krylov.useAdaptiveTol ||
+      m_nonlinearSolverParameters.inexactNewtonType() == NonlinearSolverParameters::InexactNewtonType::EisenstatWalker );
+
   for( newtonIter = 0; newtonIter < maxNewtonIter; ++newtonIter )
   {
 
@@ -1019,28 +1430,35 @@ bool PhysicsSolverBase::solveNonlinearSystem( real64 const & time_n,
       }
     }
 
+    // nonlinear preconditioning: local Newton iterations on the strongly nonlinear rows before the global update
+    if( m_nonlinearSolverParameters.m_nonlinearPreconditionerType == NonlinearSolverParameters::NonlinearPreconditionerType::LocalNewton )
+    {
+      localNewtonIterations( time_n, stepDt, domain, residualNorm );
+      if( residualNorm < newtonTol && newtonIter >= minNewtonIter )
+      {
+        isNewtonConverged = true;
+        break;
+      }
+    }
+
     {
       Timer timer( m_timers["linear solver total"] );
 
       // if using adaptive Krylov tolerance scheme, update tolerance.
-      LinearSolverParameters::Krylov & krylovParams = m_linearSolverParameters.get().krylov;
-      if( krylovParams.useAdaptiveTol )
+      LinearSolverParameters::Krylov & krylovParams = linearSolverParams.krylov;
+      if( useAdaptiveKrylovTol )
       {
         krylovParams.relTolerance = newtonIter > 0 ? eisenstatWalker( residualNorm, lastResidual, krylovParams ) : krylovParams.weakestTol;
       }
 
-      // TODO: Trilinos currently requires this, re-evaluate after moving to Tpetra-based solvers
-      if( m_precond )
-      {
-        m_precond->clear();
-      }
+      // Decide whether the preconditioner can be reused for this solve
+      updatePreconditionerReuse( time_n, stepDt, newtonIter );
 
       {
         Timer timer_setup( m_timers["linear solver create"] );
 
         // Compose parallel LA matrix/rhs out of local LA matrix/rhs
-        //
-        m_matrix.create( m_localMatrix.toViewConst(), m_dofManager.numLocalDofs(), MPI_COMM_GEOS );
+        composeParallelMatrix();
       }
 
       // Output the linear system matrix/rhs for debugging purposes
@@ -1051,6 +1469,10 @@ bool PhysicsSolverBase::solveNonlinearSystem( real64 const & time_n,
 
       // Increment the solver statistics for reporting purposes
       m_solverStatistics.logNonlinearIteration( m_linearSolverResult.numIterations );
+      if( useAdaptiveKrylovTol )
+      {
+        m_solverStatistics.logLinearIterationsSaved( estimateLinearIterationsSaved( m_linearSolverResult, nominalKrylovTol ) );
+      }
 
       // Output the linear system solution for debugging purposes
       debugOutputSolution( time_n, cycleNumber, newtonIter, m_solution );
@@ -1073,6 +1495,7 @@ bool PhysicsSolverBase::solveNonlinearSystem( real64 const & time_n,
 
       // apply the system solution to the fields/variables
       applySystemSolution( m_dofManager, m_solution.values(), scaleFactor, stepDt, domain );
+      recordSolutionUpdate( m_solution.values(), scaleFactor );
     }
 
     {
@@ -1085,6 +1508,8 @@ bool PhysicsSolverBase::solveNonlinearSystem( real64 const & time_n,
     lastResidual = residualNorm;
   }
 
+  linearSolverParams.krylov.relTolerance = nominalKrylovTol;
+
   return isNewtonConverged;
 }
 
@@ -1129,6 +1554,8 @@ void PhysicsSolverBase::setupSystem( DomainPartition & domain,
     SparsityPattern< globalIndex > pattern;
     dofManager.setSparsityPattern( pattern );
     localMatrix.assimilate< parallelDevicePolicy<> >( std::move( pattern ) );
+    m_isSparsityPatternModified = true;
+    m_assemblyMaps.clear();
   }
   localMatrix.setName( this->getName() + "/matrix" );
 
@@ -1259,6 +1686,93 @@ PhysicsSolverBase::calculateResidualNorm( real64 const & GEOS_UNUSED_PARAM( time
   return 0;
 }
 
+std::function< real64() >
+PhysicsSolverBase::calculateLocalResidualNorm( real64 const & time,
+                                               real64 const & dt,
+                                               DomainPartition const & domain,
+                                               DofManager const & dofManager,
+                                               arrayView1d< real64 const > const & localRhs,
+                                               physicsSolverBaseKernels::ResidualNormReduction & GEOS_UNUSED_PARAM( reduction ) )
+{
+  real64 const residualNorm = calculateResidualNorm( time, dt, domain, dofManager, localRhs );
+  return [residualNorm]() { return residualNorm; };
+}
+
+void PhysicsSolverBase::updatePreconditionerReuse( real64 const & time_n,
+                                                   real64 const & dt,
+                                                   integer const newtonIter )
+{
+  m_precondReuse.update( m_linearSolverParameters.get().reuse, time_n, dt, newtonIter );
+}
+
+void PhysicsSolverBase::registerUseAssemblyMapsWrapper()
+{
+  registerWrapper( viewKeyStruct::useAssemblyMapsString(), &m_useAssemblyMaps ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to record, on the first assembly after the setup of the sparsity pattern, the positions of the "
+                    "local contributions in the matrix, and add the values directly at these positions in the next assemblies "
+                    "instead of searching them. Available for the quasi-static solid mechanics, isothermal single-phase FVM and "
+                    "isothermal compositional FVM solvers." );
+}
+
+void PhysicsSolverBase::composeParallelMatrix()
+{
+  GEOS_MARK_FUNCTION;
+
+  bool const canUpdateValues = !m_isSparsityPatternModified &&
+                               m_matrix.ready() &&
+                               m_matrix.numLocalRows() == m_localMatrix.numRows();
+
+  // TODO: Trilinos currently requires this, re-evaluate after moving to Tpetra-based solvers
+  // The solver-specific preconditioner is kept when it is about to be reused with the same matrix layout
+  if( m_precond && !( canUpdateValues && m_precondReuse.canReuse( m_linearSolverParameters.get().reuse ) ) )
+  {
+    m_precond->clear();
+  }
+  if( m_linearSolver )
+  {
+    m_linearSolver->clear();
+  }
+
+  if( canUpdateValues )
+  {
+    m_matrix.updateValues( m_localMatrix.toViewConst() );
+  }
+  else
+  {
+    m_matrix.create( m_localMatrix.toViewConst(), m_dofManager.numLocalDofs(), MPI_COMM_GEOS );
+    m_isSparsityPatternModified = false;
+
+    // the solver may hold data tied to the previous matrix layout (e.g. direct solver exporters)
+    m_linearSolver.reset();
+    m_defaultPrecond.reset();
+    m_precondReuse.markStale();
+  }
+}
+
+namespace
+{
+
+/**
+ * @brief Check whether a linear solver created with some parameters can be reused with new ones
+ * @param oldParams the parameters the solver was created with
+ * @param newParams the current parameters
+ * @return true if the solver can be reused (after updating the Krylov tolerance), false otherwise
+ *
+ * All the parameters are compared, except the relative Krylov tolerance that is updated in place
+ * (it is modified at every Newton iteration by the adaptive tolerance scheme).
+ */
+bool isLinearSolverReusable( LinearSolverParameters const & oldParams,
+                             LinearSolverParameters const & newParams )
+{
+  LinearSolverParameters params = newParams;
+  params.krylov.relTolerance = oldParams.krylov.relTolerance;
+  return params == oldParams;
+}
+
+}
+
 void PhysicsSolverBase::solveLinearSystem( DofManager const & dofManager,
                                            ParallelMatrix & matrix,
                                            ParallelVector & rhs,
@@ -1272,31 +1786,130 @@ void PhysicsSolverBase::solveLinearSystem( DofManager const & dofManager,
   LinearSolverParameters const & params = m_linearSolverParameters.get();
   matrix.setDofManager( &dofManager );
 
-  if( params.solverType == LinearSolverParameters::SolverType::direct || !m_precond )
+  // Communication-avoiding Krylov methods, single precision preconditioners and the block ILU(k)
+  // are only implemented natively, not by the external solver packages
+  bool const nativeKrylovOnly = params.solverType == LinearSolverParameters::SolverType::pipelinedCg ||
+                                params.solverType == LinearSolverParameters::SolverType::sstepGmres ||
+                                params.preconditionerPrecision == LinearSolverParameters::Precision::fp32 ||
+                                params.preconditionerType == LinearSolverParameters::PreconditionerType::blockIlu;
+
+  if( params.solverType == LinearSolverParameters::SolverType::direct || ( !m_precond && !nativeKrylovOnly ) )
   {
-    std::unique_ptr< LinearSolverBase< LAInterface > > solver = LAInterface::createSolver( params );
+    bool reusePrecond = m_precondReuse.canReuse( params.reuse );
+    if( !m_linearSolver || !isLinearSolverReusable( m_linearSolver->parameters(), params ) )
+    {
+      m_linearSolver = LAInterface::createSolver( params );
+      reusePrecond = false;
+    }
+    else
+    {
+      // the tolerance may have been changed by the adaptive (Eisenstat-Walker) scheme
+      m_linearSolver->setKrylovRelTolerance( params.krylov.relTolerance );
+    }
+    reusePrecond = reusePrecond && m_linearSolver->supportsPreconditionerReuse();
+
+    m_linearSolver->setPreconditionerReuse( reusePrecond );
     {
       Timer timer_setup( m_timers["linear solver setup"] );
-      solver->setup( matrix );
+      m_linearSolver->setup( matrix );
     }
     {
       Timer timer_setup( m_timers["linear solver solve"] );
-      solver->solve( rhs, solution );
+      m_linearSolver->solve( rhs, solution );
+    }
+    m_linearSolverResult = m_linearSolver->result();
+
+    if( reusePrecond && !m_linearSolverResult.success() )
+    {
+      // The reused preconditioner is too far off, recompute it and solve again
+      GEOS_LOG_LEVEL_INFO_RANK_0( logInfo::LinearSolver,
+                                  GEOS_FMT( "        Linear solve with reused preconditioner failed after {} iterations, recomputing the preconditioner",
+                                            m_linearSolverResult.numIterations ) );
+      LinearSolverResult const failedResult = m_linearSolverResult;
+      reusePrecond = false;
+      solution.zero();
+      m_linearSolver->setPreconditionerReuse( false );
+      {
+        Timer timer_setup( m_timers["linear solver setup"] );
+        m_linearSolver->setup( matrix );
+      }
+      {
+        Timer timer_setup( m_timers["linear solver solve"] );
+        m_linearSolver->solve( rhs, solution );
+      }
+      m_linearSolverResult = m_linearSolver->result();
+      m_linearSolverResult.numIterations += failedResult.numIterations;
+      m_linearSolverResult.setupTime += failedResult.setupTime;
+      m_linearSolverResult.solveTime += failedResult.solveTime;
+    }
+
+    if( m_precondReuse.recordSolve( params.reuse, reusePrecond, m_linearSolverResult.numIterations ) )
+    {
+      // Convergence degraded too much since the last setup, recompute the preconditioner at the next solve
+      GEOS_LOG_LEVEL_INFO_RANK_0( logInfo::LinearSolver,
+                                  GEOS_FMT( "        Krylov iterations increased from {} to {}, the preconditioner will be recomputed",
+                                            m_precondReuse.numIterationsAfterSetup(), m_linearSolverResult.numIterations ) );
     }
-    m_linearSolverResult = solver->result();
   }
   else
   {
+    // Without a solver-specific preconditioner, use the one requested in the linear solver parameters
+    bool reusePrecond = m_precondReuse.canReuse( params.reuse );
+    if( !m_precond && ( !m_defaultPrecond || !isLinearSolverReusable( m_defaultPrecondParams, params ) ) )
+    {
+      m_defaultPrecond = LAInterface::createPreconditioner( params );
+      m_defaultPrecondParams = params;
+      reusePrecond = false;
+    }
+    PreconditionerBase< LAInterface > & precond = m_precond ? *m_precond : *m_defaultPrecond;
     {
       Timer timer_setup( m_timers["linear solver setup"] );
-      m_precond->setup( matrix );
+      if( reusePrecond )
+      {
+        precond.reuse( matrix );
+      }
+      else
+      {
+        precond.setup( matrix );
+      }
     }
-    std::unique_ptr< KrylovSolver< ParallelVector > > solver = KrylovSolver< ParallelVector >::create( params, matrix, *m_precond );
+    std::unique_ptr< KrylovSolver< ParallelVector > > solver = KrylovSolver< ParallelVector >::create( params, matrix, precond );
     {
       Timer timer_setup( m_timers["linear solver solve"] );
       solver->solve( rhs, solution );
     }
     m_linearSolverResult = solver->result();
+
+    if( reusePrecond && !m_linearSolverResult.success() )
+    {
+      // The reused preconditioner is too far off, recompute it and solve again
+      GEOS_LOG_LEVEL_INFO_RANK_0( logInfo::LinearSolver,
+                                  GEOS_FMT( "        Linear solve with reused preconditioner failed after {} iterations, recomputing the preconditioner",
+                                            m_linearSolverResult.numIterations ) );
+      LinearSolverResult const failedResult = m_linearSolverResult;
+      reusePrecond = false;
+      solution.zero();
+      {
+        Timer timer_setup( m_timers["linear solver setup"] );
+        precond.setup( matrix );
+      }
+      {
+        Timer timer_setup( m_timers["linear solver solve"] );
+        solver->solve( rhs, solution );
+      }
+      m_linearSolverResult = solver->result();
+      m_linearSolverResult.numIterations += failedResult.numIterations;
+      m_linearSolverResult.setupTime += failedResult.setupTime;
+      m_linearSolverResult.solveTime += failedResult.solveTime;
+    }
+
+    if( m_precondReuse.recordSolve( params.reuse, reusePrecond, m_linearSolverResult.numIterations ) )
+    {
+      // Convergence degraded too much since the last setup, recompute the preconditioner at the next solve
+      GEOS_LOG_LEVEL_INFO_RANK_0( logInfo::LinearSolver,
+                                  GEOS_FMT( "        Krylov iterations increased from {} to {}, the preconditioner will be recomputed",
+                                            m_precondReuse.numIterationsAfterSetup(), m_linearSolverResult.numIterations ) );
+    }
   }
 
   GEOS_LOG_LEVEL_INFO_RANK_0( logInfo::LinearSolver, GEOS_FMT( "        Last LinSolve(iter,res) = ( {:3}, {:4.2e} )",
@@ -1431,6 +2044,16 @@ bool PhysicsSolverBase::checkSequentialSolutionIncrements( DomainPartition & GEO
   return true;
 }
 
+void PhysicsSolverBase::saveNonlinearIterationState( DomainPartition & GEOS_UNUSED_PARAM( domain ) )
+{
+  GEOS_ERROR( getDataContext() << ": the local Newton nonlinear preconditioner is not supported by this solver" );
+}
+
+void PhysicsSolverBase::restoreNonlinearIterationState( DomainPartition & GEOS_UNUSED_PARAM( domain ) )
+{
+  GEOS_ERROR( getDataContext() << ": the local Newton nonlinear preconditioner is not supported by this solver" );
+}
+
 void PhysicsSolverBase::saveSequentialIterationState( DomainPartition & GEOS_UNUSED_PARAM( domain ) )
 {
   // up to specific solver to save what is needed
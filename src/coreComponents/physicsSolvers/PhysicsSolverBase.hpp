@@ -21,10 +21,12 @@
 #define GEOS_PHYSICSSOLVERS_PHYSICSSOLVERBASE_HPP_
 
 #include "codingUtilities/traits.hpp"
+#include "common/AssemblyMap.hpp"
 #include "common/DataTypes.hpp"
 #include "dataRepository/ExecutableGroup.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
 #include "linearAlgebra/utilities/LinearSolverResult.hpp"
+#include "linearAlgebra/utilities/PreconditionerReuseTracker.hpp"
 #include "linearAlgebra/DofManager.hpp"
 #include "mesh/MeshBody.hpp"
 #include "physicsSolvers/NonlinearSolverParameters.hpp"
@@ -32,6 +34,8 @@
 #include "physicsSolvers/SolverStatistics.hpp"
 #include "physicsSolvers/LogLevelsInfo.hpp"
 
+#include <array>
+#include <functional>
 #include <limits>
 
 namespace geos
@@ -191,6 +195,19 @@ public:
    */
   CRSMatrixView< real64 const, globalIndex const > getLocalMatrix() const { return m_localMatrix.toViewConst(); }
 
+  /**
+   * @brief Getter for the preconditioner reuse tracker
+   * @return the tracker deciding when the preconditioner of the global system is recomputed
+   */
+  PreconditionerReuseTracker const & getPreconditionerReuseTracker() const { return m_precondReuse; }
+
+  /**
+   * @brief Getter for the assembly maps of the assembly kernels
+   * @return the maps indexed by the name of the kernel and of the items it assembles,
+   *         or nullptr if the assembly maps are disabled
+   */
+  std::map< string, AssemblyMap > * getAssemblyMaps() const { return m_useAssemblyMaps ? &m_assemblyMaps : nullptr; }
+
   /**
    * @defgroup Solver Interface Functions
    *
@@ -230,6 +247,16 @@ public:
    */
   virtual real64 setNextDtBasedOnNewtonIter( real64 const & currentDt );
 
+  /**
+   * @brief function to set the next time step size with the PID control of the truncation error
+   * @param[in] currentDt the current time step size
+   * @return the prescribed time step size
+   *
+   * The truncation error estimates of the last accepted time steps are computed by estimateTruncationError().
+   * Without estimate (e.g., at the first time step), the time step size is based on Newton convergence.
+   */
+  virtual real64 setNextDtBasedOnTruncationError( real64 const & currentDt );
+
   /**
    * @brief function to set the next dt based on state change
    * @param [in]  currentDt the current time step size
@@ -341,6 +368,72 @@ public:
                                          real64 & lastResidual,
                                          real64 & residualNormT );
 
+  /**
+   * @brief Function to perform the local Newton iterations of the nonlinear preconditioner.
+   * @param time_n time at the beginning of the step
+   * @param dt the prescribed timestep
+   * @param domain the domain object
+   * @param residualNorm (in) residual norm of the assembled system, (out) residual norm after the local iterations
+   *
+   * Before the global Newton update, a few Newton iterations are performed on local subproblems: the rows
+   * flagged by flagLocalNewtonRows() on each rank, with the other rows and the couplings to other ranks frozen
+   * (additive Schwarz nonlinear preconditioning, without overlap). The restricted systems are solved with GMRES
+   * and a rank-local block ILU preconditioner. An iteration that increases the global residual norm is rejected,
+   * the saved iterate is restored, and the local iterations end. On exit, the system is assembled at the new state.
+   */
+  void localNewtonIterations( real64 const & time_n,
+                              real64 const & dt,
+                              DomainPartition & domain,
+                              real64 & residualNorm );
+
+  /**
+   * @brief Flag the local rows of the subproblems solved by the local Newton iterations.
+   * @param domain the domain object
+   * @param dofManager degree-of-freedom manager associated with the linear system
+   * @param localRhs the system right-hand side vector
+   * @param threshold fraction of the largest residual on the rank above which a row is flagged
+   * @param isFlagged the flag of each local row (output)
+   *
+   * By default, the rows whose absolute residual is larger than @p threshold times the largest absolute
+   * residual on the rank are flagged. Solvers with several equations per mesh object should override this
+   * function to normalize each equation and flag all the rows of a mesh object together.
+   */
+  virtual void flagLocalNewtonRows( DomainPartition const & domain,
+                                    DofManager const & dofManager,
+                                    arrayView1d< real64 const > const & localRhs,
+                                    real64 const threshold,
+                                    arrayView1d< integer > const & isFlagged ) const;
+
+  /**
+   * @brief Start the bookkeeping of the update of the primary variables, and apply the time-step predictor.
+   * @param dt the prescribed timestep
+   * @param domain the domain object
+   *
+   * With the PID time-step controller, the primary variables are extrapolated linearly from the update
+   * of the last accepted time step, which provides the initial guess of the Newton loop. The predicted
+   * update is scaled and checked like a Newton update, and skipped if the check fails.
+   */
+  void applyTimeStepPredictor( real64 const & dt,
+                               DomainPartition & domain );
+
+  /**
+   * @brief Record an update of the primary variables applied during the current time step.
+   * @param localSolution the update (in the degree-of-freedom space)
+   * @param scalingFactor the factor applied to @p localSolution
+   */
+  void recordSolutionUpdate( arrayView1d< real64 const > const & localSolution,
+                             real64 const scalingFactor );
+
+  /**
+   * @brief Estimate the truncation error of an accepted time step, and store its update for the next predictor.
+   * @param dt the size of the accepted time step
+   *
+   * The error estimate is the difference between the converged and the predicted update of the primary
+   * variables, relative to the converged update. The largest value over the components of the
+   * degrees of freedom is retained.
+   */
+  void estimateTruncationError( real64 const & dt );
+
   /**
    * @brief Function for a linear implicit integration step
    * @param time_n time at the beginning of the step
@@ -499,6 +592,27 @@ public:
                          DofManager const & dofManager,
                          arrayView1d< real64 const > const & localRhs );
 
+  /**
+   * @brief calculate the rank-local part of the norm of the global system residual
+   * @param time the time at the beginning of the step
+   * @param dt the desired timestep
+   * @param domain the domain partition
+   * @param dofManager degree-of-freedom manager associated with the linear system
+   * @param localRhs the system right-hand side vector
+   * @param reduction the fused reduction in which the rank-local values are registered
+   * @return a function returning the norm of the residual, to be called once @p reduction is reduced
+   *
+   * This function allows several solvers (e.g., the subsolvers of a coupled solver) to share a single
+   * reduction across MPI ranks. By default, the norm is reduced separately by calculateResidualNorm.
+   */
+  virtual std::function< real64() >
+  calculateLocalResidualNorm( real64 const & time,
+                              real64 const & dt,
+                              DomainPartition const & domain,
+                              DofManager const & dofManager,
+                              arrayView1d< real64 const > const & localRhs,
+                              physicsSolverBaseKernels::ResidualNormReduction & reduction );
+
   /**
    * @brief function to apply a linear system solver to the assembled system.
    * @param dofManager degree-of-freedom manager associated with the linear system
@@ -518,6 +632,29 @@ public:
                      ParallelVector & rhs,
                      ParallelVector & solution );
 
+  /**
+   * @brief Compose the parallel system matrix out of the local system matrix.
+   *
+   * The parallel matrix is fully re-created only when the sparsity pattern of the local matrix
+   * has been modified (by setupSystem) since the last call. Otherwise, only the values are
+   * copied into the existing parallel matrix, which avoids rebuilding the row/column maps
+   * and the communication pattern at every nonlinear iteration.
+   */
+  void composeParallelMatrix();
+
+  /**
+   * @brief Flag the preconditioner for recomputation at the next linear solve according to the reuse policy.
+   * @param time_n the time at the beginning of the step
+   * @param dt the size of the time step
+   * @param newtonIter the current Newton iteration
+   *
+   * Independently of the policy, the preconditioner is also recomputed when the convergence of the
+   * Krylov method degrades (see LinearSolverParameters::Reuse), which is detected in solveLinearSystem.
+   */
+  void updatePreconditionerReuse( real64 const & time_n,
+                                  real64 const & dt,
+                                  integer const newtonIter );
+
   /**
    * @brief Function to check system solution for physical consistency and constraint violation
    * @param domain the domain partition
@@ -704,6 +841,9 @@ public:
 
     /// @return string for the writeLinearSystem wrapper
     static constexpr char const * writeLinearSystemString() { return "writeLinearSystem"; }
+
+    /// @return string for the useAssemblyMaps wrapper
+    static constexpr char const * useAssemblyMapsString() { return "useAssemblyMaps"; }
   };
 
   /**
@@ -763,6 +903,23 @@ public:
    */
   virtual void saveSequentialIterationState( DomainPartition & domain );
 
+  /**
+   * @brief Save the primary variables of the current nonlinear iterate
+   * @param domain the domain partition
+   *
+   * The saved values, including the ghost values, are copied back by restoreNonlinearIterationState()
+   * when an update of the local Newton iterations is rejected.
+   */
+  virtual void saveNonlinearIterationState( DomainPartition & domain );
+
+  /**
+   * @brief Restore the primary variables saved by saveNonlinearIterationState()
+   * @param domain the domain partition
+   *
+   * The secondary variables are not restored, updateState() must be called afterwards.
+   */
+  virtual void restoreNonlinearIterationState( DomainPartition & domain );
+
   /**
    * @brief accessor for the linear solver parameters.
    * @return the linear solver parameter list
@@ -942,6 +1099,14 @@ protected:
                           real64 const oldNewtonNorm,
                           LinearSolverParameters::Krylov const & krylovParams );
 
+  /**
+   * @brief Register the useAssemblyMaps input flag.
+   *
+   * To be called in the constructor of the solvers whose assembly kernels use the assembly maps
+   * (see getAssemblyMaps()). The flag is not an input of the other solvers, and remains off.
+   */
+  void registerUseAssemblyMapsWrapper();
+
   /**
    * @brief Get the Constitutive Name object
    *
@@ -1015,6 +1180,27 @@ protected:
   /// Number of cycles since last timestep cut
   integer m_numTimestepsSinceLastDtCut;
 
+  /// Update of the primary variables (in the degree-of-freedom space) since the beginning of the current time step
+  array1d< real64 > m_stepIncrement;
+
+  /// Update of the primary variables applied by the predictor at the beginning of the current time step
+  array1d< real64 > m_predictedIncrement;
+
+  /// Update of the primary variables over the last accepted time step
+  array1d< real64 > m_lastStepIncrement;
+
+  /// Size of the last accepted time step (zero if its update cannot be used by the predictor)
+  real64 m_lastStepDt;
+
+  /// Flag indicating whether the predictor was applied at the beginning of the current time step
+  bool m_isPredictorApplied;
+
+  /// Truncation error estimates of the last accepted time steps, relative to the tolerance (the most recent first)
+  std::array< real64, 3 > m_truncationErrors;
+
+  /// Number of valid entries in m_truncationErrors
+  integer m_numTruncationErrors;
+
   /// name of the FV discretization object in the data repository
   string m_discretizationName;
 
@@ -1036,15 +1222,36 @@ protected:
   /// Custom preconditioner for the "native" iterative solver
   std::unique_ptr< PreconditionerBase< LAInterface > > m_precond;
 
+  /// Linear solver kept alive across nonlinear iterations (rebuilt when pattern or parameters change)
+  std::unique_ptr< LinearSolverBase< LAInterface > > m_linearSolver;
+
+  /// Preconditioner of the native iterative solver when no custom one is provided (rebuilt when pattern or parameters change)
+  std::unique_ptr< PreconditionerBase< LAInterface > > m_defaultPrecond;
+
+  /// Parameters the default preconditioner of the native iterative solver was created with
+  LinearSolverParameters m_defaultPrecondParams;
+
+  /// Flag indicating that the sparsity pattern of the local matrix changed since the parallel matrix was created
+  bool m_isSparsityPatternModified;
+
   /// flag for debug output of matrix, rhs, and solution
   integer m_writeLinearSystem;
 
+  /// Flag to cache the positions of the local contributions in the matrix between assemblies
+  integer m_useAssemblyMaps;
+
+  /// Assembly maps of the assembly kernels (a cache filled during the assembly, hence mutable)
+  mutable std::map< string, AssemblyMap > m_assemblyMaps;
+
   /// Linear solver parameters
   LinearSolverParametersInput m_linearSolverParameters;
 
   /// Result of the last linear solve
   LinearSolverResult m_linearSolverResult;
 
+  /// Decides when the preconditioner must be recomputed according to the reuse policy
+  PreconditionerReuseTracker m_precondReuse;
+
   /// Nonlinear solver parameters
   NonlinearSolverParameters m_nonlinearSolverParameters;
 
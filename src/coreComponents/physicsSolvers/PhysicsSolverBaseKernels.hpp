@@ -300,28 +300,38 @@ public:
                                  real64 const & localResidualNormalizer,
                                  real64 & globalResidualNorm )
   {
-    globalResidualNorm = sqrt( MpiWrapper::sum( localResidualNorm ) ) / sqrt( MpiWrapper::sum( localResidualNormalizer ) );
+    // norm and normalizer are reduced together
+    real64 const localSums[2] = { localResidualNorm, localResidualNormalizer };
+    real64 globalSums[2]{};
+    MpiWrapper::allReduce( localSums,
+                           globalSums,
+                           2,
+                           MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ),
+                           MPI_COMM_GEOS );
+    globalResidualNorm = sqrt( globalSums[0] ) / sqrt( globalSums[1] );
   }
 
   static void computeGlobalNorm( array1d< real64 > const & localResidualNorm,
                                  array1d< real64 > const & localResidualNormalizer,
                                  array1d< real64 > & globalResidualNorm )
   {
-    array1d< real64 > sumLocalResidualNorm( localResidualNorm.size() );
-    array1d< real64 > sumLocalResidualNormalizer( localResidualNormalizer.size() );
-    MpiWrapper::allReduce( localResidualNorm.data(),
-                           sumLocalResidualNorm.data(),
-                           localResidualNorm.size(),
-                           MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ),
-                           MPI_COMM_GEOS );
-    MpiWrapper::allReduce( localResidualNormalizer.data(),
-                           sumLocalResidualNormalizer.data(),
-                           localResidualNormalizer.size(),
+    // norms and normalizers are reduced together
+    integer const numNorm = LvArray::integerConversion< integer >( localResidualNorm.size() );
+    array1d< real64 > localSums( 2 * numNorm );
+    array1d< real64 > globalSums( 2 * numNorm );
+    for( integer i = 0; i < numNorm; ++i )
+    {
+      localSums[i] = localResidualNorm[i];
+      localSums[numNorm + i] = localResidualNormalizer[i];
+    }
+    MpiWrapper::allReduce( localSums.data(),
+                           globalSums.data(),
+                           2 * numNorm,
                            MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ),
                            MPI_COMM_GEOS );
-    for( integer i = 0; i < localResidualNorm.size(); ++i )
+    for( integer i = 0; i < numNorm; ++i )
     {
-      globalResidualNorm[i] = sqrt( sumLocalResidualNorm[i] ) / sqrt( sumLocalResidualNormalizer[i] );
+      globalResidualNorm[i] = sqrt( globalSums[i] ) / sqrt( globalSums[numNorm + i] );
     }
   }
 
@@ -341,6 +351,146 @@ ENUM_STRINGS( NormType,
               "Linfinity",
               "L2" );
 
+/**
+ * @class ResidualNormReduction
+ * @brief Fused reduction across MPI ranks of the rank-local residual norms of one or several solvers
+ *
+ * The rank-local values are registered first (maximum for Linf norms, sums for L2 norms and normalizers),
+ * then reduced with at most one collective per reduction operation, whatever the number of equations and
+ * solvers. The global values are retrieved with the indices returned at registration.
+ */
+class ResidualNormReduction
+{
+public:
+
+  /**
+   * @brief Register a rank-local value reduced with a maximum
+   * @param localValue the rank-local value
+   * @return the index of the value
+   */
+  integer addMax( real64 const localValue )
+  {
+    GEOS_ASSERT( !m_isReduced );
+    m_localMax.emplace_back( localValue );
+    return LvArray::integerConversion< integer >( m_localMax.size() ) - 1;
+  }
+
+  /**
+   * @brief Register a rank-local value reduced with a sum
+   * @param localValue the rank-local value
+   * @return the index of the value
+   */
+  integer addSum( real64 const localValue )
+  {
+    GEOS_ASSERT( !m_isReduced );
+    m_localSum.emplace_back( localValue );
+    return LvArray::integerConversion< integer >( m_localSum.size() ) - 1;
+  }
+
+  /**
+   * @brief Register the rank-local residual norm of an equation
+   * @param normType the type of norm
+   * @param localResidualNorm the rank-local norm (Linf), or the rank-local sum of squared residuals (L2)
+   * @param localResidualNormalizer the rank-local sum of squared normalizers (L2 only)
+   * @return the index of the norm
+   */
+  integer addNorm( NormType const normType,
+                   real64 const localResidualNorm,
+                   real64 const localResidualNormalizer = 0.0 )
+  {
+    if( normType == NormType::Linf )
+    {
+      m_normIndex.emplace_back( addMax( localResidualNorm ) );
+      m_normalizerIndex.emplace_back( -1 );
+    }
+    else
+    {
+      m_normIndex.emplace_back( addSum( localResidualNorm ) );
+      m_normalizerIndex.emplace_back( addSum( localResidualNormalizer ) );
+    }
+    return LvArray::integerConversion< integer >( m_normIndex.size() ) - 1;
+  }
+
+  /**
+   * @brief Reduce the registered values across the MPI ranks
+   */
+  void reduce()
+  {
+    m_globalMax.resize( m_localMax.size() );
+    m_globalSum.resize( m_localSum.size() );
+    if( !m_localMax.empty() )
+    {
+      MpiWrapper::allReduce( m_localMax.data(),
+                             m_globalMax.data(),
+                             LvArray::integerConversion< int >( m_localMax.size() ),
+                             MpiWrapper::getMpiOp( MpiWrapper::Reduction::Max ),
+                             MPI_COMM_GEOS );
+    }
+    if( !m_localSum.empty() )
+    {
+      MpiWrapper::allReduce( m_localSum.data(),
+                             m_globalSum.data(),
+                             LvArray::integerConversion< int >( m_localSum.size() ),
+                             MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ),
+                             MPI_COMM_GEOS );
+    }
+    m_isReduced = true;
+  }
+
+  /**
+   * @param index the index returned by addMax
+   * @return the maximum of the value across the MPI ranks
+   */
+  real64 globalMax( integer const index ) const
+  {
+    GEOS_ASSERT( m_isReduced );
+    return m_globalMax[index];
+  }
+
+  /**
+   * @param index the index returned by addSum
+   * @return the sum of the value across the MPI ranks
+   */
+  real64 globalSum( integer const index ) const
+  {
+    GEOS_ASSERT( m_isReduced );
+    return m_globalSum[index];
+  }
+
+  /**
+   * @param index the index returned by addNorm
+   * @return the global residual norm of the equation
+   */
+  real64 globalNorm( integer const index ) const
+  {
+    return m_normalizerIndex[index] < 0
+         ? globalMax( m_normIndex[index] )
+         : sqrt( globalSum( m_normIndex[index] ) ) / sqrt( globalSum( m_normalizerIndex[index] ) );
+  }
+
+private:
+
+  /// Index of the (rank-local) value of each norm registered with addNorm
+  array1d< integer > m_normIndex;
+
+  /// Index of the (rank-local) normalizer of each norm registered with addNorm (-1 for Linf norms)
+  array1d< integer > m_normalizerIndex;
+
+  /// Rank-local values reduced with a maximum
+  array1d< real64 > m_localMax;
+
+  /// Rank-local values reduced with a sum
+  array1d< real64 > m_localSum;
+
+  /// Global values reduced with a maximum
+  array1d< real64 > m_globalMax;
+
+  /// Global values reduced with a sum
+  array1d< real64 > m_globalSum;
+
+  /// Flag indicating whether the registered values have been reduced
+  bool m_isReduced = false;
+};
 
 } // namespace physicsSolverBaseKernels
 
@@ -28,6 +28,7 @@ SolverStatistics::SolverStatistics( string const & name, Group * const parent )
   : Group( name, parent ),
   m_currentNumOuterLoopIterations( 0 ),
   m_currentNumNonlinearIterations( 0 ),
+  m_currentNumLocalNewtonIterations( 0 ),
   m_currentNumLinearIterations( 0 )
 {
   registerWrapper( viewKeyStruct::numTimeStepsString(), &m_numTimeSteps ).
@@ -38,6 +39,14 @@ SolverStatistics::SolverStatistics( string const & name, Group * const parent )
     setApplyDefaultValue( 0 ).
     setDescription( "Number of time step cuts" );
 
+  registerWrapper( viewKeyStruct::numNonConvergedTimeStepsString(), &m_numNonConvergedTimeSteps ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Number of time steps accepted without nonlinear convergence" );
+
+  registerWrapper( viewKeyStruct::numTimeStepsAboveErrorToleranceString(), &m_numTimeStepsAboveErrorTolerance ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Number of time steps whose truncation error estimate exceeded the tolerance" );
+
   registerWrapper( viewKeyStruct::numSuccessfulOuterLoopIterationsString(), &m_numSuccessfulOuterLoopIterations ).
     setApplyDefaultValue( 0 ).
     setDescription( "Cumulative number of successful outer loop iterations" );
@@ -46,6 +55,10 @@ SolverStatistics::SolverStatistics( string const & name, Group * const parent )
     setApplyDefaultValue( 0 ).
     setDescription( "Cumulative number of successful nonlinear iterations" );
 
+  registerWrapper( viewKeyStruct::numSuccessfulLocalNewtonIterationsString(), &m_numSuccessfulLocalNewtonIterations ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Cumulative number of successful local Newton iterations of the nonlinear preconditioner" );
+
   registerWrapper( viewKeyStruct::numSuccessfulLinearIterationsString(), &m_numSuccessfulLinearIterations ).
     setApplyDefaultValue( 0 ).
     setDescription( "Cumulative number of successful linear iterations" );
@@ -59,9 +72,17 @@ SolverStatistics::SolverStatistics( string const & name, Group * const parent )
     setApplyDefaultValue( 0 ).
     setDescription( "Cumulative number of discarded nonlinear iterations" );
 
+  registerWrapper( viewKeyStruct::numDiscardedLocalNewtonIterationsString(), &m_numDiscardedLocalNewtonIterations ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Cumulative number of discarded local Newton iterations of the nonlinear preconditioner" );
+
   registerWrapper( viewKeyStruct::numDiscardedLinearIterationsString(), &m_numDiscardedLinearIterations ).
     setApplyDefaultValue( 0 ).
     setDescription( "Cumulative number of discarded linear iterations" );
+
+  registerWrapper( viewKeyStruct::numLinearIterationsSavedString(), &m_numLinearIterationsSaved ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Cumulative (estimated) number of linear iterations saved by the inexact Newton method" );
 }
 
 void SolverStatistics::initializeTimeStepStatistics()
@@ -69,6 +90,7 @@ void SolverStatistics::initializeTimeStepStatistics()
   // the time step begins, we reset the individual-timestep counters
   m_currentNumOuterLoopIterations = 0;
   m_currentNumNonlinearIterations = 0;
+  m_currentNumLocalNewtonIterations = 0;
   m_currentNumLinearIterations = 0;
 }
 
@@ -85,6 +107,19 @@ void SolverStatistics::logNonlinearIteration()
   m_currentNumNonlinearIterations++;
 }
 
+void SolverStatistics::logLocalNewtonIteration( integer const numLinearIterations )
+{
+  // we have just performed a local Newton iteration, its linear solve is part of the work of the time step
+  m_currentNumLocalNewtonIterations++;
+  m_currentNumLinearIterations += numLinearIterations;
+}
+
+void SolverStatistics::logLinearIterationsSaved( integer const numLinearIterationsSaved )
+{
+  // the iterations saved are counted for all the time steps, including the discarded ones
+  m_numLinearIterationsSaved += numLinearIterationsSaved;
+}
+
 void SolverStatistics::logOuterLoopIteration()
 {
   // we have just performed an outer loop iteration, so we increment the individual-timestep counter for outer loop iterations
@@ -97,6 +132,7 @@ void SolverStatistics::logTimeStepCut()
   // we have just cut the time step, so we increment the cumulative counters for discarded timesteps
   m_numDiscardedOuterLoopIterations += m_currentNumOuterLoopIterations;
   m_numDiscardedNonlinearIterations += m_currentNumNonlinearIterations;
+  m_numDiscardedLocalNewtonIterations += m_currentNumLocalNewtonIterations;
   m_numDiscardedLinearIterations += m_currentNumLinearIterations;
   m_numTimeStepCuts++;
 
@@ -104,11 +140,24 @@ void SolverStatistics::logTimeStepCut()
   initializeTimeStepStatistics();
 }
 
+void SolverStatistics::logNonConvergedTimeStep()
+{
+  // the time step is accepted, but its solution may be inaccurate
+  m_numNonConvergedTimeSteps++;
+}
+
+void SolverStatistics::logTimeStepAboveErrorTolerance()
+{
+  // the time step is accepted, but the next one will be smaller to bring the error back to the tolerance
+  m_numTimeStepsAboveErrorTolerance++;
+}
+
 void SolverStatistics::saveTimeStepStatistics()
 {
   // the timestep has converged, so we increment the cumulative counters for successful timesteps
   m_numSuccessfulOuterLoopIterations += m_currentNumOuterLoopIterations;
   m_numSuccessfulNonlinearIterations += m_currentNumNonlinearIterations;
+  m_numSuccessfulLocalNewtonIterations += m_currentNumLocalNewtonIterations;
   m_numSuccessfulLinearIterations += m_currentNumLinearIterations;
   m_numTimeSteps++;
 }
@@ -118,6 +167,7 @@ void SolverStatistics::outputStatistics() const
   bool const printOuterLoopIterations = !(m_numSuccessfulOuterLoopIterations == 0 && m_numDiscardedOuterLoopIterations == 0);
   bool const printIterations = !(m_numSuccessfulNonlinearIterations == 0 && m_numDiscardedNonlinearIterations == 0);
   bool const printLinearIterations = !(m_numSuccessfulLinearIterations == 0 && m_numDiscardedLinearIterations == 0);
+  bool const printLocalNewtonIterations = !(m_numSuccessfulLocalNewtonIterations == 0 && m_numDiscardedLocalNewtonIterations == 0);
 
   auto const logStat = [&]( auto const name, auto const value )
   {
@@ -139,21 +189,41 @@ void SolverStatistics::outputStatistics() const
       logStat( "successful outer loop iterations", m_numSuccessfulOuterLoopIterations );
     }
     logStat( "successful nonlinear iterations", m_numSuccessfulNonlinearIterations );
+    if( printLocalNewtonIterations )
+    {
+      logStat( "successful local Newton iterations", m_numSuccessfulLocalNewtonIterations );
+    }
     if( printLinearIterations ) // don't print for the outer iterations in sequential schemes
     {
       logStat( "successful linear iterations", m_numSuccessfulLinearIterations );
     }
 
     logStat( "time step cuts", m_numTimeStepCuts );
+    if( m_numNonConvergedTimeSteps > 0 )
+    {
+      logStat( "non-converged time steps", m_numNonConvergedTimeSteps );
+    }
+    if( m_numTimeStepsAboveErrorTolerance > 0 )
+    {
+      logStat( "time steps above the truncation error tolerance", m_numTimeStepsAboveErrorTolerance );
+    }
     if( printOuterLoopIterations )
     {
       logStat( "discarded outer loop iterations", m_numDiscardedOuterLoopIterations );
     }
     logStat( "discarded nonlinear iterations", m_numDiscardedNonlinearIterations );
+    if( printLocalNewtonIterations )
+    {
+      logStat( "discarded local Newton iterations", m_numDiscardedLocalNewtonIterations );
+    }
     if( printLinearIterations ) // don't print for the outer iterations in sequential schemes
     {
       logStat( "discarded linear iterations", m_numDiscardedLinearIterations );
     }
+    if( m_numLinearIterationsSaved != 0 )
+    {
+      logStat( "linear iterations saved by inexact Newton (estimate)", m_numLinearIterationsSaved );
+    }
   }
 }
 } // namespace geos
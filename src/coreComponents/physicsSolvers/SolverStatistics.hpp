@@ -60,6 +60,19 @@ public:
    */
   void logNonlinearIteration();
 
+  /**
+   * @brief Tell the solverStatistics that we are doing a local Newton iteration of the nonlinear preconditioner
+   * @param[in] numLinearIterations the number of linear iterations done by the linear solver on the local subproblems
+   * @detail The local iterations are counted separately from the global Newton iterations, their linear iterations are not
+   */
+  void logLocalNewtonIteration( integer const numLinearIterations );
+
+  /**
+   * @brief Tell the solverStatistics how many linear iterations the inexact Newton method saved in a nonlinear iteration
+   * @param[in] numLinearIterationsSaved the estimated number of linear iterations saved (negative if more were done)
+   */
+  void logLinearIterationsSaved( integer const numLinearIterationsSaved );
+
   /**
    * @brief Tell the solverStatistics that we are doing an outer loop iteration
    */
@@ -70,6 +83,16 @@ public:
    */
   void logTimeStepCut();
 
+  /**
+   * @brief Tell the solverStatistics that a time step was accepted without nonlinear convergence
+   */
+  void logNonConvergedTimeStep();
+
+  /**
+   * @brief Tell the solverStatistics that the truncation error estimate of a time step exceeded its tolerance
+   */
+  void logTimeStepAboveErrorTolerance();
+
   /**
    * @brief Save the statistics for the individual time step and increment the cumulative stats
    */
@@ -92,6 +115,18 @@ public:
   integer getNumTimeStepCuts() const
   { return m_numTimeStepCuts; }
 
+  /**
+   * @return Number of time steps accepted without nonlinear convergence
+   */
+  integer getNumNonConvergedTimeSteps() const
+  { return m_numNonConvergedTimeSteps; }
+
+  /**
+   * @return Number of time steps whose truncation error estimate exceeded the tolerance
+   */
+  integer getNumTimeStepsAboveErrorTolerance() const
+  { return m_numTimeStepsAboveErrorTolerance; }
+
   /**
    * @return Cumulative number of successful outer loop iterations
    */
@@ -104,12 +139,24 @@ public:
   integer getNumSuccessfulNonlinearIterations() const
   { return m_numSuccessfulNonlinearIterations; }
 
+  /**
+   * @return Cumulative number of successful local Newton iterations of the nonlinear preconditioner
+   */
+  integer getNumSuccessfulLocalNewtonIterations() const
+  { return m_numSuccessfulLocalNewtonIterations; }
+
   /**
    * @return Cumulative number of successful linear iterations
    */
   integer getNumSuccessfulLinearIterations() const
   { return m_numSuccessfulLinearIterations; }
 
+  /**
+   * @return Cumulative (estimated) number of linear iterations saved by the inexact Newton method
+   */
+  integer getNumLinearIterationsSaved() const
+  { return m_numLinearIterationsSaved; }
+
   /**
    * @return Cumulative number of discarded outer loop iterations
    */
@@ -122,6 +169,12 @@ public:
   integer getNumDiscardedNonlinearIterations() const
   { return m_numDiscardedNonlinearIterations; }
 
+  /**
+   * @return Cumulative number of discarded local Newton iterations of the nonlinear preconditioner
+   */
+  integer getNumDiscardedLocalNewtonIterations() const
+  { return m_numDiscardedLocalNewtonIterations; }
+
   /**
    * @return Cumulative number of discarded linear iterations
    */
@@ -139,11 +192,17 @@ public:
     static constexpr char const * numTimeStepsString() { return "numTimeSteps"; }
     /// String key for the number of time step cuts
     static constexpr char const * numTimeStepCutsString() { return "numTimeStepCuts"; }
+    /// String key for the number of time steps accepted without nonlinear convergence
+    static constexpr char const * numNonConvergedTimeStepsString() { return "numNonConvergedTimeSteps"; }
+    /// String key for the number of time steps whose truncation error estimate exceeded the tolerance
+    static constexpr char const * numTimeStepsAboveErrorToleranceString() { return "numTimeStepsAboveErrorTolerance"; }
 
     /// String key for the successful number of outer loop iterations
     static constexpr char const * numSuccessfulOuterLoopIterationsString() { return "numSuccessfulOuterLoopIterations"; }
     /// String key for the successful number of nonlinear iterations
     static constexpr char const * numSuccessfulNonlinearIterationsString() { return "numSuccessfulNonlinearIterations"; }
+    /// String key for the successful number of local Newton iterations
+    static constexpr char const * numSuccessfulLocalNewtonIterationsString() { return "numSuccessfulLocalNewtonIterations"; }
     /// String key for the successful number of linear iterations
     static constexpr char const * numSuccessfulLinearIterationsString() { return "numSuccessfulLinearIterations"; }
 
@@ -151,8 +210,13 @@ public:
     static constexpr char const * numDiscardedOuterLoopIterationsString() { return "numDiscardedOuterLoopIterations"; }
     /// String key for the discarded number of nonlinear iterations
     static constexpr char const * numDiscardedNonlinearIterationsString() { return "numDiscardedNonlinearIterations"; }
+    /// String key for the discarded number of local Newton iterations
+    static constexpr char const * numDiscardedLocalNewtonIterationsString() { return "numDiscardedLocalNewtonIterations"; }
     /// String key for the discarded number of linear iterations
     static constexpr char const * numDiscardedLinearIterationsString() { return "numDiscardedLinearIterations"; }
+
+    /// String key for the number of linear iterations saved by the inexact Newton method
+    static constexpr char const * numLinearIterationsSavedString() { return "numLinearIterationsSaved"; }
   };
 
 private:
@@ -162,6 +226,12 @@ private:
   /// Number of time step cuts
   integer m_numTimeStepCuts;
 
+  /// Number of time steps accepted without nonlinear convergence
+  integer m_numNonConvergedTimeSteps;
+
+  /// Number of time steps whose truncation error estimate exceeded the tolerance
+  integer m_numTimeStepsAboveErrorTolerance;
+
 
   /// Number of outer loop iterations in the current time step (utility variable constantly overwritten)
   integer m_currentNumOuterLoopIterations;
@@ -169,6 +239,9 @@ private:
   /// Number of nonlinear iterations in the current time step (utility variable constantly overwritten)
   integer m_currentNumNonlinearIterations;
 
+  /// Number of local Newton iterations in the current time step (utility variable constantly overwritten)
+  integer m_currentNumLocalNewtonIterations;
+
   /// Number of linear iterations in the current time step (utility variable constantly overwritten)
   integer m_currentNumLinearIterations;
 
@@ -179,6 +252,9 @@ private:
   /// Cumulative number of successful nonlinear iterations
   integer m_numSuccessfulNonlinearIterations;
 
+  /// Cumulative number of successful local Newton iterations
+  integer m_numSuccessfulLocalNewtonIterations;
+
   /// Cumulative number of successful linear iterations
   integer m_numSuccessfulLinearIterations;
 
@@ -189,9 +265,16 @@ private:
   /// Cumulative number of discarded nonlinear iterations
   integer m_numDiscardedNonlinearIterations;
 
+  /// Cumulative number of discarded local Newton iterations
+  integer m_numDiscardedLocalNewtonIterations;
+
   /// Cumulative number of discarded linear iterations
   integer m_numDiscardedLinearIterations;
 
+
+  /// Cumulative (estimated) number of linear iterations saved by the inexact Newton method
+  integer m_numLinearIterationsSaved;
+
 };
 
 } //namespace geos
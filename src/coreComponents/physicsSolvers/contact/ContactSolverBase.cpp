@@ -216,6 +216,17 @@ real64 ContactSolverBase::explicitStep( real64 const & GEOS_UNUSED_PARAM( time_n
   return dt;
 }
 
+std::function< real64() >
+ContactSolverBase::calculateLocalResidualNorm( real64 const & time_n,
+                                               real64 const & dt,
+                                               DomainPartition const & domain,
+                                               DofManager const & dofManager,
+                                               arrayView1d< real64 const > const & localRhs,
+                                               physicsSolverBaseKernels::ResidualNormReduction & reduction )
+{
+  return PhysicsSolverBase::calculateLocalResidualNorm( time_n, dt, domain, dofManager, localRhs, reduction );
+}
+
 void ContactSolverBase::synchronizeFractureState( DomainPartition & domain ) const
 {
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
@@ -43,6 +43,20 @@ public:
                 integer const cycleNumber,
                 DomainPartition & domain ) override final;
 
+  /**
+   * @copydoc PhysicsSolverBase::calculateLocalResidualNorm
+   *
+   * The contact solvers complete the solid mechanics norm with the norms of the fracture equations
+   * in calculateResidualNorm, so the norm is evaluated eagerly here.
+   */
+  virtual std::function< real64() >
+  calculateLocalResidualNorm( real64 const & time_n,
+                              real64 const & dt,
+                              DomainPartition const & domain,
+                              DofManager const & dofManager,
+                              arrayView1d< real64 const > const & localRhs,
+                              physicsSolverBaseKernels::ResidualNormReduction & reduction ) override;
+
   string const & getUniqueFractureRegionName() const { return m_fractureRegionNames[0]; }
 
   void outputConfigurationStatistics( DomainPartition const & domain ) const override final;
@@ -204,6 +204,7 @@ void SolidMechanicsAugmentedLagrangianContact::setupSystem( DomainPartition & do
 
   // Finally, steal the pattern into a CRS matrix
   localMatrix.assimilate< parallelDevicePolicy<> >( std::move( pattern ) );
+  m_isSparsityPatternModified = true;
   localMatrix.setName( this->getName() + "/localMatrix" );
 
   rhs.setName( this->getName() + "/rhs" );
@@ -267,6 +267,7 @@ void SolidMechanicsEmbeddedFractures::setupSystem( DomainPartition & domain,
 
     // Finally, steal the pattern into a CRS matrix
     localMatrix.assimilate< parallelDevicePolicy<> >( std::move( pattern ) );
+    m_isSparsityPatternModified = true;
     localMatrix.setName( this->getName() + "/localMatrix" );
 
     rhs.setName( this->getName() + "/rhs" );
@@ -102,6 +102,7 @@ void SolidMechanicsPenaltyContact::setupSystem( DomainPartition & domain,
 
   sparsityPattern.compress();
   localMatrix.assimilate< parallelDevicePolicy<> >( std::move( sparsityPattern ) );
+  m_isSparsityPatternModified = true;
 }
 
 void SolidMechanicsPenaltyContact::assembleSystem( real64 const time,
@@ -41,6 +41,7 @@
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
 #include "physicsSolvers/fluidFlow/CompositionalMultiphaseBaseFields.hpp"
 #include "physicsSolvers/fluidFlow/FlowSolverBaseFields.hpp"
+#include "physicsSolvers/fluidFlow/LogLevelsInfo.hpp"
 #include "physicsSolvers/fluidFlow/SourceFluxStatistics.hpp"
 #include "physicsSolvers/fluidFlow/kernels/compositional/AccumulationKernel.hpp"
 #include "physicsSolvers/fluidFlow/kernels/compositional/ThermalAccumulationKernel.hpp"
@@ -78,7 +79,8 @@ CompositionalMultiphaseBase::CompositionalMultiphaseBase( const string & name,
   m_allowCompDensChopping( 1 ),
   m_useTotalMassEquation( 1 ),
   m_useSimpleAccumulation( 1 ),
-  m_minCompDens( isothermalCompositionalMultiphaseBaseKernels::minDensForDivision )
+  m_minCompDens( isothermalCompositionalMultiphaseBaseKernels::minDensForDivision ),
+  m_useBinnedFluidUpdate( 0 )
 {
 //START_SPHINX_INCLUDE_00
   this->registerWrapper( viewKeyStruct::inputTemperatureString(), &m_inputTemperature ).
@@ -181,6 +183,16 @@ CompositionalMultiphaseBase::CompositionalMultiphaseBase( const string & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setApplyDefaultValue( 0.01 ).
     setDescription( "Minimum value for solution scaling factor" );
+
+  this->registerWrapper( viewKeyStruct::useBinnedFluidUpdateString(), &m_useBinnedFluidUpdate ).
+    setSizedFromParent( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Flag indicating whether the fluid update groups the cells by their phase state and uses a dynamic schedule "
+                    "to balance the work between threads (host execution only)" );
+
+  addLogLevel< logInfo::FluidUpdate >();
+  addLogLevel< logInfo::PhaseEquilibrium >();
 }
 
 void CompositionalMultiphaseBase::postInputInitialization()
@@ -233,6 +245,14 @@ void CompositionalMultiphaseBase::postInputInitialization()
     GEOS_LOG_RANK_0( "'useSimpleAccumulation' is not yet implemented for thermal simulation. Switched to phase sum accumulation." );
     m_useSimpleAccumulation = 0;
   }
+
+#if defined( GEOS_USE_DEVICE )
+  if( m_useBinnedFluidUpdate == 1 ) // the binned fluid update runs on host
+  {
+    GEOS_LOG_RANK_0( "'useBinnedFluidUpdate' is not available for device execution. Switched to the default fluid update." );
+    m_useBinnedFluidUpdate = 0;
+  }
+#endif
 }
 
 void CompositionalMultiphaseBase::registerDataOnMesh( Group & meshBodies )
@@ -687,13 +707,59 @@ void CompositionalMultiphaseBase::updateFluidModel( ObjectManagerBase & dataGrou
     using ExecPolicy = typename FluidType::exec_policy;
     typename FluidType::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
 
-    thermalCompositionalMultiphaseBaseKernels::
-      FluidUpdateKernel::
-      launch< ExecPolicy >( dataGroup.size(),
-                            fluidWrapper,
-                            pres,
-                            temp,
-                            compFrac );
+    // fluids restricted to serial execution are not thread-safe and keep the default update
+    if( m_useBinnedFluidUpdate && !std::is_same< ExecPolicy, serialPolicy >::value )
+    {
+      integer const numBins = m_numPhases + 1;
+      array1d< localIndex > binSizes( numBins );
+      array1d< real64 > binTimes( numBins );
+
+      thermalCompositionalMultiphaseBaseKernels::
+        FluidUpdateKernel::
+        launchBinned( dataGroup.size(),
+                      m_numPhases,
+                      castedFluid.phaseFraction(),
+                      fluidWrapper,
+                      pres,
+                      temp,
+                      compFrac,
+                      binSizes.toView(),
+                      binTimes.toView() );
+
+      if( isLogLevelActive< logInfo::FluidUpdate >( getLogLevel() ) )
+      {
+        // report the total number of cells and the max/average time over ranks of each bin
+        array1d< localIndex > globalBinSizes( numBins );
+        array1d< real64 > maxBinTimes( numBins );
+        array1d< real64 > sumBinTimes( numBins );
+        MpiWrapper::allReduce( binSizes.data(), globalBinSizes.data(), numBins,
+                               MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ), MPI_COMM_GEOS );
+        MpiWrapper::allReduce( binTimes.data(), maxBinTimes.data(), numBins,
+                               MpiWrapper::getMpiOp( MpiWrapper::Reduction::Max ), MPI_COMM_GEOS );
+        MpiWrapper::allReduce( binTimes.data(), sumBinTimes.data(), numBins,
+                               MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ), MPI_COMM_GEOS );
+
+        integer const numRanks = MpiWrapper::commSize( MPI_COMM_GEOS );
+        std::ostringstream binInfo;
+        for( integer b = 0; b < numBins; ++b )
+        {
+          binInfo << GEOS_FMT( "\n    {} phase(s): {} cells in {:.3e} s (max over ranks), {:.3e} s (average over ranks)",
+                               b, globalBinSizes[b], maxBinTimes[b], sumBinTimes[b] / numRanks );
+        }
+        GEOS_LOG_RANK_0( GEOS_FMT( "{}: fluid update of {} by phase state at the previous update:{}",
+                                   getName(), dataGroup.getName(), binInfo.str() ) );
+      }
+    }
+    else
+    {
+      thermalCompositionalMultiphaseBaseKernels::
+        FluidUpdateKernel::
+        launch< ExecPolicy >( dataGroup.size(),
+                              fluidWrapper,
+                              pres,
+                              temp,
+                              compFrac );
+    }
   } );
 }
 
@@ -2554,11 +2620,50 @@ void CompositionalMultiphaseBase::saveSequentialIterationState( DomainPartition
   m_sequentialCompDensChange = MpiWrapper::max( maxCompDensChange ); // store to be later used for convergence check
 }
 
+void CompositionalMultiphaseBase::saveNonlinearIterationState( DomainPartition & domain )
+{
+  FlowSolverBase::saveNonlinearIterationState( domain );
+
+  m_compDensNonlinearIterationState.resize( 0 );
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                                               MeshLevel & mesh,
+                                                               arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions( regionNames,
+                                                [&]( localIndex const,
+                                                     ElementSubRegionBase & subRegion )
+    {
+      appendFieldValues( subRegion.getField< fields::flow::globalCompDensity >().toViewConst(), m_compDensNonlinearIterationState );
+    } );
+  } );
+}
+
+void CompositionalMultiphaseBase::restoreNonlinearIterationState( DomainPartition & domain )
+{
+  FlowSolverBase::restoreNonlinearIterationState( domain );
+
+  localIndex offset = 0;
+  arrayView1d< real64 const > const state = m_compDensNonlinearIterationState.toViewConst();
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                                               MeshLevel & mesh,
+                                                               arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions( regionNames,
+                                                [&]( localIndex const,
+                                                     ElementSubRegionBase & subRegion )
+    {
+      offset = restoreFieldValues( state, offset, subRegion.getField< fields::flow::globalCompDensity >() );
+    } );
+  } );
+  GEOS_ASSERT_EQ( offset, state.size() );
+}
+
 void CompositionalMultiphaseBase::updateState( DomainPartition & domain )
 {
   GEOS_MARK_FUNCTION;
 
   real64 maxDeltaPhaseVolFrac = 0.0;
+  MultiFluidBase::FlashStatistics flashStatistics;
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
                                                                MeshLevel & mesh,
                                                                arrayView1d< string const > const & regionNames )
@@ -2572,6 +2677,12 @@ void CompositionalMultiphaseBase::updateState( DomainPartition & domain )
       // update all fluid properties
       real64 const deltaPhaseVolFrac = updateFluidState( subRegion );
       maxDeltaPhaseVolFrac = LvArray::math::max( maxDeltaPhaseVolFrac, deltaPhaseVolFrac );
+      if( isLogLevelActive< logInfo::PhaseEquilibrium >( getLogLevel() ) )
+      {
+        string const & fluidName = subRegion.template getReference< string >( viewKeyStruct::fluidNamesString() );
+        MultiFluidBase const & fluid = getConstitutiveModel< MultiFluidBase >( subRegion, fluidName );
+        fluid.accumulateFlashStatistics( subRegion.ghostRank(), flashStatistics );
+      }
       // for thermal, update solid internal energy
       if( m_isThermal )
       {
@@ -2585,6 +2696,29 @@ void CompositionalMultiphaseBase::updateState( DomainPartition & domain )
 
   GEOS_LOG_LEVEL_INFO_RANK_0( logInfo::Solution,
                               GEOS_FMT( "        {}: Max phase volume fraction change = {}", getName(), fmt::format( "{:.{}f}", maxDeltaPhaseVolFrac, 4 ) ) );
+
+  if( isLogLevelActive< logInfo::PhaseEquilibrium >( getLogLevel() ) )
+  {
+    // reduce all the counters at once
+    std::array< integer, 4 > const localStatistics{ flashStatistics.numFlashes,
+                                                    flashStatistics.numSSIIterations,
+                                                    flashStatistics.numNewtonIterations,
+                                                    flashStatistics.numRestarts };
+    std::array< integer, 4 > globalStatistics{};
+    MpiWrapper::allReduce( localStatistics.data(),
+                           globalStatistics.data(),
+                           LvArray::integerConversion< int >( localStatistics.size() ),
+                           MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ),
+                           MPI_COMM_GEOS );
+
+    // models without an iterative phase equilibrium calculation report no flash
+    if( globalStatistics[0] > 0 )
+    {
+      GEOS_LOG_LEVEL_INFO_RANK_0( logInfo::PhaseEquilibrium,
+                                  GEOS_FMT( "        {}: {} flash calculations, {} SSI iterations, {} Newton iterations, {} restarts",
+                                            getName(), globalStatistics[0], globalStatistics[1], globalStatistics[2], globalStatistics[3] ) );
+    }
+  }
 }
 
 bool CompositionalMultiphaseBase::checkSequentialSolutionIncrements( DomainPartition & domain ) const
@@ -164,6 +164,10 @@ public:
 
   virtual void saveSequentialIterationState( DomainPartition & domain ) override final;
 
+  virtual void saveNonlinearIterationState( DomainPartition & domain ) override;
+
+  virtual void restoreNonlinearIterationState( DomainPartition & domain ) override;
+
   virtual void updateState( DomainPartition & domain ) override final;
 
   /**
@@ -272,6 +276,10 @@ public:
     static constexpr char const * maxSequentialCompDensChangeString() { return "maxSequentialCompDensChange"; }
     static constexpr char const * minScalingFactorString() { return "minScalingFactor"; }
 
+    // performance options
+
+    static constexpr char const * useBinnedFluidUpdateString() { return "useBinnedFluidUpdate"; }
+
   };
 
   /**
@@ -499,6 +507,12 @@ protected:
   /// the targeted CFL for timestep
   real64 m_targetFlowCFL;
 
+  /// flag indicating whether the fluid update groups the cells by phase state to balance the threads
+  integer m_useBinnedFluidUpdate;
+
+  /// global component densities saved by saveNonlinearIterationState
+  array1d< real64 > m_compDensNonlinearIterationState;
+
 private:
 
   /**
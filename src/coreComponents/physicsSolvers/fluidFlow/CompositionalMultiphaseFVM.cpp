@@ -100,6 +100,8 @@ CompositionalMultiphaseFVM::CompositionalMultiphaseFVM( const string & name,
     setApplyDefaultValue( ScalingType::Global ).
     setDescription( "Solution scaling type."
                     "Valid options:\n* " + EnumStrings< ScalingType >::concat( "\n* " ) );
+
+  registerUseAssemblyMapsWrapper();
 }
 
 void CompositionalMultiphaseFVM::postInputInitialization()
@@ -110,6 +112,11 @@ void CompositionalMultiphaseFVM::postInputInitialization()
   {
     GEOS_ERROR( GEOS_FMT( "{}: line search is not supported for {} = {}", getName(), viewKeyStruct::scalingTypeString(), EnumStrings< ScalingType >::toString( ScalingType::Local )) );
   }
+
+  GEOS_THROW_IF( m_isThermal && m_useAssemblyMaps,
+                 getWrapperDataContext( viewKeyStruct::useAssemblyMapsString() ) <<
+                 ": the assembly maps are not available with the thermal option",
+                 InputError );
 }
 
 void CompositionalMultiphaseFVM::initializePreSubGroups()
@@ -173,6 +180,7 @@ void CompositionalMultiphaseFVM::assembleFluxTerms( real64 const dt,
     FluxApproximationBase const & fluxApprox = fvManager.getFluxApproximation( m_discretizationName );
 
     string const & elemDofKey = dofManager.getKey( viewKeyStruct::elemDofFieldString() );
+    std::map< string, AssemblyMap > * const assemblyMaps = getAssemblyMaps();
 
     fluxApprox.forAllStencils( mesh, [&] ( auto & stencil )
     {
@@ -223,6 +231,9 @@ void CompositionalMultiphaseFVM::assembleFluxTerms( real64 const dt,
         }
         else
         {
+          AssemblyMap * const assemblyMap = assemblyMaps != nullptr
+                                          ? &(*assemblyMaps)[ mesh.getPath() + "/" + LvArray::system::demangleType< TYPEOFREF( stencil ) >() ]
+                                          : nullptr;
           isothermalCompositionalMultiphaseFVMKernels::
             FluxComputeKernelFactory::
             createAndLaunch< parallelDevicePolicy<> >( m_numComponents,
@@ -237,7 +248,8 @@ void CompositionalMultiphaseFVM::assembleFluxTerms( real64 const dt,
                                                        stencilWrapper,
                                                        dt,
                                                        localMatrix.toViewConstSizes(),
-                                                       localRhs.toView() );
+                                                       localRhs.toView(),
+                                                       assemblyMap );
         }
       }
 
@@ -333,11 +345,26 @@ void CompositionalMultiphaseFVM::assembleStabilizedFluxTerms( real64 const dt,
   } );
 }
 
-real64 CompositionalMultiphaseFVM::calculateResidualNorm( real64 const & GEOS_UNUSED_PARAM( time_n ),
-                                                          real64 const & GEOS_UNUSED_PARAM( dt ),
+real64 CompositionalMultiphaseFVM::calculateResidualNorm( real64 const & time_n,
+                                                          real64 const & dt,
                                                           DomainPartition const & domain,
                                                           DofManager const & dofManager,
                                                           arrayView1d< real64 const > const & localRhs )
+{
+  physicsSolverBaseKernels::ResidualNormReduction reduction;
+  std::function< real64() > const residualNorm =
+    CompositionalMultiphaseFVM::calculateLocalResidualNorm( time_n, dt, domain, dofManager, localRhs, reduction );
+  reduction.reduce();
+  return residualNorm();
+}
+
+std::function< real64() >
+CompositionalMultiphaseFVM::calculateLocalResidualNorm( real64 const & GEOS_UNUSED_PARAM( time_n ),
+                                                        real64 const & GEOS_UNUSED_PARAM( dt ),
+                                                        DomainPartition const & domain,
+                                                        DofManager const & dofManager,
+                                                        arrayView1d< real64 const > const & localRhs,
+                                                        physicsSolverBaseKernels::ResidualNormReduction & reduction )
 {
   GEOS_MARK_FUNCTION;
 
@@ -432,47 +459,38 @@ real64 CompositionalMultiphaseFVM::calculateResidualNorm( real64 const & GEOS_UN
     } );
   } );
 
-  // step 3: second reduction across MPI ranks
+  // step 3: registration for the reduction across MPI ranks, the norm is computed once the reduction is done
 
-  real64 residualNorm = 0.0;
-  array1d< real64 > globalResidualNorm;
-  globalResidualNorm.resize( numNorm );
-  if( m_isThermal )
+  integer const numActiveNorm = m_isThermal ? 3 : 2;
+  array1d< integer > normIndices( numActiveNorm );
+  for( integer i = 0; i < numActiveNorm; ++i )
   {
-    if( normType == physicsSolverBaseKernels::NormType::Linf )
-    {
-      physicsSolverBaseKernels::LinfResidualNormHelper::
-        computeGlobalNorm( localResidualNorm, globalResidualNorm );
-    }
-    else
+    normIndices[i] = reduction.addNorm( normType, localResidualNorm[i], localResidualNormalizer[i] );
+  }
+
+  return [this, &reduction, normIndices]()
+  {
+    array1d< real64 > globalResidualNorm( normIndices.size() );
+    real64 residualNorm = 0.0;
+    for( integer i = 0; i < normIndices.size(); ++i )
     {
-      physicsSolverBaseKernels::L2ResidualNormHelper::
-        computeGlobalNorm( localResidualNorm, localResidualNormalizer, globalResidualNorm );
+      globalResidualNorm[i] = reduction.globalNorm( normIndices[i] );
+      residualNorm += globalResidualNorm[i] * globalResidualNorm[i];
     }
-    residualNorm = sqrt( globalResidualNorm[0] * globalResidualNorm[0] + globalResidualNorm[1] * globalResidualNorm[1]  + globalResidualNorm[2] * globalResidualNorm[2] );
+    residualNorm = sqrt( residualNorm );
 
-    GEOS_LOG_LEVEL_INFO_RANK_0_NLR( logInfo::Convergence, GEOS_FMT( "        ( Rmass Rvol ) = ( {:4.2e} {:4.2e} )        ( Renergy ) = ( {:4.2e} )",
-                                                                    globalResidualNorm[0], globalResidualNorm[1], globalResidualNorm[2] ));
-  }
-  else
-  {
-    if( normType == physicsSolverBaseKernels::NormType::Linf )
+    if( m_isThermal )
     {
-      physicsSolverBaseKernels::LinfResidualNormHelper::
-        computeGlobalNorm( localResidualNorm, globalResidualNorm );
+      GEOS_LOG_LEVEL_INFO_RANK_0_NLR( logInfo::Convergence, GEOS_FMT( "        ( Rmass Rvol ) = ( {:4.2e} {:4.2e} )        ( Renergy ) = ( {:4.2e} )",
+                                                                      globalResidualNorm[0], globalResidualNorm[1], globalResidualNorm[2] ));
     }
     else
     {
-      physicsSolverBaseKernels::L2ResidualNormHelper::
-        computeGlobalNorm( localResidualNorm, localResidualNormalizer, globalResidualNorm );
+      GEOS_LOG_LEVEL_INFO_RANK_0_NLR( logInfo::Convergence, GEOS_FMT( "        ( Rmass Rvol ) = ( {:4.2e} {:4.2e} )",
+                                                                      globalResidualNorm[0], globalResidualNorm[1] ) );
     }
-    residualNorm = sqrt( globalResidualNorm[0] * globalResidualNorm[0] + globalResidualNorm[1] * globalResidualNorm[1] );
-
-    GEOS_LOG_LEVEL_INFO_RANK_0_NLR( logInfo::Convergence, GEOS_FMT( "        ( Rmass Rvol ) = ( {:4.2e} {:4.2e} )",
-                                                                    globalResidualNorm[0], globalResidualNorm[1] ) );
-  }
-
-  return residualNorm;
+    return residualNorm;
+  };
 }
 
 real64 CompositionalMultiphaseFVM::scalingForSystemSolution( DomainPartition & domain,
@@ -812,6 +830,54 @@ void CompositionalMultiphaseFVM::applySystemSolution( DofManager const & dofMana
   } );
 }
 
+void CompositionalMultiphaseFVM::flagLocalNewtonRows( DomainPartition const & GEOS_UNUSED_PARAM( domain ),
+                                                      DofManager const & GEOS_UNUSED_PARAM( dofManager ),
+                                                      arrayView1d< real64 const > const & localRhs,
+                                                      real64 const threshold,
+                                                      arrayView1d< integer > const & isFlagged ) const
+{
+  GEOS_MARK_FUNCTION;
+
+  // the dofs of a cell are numbered consecutively (location-based numbering of the single cell field)
+  integer const numDof = m_numDofPerCell;
+  GEOS_ERROR_IF_NE( localRhs.size() % numDof, 0 );
+  localIndex const numCells = localRhs.size() / numDof;
+
+  // each equation (component mass, volume and energy balances) is normalized by its largest residual on the rank
+  stackArray1d< real64, MultiFluidBase::MAX_NUM_COMPONENTS + 2 > maxResidual( numDof );
+  for( integer eq = 0; eq < numDof; ++eq )
+  {
+    RAJA::ReduceMax< parallelDeviceReduce, real64 > eqMaxResidual( 0.0 );
+    forAll< parallelDevicePolicy<> >( numCells, [=] GEOS_HOST_DEVICE ( localIndex const ei )
+    {
+      eqMaxResidual.max( LvArray::math::abs( localRhs[ei * numDof + eq] ) );
+    } );
+    maxResidual[eq] = eqMaxResidual.get();
+  }
+
+  // a cell is flagged (with all its equations) when one of its normalized residuals is above the threshold
+  stackArray1d< real64, MultiFluidBase::MAX_NUM_COMPONENTS + 2 > minResidual( numDof );
+  for( integer eq = 0; eq < numDof; ++eq )
+  {
+    minResidual[eq] = ( maxResidual[eq] > 0.0 ) ? threshold * maxResidual[eq] : LvArray::NumericLimits< real64 >::max;
+  }
+  forAll< parallelDevicePolicy<> >( numCells, [=] GEOS_HOST_DEVICE ( localIndex const ei )
+  {
+    integer cellIsFlagged = 0;
+    for( integer eq = 0; eq < numDof; ++eq )
+    {
+      if( LvArray::math::abs( localRhs[ei * numDof + eq] ) >= minResidual[eq] )
+      {
+        cellIsFlagged = 1;
+      }
+    }
+    for( integer eq = 0; eq < numDof; ++eq )
+    {
+      isFlagged[ei * numDof + eq] = cellIsFlagged;
+    }
+  } );
+}
+
 void CompositionalMultiphaseFVM::updatePhaseMobility( ObjectManagerBase & dataGroup ) const
 {
   GEOS_MARK_FUNCTION;
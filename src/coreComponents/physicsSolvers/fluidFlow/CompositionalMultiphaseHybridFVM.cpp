@@ -816,6 +816,40 @@ void CompositionalMultiphaseHybridFVM::resetStateToBeginningOfStep( DomainPartit
   } );
 }
 
+void CompositionalMultiphaseHybridFVM::saveNonlinearIterationState( DomainPartition & domain )
+{
+  // 1. Save the cell-centered fields
+  CompositionalMultiphaseBase::saveNonlinearIterationState( domain );
+
+  // 2. Save the face-based fields
+  m_facePresNonlinearIterationState.resize( 0 );
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                MeshLevel & mesh,
+                                                                arrayView1d< string const > const & )
+  {
+    FaceManager const & faceManager = mesh.getFaceManager();
+    appendFieldValues( faceManager.getField< fields::flow::facePressure >().toViewConst(), m_facePresNonlinearIterationState );
+  } );
+}
+
+void CompositionalMultiphaseHybridFVM::restoreNonlinearIterationState( DomainPartition & domain )
+{
+  // 1. Restore the cell-centered fields
+  CompositionalMultiphaseBase::restoreNonlinearIterationState( domain );
+
+  // 2. Restore the face-based fields
+  localIndex offset = 0;
+  arrayView1d< real64 const > const state = m_facePresNonlinearIterationState.toViewConst();
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                MeshLevel & mesh,
+                                                                arrayView1d< string const > const & )
+  {
+    FaceManager & faceManager = mesh.getFaceManager();
+    offset = restoreFieldValues( state, offset, faceManager.getField< fields::flow::facePressure >() );
+  } );
+  GEOS_ASSERT_EQ( offset, state.size() );
+}
+
 void CompositionalMultiphaseHybridFVM::updatePhaseMobility( ObjectManagerBase & dataGroup ) const
 {
   GEOS_MARK_FUNCTION;
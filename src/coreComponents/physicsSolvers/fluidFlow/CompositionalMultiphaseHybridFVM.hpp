@@ -127,6 +127,12 @@ public:
   virtual void
   resetStateToBeginningOfStep( DomainPartition & domain ) override;
 
+  virtual void
+  saveNonlinearIterationState( DomainPartition & domain ) override;
+
+  virtual void
+  restoreNonlinearIterationState( DomainPartition & domain ) override;
+
   virtual void
   assembleFluxTerms( real64 const dt,
                      DomainPartition const & domain,
@@ -181,6 +187,9 @@ private:
   /// region filter used in flux assembly
   SortedArray< localIndex > m_regionFilter;
 
+  /// face pressures saved by saveNonlinearIterationState
+  array1d< real64 > m_facePresNonlinearIterationState;
+
 };
 
 } // namespace geos
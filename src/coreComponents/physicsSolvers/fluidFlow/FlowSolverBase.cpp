@@ -286,6 +286,42 @@ void FlowSolverBase::saveSequentialIterationState( DomainPartition & domain )
   m_sequentialTempChange = m_isThermal ? MpiWrapper::max( maxTempChange ) : 0.0;
 }
 
+void FlowSolverBase::saveNonlinearIterationState( DomainPartition & domain )
+{
+  m_nonlinearIterationState.resize( 0 );
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                                               MeshLevel & mesh,
+                                                               arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions( regionNames,
+                                                [&]( localIndex const,
+                                                     ElementSubRegionBase & subRegion )
+    {
+      appendFieldValues( subRegion.getField< fields::flow::pressure >().toViewConst(), m_nonlinearIterationState );
+      appendFieldValues( subRegion.getField< fields::flow::temperature >().toViewConst(), m_nonlinearIterationState );
+    } );
+  } );
+}
+
+void FlowSolverBase::restoreNonlinearIterationState( DomainPartition & domain )
+{
+  localIndex offset = 0;
+  arrayView1d< real64 const > const state = m_nonlinearIterationState.toViewConst();
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                                               MeshLevel & mesh,
+                                                               arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions( regionNames,
+                                                [&]( localIndex const,
+                                                     ElementSubRegionBase & subRegion )
+    {
+      offset = restoreFieldValues( state, offset, subRegion.getField< fields::flow::pressure >() );
+      offset = restoreFieldValues( state, offset, subRegion.getField< fields::flow::temperature >() );
+    } );
+  } );
+  GEOS_ASSERT_EQ( offset, state.size() );
+}
+
 void FlowSolverBase::setConstitutiveNamesCallSuper( ElementSubRegionBase & subRegion ) const
 {
   PhysicsSolverBase::setConstitutiveNamesCallSuper( subRegion );
@@ -21,6 +21,7 @@
 #define GEOS_PHYSICSSOLVERS_FINITEVOLUME_FLOWSOLVERBASE_HPP_
 
 #include "physicsSolvers/PhysicsSolverBase.hpp"
+#include "common/GEOS_RAJA_Interface.hpp"
 #include "common/Units.hpp"
 #include "finiteVolume/BoundaryStencil.hpp"
 #include "fieldSpecification/AquiferBoundaryCondition.hpp"
@@ -114,6 +115,10 @@ public:
    */
   virtual void saveSequentialIterationState( DomainPartition & domain ) override;
 
+  virtual void saveNonlinearIterationState( DomainPartition & domain ) override;
+
+  virtual void restoreNonlinearIterationState( DomainPartition & domain ) override;
+
   integer & isThermal() { return m_isThermal; }
 
   /**
@@ -222,6 +227,45 @@ protected:
 
   virtual void setConstitutiveNamesCallSuper( ElementSubRegionBase & subRegion ) const override;
 
+  /**
+   * @brief Append the values of a field, including the ghost values, to a buffer
+   * @tparam VIEW type of the view of the field
+   * @param[in] field the field
+   * @param[inout] buffer the buffer
+   */
+  template< typename VIEW >
+  static void appendFieldValues( VIEW const & field,
+                                 array1d< real64 > & buffer )
+  {
+    localIndex const offset = buffer.size();
+    buffer.resize( offset + field.size() );
+    arrayView1d< real64 > const values = buffer.toView();
+    forAll< parallelDevicePolicy<> >( field.size(), [=] GEOS_HOST_DEVICE ( localIndex const i )
+    {
+      values[offset + i] = field.data()[i];
+    } );
+  }
+
+  /**
+   * @brief Copy back the values of a field appended to a buffer by appendFieldValues
+   * @tparam VIEW type of the view of the field
+   * @param[in] buffer the buffer
+   * @param[in] offset the position of the field values in the buffer
+   * @param[in] field the field
+   * @return the position of the next field values in the buffer
+   */
+  template< typename VIEW >
+  static localIndex restoreFieldValues( arrayView1d< real64 const > const & buffer,
+                                        localIndex const offset,
+                                        VIEW const & field )
+  {
+    forAll< parallelDevicePolicy<> >( field.size(), [=] GEOS_HOST_DEVICE ( localIndex const i )
+    {
+      field.data()[i] = buffer[offset + i];
+    } );
+    return offset + field.size();
+  }
+
   /// the number of Degrees of Freedom per cell
   integer m_numDofPerCell;
 
@@ -254,6 +298,9 @@ protected:
   real64 m_sequentialTempChange;
   real64 m_maxSequentialTempChange;
 
+  /// pressure and temperature saved by saveNonlinearIterationState
+  array1d< real64 > m_nonlinearIterationState;
+
   /**
    * @brief Class used for displaying boundary warning message
    */
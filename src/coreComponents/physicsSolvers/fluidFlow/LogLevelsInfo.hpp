@@ -47,6 +47,18 @@ struct Statistics
   static constexpr std::string_view getDescription() { return "Print statistics"; }
 };
 
+struct FluidUpdate
+{
+  static constexpr int getMinLogLevel() { return 2; }
+  static constexpr std::string_view getDescription() { return "Timings of the fluid update binned by phase state"; }
+};
+
+struct PhaseEquilibrium
+{
+  static constexpr int getMinLogLevel() { return 2; }
+  static constexpr std::string_view getDescription() { return "Iteration statistics of the phase equilibrium calculations"; }
+};
+
 /// @endcond
 ///@}
 
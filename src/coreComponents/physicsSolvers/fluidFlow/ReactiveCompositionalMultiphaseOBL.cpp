@@ -1347,6 +1347,44 @@ void ReactiveCompositionalMultiphaseOBL::resetStateToBeginningOfStep( DomainPart
   } );
 }
 
+void ReactiveCompositionalMultiphaseOBL::saveNonlinearIterationState( DomainPartition & domain )
+{
+  FlowSolverBase::saveNonlinearIterationState( domain );
+
+  m_compFracNonlinearIterationState.resize( 0 );
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                                               MeshLevel & mesh,
+                                                               arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions( regionNames,
+                                                [&]( localIndex const,
+                                                     ElementSubRegionBase & subRegion )
+    {
+      appendFieldValues( subRegion.getField< fields::flow::globalCompFraction >().toViewConst(), m_compFracNonlinearIterationState );
+    } );
+  } );
+}
+
+void ReactiveCompositionalMultiphaseOBL::restoreNonlinearIterationState( DomainPartition & domain )
+{
+  FlowSolverBase::restoreNonlinearIterationState( domain );
+
+  localIndex offset = 0;
+  arrayView1d< real64 const > const state = m_compFracNonlinearIterationState.toViewConst();
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                                               MeshLevel & mesh,
+                                                               arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions( regionNames,
+                                                [&]( localIndex const,
+                                                     ElementSubRegionBase & subRegion )
+    {
+      offset = restoreFieldValues( state, offset, subRegion.getField< fields::flow::globalCompFraction >() );
+    } );
+  } );
+  GEOS_ASSERT_EQ( offset, state.size() );
+}
+
 void ReactiveCompositionalMultiphaseOBL::updateOBLOperators( ObjectManagerBase & dataGroup ) const
 {
   GEOS_MARK_FUNCTION;
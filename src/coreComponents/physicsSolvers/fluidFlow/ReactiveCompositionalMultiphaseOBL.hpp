@@ -135,6 +135,12 @@ public:
   virtual void
   resetStateToBeginningOfStep( DomainPartition & domain ) override;
 
+  virtual void
+  saveNonlinearIterationState( DomainPartition & domain ) override;
+
+  virtual void
+  restoreNonlinearIterationState( DomainPartition & domain ) override;
+
   virtual void
   implicitStepComplete( real64 const & time,
                         real64 const & dt,
@@ -351,6 +357,9 @@ private:
 
   /// flag indicating whether DARTS L2 norm is used for Newton convergence criterion
   integer m_useDARTSL2Norm;
+
+  /// global component fractions saved by saveNonlinearIterationState
+  array1d< real64 > m_compFracNonlinearIterationState;
 };
 
 
@@ -61,7 +61,13 @@ template< typename BASE >
 SinglePhaseFVM< BASE >::SinglePhaseFVM( const string & name,
                                         Group * const parent ):
   BASE( name, parent )
-{}
+{
+  // only the flux kernels of the single-phase (non-proppant) solver use the assembly maps
+  if constexpr ( std::is_same_v< BASE, SinglePhaseBase > )
+  {
+    this->registerUseAssemblyMapsWrapper();
+  }
+}
 
 template< typename BASE >
 void SinglePhaseFVM< BASE >::initializePreSubGroups()
@@ -83,6 +89,11 @@ void SinglePhaseFVM< BASE >::initializePreSubGroups()
     LinearSolverParameters & linParams = m_linearSolverParameters.get();
     linParams.amg.numFunctions = 2;
   }
+
+  GEOS_THROW_IF( m_isThermal && this->m_useAssemblyMaps,
+                 this->getWrapperDataContext( PhysicsSolverBase::viewKeyStruct::useAssemblyMapsString() ) <<
+                 ": the assembly maps are not available with the thermal option",
+                 InputError );
 }
 
 template< typename BASE >
@@ -120,11 +131,27 @@ void SinglePhaseFVM< BASE >::setupSystem( DomainPartition & domain,
 }
 
 template< typename BASE >
-real64 SinglePhaseFVM< BASE >::calculateResidualNorm( real64 const & GEOS_UNUSED_PARAM( time_n ),
-                                                      real64 const & GEOS_UNUSED_PARAM( dt ),
+real64 SinglePhaseFVM< BASE >::calculateResidualNorm( real64 const & time_n,
+                                                      real64 const & dt,
                                                       DomainPartition const & domain,
                                                       DofManager const & dofManager,
                                                       arrayView1d< real64 const > const & localRhs )
+{
+  physicsSolverBaseKernels::ResidualNormReduction reduction;
+  std::function< real64() > const residualNorm =
+    SinglePhaseFVM< BASE >::calculateLocalResidualNorm( time_n, dt, domain, dofManager, localRhs, reduction );
+  reduction.reduce();
+  return residualNorm();
+}
+
+template< typename BASE >
+std::function< real64() >
+SinglePhaseFVM< BASE >::calculateLocalResidualNorm( real64 const & GEOS_UNUSED_PARAM( time_n ),
+                                                    real64 const & GEOS_UNUSED_PARAM( dt ),
+                                                    DomainPartition const & domain,
+                                                    DofManager const & dofManager,
+                                                    arrayView1d< real64 const > const & localRhs,
+                                                    physicsSolverBaseKernels::ResidualNormReduction & reduction )
 {
   GEOS_MARK_FUNCTION;
 
@@ -198,44 +225,28 @@ real64 SinglePhaseFVM< BASE >::calculateResidualNorm( real64 const & GEOS_UNUSED
     } );
   } );
 
-  // step 3: second reduction across MPI ranks
+  // step 3: registration for the reduction across MPI ranks, the norm is computed once the reduction is done
 
-  real64 residualNorm = 0.0;
-  if( m_isThermal )
-  {
-    array1d< real64 > globalResidualNorm;
-    globalResidualNorm.resize( numNorm );
-    if( normType == physicsSolverBaseKernels::NormType::Linf )
-    {
-      physicsSolverBaseKernels::LinfResidualNormHelper::
-        computeGlobalNorm( localResidualNorm, globalResidualNorm );
-    }
-    else
-    {
-      physicsSolverBaseKernels::L2ResidualNormHelper::
-        computeGlobalNorm( localResidualNorm, localResidualNormalizer, globalResidualNorm );
-    }
-    residualNorm = sqrt( globalResidualNorm[0] * globalResidualNorm[0] + globalResidualNorm[1] * globalResidualNorm[1] );
+  integer const normIndex = reduction.addNorm( normType, localResidualNorm[0], localResidualNormalizer[0] );
+  integer const energyNormIndex = m_isThermal ? reduction.addNorm( normType, localResidualNorm[1], localResidualNormalizer[1] ) : -1;
 
-    GEOS_LOG_LEVEL_INFO_RANK_0_NLR( logInfo::Convergence, GEOS_FMT( "        ( R{} ) = ( {:4.2e} )        ( Renergy ) = ( {:4.2e} )",
-                                                                    FlowSolverBase::coupledSolverAttributePrefix(), globalResidualNorm[0], globalResidualNorm[1] ));
-  }
-  else
+  return [this, &reduction, normIndex, energyNormIndex]()
   {
-
-    if( normType == physicsSolverBaseKernels::NormType::Linf )
+    real64 residualNorm = reduction.globalNorm( normIndex );
+    if( energyNormIndex >= 0 )
     {
-      physicsSolverBaseKernels::LinfResidualNormHelper::computeGlobalNorm( localResidualNorm[0], residualNorm );
+      real64 const energyResidualNorm = reduction.globalNorm( energyNormIndex );
+      GEOS_LOG_LEVEL_INFO_RANK_0_NLR( logInfo::Convergence, GEOS_FMT( "        ( R{} ) = ( {:4.2e} )        ( Renergy ) = ( {:4.2e} )",
+                                                                      FlowSolverBase::coupledSolverAttributePrefix(), residualNorm, energyResidualNorm ));
+      residualNorm = sqrt( residualNorm * residualNorm + energyResidualNorm * energyResidualNorm );
     }
     else
     {
-      physicsSolverBaseKernels::L2ResidualNormHelper::computeGlobalNorm( localResidualNorm[0], localResidualNormalizer[0], residualNorm );
+      GEOS_LOG_LEVEL_INFO_RANK_0_NLR( logInfo::Convergence,
+                                      GEOS_FMT( "        ( R{} ) = ( {:4.2e} )", FlowSolverBase::coupledSolverAttributePrefix(), residualNorm ));
     }
-
-    GEOS_LOG_LEVEL_INFO_RANK_0_NLR( logInfo::Convergence,
-                                    GEOS_FMT( "        ( R{} ) = ( {:4.2e} )", FlowSolverBase::coupledSolverAttributePrefix(), residualNorm ));
-  }
-  return residualNorm;
+    return residualNorm;
+  };
 }
 
 
@@ -305,6 +316,7 @@ void SinglePhaseFVM<>::assembleFluxTerms( real64 const dt,
   FluxApproximationBase const & fluxApprox = fvManager.getFluxApproximation( m_discretizationName );
 
   string const & dofKey = dofManager.getKey( SinglePhaseBase::viewKeyStruct::elemDofFieldString() );
+  std::map< string, AssemblyMap > * const assemblyMaps = getAssemblyMaps();
 
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                                 MeshLevel const & mesh,
@@ -329,6 +341,9 @@ void SinglePhaseFVM<>::assembleFluxTerms( real64 const dt,
       }
       else
       {
+        AssemblyMap * const assemblyMap = assemblyMaps != nullptr
+                                        ? &(*assemblyMaps)[ mesh.getPath() + "/" + LvArray::system::demangleType< TYPEOFREF( stencil ) >() ]
+                                        : nullptr;
         singlePhaseFVMKernels::
           FluxComputeKernelFactory::createAndLaunch< parallelDevicePolicy<> >( dofManager.rankOffset(),
                                                                                dofKey,
@@ -337,7 +352,8 @@ void SinglePhaseFVM<>::assembleFluxTerms( real64 const dt,
                                                                                stencilWrapper,
                                                                                dt,
                                                                                localMatrix.toViewConstSizes(),
-                                                                               localRhs.toView() );
+                                                                               localRhs.toView(),
+                                                                               assemblyMap );
       }
 
 
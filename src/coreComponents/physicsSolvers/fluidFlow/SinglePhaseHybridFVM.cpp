@@ -656,6 +656,40 @@ void SinglePhaseHybridFVM::resetStateToBeginningOfStep( DomainPartition & domain
   } );
 }
 
+void SinglePhaseHybridFVM::saveNonlinearIterationState( DomainPartition & domain )
+{
+  // 1. Save the cell-centered fields
+  SinglePhaseBase::saveNonlinearIterationState( domain );
+
+  // 2. Save the face-based fields
+  m_facePresNonlinearIterationState.resize( 0 );
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                MeshLevel & mesh,
+                                                                arrayView1d< string const > const & )
+  {
+    FaceManager const & faceManager = mesh.getFaceManager();
+    appendFieldValues( faceManager.getField< fields::flow::facePressure >().toViewConst(), m_facePresNonlinearIterationState );
+  } );
+}
+
+void SinglePhaseHybridFVM::restoreNonlinearIterationState( DomainPartition & domain )
+{
+  // 1. Restore the cell-centered fields
+  SinglePhaseBase::restoreNonlinearIterationState( domain );
+
+  // 2. Restore the face-based fields
+  localIndex offset = 0;
+  arrayView1d< real64 const > const state = m_facePresNonlinearIterationState.toViewConst();
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                MeshLevel & mesh,
+                                                                arrayView1d< string const > const & )
+  {
+    FaceManager & faceManager = mesh.getFaceManager();
+    offset = restoreFieldValues( state, offset, faceManager.getField< fields::flow::facePressure >() );
+  } );
+  GEOS_ASSERT_EQ( offset, state.size() );
+}
+
 void SinglePhaseHybridFVM::updatePressureGradient( DomainPartition & domain )
 {
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
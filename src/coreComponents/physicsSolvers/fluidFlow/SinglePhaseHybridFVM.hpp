@@ -114,6 +114,12 @@ public:
   virtual void
   resetStateToBeginningOfStep( DomainPartition & domain ) override;
 
+  virtual void
+  saveNonlinearIterationState( DomainPartition & domain ) override;
+
+  virtual void
+  restoreNonlinearIterationState( DomainPartition & domain ) override;
+
   virtual void
   implicitStepSetup( real64 const & time_n,
                      real64 const & dt,
@@ -197,6 +203,9 @@ private:
   /// region filter used in flux assembly
   SortedArray< localIndex > m_regionFilter;
 
+  /// face pressures saved by saveNonlinearIterationState
+  array1d< real64 > m_facePresNonlinearIterationState;
+
 };
 
 } /* namespace geos */
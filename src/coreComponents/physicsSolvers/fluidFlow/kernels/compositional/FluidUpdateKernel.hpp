@@ -22,6 +22,8 @@
 
 #include "common/DataTypes.hpp"
 #include "common/GEOS_RAJA_Interface.hpp"
+#include "common/Stopwatch.hpp"
+#include "constitutive/fluid/multifluid/Layouts.hpp"
 
 namespace geos
 {
@@ -67,6 +69,86 @@ struct FluidUpdateKernel
       }
     } );
   }
+
+  /**
+   * @brief Update the fluid on host with the cells grouped by their phase state
+   * @details The cost of a fluid update varies widely between single-phase and multiphase cells.
+   *          The cells are binned by the number of phases present at the previous update, and each
+   *          bin is processed with a dynamic schedule so that the threads finish at the same time.
+   * @tparam CHUNK_SIZE number of cells handed to a thread at a time
+   * @param[in] size the number of cells
+   * @param[in] numPhases the number of fluid phases
+   * @param[in] phaseFrac the phase fractions computed at the previous update
+   * @param[in] fluidWrapper the fluid kernel wrapper
+   * @param[in] pres the pressure
+   * @param[in] temp the temperature
+   * @param[in] compFrac the global component fractions
+   * @param[out] binSizes the number of cells in each bin (of size numPhases + 1)
+   * @param[out] binTimes the time spent updating the cells of each bin (of size numPhases + 1)
+   */
+  template< integer CHUNK_SIZE = 32, typename FLUID_WRAPPER >
+  static void
+  launchBinned( localIndex const size,
+                integer const numPhases,
+                arrayView3d< real64 const, constitutive::multifluid::USD_PHASE > const & phaseFrac,
+                FLUID_WRAPPER const & fluidWrapper,
+                arrayView1d< real64 const > const & pres,
+                arrayView1d< real64 const > const & temp,
+                arrayView2d< real64 const, compflow::USD_COMP > const & compFrac,
+                arrayView1d< localIndex > const & binSizes,
+                arrayView1d< real64 > const & binTimes )
+  {
+    integer const numBins = numPhases + 1;
+
+    // 1. Stable counting sort of the cells by number of phases present
+    array1d< integer > cellBin( size );
+    array1d< localIndex > binOffsets( numBins + 1 );
+    for( localIndex k = 0; k < size; ++k )
+    {
+      integer numPresentPhases = 0;
+      for( integer ip = 0; ip < numPhases; ++ip )
+      {
+        numPresentPhases += ( phaseFrac[k][0][ip] > 0.0 ) ? 1 : 0;
+      }
+      cellBin[k] = numPresentPhases;
+      ++binOffsets[numPresentPhases + 1];
+    }
+    for( integer b = 0; b < numBins; ++b )
+    {
+      binOffsets[b + 1] += binOffsets[b];
+    }
+
+    array1d< localIndex > sortedCells( size );
+    array1d< localIndex > binPosition( numBins );
+    for( localIndex k = 0; k < size; ++k )
+    {
+      integer const b = cellBin[k];
+      sortedCells[binOffsets[b] + binPosition[b]++] = k;
+    }
+
+    // 2. Update each bin with a dynamic schedule
+    arrayView1d< localIndex const > const cells = sortedCells.toViewConst();
+    for( integer b = 0; b < numBins; ++b )
+    {
+      localIndex const first = binOffsets[b];
+      binSizes[b] = binOffsets[b + 1] - first;
+      if( binSizes[b] == 0 )
+      {
+        binTimes[b] = 0.0;
+        continue;
+      }
+
+      Stopwatch timer( binTimes[b] );
+      forAll< parallelHostDynamicPolicy< CHUNK_SIZE > >( binSizes[b], [=] ( localIndex const a )
+      {
+        localIndex const k = cells[first + a];
+        for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
+        {
+          fluidWrapper.update( k, q, pres[k], temp[k], compFrac[k] );
+        }
+      } );
+    }
+  }
 };
 
 } // namespace thermalCompositionalMultiphaseBaseKernels
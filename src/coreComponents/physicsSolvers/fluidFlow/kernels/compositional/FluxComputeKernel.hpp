@@ -427,11 +427,13 @@ public:
         {
           RAJA::atomicAdd( parallelDeviceAtomic{}, &m_localRhs[localRow + ic],
                            stack.localFlux[i * numEqn + ic] );
-          m_localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >
-            ( localRow + ic,
-            stack.dofColIndices.data(),
-            stack.localFluxJacobian[i * numEqn + ic].dataIfContiguous(),
-            stack.stencilSize * numDof );
+          m_assemblyMap.addToRow< parallelDeviceAtomic >( m_localMatrix,
+                                                          iconn,
+                                                          i * numEqn + ic,
+                                                          localRow + ic,
+                                                          stack.dofColIndices.data(),
+                                                          stack.localFluxJacobian[i * numEqn + ic].dataIfContiguous(),
+                                                          stack.stencilSize * numDof );
         }
 
         // call the lambda to assemble additional terms, such as thermal terms
@@ -516,6 +518,7 @@ public:
    * @param[in] dt time step size
    * @param[inout] localMatrix the local CRS matrix
    * @param[inout] localRhs the local right-hand side vector
+   * @param[inout] assemblyMap the assembly map of the stencil (optional)
    */
   template< typename POLICY, typename STENCILWRAPPER >
   static void
@@ -531,7 +534,8 @@ public:
                    STENCILWRAPPER const & stencilWrapper,
                    real64 const dt,
                    CRSMatrixView< real64, globalIndex const > const & localMatrix,
-                   arrayView1d< real64 > const & localRhs )
+                   arrayView1d< real64 > const & localRhs,
+                   AssemblyMap * const assemblyMap = nullptr )
   {
     isothermalCompositionalMultiphaseBaseKernels::internal::kernelLaunchSelectorCompSwitch( numComps, [&]( auto NC )
     {
@@ -563,6 +567,11 @@ public:
       kernelType kernel( numPhases, rankOffset, stencilWrapper, dofNumberAccessor,
                          compFlowAccessors, multiFluidAccessors, capPressureAccessors, permeabilityAccessors,
                          dt, localMatrix, localRhs, kernelFlags );
+      if( assemblyMap != nullptr )
+      {
+        assemblyMap->setup( stencilWrapper.size(), kernelType::maxNumElems * kernelType::numEqn, kernelType::maxStencilSize * NUM_DOF );
+        kernel.setAssemblyMap( assemblyMap->toView() );
+      }
       kernelType::template launch< POLICY >( stencilWrapper.size(), kernel );
     } );
   }
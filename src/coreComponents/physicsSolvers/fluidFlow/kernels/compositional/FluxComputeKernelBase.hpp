@@ -20,6 +20,7 @@
 #ifndef GEOS_PHYSICSSOLVERS_FLUIDFLOW_COMPOSITIONAL_FLUXCOMPUTEKERNELBASE_HPP
 #define GEOS_PHYSICSSOLVERS_FLUIDFLOW_COMPOSITIONAL_FLUXCOMPUTEKERNELBASE_HPP
 
+#include "common/AssemblyMap.hpp"
 #include "common/DataLayouts.hpp"
 #include "common/DataTypes.hpp"
 #include "common/GEOS_RAJA_Interface.hpp"
@@ -129,6 +130,15 @@ public:
                          arrayView1d< real64 > const & localRhs,
                          BitFlags< KernelFlags > kernelFlags );
 
+  /**
+   * @brief Set the assembly map used to add the flux contributions to the Jacobian.
+   * @param[in] assemblyMap the view of the map, whose items are the connections of the stencil
+   */
+  void setAssemblyMap( AssemblyMap::View const & assemblyMap )
+  {
+    m_assemblyMap = assemblyMap;
+  }
+
 protected:
 
   /// Number of fluid phases
@@ -171,6 +181,9 @@ protected:
   arrayView1d< real64 > const m_localRhs;
 
   BitFlags< KernelFlags > const m_kernelFlags;
+
+  /// Positions of the flux contributions in the local CRS matrix (empty if not used)
+  AssemblyMap::View m_assemblyMap;
 };
 
 } // namespace isothermalCompositionalMultiphaseFVMKernels
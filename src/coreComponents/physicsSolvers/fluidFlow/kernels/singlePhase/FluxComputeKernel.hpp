@@ -276,10 +276,13 @@ public:
         GEOS_ASSERT_GT( m_localMatrix.numRows(), localRow );
 
         RAJA::atomicAdd( parallelDeviceAtomic{}, &m_localRhs[localRow], stack.localFlux[i * numEqn] );
-        m_localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( localRow,
-                                                                            stack.dofColIndices.data(),
-                                                                            stack.localFluxJacobian[i * numEqn].dataIfContiguous(),
-                                                                            stack.stencilSize * numDof );
+        m_assemblyMap.addToRow< parallelDeviceAtomic >( m_localMatrix,
+                                                        iconn,
+                                                        i * numEqn,
+                                                        localRow,
+                                                        stack.dofColIndices.data(),
+                                                        stack.localFluxJacobian[i * numEqn].dataIfContiguous(),
+                                                        stack.stencilSize * numDof );
 
         // call the lambda to assemble additional terms, such as thermal terms
         kernelOp( i, localRow );
@@ -345,6 +348,7 @@ public:
    * @param[in] dt time step size
    * @param[inout] localMatrix the local CRS matrix
    * @param[inout] localRhs the local right-hand side vector
+   * @param[inout] assemblyMap the assembly map of the stencil (optional)
    */
   template< typename POLICY, typename STENCILWRAPPER >
   static void
@@ -355,7 +359,8 @@ public:
                    STENCILWRAPPER const & stencilWrapper,
                    real64 const & dt,
                    CRSMatrixView< real64, globalIndex const > const & localMatrix,
-                   arrayView1d< real64 > const & localRhs )
+                   arrayView1d< real64 > const & localRhs,
+                   AssemblyMap * const assemblyMap = nullptr )
   {
     integer constexpr NUM_EQN = 1;
     integer constexpr NUM_DOF = 1;
@@ -372,6 +377,11 @@ public:
     kernelType kernel( rankOffset, stencilWrapper, dofNumberAccessor,
                        flowAccessors, fluidAccessors, permAccessors,
                        dt, localMatrix, localRhs );
+    if( assemblyMap != nullptr )
+    {
+      assemblyMap->setup( stencilWrapper.size(), kernelType::maxNumElems * NUM_EQN, kernelType::maxStencilSize * NUM_DOF );
+      kernel.setAssemblyMap( assemblyMap->toView() );
+    }
     kernelType::template launch< POLICY >( stencilWrapper.size(), kernel );
   }
 };
@@ -20,6 +20,7 @@
 #ifndef GEOS_PHYSICSSOLVERS_FLUIDFLOW_SINGLEPHASE_FLUXCOMPUTEKERNELBASE_HPP
 #define GEOS_PHYSICSSOLVERS_FLUIDFLOW_SINGLEPHASE_FLUXCOMPUTEKERNELBASE_HPP
 
+#include "common/AssemblyMap.hpp"
 #include "common/DataLayouts.hpp"
 #include "common/DataTypes.hpp"
 #include "common/GEOS_RAJA_Interface.hpp"
@@ -127,6 +128,15 @@ public:
     m_localRhs( localRhs )
   {}
 
+  /**
+   * @brief Set the assembly map used to add the flux contributions to the Jacobian.
+   * @param[in] assemblyMap the view of the map, whose items are the connections of the stencil
+   */
+  void setAssemblyMap( AssemblyMap::View const & assemblyMap )
+  {
+    m_assemblyMap = assemblyMap;
+  }
+
 protected:
 
   /// Offset for my MPI rank
@@ -164,6 +174,9 @@ protected:
   CRSMatrixView< real64, globalIndex const > const m_localMatrix;
   /// View on the local RHS
   arrayView1d< real64 > const m_localRhs;
+
+  /// Positions of the flux contributions in the local CRS matrix (empty if not used)
+  AssemblyMap::View m_assemblyMap;
 };
 
 } // namespace singlePhaseFVMKernels
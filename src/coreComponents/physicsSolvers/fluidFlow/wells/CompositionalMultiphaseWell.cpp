@@ -1242,6 +1242,21 @@ CompositionalMultiphaseWell::calculateResidualNorm( real64 const & time_n,
                                                     DomainPartition const & domain,
                                                     DofManager const & dofManager,
                                                     arrayView1d< real64 const > const & localRhs )
+{
+  physicsSolverBaseKernels::ResidualNormReduction reduction;
+  std::function< real64() > const residualNorm =
+    CompositionalMultiphaseWell::calculateLocalResidualNorm( time_n, dt, domain, dofManager, localRhs, reduction );
+  reduction.reduce();
+  return residualNorm();
+}
+
+std::function< real64() >
+CompositionalMultiphaseWell::calculateLocalResidualNorm( real64 const & time_n,
+                                                         real64 const & dt,
+                                                         DomainPartition const & domain,
+                                                         DofManager const & dofManager,
+                                                         arrayView1d< real64 const > const & localRhs,
+                                                         physicsSolverBaseKernels::ResidualNormReduction & reduction )
 {
   GEOS_MARK_FUNCTION;
 
@@ -1339,29 +1354,29 @@ CompositionalMultiphaseWell::calculateResidualNorm( real64 const & time_n,
     } );
   } );
 
-  // step 3: second reduction across MPI ranks
-  real64 resNorm=localResidualNorm[0];
-  if( isThermal() )
+  // step 3: registration for the reduction across MPI ranks, the norm is computed once the reduction is done
+  integer const massNormIndex = reduction.addMax( localResidualNorm[0] );
+  integer const energyNormIndex = isThermal() ? reduction.addMax( localResidualNorm[1] ) : -1;
+
+  return [this, &reduction, massNormIndex, energyNormIndex]()
   {
-    real64 globalResidualNorm[2]{};
-    globalResidualNorm[0] = MpiWrapper::max( localResidualNorm[0] );
-    globalResidualNorm[1] = MpiWrapper::max( localResidualNorm[1] );
-    resNorm=sqrt( globalResidualNorm[0] * globalResidualNorm[0] + globalResidualNorm[1] * globalResidualNorm[1] );
-    if( getLogLevel() >= 1 && logger::internal::rank == 0 )
+    real64 resNorm = reduction.globalMax( massNormIndex );
+    if( energyNormIndex >= 0 )
     {
-      std::cout << GEOS_FMT( "        ( R{} ) = ( {:4.2e} )        ( Renergy ) = ( {:4.2e} )",
-                             coupledSolverAttributePrefix(), globalResidualNorm[0], globalResidualNorm[1] );
+      real64 const energyResNorm = reduction.globalMax( energyNormIndex );
+      if( getLogLevel() >= 1 && logger::internal::rank == 0 )
+      {
+        std::cout << GEOS_FMT( "        ( R{} ) = ( {:4.2e} )        ( Renergy ) = ( {:4.2e} )",
+                               coupledSolverAttributePrefix(), resNorm, energyResNorm );
+      }
+      resNorm = sqrt( resNorm * resNorm + energyResNorm * energyResNorm );
     }
-  }
-  else
-  {
-    resNorm= MpiWrapper::max( resNorm );
-    if( getLogLevel() >= 1 && logger::internal::rank == 0 )
+    else if( getLogLevel() >= 1 && logger::internal::rank == 0 )
     {
       std::cout << GEOS_FMT( "        ( R{} ) = ( {:4.2e} )", coupledSolverAttributePrefix(), resNorm );
     }
-  }
-  return resNorm;
+    return resNorm;
+  };
 }
 
 real64
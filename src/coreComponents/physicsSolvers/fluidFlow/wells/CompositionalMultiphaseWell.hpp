@@ -97,6 +97,14 @@ public:
                          DofManager const & dofManager,
                          arrayView1d< real64 const > const & localRhs ) override;
 
+  virtual std::function< real64() >
+  calculateLocalResidualNorm( real64 const & time_n,
+                              real64 const & dt,
+                              DomainPartition const & domain,
+                              DofManager const & dofManager,
+                              arrayView1d< real64 const > const & localRhs,
+                              physicsSolverBaseKernels::ResidualNormReduction & reduction ) override;
+
   virtual real64
   scalingForSystemSolution( DomainPartition & domain,
                             DofManager const & dofManager,
@@ -704,6 +704,21 @@ SinglePhaseWell::calculateResidualNorm( real64 const & time_n,
                                         DomainPartition const & domain,
                                         DofManager const & dofManager,
                                         arrayView1d< real64 const > const & localRhs )
+{
+  physicsSolverBaseKernels::ResidualNormReduction reduction;
+  std::function< real64() > const residualNorm =
+    SinglePhaseWell::calculateLocalResidualNorm( time_n, dt, domain, dofManager, localRhs, reduction );
+  reduction.reduce();
+  return residualNorm();
+}
+
+std::function< real64() >
+SinglePhaseWell::calculateLocalResidualNorm( real64 const & time_n,
+                                             real64 const & dt,
+                                             DomainPartition const & domain,
+                                             DofManager const & dofManager,
+                                             arrayView1d< real64 const > const & localRhs,
+                                             physicsSolverBaseKernels::ResidualNormReduction & reduction )
 {
   GEOS_MARK_FUNCTION;
 
@@ -755,15 +770,19 @@ SinglePhaseWell::calculateResidualNorm( real64 const & time_n,
   } );
 
 
-  // step 3: second reduction across MPI ranks
+  // step 3: registration for the reduction across MPI ranks, the norm is computed once the reduction is done
 
-  real64 const residualNorm = MpiWrapper::max( localResidualNorm );
+  integer const normIndex = reduction.addMax( localResidualNorm );
 
-  if( getLogLevel() >= 1 && logger::internal::rank == 0 )
+  return [this, &reduction, normIndex]()
   {
-    std::cout << GEOS_FMT( "        ( R{} ) = ( {:4.2e} )", coupledSolverAttributePrefix(), residualNorm );
-  }
-  return residualNorm;
+    real64 const residualNorm = reduction.globalMax( normIndex );
+    if( getLogLevel() >= 1 && logger::internal::rank == 0 )
+    {
+      std::cout << GEOS_FMT( "        ( R{} ) = ( {:4.2e} )", coupledSolverAttributePrefix(), residualNorm );
+    }
+    return residualNorm;
+  };
 }
 
 bool SinglePhaseWell::checkSystemSolution( DomainPartition & domain,
@@ -0,0 +1,189 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file AndersonAcceleration.cpp
+ */
+
+#include "AndersonAcceleration.hpp"
+
+#include "common/MpiWrapper.hpp"
+#include "common/TimingMacros.hpp"
+#include "denseLinearAlgebra/interfaces/blaslapack/BlasLapackLA.hpp"
+
+namespace geos
+{
+
+namespace
+{
+
+/**
+ * @brief Local part of the dot product of two distributed vectors
+ * @param a the first vector
+ * @param b the second vector
+ * @param isOwned flags indicating the entries owned by this rank
+ * @param n the local size of the vectors
+ * @return the local dot product, restricted to the owned entries
+ */
+real64 localDot( real64 const * const a,
+                 real64 const * const b,
+                 integer const * const isOwned,
+                 localIndex const n )
+{
+  RAJA::ReduceSum< parallelHostReduce, real64 > sum( 0.0 );
+  forAll< parallelHostPolicy >( n, [=]( localIndex const i )
+  {
+    if( isOwned[i] )
+    {
+      sum += a[i] * b[i];
+    }
+  } );
+  return sum.get();
+}
+
+}
+
+AndersonAcceleration::AndersonAcceleration( integer const depth )
+{
+  reset( depth );
+}
+
+void AndersonAcceleration::reset( integer const depth )
+{
+  GEOS_ERROR_IF_LT_MSG( depth, 1, "AndersonAcceleration: the depth must be at least 1" );
+  m_depth = depth;
+  m_numUpdates = 0;
+  m_numUsedIterations = 0;
+  m_hasPreviousIteration = false;
+}
+
+array1d< real64 > AndersonAcceleration::accelerate( arrayView1d< real64 const > const & x,
+                                                    arrayView1d< real64 const > const & g,
+                                                    arrayView1d< integer const > const & isOwned )
+{
+  GEOS_MARK_FUNCTION;
+
+  GEOS_ERROR_IF_NE( x.size(), g.size() );
+  GEOS_ERROR_IF_NE( x.size(), isOwned.size() );
+  localIndex const n = x.size();
+
+  // 1. Fixed-point residual, and differences with the previous iteration stored in the history
+  array1d< real64 > f( n );
+  arrayView1d< real64 > const fView = f.toView();
+  forAll< parallelHostPolicy >( n, [=]( localIndex const i )
+  {
+    fView[i] = g[i] - x[i];
+  } );
+
+  if( m_hasPreviousIteration )
+  {
+    GEOS_ERROR_IF_NE_MSG( m_fPrev.size(), n, "AndersonAcceleration: the size of the vectors changed without reset" );
+    if( m_deltaF.size( 0 ) != m_depth || m_deltaF.size( 1 ) != n )
+    {
+      m_deltaF.resize( m_depth, n );
+      m_deltaG.resize( m_depth, n );
+    }
+    localIndex const slot = m_numUpdates % m_depth;
+    arrayView1d< real64 const > const fPrev = m_fPrev.toViewConst();
+    arrayView1d< real64 const > const gPrev = m_gPrev.toViewConst();
+    arrayView2d< real64 > const deltaF = m_deltaF.toView();
+    arrayView2d< real64 > const deltaG = m_deltaG.toView();
+    forAll< parallelHostPolicy >( n, [=]( localIndex const i )
+    {
+      deltaF( slot, i ) = fView[i] - fPrev[i];
+      deltaG( slot, i ) = g[i] - gPrev[i];
+    } );
+    ++m_numUpdates;
+  }
+
+  m_fPrev = f;
+  m_gPrev.resize( n );
+  arrayView1d< real64 > const gPrev = m_gPrev.toView();
+  array1d< real64 > xNext( n );
+  arrayView1d< real64 > const xNextView = xNext.toView();
+  forAll< parallelHostPolicy >( n, [=]( localIndex const i )
+  {
+    gPrev[i] = g[i];
+    xNextView[i] = g[i];
+  } );
+  m_hasPreviousIteration = true;
+
+  integer const m = LvArray::math::min( m_numUpdates, m_depth );
+  m_numUsedIterations = 0;
+  if( m == 0 )
+  {
+    return xNext;
+  }
+
+  // 2. Normal equations of min || f - sum_k gamma_k deltaF_k ||, assembled with a single reduction
+  array1d< real64 > localSums( m * m + m );
+  for( integer i = 0; i < m; ++i )
+  {
+    for( integer j = 0; j <= i; ++j )
+    {
+      localSums[i * m + j] = localDot( m_deltaF[i].dataIfContiguous(), m_deltaF[j].dataIfContiguous(), isOwned.data(), n );
+    }
+    localSums[m * m + i] = localDot( m_deltaF[i].dataIfContiguous(), f.data(), isOwned.data(), n );
+  }
+  array1d< real64 > globalSums( localSums.size() );
+  MpiWrapper::allReduce( localSums.data(),
+                         globalSums.data(),
+                         LvArray::integerConversion< int >( localSums.size() ),
+                         MPI_SUM,
+                         MPI_COMM_GEOS );
+
+  array2d< real64 > gram( m, m );
+  array1d< real64 > rhs( m );
+  real64 maxDiag = 0.0;
+  for( integer i = 0; i < m; ++i )
+  {
+    for( integer j = 0; j <= i; ++j )
+    {
+      gram( i, j ) = globalSums[i * m + j];
+      gram( j, i ) = globalSums[i * m + j];
+    }
+    rhs[i] = globalSums[m * m + i];
+    maxDiag = LvArray::math::max( maxDiag, gram( i, i ) );
+  }
+  if( maxDiag <= 0.0 )
+  {
+    // the residual did not change over the history, keep the plain fixed-point update
+    return xNext;
+  }
+
+  // a small regularization protects against (nearly) colinear residual differences
+  for( integer i = 0; i < m; ++i )
+  {
+    gram( i, i ) += 1e-10 * maxDiag;
+  }
+  array1d< real64 > gamma( m );
+  BlasLapackLA::solveLinearSystem( gram.toSliceConst(), rhs.toSliceConst(), gamma.toSlice() );
+
+  // 3. Mix the outputs of the fixed-point map
+  arrayView2d< real64 const > const deltaG = m_deltaG.toViewConst();
+  for( integer k = 0; k < m; ++k )
+  {
+    real64 const gammaK = gamma[k];
+    forAll< parallelHostPolicy >( n, [=]( localIndex const i )
+    {
+      xNextView[i] -= gammaK * deltaG( k, i );
+    } );
+  }
+  m_numUsedIterations = m;
+
+  return xNext;
+}
+
+} // namespace geos
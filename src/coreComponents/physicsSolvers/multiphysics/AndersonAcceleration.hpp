@@ -0,0 +1,105 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file AndersonAcceleration.hpp
+ */
+
+#ifndef GEOS_PHYSICSSOLVERS_MULTIPHYSICS_ANDERSONACCELERATION_HPP_
+#define GEOS_PHYSICSSOLVERS_MULTIPHYSICS_ANDERSONACCELERATION_HPP_
+
+#include "common/DataTypes.hpp"
+
+namespace geos
+{
+
+/**
+ * @class AndersonAcceleration
+ * @brief Anderson acceleration of a fixed-point iteration x = G( x ).
+ *
+ * At each iteration, the next iterate is the combination of the last outputs of G that minimizes
+ * the (linearized) fixed-point residual f = G( x ) - x over the last @p depth iterations
+ * (type-II Anderson mixing, see Walker and Ni, 2011. Anderson acceleration for fixed-point
+ * iterations. SIAM Journal on Numerical Analysis, 49(4), pp.1715-1735).
+ *
+ * The vectors are distributed: the small least-squares problem is assembled with a single
+ * global reduction, so that all the ranks compute the same mixing coefficients. Only the
+ * owned entries enter the reduction, the ghost entries are mixed with the same coefficients.
+ */
+class AndersonAcceleration
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param depth the maximum number of previous iterations used in the least-squares problem
+   */
+  explicit AndersonAcceleration( integer const depth = 5 );
+
+  /**
+   * @brief Discard the history, e.g. at the beginning of a new time step.
+   * @param depth the maximum number of previous iterations used in the least-squares problem
+   */
+  void reset( integer const depth );
+
+  /**
+   * @brief Compute the next iterate of the accelerated fixed-point iteration.
+   * @param x the input of the fixed-point map at the current iteration
+   * @param g the output of the fixed-point map at the current iteration, G( x )
+   * @param isOwned flags indicating the entries owned by this rank (the others are ghosts)
+   * @return the next iterate
+   *
+   * Without history (first call after reset()), the next iterate is @p g (plain fixed-point update).
+   */
+  array1d< real64 > accelerate( arrayView1d< real64 const > const & x,
+                                arrayView1d< real64 const > const & g,
+                                arrayView1d< integer const > const & isOwned );
+
+  /**
+   * @return the number of previous iterations used by the last call to accelerate()
+   */
+  integer numUsedIterations() const
+  { return m_numUsedIterations; }
+
+private:
+
+  /// Maximum number of previous iterations used in the least-squares problem
+  integer m_depth;
+
+  /// Number of residual differences stored since the last reset
+  integer m_numUpdates;
+
+  /// Number of previous iterations used by the last call to accelerate()
+  integer m_numUsedIterations;
+
+  /// Flag indicating whether accelerate() was called since the last reset
+  bool m_hasPreviousIteration;
+
+  /// Fixed-point residual at the previous iteration
+  array1d< real64 > m_fPrev;
+
+  /// Output of the fixed-point map at the previous iteration
+  array1d< real64 > m_gPrev;
+
+  /// Differences of successive residuals (circular history, one per row)
+  array2d< real64 > m_deltaF;
+
+  /// Differences of successive outputs of the fixed-point map (circular history, one per row)
+  array2d< real64 > m_deltaG;
+};
+
+} // namespace geos
+
+#endif // GEOS_PHYSICSSOLVERS_MULTIPHYSICS_ANDERSONACCELERATION_HPP_
@@ -166,6 +166,7 @@ public:
 
     // Finally, steal the pattern into a CRS matrix
     localMatrix.assimilate< parallelDevicePolicy<> >( std::move( pattern ) );
+    this->m_isSparsityPatternModified = true;
     localMatrix.setName( this->getName() + "/localMatrix" );
 
     rhs.setName( this->getName() + "/rhs" );
@@ -217,6 +217,24 @@ public:
     } );
   }
 
+  virtual void
+  saveNonlinearIterationState( DomainPartition & domain ) override
+  {
+    forEachArgInTuple( m_solvers, [&]( auto & solver, auto )
+    {
+      solver->saveNonlinearIterationState( domain );
+    } );
+  }
+
+  virtual void
+  restoreNonlinearIterationState( DomainPartition & domain ) override
+  {
+    forEachArgInTuple( m_solvers, [&]( auto & solver, auto )
+    {
+      solver->restoreNonlinearIterationState( domain );
+    } );
+  }
+
   /// This method is meant to be kept final. Derived CoupledSolvers are expected, if needed,
   /// to override fullyCoupledSolverStep and/or sequentiallyCoupledSolverStep.
   real64
@@ -251,14 +269,38 @@ public:
                          DofManager const & dofManager,
                          arrayView1d< real64 const > const & localRhs ) override
   {
-    real64 norm = 0.0;
+    // the norms of all the subsolvers are reduced together
+    physicsSolverBaseKernels::ResidualNormReduction reduction;
+    std::function< real64() > const residualNorm =
+      CoupledSolver::calculateLocalResidualNorm( time_n, dt, domain, dofManager, localRhs, reduction );
+    reduction.reduce();
+    return residualNorm();
+  }
+
+  virtual std::function< real64() >
+  calculateLocalResidualNorm( real64 const & time_n,
+                              real64 const & dt,
+                              DomainPartition const & domain,
+                              DofManager const & dofManager,
+                              arrayView1d< real64 const > const & localRhs,
+                              physicsSolverBaseKernels::ResidualNormReduction & reduction ) override
+  {
+    std::vector< std::function< real64() > > singlePhysicsNorms;
     forEachArgInTuple( m_solvers, [&]( auto & solver, auto )
     {
-      real64 const singlePhysicsNorm = solver->calculateResidualNorm( time_n, dt, domain, dofManager, localRhs );
-      norm += singlePhysicsNorm * singlePhysicsNorm;
+      singlePhysicsNorms.emplace_back( solver->calculateLocalResidualNorm( time_n, dt, domain, dofManager, localRhs, reduction ) );
     } );
 
-    return sqrt( norm );
+    return [singlePhysicsNorms]()
+    {
+      real64 norm = 0.0;
+      for( std::function< real64() > const & singlePhysicsNorm : singlePhysicsNorms )
+      {
+        real64 const value = singlePhysicsNorm();
+        norm += value * value;
+      }
+      return sqrt( norm );
+    };
   }
 
   virtual void
@@ -597,7 +639,9 @@ protected:
 
       if( params.sequentialConvergenceCriterion() == NonlinearSolverParameters::SequentialConvergenceCriterion::ResidualNorm )
       {
-        real64 residualNorm = 0;
+        // the norms of all the single-physics solvers are reduced together
+        physicsSolverBaseKernels::ResidualNormReduction reduction;
+        std::vector< std::function< real64() > > singlePhysicsNorms;
 
         // loop over all the single-physics solvers
         forEachArgInTuple( m_solvers, [&]( auto & solver, auto )
@@ -623,15 +667,22 @@ protected:
           solver->getSystemRhs().close();
 
           // once this is done, we recompute the single-physics residual
-          real64 const singlePhysicsNorm =
-            solver->calculateResidualNorm( time_n,
-                                           dt,
-                                           domain,
-                                           solver->getDofManager(),
-                                           solver->getSystemRhs().values() );
-          residualNorm += singlePhysicsNorm * singlePhysicsNorm;
+          singlePhysicsNorms.emplace_back( solver->calculateLocalResidualNorm( time_n,
+                                                                               dt,
+                                                                               domain,
+                                                                               solver->getDofManager(),
+                                                                               solver->getSystemRhs().values(),
+                                                                               reduction ) );
         } );
 
+        reduction.reduce();
+        real64 residualNorm = 0;
+        for( std::function< real64() > const & singlePhysicsNorm : singlePhysicsNorms )
+        {
+          real64 const value = singlePhysicsNorm();
+          residualNorm += value * value;
+        }
+
         // finally, we perform the convergence check on the multiphysics residual
         residualNorm = sqrt( residualNorm );
         GEOS_LOG_LEVEL_INFO_RANK_0( logInfo::Convergence, GEOS_FMT( "        ( R ) = ( {:4.2e} )", residualNorm ) );
@@ -22,6 +22,7 @@
 #define GEOS_PHYSICSSOLVERS_MULTIPHYSICS_POROMECHANICSSOLVER_HPP_
 
 #include "physicsSolvers/fluidFlow/FlowSolverBaseFields.hpp"
+#include "physicsSolvers/multiphysics/AndersonAcceleration.hpp"
 #include "physicsSolvers/multiphysics/CoupledSolver.hpp"
 #include "physicsSolvers/multiphysics/PoromechanicsFields.hpp"
 #include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEM.hpp"
@@ -395,7 +396,7 @@ public:
 
 protected:
 
-  /* Implementation of Nonlinear Acceleration (Aitken) of averageMeanTotalStressIncrement */
+  /* Implementation of Nonlinear Acceleration (Aitken, Anderson) of averageMeanTotalStressIncrement */
 
   void recordAverageMeanTotalStressIncrement( DomainPartition & domain,
                                               array1d< real64 > & averageMeanTotalStressIncrement )
@@ -420,6 +421,25 @@ protected:
     } );
   }
 
+  void recordOwnedElements( DomainPartition & domain,
+                            array1d< integer > & isOwned )
+  {
+    isOwned.resize( 0 );
+    PhysicsSolverBase::forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                                                                    MeshLevel & mesh,
+                                                                                    arrayView1d< string const > const & regionNames ) {
+      mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                            auto & subRegion ) {
+        // same ordering as in recordAverageMeanTotalStressIncrement
+        arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+        for( localIndex k = 0; k < subRegion.size(); k++ )
+        {
+          isOwned.emplace_back( ghostRank[k] < 0 ? 1 : 0 );
+        }
+      } );
+    } );
+  }
+
   void applyAcceleratedAverageMeanTotalStressIncrement( DomainPartition & domain,
                                                         array1d< real64 > & averageMeanTotalStressIncrement )
   {
@@ -493,6 +513,16 @@ protected:
         m_omega0 = m_omega1;
       }
     }
+    else if( this->getNonlinearSolverParameters().m_nonlinearAccelerationType == NonlinearSolverParameters::NonlinearAccelerationType::Anderson )
+    {
+      if( iter == 0 )
+      {
+        // new time step (or time step cut): the history of the previous outer loop is discarded
+        m_anderson.reset( this->getNonlinearSolverParameters().m_nonlinearAccelerationDepth );
+        recordAverageMeanTotalStressIncrement( domain, m_s1 );
+        recordOwnedElements( domain, m_isOwned );
+      }
+    }
   }
 
   void finishSequentialIteration( integer const & iter,
@@ -512,6 +542,15 @@ protected:
         applyAcceleratedAverageMeanTotalStressIncrement( domain, m_s2 );
       }
     }
+    else if( this->getNonlinearSolverParameters().m_nonlinearAccelerationType == NonlinearSolverParameters::NonlinearAccelerationType::Anderson )
+    {
+      // m_s1 is the input of the outer iteration, m_s2_tilde its (unaccelerated) output
+      m_s1 = m_anderson.accelerate( m_s1.toViewConst(), m_s2_tilde.toViewConst(), m_isOwned.toViewConst() );
+      applyAcceleratedAverageMeanTotalStressIncrement( domain, m_s1 );
+      GEOS_LOG_LEVEL_INFO_RANK_0( logInfo::NonlinearSolver,
+                                  GEOS_FMT( "  Iteration {:2}: Anderson acceleration with {} previous iteration(s)",
+                                            iter + 1, m_anderson.numUsedIterations() ) );
+    }
   }
 
   virtual void mapSolutionBetweenSolvers( DomainPartition & domain, integer const solverType ) override
@@ -563,7 +602,7 @@ protected:
 
     // needed to perform nonlinear acceleration
     if( solverType == static_cast< integer >( SolverType::SolidMechanics ) &&
-        this->getNonlinearSolverParameters().m_nonlinearAccelerationType== NonlinearSolverParameters::NonlinearAccelerationType::Aitken )
+        this->getNonlinearSolverParameters().m_nonlinearAccelerationType != NonlinearSolverParameters::NonlinearAccelerationType::None )
     {
       recordAverageMeanTotalStressIncrement( domain, m_s2_tilde );
     }
@@ -618,9 +657,11 @@ protected:
 
   virtual void validateNonlinearAcceleration() override
   {
-    if( MpiWrapper::commSize( MPI_COMM_GEOS ) > 1 )
+    // the Anderson acceleration uses global reductions, the Aitken acceleration does not
+    if( this->getNonlinearSolverParameters().m_nonlinearAccelerationType == NonlinearSolverParameters::NonlinearAccelerationType::Aitken &&
+        MpiWrapper::commSize( MPI_COMM_GEOS ) > 1 )
     {
-      GEOS_ERROR( "Nonlinear acceleration is not implemented for MPI runs" );
+      GEOS_ERROR( "Aitken nonlinear acceleration is not implemented for MPI runs" );
     }
   }
 
@@ -648,6 +689,12 @@ protected:
   real64 m_omega0; // Old Aitken relaxation factor
   real64 m_omega1; // New Aitken relaxation factor
 
+  /// Anderson acceleration of the averageMeanTotalStressIncrement (the input of the current outer iteration is stored in m_s1)
+  AndersonAcceleration m_anderson;
+
+  /// Flags indicating the locally owned elements, in the order of the averageMeanTotalStressIncrement arrays
+  array1d< integer > m_isOwned;
+
 };
 
 } /* namespace geos */
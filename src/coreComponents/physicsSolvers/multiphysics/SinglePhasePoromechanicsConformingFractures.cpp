@@ -116,6 +116,7 @@ void SinglePhasePoromechanicsConformingFractures< FLOW_SOLVER >::setupSystem( Do
 
   localMatrix.setName( this->getName() + "/matrix" );
   localMatrix.assimilate< parallelDevicePolicy<> >( std::move( pattern ) );
+  this->m_isSparsityPatternModified = true;
 
   rhs.setName( this->getName() + "/rhs" );
   rhs.create( numLocalRows, MPI_COMM_GEOS );
@@ -167,6 +167,7 @@ void SinglePhasePoromechanicsEmbeddedFractures::setupSystem( DomainPartition & d
   // Finally, steal the pattern into a CRS matrix
   localMatrix.setName( this->getName() + "/localMatrix" );
   localMatrix.assimilate< parallelDevicePolicy<> >( std::move( pattern ) );
+  m_isSparsityPatternModified = true;
 
   rhs.setName( this->getName() + "/rhs" );
   rhs.create( dofManager.numLocalDofs(), MPI_COMM_GEOS );
@@ -124,6 +124,7 @@ void LaplaceFEM::setupSystem( DomainPartition & domain,
 
     sparsityPattern.compress();
     localMatrix.assimilate< parallelDevicePolicy<> >( std::move( sparsityPattern ) );
+    m_isSparsityPatternModified = true;
   } );
 }
 
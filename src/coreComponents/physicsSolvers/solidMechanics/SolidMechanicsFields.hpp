@@ -153,6 +153,14 @@ DECLARE_FIELD( contactForce,
                WRITE_AND_READ,
                "Contact force" );
 
+DECLARE_FIELD( matrixFreeDisplacement,
+               "matrixFreeDisplacement",
+               array2dLayoutIncrDisplacement,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Nodal input of the matrix-free stiffness operator" );
+
 }
 
 }
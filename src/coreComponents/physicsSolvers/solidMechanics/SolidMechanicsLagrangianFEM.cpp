@@ -20,8 +20,10 @@
 #define GEOS_DISPATCH_VEM /// enables VEM in FiniteElementDispatch
 
 #include "SolidMechanicsLagrangianFEM.hpp"
+#include "SolidMechanicsMatrixFreeOperator.hpp"
 #include "kernels/ImplicitSmallStrainNewmark.hpp"
 #include "kernels/ImplicitSmallStrainQuasiStatic.hpp"
+#include "kernels/ImplicitSmallStrainMatrixFree.hpp"
 #include "kernels/ExplicitSmallStrain.hpp"
 #include "kernels/ExplicitFiniteStrain.hpp"
 #include "kernels/FixedStressThermoPoromechanics.hpp"
@@ -29,6 +31,7 @@
 #include "codingUtilities/Utilities.hpp"
 #include "constitutive/ConstitutiveManager.hpp"
 #include "common/GEOS_RAJA_Interface.hpp"
+#include "common/Timer.hpp"
 #include "discretizationMethods/NumericalMethodsManager.hpp"
 #include "fieldSpecification/FieldSpecificationManager.hpp"
 #include "fieldSpecification/TractionBoundaryCondition.hpp"
@@ -40,6 +43,10 @@
 #include "mesh/CellElementSubRegion.hpp"
 #include "mesh/mpiCommunications/NeighborCommunicator.hpp"
 #include "fileIO/Outputs/ChomboIO.hpp"
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+#include "linearAlgebra/solvers/PreconditionerChebyshev.hpp"
+#include "linearAlgebra/solvers/PreconditionerIdentity.hpp"
+#include "linearAlgebra/solvers/PreconditionerJacobi.hpp"
 
 namespace geos
 {
@@ -59,6 +66,8 @@ SolidMechanicsLagrangianFEM::SolidMechanicsLagrangianFEM( const string & name,
   m_maxForce( 0.0 ),
   m_maxNumResolves( 10 ),
   m_strainTheory( 0 ),
+  m_useElementColoring( 0 ),
+  m_useMatrixFreeSolver( 0 ),
   m_isFixedStressPoromechanicsUpdate( false )
 {
 
@@ -109,6 +118,22 @@ SolidMechanicsLagrangianFEM::SolidMechanicsLagrangianFEM( const string & name,
                     " 0 - Infinitesimal Strain \n"
                     " 1 - Finite Strain" );
 
+  registerWrapper( viewKeyStruct::useElementColoringString(), &m_useElementColoring ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to color the elements such that elements of the same color do not share a node, and to "
+                    "assemble the nodal forces of the explicit dynamic update one color at a time without atomic operations." );
+
+  registerWrapper( viewKeyStruct::useMatrixFreeSolverString(), &m_useMatrixFreeSolver ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to solve the quasi-static linear systems with a native Krylov solver and a matrix-free "
+                    "stiffness operator applied element by element. Only the diagonal of the Jacobian is assembled. "
+                    "Supported preconditioners are none, jacobi and chebyshev (Chebyshev-Jacobi). "
+                    "Requires an elastic constitutive model." );
+
+  registerUseAssemblyMapsWrapper();
+
   registerWrapper( viewKeyStruct::contactRelationNameString(), &m_contactRelationName ).
     setRTTypeName( rtTypes::CustomTypes::groupNameRef ).
     setApplyDefaultValue( viewKeyStruct::noContactRelationNameString() ).
@@ -137,6 +162,34 @@ void SolidMechanicsLagrangianFEM::postInputInitialization()
   linParams.amg.separateComponents = true;
 
   m_surfaceGenerator = this->getParent().getGroupPointer< PhysicsSolverBase >( m_surfaceGeneratorName );
+
+  if( m_useMatrixFreeSolver )
+  {
+    GEOS_THROW_IF( m_timeIntegrationOption != TimeIntegrationOption::QuasiStatic,
+                   getWrapperDataContext( viewKeyStruct::useMatrixFreeSolverString() ) <<
+                   ": the matrix-free solver is only available with the QuasiStatic time integration option",
+                   InputError );
+    GEOS_THROW_IF( m_contactRelationName != viewKeyStruct::noContactRelationNameString(),
+                   getWrapperDataContext( viewKeyStruct::useMatrixFreeSolverString() ) <<
+                   ": the matrix-free solver cannot be used with a contact relation",
+                   InputError );
+    GEOS_THROW_IF( linParams.solverType == LinearSolverParameters::SolverType::direct ||
+                   linParams.solverType == LinearSolverParameters::SolverType::preconditioner,
+                   getWrapperDataContext( viewKeyStruct::useMatrixFreeSolverString() ) <<
+                   ": the matrix-free solver requires a Krylov linear solver",
+                   InputError );
+    GEOS_THROW_IF( linParams.preconditionerType != LinearSolverParameters::PreconditionerType::none &&
+                   linParams.preconditionerType != LinearSolverParameters::PreconditionerType::jacobi &&
+                   linParams.preconditionerType != LinearSolverParameters::PreconditionerType::chebyshev,
+                   getWrapperDataContext( viewKeyStruct::useMatrixFreeSolverString() ) <<
+                   ": the matrix-free solver only supports the none, jacobi and chebyshev preconditioners",
+                   InputError );
+  }
+
+  GEOS_THROW_IF( m_useAssemblyMaps && m_timeIntegrationOption != TimeIntegrationOption::QuasiStatic,
+                 getWrapperDataContext( PhysicsSolverBase::viewKeyStruct::useAssemblyMapsString() ) <<
+                 ": the assembly maps are only available with the QuasiStatic time integration option",
+                 InputError );
 }
 
 SolidMechanicsLagrangianFEM::~SolidMechanicsLagrangianFEM()
@@ -195,6 +248,12 @@ void SolidMechanicsLagrangianFEM::registerDataOnMesh( Group & meshBodies )
     nodes.registerField< solidMechanics::contactForce >( getName() ).
       reference().resizeDimension< 1 >( 3 );
 
+    if( m_useMatrixFreeSolver )
+    {
+      nodes.registerField< solidMechanics::matrixFreeDisplacement >( getName() ).
+        reference().resizeDimension< 1 >( 3 );
+    }
+
     Group & nodeSets = nodes.sets();
     nodeSets.registerWrapper< SortedArray< localIndex > >( viewKeyStruct::sendOrReceiveNodesString() ).
       setPlotLevel( PlotLevel::NOPLOT ).
@@ -221,8 +280,18 @@ void SolidMechanicsLagrangianFEM::registerDataOnMesh( Group & meshBodies )
         setPlotLevel( PlotLevel::NOPLOT ).
         setRestartFlags( RestartFlags::NO_WRITE );
 
+      subRegion.registerWrapper< ArrayOfArrays< localIndex > >( viewKeyStruct::elemsAttachedToSendOrReceiveNodesByColorString() ).
+        setPlotLevel( PlotLevel::NOPLOT ).
+        setRestartFlags( RestartFlags::NO_WRITE );
+
+      subRegion.registerWrapper< ArrayOfArrays< localIndex > >( viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesByColorString() ).
+        setPlotLevel( PlotLevel::NOPLOT ).
+        setRestartFlags( RestartFlags::NO_WRITE );
+
       subRegion.excludeWrappersFromPacking( { viewKeyStruct::elemsAttachedToSendOrReceiveNodesString(),
-                                              viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesString() } );
+                                              viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesString(),
+                                              viewKeyStruct::elemsAttachedToSendOrReceiveNodesByColorString(),
+                                              viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesByColorString() } );
     } );
   } );
 }
@@ -281,13 +350,14 @@ real64 SolidMechanicsLagrangianFEM::explicitKernelDispatch( MeshLevel & mesh,
                                                             arrayView1d< string const > const & targetRegions,
                                                             string const & finiteElementName,
                                                             real64 const dt,
-                                                            std::string const & elementListName )
+                                                            std::string const & elementListName,
+                                                            std::string const & coloredElementListName )
 {
   GEOS_MARK_FUNCTION;
   real64 rval = 0;
   if( m_strainTheory==0 )
   {
-    auto kernelFactory = solidMechanicsLagrangianFEMKernels::ExplicitSmallStrainFactory( dt, elementListName );
+    auto kernelFactory = solidMechanicsLagrangianFEMKernels::ExplicitSmallStrainFactory( dt, elementListName, coloredElementListName );
     rval = finiteElement::
              regionBasedKernelApplication< parallelDevicePolicy<   >,
                                            constitutive::SolidBase,
@@ -299,7 +369,7 @@ real64 SolidMechanicsLagrangianFEM::explicitKernelDispatch( MeshLevel & mesh,
   }
   else if( m_strainTheory==1 )
   {
-    auto kernelFactory = solidMechanicsLagrangianFEMKernels::ExplicitFiniteStrainFactory( dt, elementListName );
+    auto kernelFactory = solidMechanicsLagrangianFEMKernels::ExplicitFiniteStrainFactory( dt, elementListName, coloredElementListName );
     rval = finiteElement::
              regionBasedKernelApplication< parallelDevicePolicy<   >,
                                            constitutive::SolidBase,
@@ -446,6 +516,27 @@ void SolidMechanicsLagrangianFEM::initializePostInitialConditionsPreSubGroups()
         elemsNotAttachedToSendOrReceiveNodes.insert( tmpElemsNotAttachedToSendOrReceiveNodes.begin(),
                                                      tmpElemsNotAttachedToSendOrReceiveNodes.end() );
 
+        if( m_useElementColoring && m_timeIntegrationOption == TimeIntegrationOption::ExplicitDynamic )
+        {
+          if( elementSubRegion.computeElementColoring( elemsToNodes, nodes.size() ) )
+          {
+            GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "{}: {} element colors in subregion {}",
+                                                getName(), elementSubRegion.numElementColors(), elementSubRegion.getName() ) );
+          }
+          else
+          {
+            GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "{}: no coloring with at most {} colors found for subregion {}, using atomic assembly",
+                                                getName(), ElementSubRegionBase::maxNumElementColors, elementSubRegion.getName() ) );
+          }
+
+          elementSubRegion.groupElementsByColor( elemsAttachedToSendOrReceiveNodes.toViewConst(),
+                                                 elementSubRegion.getReference< ArrayOfArrays< localIndex > >(
+                                                   viewKeyStruct::elemsAttachedToSendOrReceiveNodesByColorString() ) );
+          elementSubRegion.groupElementsByColor( elemsNotAttachedToSendOrReceiveNodes.toViewConst(),
+                                                 elementSubRegion.getReference< ArrayOfArrays< localIndex > >(
+                                                   viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesByColorString() ) );
+        }
+
         m_sendOrReceiveNodes.insert( tmpSendOrReceiveNodes.begin(),
                                      tmpSendOrReceiveNodes.end() );
         m_nonSendOrReceiveNodes.insert( tmpNonSendOrReceiveNodes.begin(),
@@ -626,7 +717,8 @@ real64 SolidMechanicsLagrangianFEM::explicitStep( real64 const & time_n,
                             regionNames,
                             this->getDiscretizationName(),
                             dt,
-                            string( viewKeyStruct::elemsAttachedToSendOrReceiveNodesString() ) );
+                            string( viewKeyStruct::elemsAttachedToSendOrReceiveNodesString() ),
+                            string( viewKeyStruct::elemsAttachedToSendOrReceiveNodesByColorString() ) );
 
     // apply this over a set
     solidMechanicsLagrangianFEMKernels::velocityUpdate( acc, mass, vel, dt / 2, m_sendOrReceiveNodes.toViewConst() );
@@ -646,7 +738,8 @@ real64 SolidMechanicsLagrangianFEM::explicitStep( real64 const & time_n,
                             regionNames,
                             this->getDiscretizationName(),
                             dt,
-                            string( viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesString() ) );
+                            string( viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesString() ),
+                            string( viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesByColorString() ) );
 
     // apply this over a set
     solidMechanicsLagrangianFEMKernels::velocityUpdate( acc, mass, vel, dt / 2, m_nonSendOrReceiveNodes.toViewConst() );
@@ -676,6 +769,12 @@ void SolidMechanicsLagrangianFEM::applyDisplacementBCImplicit( real64 const time
 
   integer isDisplacementBCApplied[3]{};
 
+  arrayView1d< integer > const constrainedDofs = m_matrixFreeConstrainedDofs.toView();
+  if( m_useMatrixFreeSolver )
+  {
+    constrainedDofs.zero();
+  }
+
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                                 MeshLevel & mesh,
                                                                 arrayView1d< string const > const & )
@@ -700,6 +799,30 @@ void SolidMechanicsLagrangianFEM::applyDisplacementBCImplicit( real64 const time
                                                                      localMatrix,
                                                                      localRhs );
 
+      if( m_useMatrixFreeSolver )
+      {
+        // Record the constrained rows, which the matrix-free operator replaces by their diagonal entry
+        arrayView1d< globalIndex const > const dofNumber = targetGroup.getReference< array1d< globalIndex > >( dofKey );
+        arrayView1d< integer const > const ghostRank = targetGroup.ghostRank();
+        globalIndex const rankOffset = dofManager.rankOffset();
+        integer const component = bc.getComponent();
+        forAll< parallelDevicePolicy<> >( targetSet.size(), [=] GEOS_HOST_DEVICE ( localIndex const i )
+        {
+          localIndex const a = targetSet[i];
+          if( ghostRank[a] < 0 )
+          {
+            localIndex const row = LvArray::integerConversion< localIndex >( dofNumber[a] - rankOffset );
+            for( integer c = 0; c < 3; ++c )
+            {
+              if( component < 0 || component == c )
+              {
+                constrainedDofs[row + c] = 1;
+              }
+            }
+          }
+        } );
+      }
+
       if( targetSet.size() > 0 && bc.getComponent() == 0 )
       {
         isDisplacementBCApplied[0] = 1;
@@ -991,7 +1114,26 @@ void SolidMechanicsLagrangianFEM::setupSystem( DomainPartition & domain,
                                                bool const setSparsity )
 {
   GEOS_MARK_FUNCTION;
-  PhysicsSolverBase::setupSystem( domain, dofManager, localMatrix, rhs, solution, setSparsity );
+  PhysicsSolverBase::setupSystem( domain, dofManager, localMatrix, rhs, solution, setSparsity && !m_useMatrixFreeSolver );
+
+  if( m_useMatrixFreeSolver )
+  {
+    // Only the diagonal of the Jacobian is stored: it is assembled along with the residual, and
+    // is used to impose the displacement boundary conditions and to scale the preconditioner
+    localIndex const numLocalDofs = dofManager.numLocalDofs();
+    globalIndex const rankOffset = dofManager.rankOffset();
+    SparsityPattern< globalIndex > diagonalPattern( numLocalDofs, dofManager.numGlobalDofs(), 1 );
+    for( localIndex i = 0; i < numLocalDofs; ++i )
+    {
+      diagonalPattern.insertNonZero( i, rankOffset + i );
+    }
+    localMatrix.assimilate< parallelDevicePolicy<> >( std::move( diagonalPattern ) );
+    m_isSparsityPatternModified = true;
+    m_assemblyMaps.clear();
+
+    m_matrixFreeConstrainedDofs.resize( numLocalDofs );
+    return;
+  }
 
   SparsityPattern< globalIndex > sparsityPattern( dofManager.numLocalDofs(),
                                                   dofManager.numGlobalDofs(),
@@ -1038,6 +1180,7 @@ void SolidMechanicsLagrangianFEM::setupSystem( DomainPartition & domain,
 
   sparsityPattern.compress();
   localMatrix.assimilate< parallelDevicePolicy<> >( std::move( sparsityPattern ) );
+  m_isSparsityPatternModified = true;
 }
 
 void SolidMechanicsLagrangianFEM::assembleSystem( real64 const GEOS_UNUSED_PARAM( time_n ),
@@ -1201,15 +1344,33 @@ SolidMechanicsLagrangianFEM::
 
 real64
 SolidMechanicsLagrangianFEM::
-  calculateResidualNorm( real64 const & GEOS_UNUSED_PARAM( time_n ),
-                         real64 const & GEOS_UNUSED_PARAM( dt ),
+  calculateResidualNorm( real64 const & time_n,
+                         real64 const & dt,
                          DomainPartition const & domain,
                          DofManager const & dofManager,
                          arrayView1d< real64 const > const & localRhs )
+{
+  physicsSolverBaseKernels::ResidualNormReduction reduction;
+  std::function< real64() > const residualNorm =
+    SolidMechanicsLagrangianFEM::calculateLocalResidualNorm( time_n, dt, domain, dofManager, localRhs, reduction );
+  reduction.reduce();
+  return residualNorm();
+}
+
+std::function< real64() >
+SolidMechanicsLagrangianFEM::
+  calculateLocalResidualNorm( real64 const & GEOS_UNUSED_PARAM( time_n ),
+                              real64 const & GEOS_UNUSED_PARAM( dt ),
+                              DomainPartition const & domain,
+                              DofManager const & dofManager,
+                              arrayView1d< real64 const > const & localRhs,
+                              physicsSolverBaseKernels::ResidualNormReduction & reduction )
 {
   GEOS_MARK_FUNCTION;
 
-  real64 totalResidualNorm = 0.0;
+  // indices of the sum of rhs^2 and of the max force of each mesh target in the reduction
+  array1d< integer > sumIndices;
+  array1d< integer > maxIndices;
 
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                                 MeshLevel const & mesh,
@@ -1242,48 +1403,28 @@ SolidMechanicsLagrangianFEM::
         }
       }
     } );
-    real64 const localResidualNorm[2] = { localSum.get(), m_maxForce };
-
-    // globalResidualNorm[0]: the sum of all the local sum(rhs^2).
-    // globalResidualNorm[1]: max of max force of each rank. Basically max force globally
-    real64 globalResidualNorm[2] = {0, 0};
-
-    int const rank = MpiWrapper::commRank( MPI_COMM_GEOS );
-    int const size = MpiWrapper::commSize( MPI_COMM_GEOS );
-    array1d< real64 > globalValues( size * 2 );
-
-    // Everything is done on rank 0
-    MpiWrapper::gather( localResidualNorm,
-                        2,
-                        globalValues.data(),
-                        2,
-                        0,
-                        MPI_COMM_GEOS );
+    // the sum of all the local sum(rhs^2), and the max of max force of each rank. Basically max force globally
+    sumIndices.emplace_back( reduction.addSum( localSum.get() ) );
+    maxIndices.emplace_back( reduction.addMax( m_maxForce ) );
+  } );
 
-    if( rank==0 )
+  return [this, &reduction, sumIndices, maxIndices]()
+  {
+    real64 totalResidualNorm = 0.0;
+    for( localIndex i = 0; i < sumIndices.size(); ++i )
     {
-      for( int r=0; r<size; ++r )
-      {
-        // sum/max across all ranks
-        globalResidualNorm[0] += globalValues[r*2];
-        globalResidualNorm[1] = std::max( globalResidualNorm[1], globalValues[r*2+1] );
-      }
+      real64 const residual = sqrt( reduction.globalSum( sumIndices[i] ) ) / ( reduction.globalMax( maxIndices[i] ) + 1 ); // the + 1 is for the first
+                                                                                                                           // time-step when maxForce = 0;
+      totalResidualNorm = std::max( residual, totalResidualNorm );
     }
 
-    MpiWrapper::bcast( globalResidualNorm, 2, 0, MPI_COMM_GEOS );
-
-
-    real64 const residual = sqrt( globalResidualNorm[0] ) / ( globalResidualNorm[1] + 1 ); // the + 1 is for the first
-                                                                                           // time-step when maxForce = 0;
-    totalResidualNorm = std::max( residual, totalResidualNorm );
-  } );
-
-  if( getLogLevel() >= 1 && logger::internal::rank==0 )
-  {
-    std::cout << GEOS_FMT( "        ( R{} ) = ( {:4.2e} )", coupledSolverAttributePrefix(), totalResidualNorm );
-  }
+    if( getLogLevel() >= 1 && logger::internal::rank==0 )
+    {
+      std::cout << GEOS_FMT( "        ( R{} ) = ( {:4.2e} )", coupledSolverAttributePrefix(), totalResidualNorm );
+    }
 
-  return totalResidualNorm;
+    return totalResidualNorm;
+  };
 }
 
 void
@@ -1323,6 +1464,132 @@ SolidMechanicsLagrangianFEM::applySystemSolution( DofManager const & dofManager,
   } );
 }
 
+void SolidMechanicsLagrangianFEM::solveLinearSystem( DofManager const & dofManager,
+                                                     ParallelMatrix & matrix,
+                                                     ParallelVector & rhs,
+                                                     ParallelVector & solution )
+{
+  if( !m_useMatrixFreeSolver )
+  {
+    PhysicsSolverBase::solveLinearSystem( dofManager, matrix, rhs, solution );
+    return;
+  }
+
+  GEOS_MARK_FUNCTION;
+
+  rhs.scale( -1.0 );
+  solution.zero();
+
+  LinearSolverParameters const & params = m_linearSolverParameters.get();
+  DomainPartition & domain = this->getGroupByPath< DomainPartition >( "/Problem/domain" );
+
+  // In matrix-free mode, the assembled matrix only holds the diagonal of the Jacobian
+  ParallelVector diagonal;
+  diagonal.create( dofManager.numLocalDofs(), MPI_COMM_GEOS );
+  matrix.extractDiagonal( diagonal );
+
+  SolidMechanicsMatrixFreeOperator const stiffness( *this,
+                                                    domain,
+                                                    dofManager,
+                                                    diagonal,
+                                                    m_matrixFreeConstrainedDofs.toViewConst() );
+  stiffness.liftConstraints( rhs );
+
+  std::unique_ptr< LinearOperator< ParallelVector > > precond;
+  {
+    Timer timer_setup( m_timers["linear solver setup"] );
+    switch( params.preconditionerType )
+    {
+      case LinearSolverParameters::PreconditionerType::none:
+      {
+        auto identity = std::make_unique< PreconditionerIdentity< LAInterface > >();
+        identity->setup( matrix );
+        precond = std::move( identity );
+        break;
+      }
+      case LinearSolverParameters::PreconditionerType::jacobi:
+      {
+        auto jacobi = std::make_unique< PreconditionerJacobi< LAInterface > >();
+        jacobi->setup( matrix );
+        precond = std::move( jacobi );
+        break;
+      }
+      case LinearSolverParameters::PreconditionerType::chebyshev:
+      {
+        precond = std::make_unique< PreconditionerChebyshev< ParallelVector > >( stiffness, diagonal, params.chebyshev );
+        break;
+      }
+      default:
+      {
+        GEOS_ERROR( getDataContext() << ": preconditioner type not supported by the matrix-free solver" );
+      }
+    }
+  }
+
+  std::unique_ptr< KrylovSolver< ParallelVector > > solver = KrylovSolver< ParallelVector >::create( params, stiffness, *precond );
+  {
+    Timer timer_solve( m_timers["linear solver solve"] );
+    solver->solve( rhs, solution );
+  }
+  m_linearSolverResult = solver->result();
+
+  GEOS_LOG_LEVEL_INFO_RANK_0( logInfo::LinearSolver, GEOS_FMT( "        Last LinSolve(iter,res) = ( {:3}, {:4.2e} )",
+                                                               m_linearSolverResult.numIterations,
+                                                               m_linearSolverResult.residualReduction ) );
+
+  if( params.stopIfError )
+  {
+    GEOS_ERROR_IF( m_linearSolverResult.breakdown(), getDataContext() << ": Linear solution breakdown -> simulation STOP" );
+  }
+  else
+  {
+    GEOS_WARNING_IF( !m_linearSolverResult.success(), getDataContext() << ": Linear solution failed" );
+  }
+}
+
+void SolidMechanicsLagrangianFEM::applyMatrixFreeStiffness( DomainPartition & domain,
+                                                            DofManager const & dofManager,
+                                                            arrayView1d< real64 const > const & src,
+                                                            arrayView1d< real64 > const & dst ) const
+{
+  GEOS_MARK_FUNCTION;
+
+  dst.zero();
+  dofManager.copyVectorToField( src,
+                                solidMechanics::totalDisplacement::key(),
+                                solidMechanics::matrixFreeDisplacement::key(),
+                                1.0 );
+
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                MeshLevel & mesh,
+                                                                arrayView1d< string const > const & regionNames )
+  {
+    FieldIdentifiers fieldsToBeSync;
+    fieldsToBeSync.addFields( FieldLocation::Node, { solidMechanics::matrixFreeDisplacement::key() } );
+    CommunicationTools::getInstance().synchronizeFields( fieldsToBeSync,
+                                                         mesh,
+                                                         domain.getNeighbors(),
+                                                         true );
+
+    NodeManager const & nodeManager = mesh.getNodeManager();
+    string const dofKey = dofManager.getKey( solidMechanics::totalDisplacement::key() );
+    arrayView1d< globalIndex const > const dofNumber = nodeManager.getReference< globalIndex_array >( dofKey );
+
+    solidMechanicsLagrangianFEMKernels::MatrixFreeFactory kernelFactory( dofNumber,
+                                                                         dofManager.rankOffset(),
+                                                                         dst );
+
+    finiteElement::
+      regionBasedKernelApplication< parallelDevicePolicy< >,
+                                    constitutive::SolidBase,
+                                    CellElementSubRegion >( mesh,
+                                                            regionNames,
+                                                            this->getDiscretizationName(),
+                                                            viewKeyStruct::solidMaterialNamesString(),
+                                                            kernelFactory );
+  } );
+}
+
 void SolidMechanicsLagrangianFEM::resetStateToBeginningOfStep( DomainPartition & domain )
 {
   GEOS_MARK_FUNCTION;
@@ -1473,6 +1740,10 @@ SolidMechanicsLagrangianFEM::scalingForSystemSolution( DomainPartition & domain,
 
 void SolidMechanicsLagrangianFEM::enableFixedStressPoromechanicsUpdate()
 {
+  GEOS_THROW_IF( m_useMatrixFreeSolver,
+                 getWrapperDataContext( viewKeyStruct::useMatrixFreeSolverString() ) <<
+                 ": the matrix-free solver cannot be used in a fixed-stress poromechanics coupling",
+                 InputError );
   m_isFixedStressPoromechanicsUpdate = true;
 }
 
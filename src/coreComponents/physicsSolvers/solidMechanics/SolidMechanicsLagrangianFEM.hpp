@@ -155,6 +155,12 @@ public:
                                         CRSMatrixView< real64, globalIndex const > const & localMatrix,
                                         arrayView1d< real64 > const & localRhs ) override;
 
+  virtual void
+  solveLinearSystem( DofManager const & dofManager,
+                     ParallelMatrix & matrix,
+                     ParallelVector & rhs,
+                     ParallelVector & solution ) override;
+
   virtual real64
   calculateResidualNorm( real64 const & time_n,
                          real64 const & dt,
@@ -162,6 +168,14 @@ public:
                          DofManager const & dofManager,
                          arrayView1d< real64 const > const & localRhs ) override;
 
+  virtual std::function< real64() >
+  calculateLocalResidualNorm( real64 const & time_n,
+                              real64 const & dt,
+                              DomainPartition const & domain,
+                              DofManager const & dofManager,
+                              arrayView1d< real64 const > const & localRhs,
+                              physicsSolverBaseKernels::ResidualNormReduction & reduction ) override;
+
   virtual void resetStateToBeginningOfStep( DomainPartition & domain ) override;
 
   virtual void implicitStepComplete( real64 const & time,
@@ -184,12 +198,27 @@ public:
                          PARAMS && ... params );
 
 
+  /**
+   * @brief Apply the quasi-static Jacobian to a vector without assembling it.
+   * @param domain The DomainPartition.
+   * @param dofManager degree-of-freedom manager associated with the linear system
+   * @param src the local part of the input vector
+   * @param dst the local part of the output vector
+   *
+   * Boundary conditions are not accounted for (see SolidMechanicsMatrixFreeOperator).
+   */
+  void applyMatrixFreeStiffness( DomainPartition & domain,
+                                 DofManager const & dofManager,
+                                 arrayView1d< real64 const > const & src,
+                                 arrayView1d< real64 > const & dst ) const;
+
   template< typename ... PARAMS >
   real64 explicitKernelDispatch( MeshLevel & mesh,
                                  arrayView1d< string const > const & targetRegions,
                                  string const & finiteElementName,
                                  real64 const dt,
-                                 std::string const & elementListName );
+                                 std::string const & elementListName,
+                                 std::string const & coloredElementListName );
 
   /**
    * Applies displacement boundary conditions to the system for implicit time integration
@@ -239,12 +268,16 @@ public:
     static constexpr char const * timeIntegrationOptionString() { return "timeIntegrationOption"; }
     static constexpr char const * maxNumResolvesString() { return "maxNumResolves"; }
     static constexpr char const * strainTheoryString() { return "strainTheory"; }
+    static constexpr char const * useElementColoringString() { return "useElementColoring"; }
+    static constexpr char const * useMatrixFreeSolverString() { return "useMatrixFreeSolver"; }
     static constexpr char const * solidMaterialNamesString() { return "solidMaterialNames"; }
     static constexpr char const * contactRelationNameString() { return "contactRelationName"; }
     static constexpr char const * noContactRelationNameString() { return "NOCONTACT"; }
     static constexpr char const * maxForceString() { return "maxForce"; }
     static constexpr char const * elemsAttachedToSendOrReceiveNodesString() { return "elemsAttachedToSendOrReceiveNodes"; }
     static constexpr char const * elemsNotAttachedToSendOrReceiveNodesString() { return "elemsNotAttachedToSendOrReceiveNodes"; }
+    static constexpr char const * elemsAttachedToSendOrReceiveNodesByColorString() { return "elemsAttachedToSendOrReceiveNodesByColor"; }
+    static constexpr char const * elemsNotAttachedToSendOrReceiveNodesByColorString() { return "elemsNotAttachedToSendOrReceiveNodesByColor"; }
     static constexpr char const * surfaceGeneratorNameString() { return "surfaceGeneratorName"; }
 
     static constexpr char const * sendOrReceiveNodesString() { return "sendOrReceiveNodes";}
@@ -294,6 +327,10 @@ protected:
   real64 m_maxForce = 0.0;
   integer m_maxNumResolves;
   integer m_strainTheory;
+  integer m_useElementColoring;
+  integer m_useMatrixFreeSolver;
+  /// Flags identifying the local rows constrained by a displacement boundary condition (matrix-free solver only)
+  array1d< integer > m_matrixFreeConstrainedDofs;
 //  MPI_iCommData m_iComm;
   bool m_isFixedStressPoromechanicsUpdate;
 
@@ -349,6 +386,20 @@ real64 SolidMechanicsLagrangianFEM::assemblyLaunch( MeshLevel & mesh,
                                 gravityVectorData,
                                 std::forward< PARAMS >( params )... );
 
+  std::map< string, AssemblyMap > * const assemblyMaps = getAssemblyMaps();
+  if( assemblyMaps != nullptr )
+  {
+    finiteElement::AssemblyMapKernelFactory< KERNEL_WRAPPER > assemblyMapKernelWrapper( kernelWrapper, *assemblyMaps );
+    return finiteElement::
+             regionBasedKernelApplication< parallelDevicePolicy< >,
+                                           CONSTITUTIVE_BASE,
+                                           CellElementSubRegion >( mesh,
+                                                                   regionNames,
+                                                                   this->getDiscretizationName(),
+                                                                   materialNamesString,
+                                                                   assemblyMapKernelWrapper );
+  }
+
   return finiteElement::
            regionBasedKernelApplication< parallelDevicePolicy< >,
                                          CONSTITUTIVE_BASE,
@@ -0,0 +1,134 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolidMechanicsMatrixFreeOperator.cpp
+ */
+
+#include "SolidMechanicsMatrixFreeOperator.hpp"
+
+#include "common/GEOS_RAJA_Interface.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEM.hpp"
+
+namespace geos
+{
+
+SolidMechanicsMatrixFreeOperator::SolidMechanicsMatrixFreeOperator( SolidMechanicsLagrangianFEM const & solver,
+                                                                    DomainPartition & domain,
+                                                                    DofManager const & dofManager,
+                                                                    ParallelVector const & diagonal,
+                                                                    arrayView1d< integer const > const & constrainedDofs )
+  : LinearOperator< ParallelVector >(),
+  m_solver( solver ),
+  m_domain( domain ),
+  m_dofManager( dofManager ),
+  m_diagonal( diagonal ),
+  m_constrainedDofs( constrainedDofs )
+{
+  GEOS_ERROR_IF_NE( m_constrainedDofs.size(), m_diagonal.localSize() );
+  m_maskedInput.create( m_diagonal.localSize(), m_diagonal.comm() );
+}
+
+void SolidMechanicsMatrixFreeOperator::apply( ParallelVector const & src,
+                                              ParallelVector & dst ) const
+{
+  GEOS_MARK_FUNCTION;
+
+  arrayView1d< integer const > const constrainedDofs = m_constrainedDofs;
+  arrayView1d< real64 const > const srcValues = src.values();
+  arrayView1d< real64 const > const diagonal = m_diagonal.values();
+
+  // Eliminate the constrained columns
+  arrayView1d< real64 > const maskedValues = m_maskedInput.open();
+  forAll< parallelDevicePolicy<> >( maskedValues.size(), [=] GEOS_HOST_DEVICE ( localIndex const i )
+  {
+    maskedValues[i] = constrainedDofs[i] ? 0.0 : srcValues[i];
+  } );
+  m_maskedInput.close();
+
+  arrayView1d< real64 > const dstValues = dst.open();
+  m_solver.applyMatrixFreeStiffness( m_domain, m_dofManager, m_maskedInput.values(), dstValues );
+
+  // Replace the constrained rows by their diagonal entry
+  forAll< parallelDevicePolicy<> >( dstValues.size(), [=] GEOS_HOST_DEVICE ( localIndex const i )
+  {
+    if( constrainedDofs[i] )
+    {
+      dstValues[i] = diagonal[i] * srcValues[i];
+    }
+  } );
+  dst.close();
+}
+
+void SolidMechanicsMatrixFreeOperator::liftConstraints( ParallelVector & rhs ) const
+{
+  GEOS_MARK_FUNCTION;
+
+  arrayView1d< integer const > const constrainedDofs = m_constrainedDofs;
+  arrayView1d< real64 const > const diagonal = m_diagonal.values();
+
+  // Prescribed solution increments on the constrained rows, zero elsewhere
+  arrayView1d< real64 const > const rhsValues = rhs.values();
+  arrayView1d< real64 > const liftValues = m_maskedInput.open();
+  forAll< parallelDevicePolicy<> >( liftValues.size(), [=] GEOS_HOST_DEVICE ( localIndex const i )
+  {
+    liftValues[i] = constrainedDofs[i] ? rhsValues[i] / diagonal[i] : 0.0;
+  } );
+  m_maskedInput.close();
+
+  ParallelVector lifted;
+  lifted.create( rhs.localSize(), rhs.comm() );
+  arrayView1d< real64 > const liftedValues = lifted.open();
+  m_solver.applyMatrixFreeStiffness( m_domain, m_dofManager, m_maskedInput.values(), liftedValues );
+  lifted.close();
+
+  arrayView1d< real64 const > const columnValues = lifted.values();
+  arrayView1d< real64 > const localRhs = rhs.open();
+  forAll< parallelDevicePolicy<> >( localRhs.size(), [=] GEOS_HOST_DEVICE ( localIndex const i )
+  {
+    if( !constrainedDofs[i] )
+    {
+      localRhs[i] -= columnValues[i];
+    }
+  } );
+  rhs.close();
+}
+
+globalIndex SolidMechanicsMatrixFreeOperator::numGlobalRows() const
+{
+  return m_diagonal.globalSize();
+}
+
+globalIndex SolidMechanicsMatrixFreeOperator::numGlobalCols() const
+{
+  return m_diagonal.globalSize();
+}
+
+localIndex SolidMechanicsMatrixFreeOperator::numLocalRows() const
+{
+  return m_diagonal.localSize();
+}
+
+localIndex SolidMechanicsMatrixFreeOperator::numLocalCols() const
+{
+  return m_diagonal.localSize();
+}
+
+MPI_Comm SolidMechanicsMatrixFreeOperator::comm() const
+{
+  return m_diagonal.comm();
+}
+
+} // namespace geos
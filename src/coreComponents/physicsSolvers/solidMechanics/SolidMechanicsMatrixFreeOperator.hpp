@@ -0,0 +1,111 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolidMechanicsMatrixFreeOperator.hpp
+ */
+
+#ifndef GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSMATRIXFREEOPERATOR_HPP_
+#define GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSMATRIXFREEOPERATOR_HPP_
+
+#include "linearAlgebra/common/LinearOperator.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+
+namespace geos
+{
+
+class DofManager;
+class DomainPartition;
+class SolidMechanicsLagrangianFEM;
+
+/**
+ * @class SolidMechanicsMatrixFreeOperator
+ *
+ * Linear operator applying the quasi-static Jacobian of SolidMechanicsLagrangianFEM
+ * element by element, without assembling it (see ImplicitSmallStrainMatrixFree).
+ *
+ * Rows constrained by a displacement boundary condition are replaced by their
+ * diagonal entry, and the corresponding columns are eliminated, so that the
+ * operator remains symmetric and can be used with CG. The contribution of the
+ * eliminated columns must be moved to the right-hand side with liftConstraints()
+ * before solving.
+ */
+class SolidMechanicsMatrixFreeOperator : public LinearOperator< ParallelVector >
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param solver the solid mechanics solver providing the element kernels
+   * @param domain the domain partition
+   * @param dofManager the degree-of-freedom manager associated with the linear system
+   * @param diagonal the diagonal of the Jacobian, including the boundary conditions
+   * @param constrainedDofs flags identifying the local rows constrained by a displacement boundary condition
+   *
+   * All arguments must outlive the operator.
+   */
+  SolidMechanicsMatrixFreeOperator( SolidMechanicsLagrangianFEM const & solver,
+                                    DomainPartition & domain,
+                                    DofManager const & dofManager,
+                                    ParallelVector const & diagonal,
+                                    arrayView1d< integer const > const & constrainedDofs );
+
+  /**
+   * @brief Apply the operator to a vector, <tt>dst = A * src</tt>.
+   * @param src input vector
+   * @param dst output vector
+   */
+  virtual void apply( ParallelVector const & src, ParallelVector & dst ) const override;
+
+  /**
+   * @brief Move the contribution of the prescribed displacements to the right-hand side.
+   * @param rhs the right-hand side, whose constrained rows hold the diagonal times the prescribed increment
+   */
+  void liftConstraints( ParallelVector & rhs ) const;
+
+  virtual globalIndex numGlobalRows() const override;
+
+  virtual globalIndex numGlobalCols() const override;
+
+  virtual localIndex numLocalRows() const override;
+
+  virtual localIndex numLocalCols() const override;
+
+  virtual MPI_Comm comm() const override;
+
+private:
+
+  /// The solid mechanics solver
+  SolidMechanicsLagrangianFEM const & m_solver;
+
+  /// The domain partition
+  DomainPartition & m_domain;
+
+  /// The degree-of-freedom manager
+  DofManager const & m_dofManager;
+
+  /// The diagonal of the Jacobian
+  ParallelVector const & m_diagonal;
+
+  /// Flags identifying the constrained local rows
+  arrayView1d< integer const > const m_constrainedDofs;
+
+  /// Work vector holding the input with eliminated constrained entries
+  mutable ParallelVector m_maskedInput;
+};
+
+} // namespace geos
+
+#endif // GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSMATRIXFREEOPERATOR_HPP_
@@ -85,7 +85,8 @@ public:
                         FE_TYPE const & finiteElementSpace,
                         CONSTITUTIVE_TYPE & inputConstitutiveType,
                         real64 const dt,
-                        string const elementListName );
+                        string const elementListName,
+                        string const coloredElementListName );
 
 
   //*****************************************************************************
@@ -145,6 +146,7 @@ public:
 /// The factory used to construct a ExplicitFiniteStrain kernel.
 using ExplicitFiniteStrainFactory = finiteElement::KernelFactory< ExplicitFiniteStrain,
                                                                   real64,
+                                                                  string const,
                                                                   string const >;
 
 } // namespace solidMechanicsLagrangianFEMKernels
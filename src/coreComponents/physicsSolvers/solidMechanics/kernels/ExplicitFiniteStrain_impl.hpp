@@ -42,7 +42,8 @@ ExplicitFiniteStrain< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::ExplicitFini
                                                                                           FE_TYPE const & finiteElementSpace,
                                                                                           CONSTITUTIVE_TYPE & inputConstitutiveType,
                                                                                           real64 const dt,
-                                                                                          string const elementListName ):
+                                                                                          string const elementListName,
+                                                                                          string const coloredElementListName ):
   Base( nodeManager,
         edgeManager,
         faceManager,
@@ -51,7 +52,8 @@ ExplicitFiniteStrain< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::ExplicitFini
         finiteElementSpace,
         inputConstitutiveType,
         dt,
-        elementListName )
+        elementListName,
+        coloredElementListName )
 {}
 
 template< typename SUBREGION_TYPE,
@@ -97,6 +97,9 @@ public:
    * @param dt The time interval for the step.
    * @param elementListName The name of the entry that holds the list of
    *   elements to be processed during this kernel launch.
+   * @param coloredElementListName The name of the entry that holds the same
+   *   elements grouped by color. If it is not empty, the elements are processed
+   *   one color at a time without atomic operations.
    */
   ExplicitSmallStrain( NodeManager & nodeManager,
                        EdgeManager const & edgeManager,
@@ -106,7 +109,8 @@ public:
                        FE_TYPE const & finiteElementSpace,
                        CONSTITUTIVE_TYPE & inputConstitutiveType,
                        real64 const dt,
-                       string const elementListName );
+                       string const elementListName,
+                       string const coloredElementListName );
 
   //*****************************************************************************
   /**
@@ -180,7 +184,8 @@ public:
    *
    * ### ExplicitSmallStrain Description
    * Copy of the KernelBase::kernelLaunch function without the exclusion of ghost
-   * elements.
+   * elements. If the colored element list is not empty, the launch is done
+   * through KernelBase::kernelLaunchColored.
    */
   template< typename POLICY,
             typename KERNEL_TYPE >
@@ -209,6 +214,9 @@ protected:
   /// The list of elements to process for the kernel launch.
   SortedArrayView< localIndex const > const m_elementList;
 
+  /// The list of elements to process grouped by color (empty if not colored).
+  ArrayOfArraysView< localIndex const > const m_elementListByColor;
+
 
 };
 
@@ -217,6 +225,7 @@ protected:
 /// The factory used to construct a ExplicitSmallStrain kernel.
 using ExplicitSmallStrainFactory = finiteElement::KernelFactory< ExplicitSmallStrain,
                                                                  real64,
+                                                                 string const,
                                                                  string const >;
 
 
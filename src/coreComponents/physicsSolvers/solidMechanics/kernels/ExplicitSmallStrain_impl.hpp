@@ -43,7 +43,8 @@ ExplicitSmallStrain< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::ExplicitSmall
                                                                                         FE_TYPE const & finiteElementSpace,
                                                                                         CONSTITUTIVE_TYPE & inputConstitutiveType,
                                                                                         real64 const dt,
-                                                                                        string const elementListName ):
+                                                                                        string const elementListName,
+                                                                                        string const coloredElementListName ):
   Base( elementSubRegion,
         finiteElementSpace,
         inputConstitutiveType ),
@@ -52,7 +53,8 @@ ExplicitSmallStrain< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::ExplicitSmall
   m_vel( nodeManager.getField< fields::solidMechanics::velocity >() ),
   m_acc( nodeManager.getField< fields::solidMechanics::acceleration >() ),
   m_dt( dt ),
-  m_elementList( elementSubRegion.template getReference< SortedArray< localIndex > >( elementListName ).toViewConst() )
+  m_elementList( elementSubRegion.template getReference< SortedArray< localIndex > >( elementListName ).toViewConst() ),
+  m_elementListByColor( elementSubRegion.template getReference< ArrayOfArrays< localIndex > >( coloredElementListName ).toViewConst() )
 {
   GEOS_UNUSED_VAR( edgeManager );
   GEOS_UNUSED_VAR( faceManager );
@@ -170,7 +172,7 @@ real64 ExplicitSmallStrain< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::comple
     localIndex const nodeIndex = m_elemsToNodes( k, a );
     for( int b = 0; b < numDofPerTestSupportPoint; ++b )
     {
-      RAJA::atomicAdd< parallelDeviceAtomic >( &m_acc( nodeIndex, b ), stack.fLocal[ a ][ b ] );
+      Base::assemblyAdd( m_acc( nodeIndex, b ), stack.fLocal[ a ][ b ] );
     }
   }
   return 0;
@@ -189,6 +191,11 @@ ExplicitSmallStrain< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::kernelLaunch(
 
   GEOS_UNUSED_VAR( numElems );
 
+  if( kernelComponent.m_elementListByColor.size() > 0 )
+  {
+    return Base::template kernelLaunchColored< POLICY, KERNEL_TYPE >( kernelComponent.m_elementListByColor, kernelComponent );
+  }
+
   localIndex const numProcElems = kernelComponent.m_elementList.size();
   forAll< POLICY >( numProcElems,
                     [=] GEOS_DEVICE ( localIndex const index )
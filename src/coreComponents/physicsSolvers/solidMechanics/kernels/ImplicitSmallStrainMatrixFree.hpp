@@ -0,0 +1,233 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file ImplicitSmallStrainMatrixFree.hpp
+ */
+
+#ifndef GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_IMPLICITSMALLSTRAINMATRIXFREE_HPP_
+#define GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_IMPLICITSMALLSTRAINMATRIXFREE_HPP_
+
+#include "finiteElement/kernelInterface/KernelBase.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsFields.hpp"
+
+namespace geos
+{
+
+namespace solidMechanicsLagrangianFEMKernels
+{
+
+/**
+ * @brief Implements the matrix-free application of the quasi-static stiffness operator.
+ * @copydoc geos::finiteElement::KernelBase
+ *
+ * ### MatrixFree Description
+ * Computes the product of the quasi-static Jacobian assembled by
+ * ImplicitSmallStrainQuasiStatic with the nodal vector stored in the
+ * fields::solidMechanics::matrixFreeDisplacement field, element by element and
+ * without forming the matrix. At each quadrature point the strain of the input
+ * vector is computed with the finite element gradients, the stress is obtained
+ * with the elastic stiffness of the constitutive model, and the divergence of
+ * the stress is scattered to the locally owned rows of the output vector.
+ *
+ * Since the elastic stiffness is used, the operator is only exact for the
+ * elastic constitutive models (for other models,
+ * constitutive::SolidBaseUpdates::getElasticStiffness raises an error).
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class ImplicitSmallStrainMatrixFree :
+  public finiteElement::KernelBase< SUBREGION_TYPE,
+                                    CONSTITUTIVE_TYPE,
+                                    FE_TYPE,
+                                    3,
+                                    3 >
+{
+public:
+  /// Alias for the base class;
+  using Base = finiteElement::KernelBase< SUBREGION_TYPE,
+                                          CONSTITUTIVE_TYPE,
+                                          FE_TYPE,
+                                          3,
+                                          3 >;
+
+  /// Maximum number of nodes per element, which is equal to the maxNumTestSupportPointPerElem and
+  /// maxNumTrialSupportPointPerElem by definition. When the FE_TYPE is not a Virtual Element, this
+  /// will be the actual number of nodes per element.
+  static constexpr int numNodesPerElem = Base::maxNumTestSupportPointsPerElem;
+  using Base::numDofPerTestSupportPoint;
+  using Base::numDofPerTrialSupportPoint;
+  using Base::m_elemsToNodes;
+  using Base::m_constitutiveUpdate;
+  using Base::m_finiteElementSpace;
+
+  /**
+   * @brief Constructor
+   * @param nodeManager Reference to the NodeManager object.
+   * @param edgeManager Reference to the EdgeManager object.
+   * @param faceManager Reference to the FaceManager object.
+   * @param targetRegionIndex Index of the region the subregion belongs to.
+   * @param elementSubRegion Reference to the SUBREGION_TYPE(class template
+   *                         parameter) object.
+   * @param finiteElementSpace Placeholder for the finite element space object,
+   *                           which currently doesn't do much.
+   * @param inputConstitutiveType The constitutive object.
+   * @param inputDofNumber The dof number for the primary field.
+   * @param rankOffset dof index offset of current rank
+   * @param inputDst The local part of the output vector.
+   */
+  ImplicitSmallStrainMatrixFree( NodeManager const & nodeManager,
+                                 EdgeManager const & edgeManager,
+                                 FaceManager const & faceManager,
+                                 localIndex const targetRegionIndex,
+                                 SUBREGION_TYPE const & elementSubRegion,
+                                 FE_TYPE const & finiteElementSpace,
+                                 CONSTITUTIVE_TYPE & inputConstitutiveType,
+                                 arrayView1d< globalIndex const > const inputDofNumber,
+                                 globalIndex const rankOffset,
+                                 arrayView1d< real64 > const inputDst );
+
+  //*****************************************************************************
+  /**
+   * @class StackVariables
+   * @copydoc geos::finiteElement::KernelBase::StackVariables
+   *
+   * Adds stack arrays for the element local input and output vectors.
+   */
+  struct StackVariables : public Base::StackVariables
+  {
+public:
+
+    /// Constructor.
+    GEOS_HOST_DEVICE
+    StackVariables():
+      xLocal(),
+      srcLocal{ {0.0} },
+      dstLocal{ {0.0} },
+      localRowDofIndex{ 0 },
+      numSupportPoints( 0 )
+    {}
+
+#if !defined(CALC_FEM_SHAPE_IN_KERNEL)
+    /// Dummy
+    int xLocal;
+#else
+    /// C-array stack storage for element local the nodal positions.
+    real64 xLocal[ numNodesPerElem ][ 3 ];
+#endif
+
+    /// Stack storage for the element local input vector
+    real64 srcLocal[numNodesPerElem][numDofPerTrialSupportPoint];
+
+    /// Stack storage for the element local output vector
+    real64 dstLocal[numNodesPerElem][numDofPerTestSupportPoint];
+
+    /// Stack storage for the first global dof index of each element node
+    globalIndex localRowDofIndex[numNodesPerElem];
+
+    /// The actual number of support points of the element
+    localIndex numSupportPoints;
+
+    /// Stack variables needed for the underlying FEM type
+    typename FE_TYPE::StackVariables feStack;
+  };
+  //*****************************************************************************
+
+  /**
+   * @brief Copy global values from the input vector to a local stack array.
+   * @copydoc ::geos::finiteElement::KernelBase::setup
+   *
+   * The stabilization term of virtual elements, which only depends on the
+   * element, is also applied here.
+   */
+  GEOS_HOST_DEVICE
+  void setup( localIndex const k,
+              StackVariables & stack ) const;
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::quadraturePointKernel
+   *
+   * The strain of the input vector is mapped to a stress with the elastic
+   * stiffness, which is then integrated against the basis function gradients.
+   */
+  GEOS_HOST_DEVICE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack ) const;
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::complete
+   *
+   * The element contributions are added to the locally owned rows of the output vector.
+   */
+  GEOS_HOST_DEVICE
+  inline
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const;
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::kernelLaunch
+   */
+  template< typename POLICY,
+            typename KERNEL_TYPE >
+  static real64
+  kernelLaunch( localIndex const numElems,
+                KERNEL_TYPE const & kernelComponent );
+
+protected:
+  /// The array containing the nodal position array.
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const m_X;
+
+  /// The rank-global input vector, stored as a nodal field.
+  arrayView2d< real64 const, nodes::INCR_DISPLACEMENT_USD > const m_src;
+
+  /// The global degree of freedom number
+  arrayView1d< globalIndex const > const m_dofNumber;
+
+  /// The global rank offset
+  globalIndex const m_dofRankOffset;
+
+  /// The local part of the output vector.
+  arrayView1d< real64 > const m_dst;
+
+  /// Data structure containing mesh data used to setup the finite element
+  typename FE_TYPE::template MeshData< SUBREGION_TYPE > m_meshData;
+
+  /**
+   * @brief Get a parameter representative of the stiffness, used as physical scaling for the
+   * stabilization matrix.
+   * @param[in] k Element index.
+   * @return A parameter representative of the stiffness matrix dstress/dstrain
+   */
+  GEOS_HOST_DEVICE
+  inline
+  real64 computeStabilizationScaling( localIndex const k ) const
+  {
+    return 2.0 * m_constitutiveUpdate.getShearModulus( k );
+  }
+};
+
+/// The factory used to construct a MatrixFree kernel.
+using MatrixFreeFactory = finiteElement::KernelFactory< ImplicitSmallStrainMatrixFree,
+                                                        arrayView1d< globalIndex const > const,
+                                                        globalIndex,
+                                                        arrayView1d< real64 > const >;
+
+} // namespace solidMechanicsLagrangianFEMKernels
+
+} // namespace geos
+
+#endif // GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_IMPLICITSMALLSTRAINMATRIXFREE_HPP_
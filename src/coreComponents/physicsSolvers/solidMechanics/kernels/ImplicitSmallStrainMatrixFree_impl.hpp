@@ -0,0 +1,177 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file ImplicitSmallStrainMatrixFree_impl.hpp
+ */
+
+#ifndef GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_IMPLICITSMALLSTRAINMATRIXFREE_IMPL_HPP_
+#define GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_IMPLICITSMALLSTRAINMATRIXFREE_IMPL_HPP_
+
+#include "ImplicitSmallStrainMatrixFree.hpp"
+
+namespace geos
+{
+
+namespace solidMechanicsLagrangianFEMKernels
+{
+
+
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+ImplicitSmallStrainMatrixFree< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::
+ImplicitSmallStrainMatrixFree( NodeManager const & nodeManager,
+                               EdgeManager const & edgeManager,
+                               FaceManager const & faceManager,
+                               localIndex const targetRegionIndex,
+                               SUBREGION_TYPE const & elementSubRegion,
+                               FE_TYPE const & finiteElementSpace,
+                               CONSTITUTIVE_TYPE & inputConstitutiveType,
+                               arrayView1d< globalIndex const > const inputDofNumber,
+                               globalIndex const rankOffset,
+                               arrayView1d< real64 > const inputDst ):
+  Base( elementSubRegion,
+        finiteElementSpace,
+        inputConstitutiveType ),
+  m_X( nodeManager.referencePosition()),
+  m_src( nodeManager.getField< fields::solidMechanics::matrixFreeDisplacement >() ),
+  m_dofNumber( inputDofNumber ),
+  m_dofRankOffset( rankOffset ),
+  m_dst( inputDst )
+{
+  finiteElement::FiniteElementBase::initialize< FE_TYPE >( nodeManager,
+                                                           edgeManager,
+                                                           faceManager,
+                                                           elementSubRegion,
+                                                           m_meshData );
+  GEOS_UNUSED_VAR( targetRegionIndex );
+}
+
+
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+void ImplicitSmallStrainMatrixFree< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::
+setup( localIndex const k,
+       StackVariables & stack ) const
+{
+  m_finiteElementSpace.template setup< FE_TYPE >( k, m_meshData, stack.feStack );
+
+  stack.numSupportPoints = m_finiteElementSpace.template numSupportPoints< FE_TYPE >( stack.feStack );
+
+  for( localIndex a = 0; a < stack.numSupportPoints; ++a )
+  {
+    localIndex const localNodeIndex = m_elemsToNodes( k, a );
+
+    for( int i = 0; i < numDofPerTrialSupportPoint; ++i )
+    {
+#if defined(CALC_FEM_SHAPE_IN_KERNEL)
+      stack.xLocal[ a ][ i ] = m_X[ localNodeIndex ][ i ];
+#endif
+      stack.srcLocal[ a ][ i ] = m_src[ localNodeIndex ][ i ];
+    }
+    stack.localRowDofIndex[ a ] = m_dofNumber[ localNodeIndex ];
+  }
+
+  // Apply the stabilization with the same scaling as in the assembled Jacobian
+  // (this is a no-operation with FEM classes)
+  real64 const stabilizationScaling = computeStabilizationScaling( k );
+  m_finiteElementSpace.template addEvaluatedGradGradStabilizationVector< FE_TYPE, numDofPerTrialSupportPoint >( stack.feStack,
+                                                                                                                stack.srcLocal,
+                                                                                                                stack.dstLocal,
+                                                                                                                -stabilizationScaling );
+}
+
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+void ImplicitSmallStrainMatrixFree< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::
+quadraturePointKernel( localIndex const k,
+                       localIndex const q,
+                       StackVariables & stack ) const
+{
+  real64 dNdX[ numNodesPerElem ][ 3 ];
+  real64 const detJxW = m_finiteElementSpace.template getGradN< FE_TYPE >( k, q, stack.xLocal, stack.feStack, dNdX );
+
+  real64 strain[6] = {0};
+  FE_TYPE::symmetricGradient( dNdX, stack.srcLocal, strain );
+
+  real64 stiffness[6][6];
+  m_constitutiveUpdate.getElasticStiffness( k, q, stiffness );
+
+  // same sign convention as the Jacobian assembled by ImplicitSmallStrainQuasiStatic
+  real64 stress[6] = {0};
+  for( int i = 0; i < 6; ++i )
+  {
+    for( int j = 0; j < 6; ++j )
+    {
+      stress[i] += stiffness[i][j] * strain[j];
+    }
+    stress[i] *= -detJxW;
+  }
+
+  FE_TYPE::plusGradNajAij( dNdX, stress, stack.dstLocal );
+}
+
+
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+real64 ImplicitSmallStrainMatrixFree< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::
+complete( localIndex const k,
+          StackVariables & stack ) const
+{
+  GEOS_UNUSED_VAR( k );
+
+  for( localIndex a = 0; a < stack.numSupportPoints; ++a )
+  {
+    localIndex const dof = LvArray::integerConversion< localIndex >( stack.localRowDofIndex[ a ] - m_dofRankOffset );
+    if( dof < 0 || dof >= m_dst.size() )
+      continue;
+
+    for( int i = 0; i < numDofPerTestSupportPoint; ++i )
+    {
+      RAJA::atomicAdd< parallelDeviceAtomic >( &m_dst[ dof + i ], stack.dstLocal[ a ][ i ] );
+    }
+  }
+  return 0;
+}
+
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+template< typename POLICY,
+          typename KERNEL_TYPE >
+GEOS_FORCE_INLINE
+real64
+ImplicitSmallStrainMatrixFree< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::kernelLaunch( localIndex const numElems,
+                                                                                           KERNEL_TYPE const & kernelComponent )
+{
+  return Base::template kernelLaunch< POLICY, KERNEL_TYPE >( numElems, kernelComponent );
+}
+
+
+} // namespace solidMechanicsLagrangianFEMKernels
+
+} // namespace geos
+
+#endif // GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_IMPLICITSMALLSTRAINMATRIXFREE_IMPL_HPP_
@@ -86,6 +86,7 @@ public:
   using Base::m_finiteElementSpace;
   using Base::m_meshData;
   using Base::m_dt;
+  using Base::m_assemblyMap;
 
   /**
    * @brief Constructor
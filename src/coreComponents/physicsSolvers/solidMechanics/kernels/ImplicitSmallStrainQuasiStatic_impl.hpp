@@ -170,7 +170,6 @@ GEOS_FORCE_INLINE
 real64 ImplicitSmallStrainQuasiStatic< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::complete( localIndex const k,
                                                                                                StackVariables & stack ) const
 {
-  GEOS_UNUSED_VAR( k );
   real64 maxForce = 0;
 
 #if !defined( GEOS_USE_HIP )
@@ -188,10 +187,13 @@ real64 ImplicitSmallStrainQuasiStatic< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYP
       localIndex const dof = LvArray::integerConversion< localIndex >( stack.localRowDofIndex[ numDofPerTestSupportPoint * localNode + dim ] - m_dofRankOffset );
       if( dof < 0 || dof >= m_matrix.numRows() )
         continue;
-      m_matrix.template addToRowBinarySearchUnsorted< parallelDeviceAtomic >( dof,
-                                                                              stack.localRowDofIndex,
-                                                                              stack.localJacobian[ numDofPerTestSupportPoint * localNode + dim ],
-                                                                              stack.numRows );
+      m_assemblyMap.template addToRow< parallelDeviceAtomic >( m_matrix,
+                                                               k,
+                                                               numDofPerTestSupportPoint * localNode + dim,
+                                                               dof,
+                                                               stack.localRowDofIndex,
+                                                               stack.localJacobian[ numDofPerTestSupportPoint * localNode + dim ],
+                                                               stack.numRows );
 
       RAJA::atomicAdd< parallelDeviceAtomic >( &m_rhs[ dof ], stack.localResidual[ numDofPerTestSupportPoint * localNode + dim ] );
       maxForce = fmax( maxForce, fabs( stack.localResidual[ numDofPerTestSupportPoint * localNode + dim ] ) );
@@ -52,6 +52,12 @@ AcousticWaveEquationSEM::AcousticWaveEquationSEM( const std::string & name,
     setSizedFromParent( 0 ).
     setDescription( "Pressure value at each receiver for each timestep" );
 
+  registerWrapper( viewKeyStruct::useElementColoringString(), &m_useElementColoring ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Flag to color the elements such that elements of the same color do not share a node, and to "
+                    "assemble the mass, damping and stiffness vectors one color at a time without atomic operations" );
+
 }
 
 AcousticWaveEquationSEM::~AcousticWaveEquationSEM()
@@ -291,6 +297,13 @@ void AcousticWaveEquationSEM::initializePostInitialConditionsPreSubGroups()
 
       computeTargetNodeSet( elemsToNodes, elementSubRegion.size(), fe.getNumQuadraturePoints() );
 
+      if( m_useElementColoring )
+      {
+        GEOS_LOG_RANK_0_IF( !elementSubRegion.computeElementColoring( elemsToNodes, nodeManager.size() ),
+                            GEOS_FMT( "{}: no coloring with at most {} colors found for subregion {}, using atomic assembly",
+                                      getName(), ElementSubRegionBase::maxNumElementColors, elementSubRegion.getName() ) );
+      }
+
       arrayView1d< real32 const > const velocity = elementSubRegion.getField< acousticfields::AcousticVelocity >();
       arrayView1d< real32 const > const density = elementSubRegion.getField< acousticfields::AcousticDensity >();
 
@@ -304,23 +317,45 @@ void AcousticWaveEquationSEM::initializePostInitialConditionsPreSubGroups()
         using FE_TYPE = TYPEOFREF( finiteElement );
 
         AcousticMatricesSEM::MassMatrix< FE_TYPE > kernelM( finiteElement );
-        kernelM.template computeMassMatrix< EXEC_POLICY, ATOMIC_POLICY >( elementSubRegion.size(),
-                                                                          nodeCoords,
-                                                                          elemsToNodes,
-                                                                          velocity,
-                                                                          density,
-                                                                          mass );
-
         AcousticMatricesSEM::DampingMatrix< FE_TYPE > kernelD( finiteElement );
-        kernelD.template computeDampingMatrix< EXEC_POLICY, ATOMIC_POLICY >( elementSubRegion.size(),
-                                                                             nodeCoords,
-                                                                             elemsToFaces,
-                                                                             facesToNodes,
-                                                                             facesDomainBoundaryIndicator,
-                                                                             freeSurfaceFaceIndicator,
-                                                                             velocity,
-                                                                             density,
-                                                                             damping );
+        if( m_useElementColoring && elementSubRegion.hasElementColoring() )
+        {
+          kernelM.template computeMassMatrix< EXEC_POLICY >( elementSubRegion.getElementsByColor(),
+                                                             nodeCoords,
+                                                             elemsToNodes,
+                                                             velocity,
+                                                             density,
+                                                             mass );
+
+          kernelD.template computeDampingMatrix< EXEC_POLICY >( elementSubRegion.getElementsByColor(),
+                                                                nodeCoords,
+                                                                elemsToFaces,
+                                                                facesToNodes,
+                                                                facesDomainBoundaryIndicator,
+                                                                freeSurfaceFaceIndicator,
+                                                                velocity,
+                                                                density,
+                                                                damping );
+        }
+        else
+        {
+          kernelM.template computeMassMatrix< EXEC_POLICY, ATOMIC_POLICY >( elementSubRegion.size(),
+                                                                            nodeCoords,
+                                                                            elemsToNodes,
+                                                                            velocity,
+                                                                            density,
+                                                                            mass );
+
+          kernelD.template computeDampingMatrix< EXEC_POLICY, ATOMIC_POLICY >( elementSubRegion.size(),
+                                                                               nodeCoords,
+                                                                               elemsToFaces,
+                                                                               facesToNodes,
+                                                                               facesDomainBoundaryIndicator,
+                                                                               freeSurfaceFaceIndicator,
+                                                                               velocity,
+                                                                               density,
+                                                                               damping );
+        }
 
 
       } );
@@ -398,7 +433,8 @@ real64 AcousticWaveEquationSEM::computeTimeStep( real64 & dtOut )
                                                               regionNames,
                                                               getDiscretizationName(),
                                                               "",
-                                                              kernelFactory );
+                                                              kernelFactory,
+                                                              m_useElementColoring );
 
       forAll< EXEC_POLICY >( sizeNode, [=] GEOS_HOST_DEVICE ( localIndex const a )
       {
@@ -1078,7 +1114,8 @@ void AcousticWaveEquationSEM::computeUnknowns( real64 const & time_n,
                                                           regionNames,
                                                           getDiscretizationName(),
                                                           "",
-                                                          kernelFactory );
+                                                          kernelFactory,
+                                                          m_useElementColoring );
   //Modification of cycleNember useful when minTime < 0
   addSourceToRightHandSide( time_n, rhs );
 
@@ -109,6 +109,7 @@ public:
   struct viewKeyStruct : WaveSolverBase::viewKeyStruct
   {
     static constexpr char const * pressureNp1AtReceiversString() { return "pressureNp1AtReceivers"; }
+    static constexpr char const * useElementColoringString() { return "useElementColoring"; }
 
   } waveEquationViewKeys;
 
@@ -172,6 +173,9 @@ private:
   /// Pressure_np1 at the receiver location for each time step for each receiver
   array2d< real32 > m_pressureNp1AtReceivers;
 
+  /// Flag to assemble the mass, damping and stiffness vectors one element color at a time
+  integer m_useElementColoring;
+
 };
 
 } /* namespace geos */
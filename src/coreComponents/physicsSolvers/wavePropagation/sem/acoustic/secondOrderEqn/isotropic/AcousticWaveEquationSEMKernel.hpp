@@ -127,11 +127,13 @@ public:
     GEOS_HOST_DEVICE
     StackVariables():
       xLocal(),
+      pLocal(),
       stiffnessVectorLocal()
     {}
 
     /// C-array stack storage for element local the nodal positions.
     real64 xLocal[ 8 ][ 3 ];
+    real32 pLocal[ numNodesPerElem ]{};
     real32 stiffnessVectorLocal[ numNodesPerElem ]{};
     real32 invDensity;
   };
@@ -141,7 +143,8 @@ public:
   /**
    * @copydoc geos::finiteElement::KernelBase::setup
    *
-   * Copies the primary variable, and position into the local stack array.
+   * Copies the primary variable, and position into the local stack array,
+   * and computes the element stiffness vector.
    */
   GEOS_HOST_DEVICE
   inline
@@ -157,6 +160,17 @@ public:
         stack.xLocal[ a ][ i ] = m_nodeCoords[ nodeIndex ][ i ];
       }
     }
+    for( localIndex a=0; a< numNodesPerElem; a++ )
+    {
+      stack.pLocal[ a ] = m_p_n[ m_elemsToNodes( k, a ) ];
+    }
+
+    // The sum-factorized product covers all the quadrature points at once
+    FE_TYPE::computeStiffnessProduct( stack.xLocal, stack.pLocal, stack.stiffnessVectorLocal );
+    for( localIndex a=0; a< numNodesPerElem; a++ )
+    {
+      stack.stiffnessVectorLocal[ a ] *= stack.invDensity;
+    }
   }
 
   /**
@@ -169,33 +183,11 @@ public:
   {
     for( int i=0; i<numNodesPerElem; i++ )
     {
-      RAJA::atomicAdd< parallelDeviceAtomic >( &m_stiffnessVector[m_elemsToNodes( k, i )], stack.stiffnessVectorLocal[i] );
+      Base::assemblyAdd( m_stiffnessVector[m_elemsToNodes( k, i )], stack.stiffnessVectorLocal[i] );
     }
     return 0;
   }
 
-
-  /**
-   * @copydoc geos::finiteElement::KernelBase::quadraturePointKernel
-   *
-   * ### ExplicitAcousticSEM Description
-   * Calculates stiffness vector
-   *
-   */
-  GEOS_HOST_DEVICE
-  GEOS_FORCE_INLINE
-  void quadraturePointKernel( localIndex const k,
-                              localIndex const q,
-                              StackVariables & stack ) const
-  {
-
-    m_finiteElementSpace.template computeStiffnessTerm( q, stack.xLocal, [&] ( const int i, const int j, const real64 val )
-    {
-      real32 const localIncrement = stack.invDensity*val*m_p_n[m_elemsToNodes( k, j )];
-      stack.stiffnessVectorLocal[ i ] += localIncrement;
-    } );
-  }
-
 protected:
   /// The array containing the nodal position array.
   arrayView2d< WaveSolverBase::wsCoordType const, nodes::REFERENCE_POSITION_USD > const m_nodeCoords;
@@ -59,25 +59,77 @@ struct AcousticMatricesSEM
     {
       forAll< EXEC_POLICY >( size, [=] GEOS_HOST_DEVICE ( localIndex const e )
       {
+        addElementMass< ATOMIC_POLICY >( e, nodeCoords, elemsToNodes, velocity, density, mass );
+      } ); // end loop over element
+    }
 
-        real32 const invC2 = 1.0 / ( density[e] * pow( velocity[e], 2 ) );
-        // only the eight corners of the mesh cell are needed to compute the Jacobian
-        real64 xLocal[ 8 ][ 3 ];
-        for( localIndex a = 0; a < 8; ++a )
+    /**
+     * @brief Launches the precomputation of the mass matrices one element color at a time
+     * @tparam EXEC_POLICY the execution policy
+     * @param[in] elementsByColor the elements of the subRegion grouped by color, such that
+     *   elements of the same color do not share a node (no atomic operation is needed)
+     * @param[in] nodeCoords coordinates of the nodes
+     * @param[in] elemsToNodes map from element to nodes
+     * @param[in] velocity cell-wise velocity
+     * @param[in] density cell-wise density
+     * @param[out] mass diagonal of the mass matrix
+     */
+    template< typename EXEC_POLICY >
+    void
+    computeMassMatrix( ArrayOfArraysView< localIndex const > const elementsByColor,
+                       arrayView2d< WaveSolverBase::wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords,
+                       arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes,
+                       arrayView1d< real32 const > const velocity,
+                       arrayView1d< real32 const > const density,
+                       arrayView1d< real32 > const mass )
+    {
+      for( localIndex color = 0; color < elementsByColor.size(); ++color )
+      {
+        forAll< EXEC_POLICY >( elementsByColor.sizeOfArray( color ), [=] GEOS_HOST_DEVICE ( localIndex const i )
         {
-          localIndex const nodeIndex = elemsToNodes( e, FE_TYPE::meshIndexToLinearIndex3D( a ) );
-          for( localIndex i = 0; i < 3; ++i )
-          {
-            xLocal[a][i] = nodeCoords( nodeIndex, i );
-          }
-        }
-        constexpr localIndex numQuadraturePointsPerElem = FE_TYPE::numQuadraturePoints;
-        for( localIndex q = 0; q < numQuadraturePointsPerElem; ++q )
+          addElementMass< RAJA::seq_atomic >( elementsByColor( color, i ), nodeCoords, elemsToNodes, velocity, density, mass );
+        } );
+      }
+    }
+
+    /**
+     * @brief Adds the contribution of one element to the mass matrix
+     * @tparam ATOMIC_POLICY the atomic policy
+     * @param[in] e the element index
+     * @param[in] nodeCoords coordinates of the nodes
+     * @param[in] elemsToNodes map from element to nodes
+     * @param[in] velocity cell-wise velocity
+     * @param[in] density cell-wise density
+     * @param[out] mass diagonal of the mass matrix
+     */
+    template< typename ATOMIC_POLICY >
+    GEOS_HOST_DEVICE
+    inline
+    void
+    addElementMass( localIndex const e,
+                    arrayView2d< WaveSolverBase::wsCoordType const, nodes::REFERENCE_POSITION_USD > const & nodeCoords,
+                    arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemsToNodes,
+                    arrayView1d< real32 const > const & velocity,
+                    arrayView1d< real32 const > const & density,
+                    arrayView1d< real32 > const & mass ) const
+    {
+      real32 const invC2 = 1.0 / ( density[e] * pow( velocity[e], 2 ) );
+      // only the eight corners of the mesh cell are needed to compute the Jacobian
+      real64 xLocal[ 8 ][ 3 ];
+      for( localIndex a = 0; a < 8; ++a )
+      {
+        localIndex const nodeIndex = elemsToNodes( e, FE_TYPE::meshIndexToLinearIndex3D( a ) );
+        for( localIndex i = 0; i < 3; ++i )
         {
-          real32 const localIncrement = invC2 * m_finiteElement.computeMassTerm( q, xLocal );
-          RAJA::atomicAdd< ATOMIC_POLICY >( &mass[elemsToNodes( e, q )], localIncrement );
+          xLocal[a][i] = nodeCoords( nodeIndex, i );
         }
-      } ); // end loop over element
+      }
+      constexpr localIndex numQuadraturePointsPerElem = FE_TYPE::numQuadraturePoints;
+      for( localIndex q = 0; q < numQuadraturePointsPerElem; ++q )
+      {
+        real32 const localIncrement = invC2 * m_finiteElement.computeMassTerm( q, xLocal );
+        RAJA::atomicAdd< ATOMIC_POLICY >( &mass[elemsToNodes( e, q )], localIncrement );
+      }
     }
 
     FE_TYPE const & m_finiteElement;
@@ -119,32 +171,99 @@ struct AcousticMatricesSEM
     {
       forAll< EXEC_POLICY >( size, [=] GEOS_HOST_DEVICE ( localIndex const e )
       {
-        for( localIndex i = 0; i < elemsToFaces.size( 1 ); ++i )
+        addElementDamping< ATOMIC_POLICY >( e, nodeCoords, elemsToFaces, facesToNodes, facesDomainBoundaryIndicator,
+                                             freeSurfaceFaceIndicator, velocity, density, damping );
+      } );
+    }
+
+    /**
+     * @brief Launches the precomputation of the damping matrices one element color at a time
+     * @tparam EXEC_POLICY the execution policy
+     * @param[in] elementsByColor the elements of the subRegion grouped by color, such that
+     *   elements of the same color do not share a node (no atomic operation is needed)
+     * @param[in] nodeCoords coordinates of the nodes
+     * @param[in] elemsToFaces map from elements to faces
+     * @param[in] facesToNodes map from face to nodes
+     * @param[in] facesDomainBoundaryIndicator flag equal to 1 if the face is on the boundary, and to 0 otherwise
+     * @param[in] freeSurfaceFaceIndicator flag equal to 1 if the face is on the free surface, and to 0 otherwise
+     * @param[in] velocity cell-wise velocity
+     * @param[in] density cell-wise density
+     * @param[out] damping diagonal of the damping matrix
+     */
+    template< typename EXEC_POLICY >
+    void
+    computeDampingMatrix( ArrayOfArraysView< localIndex const > const elementsByColor,
+                          arrayView2d< WaveSolverBase::wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords,
+                          arrayView2d< localIndex const > const elemsToFaces,
+                          ArrayOfArraysView< localIndex const > const facesToNodes,
+                          arrayView1d< integer const > const facesDomainBoundaryIndicator,
+                          arrayView1d< localIndex const > const freeSurfaceFaceIndicator,
+                          arrayView1d< real32 const > const velocity,
+                          arrayView1d< real32 const > const density,
+                          arrayView1d< real32 > const damping )
+    {
+      for( localIndex color = 0; color < elementsByColor.size(); ++color )
+      {
+        forAll< EXEC_POLICY >( elementsByColor.sizeOfArray( color ), [=] GEOS_HOST_DEVICE ( localIndex const i )
         {
-          localIndex const f = elemsToFaces( e, i );
-          // face on the domain boundary and not on free surface
-          if( facesDomainBoundaryIndicator[f] == 1 && freeSurfaceFaceIndicator[f] != 1 )
+          addElementDamping< RAJA::seq_atomic >( elementsByColor( color, i ), nodeCoords, elemsToFaces, facesToNodes,
+                                                 facesDomainBoundaryIndicator, freeSurfaceFaceIndicator, velocity, density, damping );
+        } );
+      }
+    }
+
+    /**
+     * @brief Adds the contribution of the boundary faces of one element to the damping matrix
+     * @tparam ATOMIC_POLICY the atomic policy
+     * @param[in] e the element index
+     * @param[in] nodeCoords coordinates of the nodes
+     * @param[in] elemsToFaces map from elements to faces
+     * @param[in] facesToNodes map from face to nodes
+     * @param[in] facesDomainBoundaryIndicator flag equal to 1 if the face is on the boundary, and to 0 otherwise
+     * @param[in] freeSurfaceFaceIndicator flag equal to 1 if the face is on the free surface, and to 0 otherwise
+     * @param[in] velocity cell-wise velocity
+     * @param[in] density cell-wise density
+     * @param[out] damping diagonal of the damping matrix
+     */
+    template< typename ATOMIC_POLICY >
+    GEOS_HOST_DEVICE
+    inline
+    void
+    addElementDamping( localIndex const e,
+                       arrayView2d< WaveSolverBase::wsCoordType const, nodes::REFERENCE_POSITION_USD > const & nodeCoords,
+                       arrayView2d< localIndex const > const & elemsToFaces,
+                       ArrayOfArraysView< localIndex const > const & facesToNodes,
+                       arrayView1d< integer const > const & facesDomainBoundaryIndicator,
+                       arrayView1d< localIndex const > const & freeSurfaceFaceIndicator,
+                       arrayView1d< real32 const > const & velocity,
+                       arrayView1d< real32 const > const & density,
+                       arrayView1d< real32 > const & damping ) const
+    {
+      for( localIndex i = 0; i < elemsToFaces.size( 1 ); ++i )
+      {
+        localIndex const f = elemsToFaces( e, i );
+        // face on the domain boundary and not on free surface
+        if( facesDomainBoundaryIndicator[f] == 1 && freeSurfaceFaceIndicator[f] != 1 )
+        {
+          // only the four corners of the mesh face are needed to compute the Jacobian
+          real64 xLocal[ 4 ][ 3 ];
+          for( localIndex a = 0; a < 4; ++a )
           {
-            // only the four corners of the mesh face are needed to compute the Jacobian
-            real64 xLocal[ 4 ][ 3 ];
-            for( localIndex a = 0; a < 4; ++a )
+            localIndex const nodeIndex = facesToNodes( f, FE_TYPE::meshIndexToLinearIndex2D( a ) );
+            for( localIndex d = 0; d < 3; ++d )
             {
-              localIndex const nodeIndex = facesToNodes( f, FE_TYPE::meshIndexToLinearIndex2D( a ) );
-              for( localIndex d = 0; d < 3; ++d )
-              {
-                xLocal[a][d] = nodeCoords( nodeIndex, d );
-              }
-            }
-            real32 const alpha = 1.0 / (density[e] * velocity[e]);
-            constexpr localIndex numNodesPerFace = FE_TYPE::numNodesPerFace;
-            for( localIndex q = 0; q < numNodesPerFace; ++q )
-            {
-              real32 const localIncrement = alpha * m_finiteElement.computeDampingTerm( q, xLocal );
-              RAJA::atomicAdd< ATOMIC_POLICY >( &damping[facesToNodes( f, q )], localIncrement );
+              xLocal[a][d] = nodeCoords( nodeIndex, d );
             }
           }
+          real32 const alpha = 1.0 / (density[e] * velocity[e]);
+          constexpr localIndex numNodesPerFace = FE_TYPE::numNodesPerFace;
+          for( localIndex q = 0; q < numNodesPerFace; ++q )
+          {
+            real32 const localIncrement = alpha * m_finiteElement.computeDampingTerm( q, xLocal );
+            RAJA::atomicAdd< ATOMIC_POLICY >( &damping[facesToNodes( f, q )], localIncrement );
+          }
         }
-      } );
+      }
     }
 
     /// The finite element space/discretization object for the element type in the subRegion
@@ -32,6 +32,8 @@
 // TPL includes
 #include <gtest/gtest.h>
 
+#include <filesystem>
+
 using namespace geos;
 using namespace geos::testing;
 using namespace geos::constitutive;
@@ -372,7 +374,8 @@ std::unique_ptr< MODEL > makePVTFunction( string const & filename,
                                                strs,
                                                componentNames,
                                                componentMolarWeight,
-                                               pvtOutputOpts );
+                                               pvtOutputOpts,
+                                               string() );
     }
   }
   GEOS_ERROR_IF( pvtFunction == nullptr,
@@ -417,7 +420,8 @@ std::unique_ptr< MODEL > makeFlashModel( string const & filename,
                                               phaseNames,
                                               componentNames,
                                               componentMolarWeight,
-                                              flashOutputOpts );
+                                              flashOutputOpts,
+                                              string() );
     }
   }
   GEOS_ERROR_IF( flashModel == nullptr,
@@ -1112,6 +1116,68 @@ TEST_F( CO2EnthalpyTest, CO2EnthalpyMolarValuesAndDeriv )
   }
 }
 
+TEST( PVTTableCacheTest, tablesAreReadBackFromCache )
+{
+  string const directory = "pvtTableCacheTest";
+
+  PTTableCoordinates tableCoords;
+  tableCoords.appendPressure( 1.0e5 ).appendPressure( 1.0e6 ).appendPressure( 1.0e7 )
+    .appendTemperature( 20.0 ).appendTemperature( 80.0 );
+
+  string_array inputParams;
+  inputParams.emplace_back( "DensityFun" );
+  inputParams.emplace_back( "TestModel" );
+  inputParams.emplace_back( "0.5" );
+
+  integer numComputations = 0;
+  auto const computeOrRead = [&]( array1d< real64 > & table1, array1d< real64 > & table2, string const & cacheDirectory )
+  {
+    table1.resize( tableCoords.nPressures() * tableCoords.nTemperatures() );
+    table2.resize( tableCoords.nTemperatures() );
+    table1.zero();
+    table2.zero();
+    PVTTableCache::computeOrRead( cacheDirectory, "TestModel", inputParams, tableCoords, { table1.toView(), table2.toView() }, [&]()
+    {
+      ++numComputations;
+      for( localIndex i = 0; i < table1.size(); ++i )
+      {
+        table1[i] = stod( inputParams[2] ) * i;
+      }
+      for( localIndex i = 0; i < table2.size(); ++i )
+      {
+        table2[i] = -1.0 * i;
+      }
+    } );
+  };
+
+  array1d< real64 > computed1, computed2, cached1, cached2;
+  computeOrRead( computed1, computed2, directory );
+  EXPECT_EQ( numComputations, 1 );
+
+  // Same model, parameters and coordinates: the tables are read from the cache
+  computeOrRead( cached1, cached2, directory );
+  EXPECT_EQ( numComputations, 1 );
+  for( localIndex i = 0; i < computed1.size(); ++i )
+  {
+    EXPECT_DOUBLE_EQ( computed1[i], cached1[i] );
+  }
+  for( localIndex i = 0; i < computed2.size(); ++i )
+  {
+    EXPECT_DOUBLE_EQ( computed2[i], cached2[i] );
+  }
+
+  // Different parameters: the tables are recomputed
+  inputParams[2] = "0.25";
+  computeOrRead( cached1, cached2, directory );
+  EXPECT_EQ( numComputations, 2 );
+  EXPECT_DOUBLE_EQ( cached1[2], 0.5 );
+
+  // Without a directory, the cache is disabled and the tables are always computed
+  computeOrRead( cached1, cached2, "" );
+  EXPECT_EQ( numComputations, 3 );
+  std::filesystem::remove_all( directory );
+}
+
 int main( int argc, char * * argv )
 {
   ::testing::InitGoogleTest( &argc, argv );
@@ -93,7 +93,8 @@ CO2SolubilitySpycherPruessTestFixture::makeFlashModel( string const & fileConten
                                             phaseNames,
                                             componentNames,
                                             componentMolarWeight,
-                                            flashOutputOpts );
+                                            flashOutputOpts,
+                                            string() );
 }
 
 TEST_P( CO2SolubilitySpycherPruessTestFixture, testExpectedValues )
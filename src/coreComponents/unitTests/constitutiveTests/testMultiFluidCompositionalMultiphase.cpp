@@ -21,6 +21,7 @@
 #include "constitutive/fluid/multifluid/compositional/CompositionalMultiphaseFluid.hpp"
 #include "mainInterface/GeosxState.hpp"
 #include "mainInterface/initialization.hpp"
+#include "physicsSolvers/fluidFlow/kernels/compositional/FluidUpdateKernel.hpp"
 
 using namespace geos;
 using namespace geos::dataRepository;
@@ -104,6 +105,113 @@ public:
     }
   }
 
+  void testBinnedUpdate()
+  {
+    using FluidUpdateKernel = thermalCompositionalMultiphaseBaseKernels::FluidUpdateKernel;
+
+    auto & fluid = this->getFluid();
+    auto & parent = this->getParent();
+
+    array2d< real64 > samples;
+    Fluid< FluidModel, Base::numComp >::getSamples( samples );
+    integer const sampleCount = samples.size( 0 );
+
+    constexpr real64 pressures[] = { 1.0e5, 50.0e5, 100.0e5, 600.0e5 };
+    constexpr real64 temperatures[] = { 15.5, 24.0, 40.0, 80.0 };
+
+    // One cell per sample and condition, so that the cells are spread over the phase states
+    localIndex const numCells = sampleCount * static_cast< localIndex >( std::size( pressures ) * std::size( temperatures ) );
+    array1d< real64 > pres( numCells );
+    array1d< real64 > temp( numCells );
+    array2d< real64, compflow::LAYOUT_COMP > compFrac( numCells, Base::numComp );
+    localIndex k = 0;
+    for( integer sampleIndex = 0; sampleIndex < sampleCount; ++sampleIndex )
+    {
+      for( real64 const pressure : pressures )
+      {
+        for( real64 const temperature : temperatures )
+        {
+          pres[k] = pressure;
+          temp[k] = units::convertCToK( temperature );
+          for( integer ic = 0; ic < Base::numComp; ++ic )
+          {
+            compFrac[k][ic] = samples[sampleIndex][ic];
+          }
+          ++k;
+        }
+      }
+    }
+
+    parent.resize( numCells );
+    std::unique_ptr< ConstitutiveBase > fluidCopyPtr = fluid.deliverClone( fluid.getName() + "Copy", &parent );
+    MultiFluidBase & fluidCopy = dynamicCast< MultiFluidBase & >( *fluidCopyPtr );
+    fluid.allocateConstitutiveData( parent, 1 );
+    fluidCopy.allocateConstitutiveData( parent, 1 );
+
+    auto const launch = [&]( MultiFluidBase & f )
+    {
+      constitutiveUpdatePassThru( f, [&] ( auto & castedFluid )
+      {
+        typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+        FluidUpdateKernel::launch< serialPolicy >( numCells, fluidWrapper, pres.toViewConst(), temp.toViewConst(), compFrac.toViewConst() );
+      } );
+    };
+
+    // Initial update of both fluids: the binned update groups the cells by the phase state of the previous update
+    launch( fluid );
+    launch( fluidCopy );
+
+    // Move the state and update one fluid with the static schedule, the other one binned by phase state
+    for( localIndex i = 0; i < numCells; ++i )
+    {
+      pres[i] *= 1.05;
+      temp[i] += 2.0;
+    }
+    launch( fluid );
+
+    array1d< localIndex > binSizes( Base::numPhase + 1 );
+    array1d< real64 > binTimes( Base::numPhase + 1 );
+    constitutiveUpdatePassThru( fluidCopy, [&] ( auto & castedFluid )
+    {
+      typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+      FluidUpdateKernel::launchBinned( numCells,
+                                       Base::numPhase,
+                                       castedFluid.phaseFraction(),
+                                       fluidWrapper,
+                                       pres.toViewConst(),
+                                       temp.toViewConst(),
+                                       compFrac.toViewConst(),
+                                       binSizes.toView(),
+                                       binTimes.toView() );
+    } );
+
+    // Every cell is updated exactly once
+    localIndex numBinnedCells = 0;
+    for( localIndex const binSize : binSizes )
+    {
+      numBinnedCells += binSize;
+    }
+    EXPECT_EQ( numBinnedCells, numCells );
+
+    // The cell updates are independent, so the results must be identical
+    auto const expectIdentical = []( auto const & expected, auto const & actual )
+    {
+      ASSERT_EQ( expected.size(), actual.size() );
+      for( localIndex i = 0; i < expected.size(); ++i )
+      {
+        EXPECT_EQ( expected.data()[i], actual.data()[i] );
+      }
+    };
+    expectIdentical( fluid.phaseFraction(), fluidCopy.phaseFraction() );
+    expectIdentical( fluid.dPhaseFraction(), fluidCopy.dPhaseFraction() );
+    expectIdentical( fluid.phaseDensity(), fluidCopy.phaseDensity() );
+    expectIdentical( fluid.dPhaseDensity(), fluidCopy.dPhaseDensity() );
+    expectIdentical( fluid.phaseViscosity(), fluidCopy.phaseViscosity() );
+    expectIdentical( fluid.phaseCompFraction(), fluidCopy.phaseCompFraction() );
+    expectIdentical( fluid.dPhaseCompFraction(), fluidCopy.dPhaseCompFraction() );
+    expectIdentical( fluid.totalDensity(), fluidCopy.totalDensity() );
+  }
+
 private:
   static FluidModel * makeFluid( string const & name, Group * parent );
 };
@@ -224,6 +332,15 @@ TEST_F( SoaveRedlichKwongLBC4Test, numericalDerivativesMolar )
   testNumericalDerivatives( false );
 }
 
+TEST_F( PengRobinson4Test, binnedUpdate )
+{
+  testBinnedUpdate();
+}
+TEST_F( SoaveRedlichKwongLBC4Test, binnedUpdate )
+{
+  testBinnedUpdate();
+}
+
 using PengRobinsonLBC5Test = MultiFluidCompositionalMultiphaseTest< EquationOfStateType::PengRobinson, VISCOSITY_TYPE::LBC, 5 >;
 using SoaveRedlichKwongLBC5Test = MultiFluidCompositionalMultiphaseTest< EquationOfStateType::SoaveRedlichKwong, VISCOSITY_TYPE::LBC, 5 >;
 TEST_F( PengRobinsonLBC5Test, numericalDerivativesMolar )
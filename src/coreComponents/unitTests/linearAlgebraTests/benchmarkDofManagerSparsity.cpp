@@ -0,0 +1,97 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file benchmarkDofManagerSparsity.cpp
+ *
+ * Measures the construction time of the monolithic sparsity pattern of DofManager for a
+ * coupled displacement (nodes, coupled through elements) / pressure (elements, coupled
+ * through faces) system, on cubic meshes of increasing size.
+ */
+
+#include "linearAlgebra/DofManager.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "unitTests/linearAlgebraTests/testDofManagerUtils.hpp"
+
+#include <benchmark/benchmark.h>
+
+namespace geos
+{
+namespace benchmarking
+{
+
+string createXmlInput( localIndex const numCells )
+{
+  return GEOS_FMT( R"xml(
+  <Problem>
+    <Mesh>
+      <InternalMesh name="mesh"
+                    elementTypes="{{C3D8}}"
+                    xCoords="{{0, 1}}"
+                    yCoords="{{0, 1}}"
+                    zCoords="{{0, 1}}"
+                    nx="{{{0}}}"
+                    ny="{{{0}}}"
+                    nz="{{{0}}}"
+                    cellBlockNames="{{block1}}"/>
+    </Mesh>
+    <ElementRegions>
+      <CellElementRegion name="region1" cellBlocks="{{block1}}" materialList="{{}}" />
+    </ElementRegions>
+  </Problem>
+  )xml", numCells );
+}
+
+void setSparsityPattern( benchmark::State & state )
+{
+  GeosxState geosState( std::make_unique< CommandLineOptions >() );
+  geos::testing::setupProblemFromXML( &geosState.getProblemManager(), createXmlInput( state.range( 0 ) ).c_str() );
+
+  DofManager dofManager( "benchmark" );
+  dofManager.setDomain( geosState.getProblemManager().getDomainPartition() );
+  dofManager.addField( "displacement", FieldLocation::Node, 3 );
+  dofManager.addField( "pressure", FieldLocation::Elem, 1 );
+  dofManager.addCoupling( "displacement", "displacement", DofManager::Connector::Elem );
+  dofManager.addCoupling( "pressure", "pressure", DofManager::Connector::Face );
+  dofManager.addCoupling( "displacement", "pressure", DofManager::Connector::Elem );
+  dofManager.reorderByRank();
+
+  for( auto _ : state )
+  {
+    SparsityPattern< globalIndex > pattern;
+    dofManager.setSparsityPattern( pattern );
+    benchmark::DoNotOptimize( pattern.numNonZeros() );
+  }
+
+  state.counters["dofs"] = dofManager.numGlobalDofs();
+  state.SetItemsProcessed( state.iterations() * dofManager.numLocalDofs() );
+}
+
+BENCHMARK( setSparsityPattern )->Arg( 10 )->Arg( 20 )->Arg( 40 )->Arg( 80 )->Unit( benchmark::kMillisecond );
+
+} // namespace benchmarking
+} // namespace geos
+
+int main( int argc, char * * argv )
+{
+  ::benchmark::Initialize( &argc, argv );
+  geos::setupEnvironment( argc, argv );
+  ::benchmark::RunSpecifiedBenchmarks();
+  geos::cleanupEnvironment();
+  return 0;
+}
@@ -518,6 +518,64 @@ TEST_F( MeshGenerationTest, edgeFaceMaps )
   }
 }
 
+TEST_F( MeshGenerationTest, elementColoring )
+{
+  arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemToNodeMap = m_subRegion->nodeList();
+
+  ASSERT_TRUE( m_subRegion->computeElementColoring( elemToNodeMap, m_nodeManager->size() ) );
+  ASSERT_TRUE( m_subRegion->hasElementColoring() );
+
+  // a structured hexahedral mesh needs 8 colors, and the greedy coloring finds them in lexicographic order
+  EXPECT_EQ( m_subRegion->numElementColors(), 8 );
+
+  arrayView1d< integer const > const elemColor = m_subRegion->getElementColor();
+  ArrayOfArraysView< localIndex const > const elementsByColor = m_subRegion->getElementsByColor();
+
+  localIndex numColoredElems = 0;
+  for( localIndex color = 0; color < elementsByColor.size(); ++color )
+  {
+    // no node is shared by two elements of the same color
+    std::vector< bool > isNodeUsed( m_nodeManager->size(), false );
+    for( localIndex const elemID : elementsByColor[ color ] )
+    {
+      EXPECT_EQ( elemColor[ elemID ], color );
+      for( localIndex a = 0; a < elemToNodeMap.size( 1 ); ++a )
+      {
+        EXPECT_FALSE( isNodeUsed[ elemToNodeMap( elemID, a ) ] );
+        isNodeUsed[ elemToNodeMap( elemID, a ) ] = true;
+      }
+    }
+    numColoredElems += elementsByColor.sizeOfArray( color );
+  }
+  EXPECT_EQ( numColoredElems, m_subRegion->size() );
+
+  // grouping of a subset of the elements
+  array1d< localIndex > elementList;
+  for( localIndex elemID = 0; elemID < m_subRegion->size(); elemID += 3 )
+  {
+    elementList.emplace_back( elemID );
+  }
+  ArrayOfArrays< localIndex > elementListByColor;
+  m_subRegion->groupElementsByColor( elementList.toViewConst(), elementListByColor );
+
+  ASSERT_EQ( elementListByColor.size(), elementsByColor.size() );
+  localIndex numListedElems = 0;
+  for( localIndex color = 0; color < elementListByColor.size(); ++color )
+  {
+    for( localIndex const elemID : elementListByColor[ color ] )
+    {
+      EXPECT_EQ( elemID % 3, 0 );
+      EXPECT_EQ( elemColor[ elemID ], color );
+    }
+    numListedElems += elementListByColor.sizeOfArray( color );
+  }
+  EXPECT_EQ( numListedElems, elementList.size() );
+
+  m_subRegion->clearElementColoring();
+  EXPECT_FALSE( m_subRegion->hasElementColoring() );
+  EXPECT_EQ( m_subRegion->numElementColors(), 0 );
+}
+
 TEST_F( MeshGenerationTest, highOrderMapsSizes )
 {
   ProblemManager & problemManager = getGlobalState().getProblemManager();
@@ -0,0 +1,150 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "gtest/gtest.h"
+
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mesh/generators/CellBlockManager.hpp"
+
+using namespace geos;
+
+constexpr localIndex numElemsInX = 6;
+constexpr localIndex numElemsInY = 5;
+constexpr localIndex numElemsInZ = 4;
+
+constexpr localIndex numNodesInX = numElemsInX + 1;
+constexpr localIndex numNodesInY = numElemsInY + 1;
+constexpr localIndex numNodesInZ = numElemsInZ + 1;
+
+constexpr localIndex numNodes = numNodesInX * numNodesInY * numNodesInZ;
+constexpr localIndex numElems = numElemsInX * numElemsInY * numElemsInZ;
+
+// Structured index of the nodes of an element, in the order of the hexahedron
+globalIndex elemNode( globalIndex const elem, localIndex const a )
+{
+  globalIndex const i = elem % numElemsInX + ( a & 1 );
+  globalIndex const j = ( elem / numElemsInX ) % numElemsInY + ( ( a >> 1 ) & 1 );
+  globalIndex const k = elem / ( numElemsInX * numElemsInY ) + ( ( a >> 2 ) & 1 );
+  return i + numNodesInX * ( j + numNodesInY * k );
+}
+
+// Sum over the elements of the spread of their local node indices
+localIndex nodeIndexSpread( CellBlock const & cellBlock )
+{
+  arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemToNodes = cellBlock.getElemToNode();
+  localIndex spread = 0;
+  for( localIndex k = 0; k < elemToNodes.size( 0 ); ++k )
+  {
+    localIndex minNode = numNodes;
+    localIndex maxNode = 0;
+    for( localIndex a = 0; a < 8; ++a )
+    {
+      minNode = LvArray::math::min( minNode, elemToNodes( k, a ) );
+      maxNode = LvArray::math::max( maxNode, elemToNodes( k, a ) );
+    }
+    spread += maxNode - minNode;
+  }
+  return spread;
+}
+
+TEST( MeshLocalityReordering, morton )
+{
+  conduit::Node node;
+  dataRepository::Group root( "root", node );
+  CellBlockManager & cellBlockManager = root.registerGroup< CellBlockManager >( "cellManager" );
+
+  // Scrambled numbering of a structured mesh: the local index of structured node/element g is (g * 11) % n
+  cellBlockManager.setNumNodes( numNodes );
+  arrayView2d< real64, nodes::REFERENCE_POSITION_USD > const X = cellBlockManager.getNodePositions();
+  arrayView1d< globalIndex > const nodeLocalToGlobal = cellBlockManager.getNodeLocalToGlobal();
+  SortedArray< localIndex > & xnegNodes = cellBlockManager.getNodeSets()["xneg"];
+  for( globalIndex g = 0; g < numNodes; ++g )
+  {
+    localIndex const a = ( g * 11 ) % numNodes;
+    X( a, 0 ) = g % numNodesInX;
+    X( a, 1 ) = ( g / numNodesInX ) % numNodesInY;
+    X( a, 2 ) = g / ( numNodesInX * numNodesInY );
+    nodeLocalToGlobal[a] = g;
+    if( g % numNodesInX == 0 )
+    {
+      xnegNodes.insert( a );
+    }
+  }
+
+  CellBlock & cellBlock = cellBlockManager.registerCellBlock( "cb1" );
+  cellBlock.setElementType( ElementType::Hexahedron );
+  cellBlock.resize( numElems );
+  arrayView2d< localIndex, cells::NODE_MAP_USD > const elemToNodes = cellBlock.getElemToNode();
+  arrayView1d< globalIndex > const elemLocalToGlobal = cellBlock.localToGlobalMap();
+  for( globalIndex g = 0; g < numElems; ++g )
+  {
+    localIndex const k = ( g * 11 ) % numElems;
+    for( localIndex a = 0; a < 8; ++a )
+    {
+      elemToNodes( k, a ) = ( elemNode( g, a ) * 11 ) % numNodes;
+    }
+    elemLocalToGlobal[k] = g;
+  }
+
+  localIndex const spreadBefore = nodeIndexSpread( cellBlock );
+  std::map< string, array1d< localIndex > > const cellNewToOld =
+    cellBlockManager.reorderForLocality( CellBlockManager::LocalityReordering::morton );
+  cellBlockManager.buildMaps();
+
+  // The numbering is more compact
+  EXPECT_LT( nodeIndexSpread( cellBlock ), spreadBefore );
+
+  // Positions and node sets follow the nodes
+  for( localIndex a = 0; a < numNodes; ++a )
+  {
+    globalIndex const g = nodeLocalToGlobal[a];
+    EXPECT_DOUBLE_EQ( X( a, 0 ), g % numNodesInX );
+    EXPECT_DOUBLE_EQ( X( a, 1 ), ( g / numNodesInX ) % numNodesInY );
+    EXPECT_DOUBLE_EQ( X( a, 2 ), g / ( numNodesInX * numNodesInY ) );
+    EXPECT_EQ( xnegNodes.contains( a ), g % numNodesInX == 0 );
+  }
+  EXPECT_EQ( xnegNodes.size(), numNodesInY * numNodesInZ );
+
+  // Elements keep their nodes, and the returned permutation is consistent
+  ASSERT_EQ( cellNewToOld.count( "cb1" ), 1 );
+  arrayView1d< localIndex const > const newToOld = cellNewToOld.at( "cb1" ).toViewConst();
+  for( localIndex k = 0; k < numElems; ++k )
+  {
+    globalIndex const g = elemLocalToGlobal[k];
+    EXPECT_EQ( newToOld[k], ( g * 11 ) % numElems );
+    for( localIndex a = 0; a < 8; ++a )
+    {
+      EXPECT_EQ( nodeLocalToGlobal[elemToNodes( k, a )], elemNode( g, a ) );
+    }
+  }
+
+  EXPECT_EQ( cellBlockManager.numFaces(), numNodesInX * numElemsInY * numElemsInZ +
+                                          numElemsInX * numNodesInY * numElemsInZ +
+                                          numElemsInX * numElemsInY * numNodesInZ );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+
+  GeosxState state( geos::basicSetup( argc, argv ) );
+
+  int const result = RUN_ALL_TESTS();
+
+  geos::basicCleanup();
+
+  return result;
+}
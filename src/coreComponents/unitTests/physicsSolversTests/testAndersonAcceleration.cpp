@@ -0,0 +1,205 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file testAndersonAcceleration.cpp
+ */
+
+#include "common/DataTypes.hpp"
+#include "mainInterface/initialization.hpp"
+#include "physicsSolvers/multiphysics/AndersonAcceleration.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geos;
+
+/**
+ * @brief Linear contraction G( x ) = M x + b, with a diagonal M of spectral radius 0.95
+ */
+class LinearContraction
+{
+public:
+
+  explicit LinearContraction( localIndex const n ):
+    m_diag( n ),
+    m_rhs( n )
+  {
+    for( localIndex i = 0; i < n; ++i )
+    {
+      m_diag[i] = 0.5 + 0.45 * i / ( n - 1 );
+      m_rhs[i] = 1.0 + i;
+    }
+  }
+
+  array1d< real64 > apply( arrayView1d< real64 const > const & x ) const
+  {
+    array1d< real64 > g( x.size() );
+    for( localIndex i = 0; i < x.size(); ++i )
+    {
+      g[i] = m_diag[i] * x[i] + m_rhs[i];
+    }
+    return g;
+  }
+
+private:
+
+  array1d< real64 > m_diag;
+  array1d< real64 > m_rhs;
+};
+
+real64 residualNorm( arrayView1d< real64 const > const & x,
+                     arrayView1d< real64 const > const & g )
+{
+  real64 norm = 0.0;
+  for( localIndex i = 0; i < x.size(); ++i )
+  {
+    norm += ( g[i] - x[i] ) * ( g[i] - x[i] );
+  }
+  return std::sqrt( norm );
+}
+
+array1d< integer > allOwned( localIndex const n )
+{
+  array1d< integer > isOwned( n );
+  isOwned.setValues< serialPolicy >( 1 );
+  return isOwned;
+}
+
+/// Number of iterations to reduce the fixed-point residual by @p tol, with or without acceleration
+integer numIterationsToConverge( LinearContraction const & map,
+                                 localIndex const n,
+                                 integer const depth,
+                                 bool const accelerate,
+                                 real64 const tol )
+{
+  AndersonAcceleration anderson( depth );
+  array1d< integer > const isOwned = allOwned( n );
+  array1d< real64 > x( n );
+  real64 initialNorm = -1.0;
+
+  integer constexpr maxIter = 1000;
+  for( integer iter = 0; iter < maxIter; ++iter )
+  {
+    array1d< real64 > const g = map.apply( x.toViewConst() );
+    real64 const norm = residualNorm( x.toViewConst(), g.toViewConst() );
+    initialNorm = initialNorm < 0.0 ? norm : initialNorm;
+    if( norm < tol * initialNorm )
+    {
+      return iter;
+    }
+    x = accelerate ? anderson.accelerate( x.toViewConst(), g.toViewConst(), isOwned.toViewConst() ) : g;
+  }
+  return maxIter;
+}
+
+TEST( AndersonAcceleration, linearContraction )
+{
+  localIndex constexpr n = 10;
+  real64 constexpr tol = 1e-8;
+  LinearContraction const map( n );
+
+  integer const numPicard = numIterationsToConverge( map, n, 3, false, tol );
+  integer const numAnderson = numIterationsToConverge( map, n, 3, true, tol );
+
+  // the depth is smaller than the number of distinct eigenvalues, so that the history wraps around
+  EXPECT_GT( numAnderson, 3 );
+  EXPECT_LT( 2 * numAnderson, numPicard );
+}
+
+TEST( AndersonAcceleration, circularHistory )
+{
+  localIndex constexpr n = 6;
+  integer constexpr depth = 2;
+  integer constexpr numCalls = 6;
+  LinearContraction const map( n );
+  array1d< integer > const isOwned = allOwned( n );
+
+  AndersonAcceleration anderson( depth );
+  std::vector< array1d< real64 > > inputs( numCalls );
+  std::vector< array1d< real64 > > outputs( numCalls );
+  array1d< real64 > x( n );
+  for( integer call = 0; call < numCalls; ++call )
+  {
+    inputs[call] = x;
+    outputs[call] = map.apply( x.toViewConst() );
+    x = anderson.accelerate( inputs[call].toViewConst(), outputs[call].toViewConst(), isOwned.toViewConst() );
+    EXPECT_EQ( anderson.numUsedIterations(), std::min( call, depth ) );
+  }
+
+  // once the history has wrapped around, only the last depth + 1 iterations are used:
+  // a fresh instance fed with these iterations only produces the same iterate
+  AndersonAcceleration fresh( depth );
+  array1d< real64 > xFresh;
+  for( integer call = numCalls - depth - 1; call < numCalls; ++call )
+  {
+    xFresh = fresh.accelerate( inputs[call].toViewConst(), outputs[call].toViewConst(), isOwned.toViewConst() );
+  }
+  for( localIndex i = 0; i < n; ++i )
+  {
+    EXPECT_NEAR( xFresh[i], x[i], 1e-10 * std::abs( x[i] ) );
+  }
+
+  // a reset discards the history
+  anderson.reset( depth + 1 );
+  anderson.accelerate( inputs[0].toViewConst(), outputs[0].toViewConst(), isOwned.toViewConst() );
+  EXPECT_EQ( anderson.numUsedIterations(), 0 );
+}
+
+TEST( AndersonAcceleration, ghostEntries )
+{
+  localIndex constexpr n = 6;
+  localIndex constexpr numGhosts = 3;
+  integer constexpr depth = 3;
+  LinearContraction const map( n );
+
+  // the last entries are ghost copies of the first ones, and must not weigh in the least-squares problem
+  array1d< integer > isOwned = allOwned( n + numGhosts );
+  for( localIndex i = n; i < n + numGhosts; ++i )
+  {
+    isOwned[i] = 0;
+  }
+  array1d< integer > const isOwnedNoGhost = allOwned( n );
+
+  AndersonAcceleration anderson( depth );
+  AndersonAcceleration andersonNoGhost( depth );
+  array1d< real64 > x( n + numGhosts );
+  array1d< real64 > xNoGhost( n );
+  for( integer call = 0; call < 5; ++call )
+  {
+    array1d< real64 > const gNoGhost = map.apply( xNoGhost.toViewConst() );
+    array1d< real64 > g( n + numGhosts );
+    for( localIndex i = 0; i < n + numGhosts; ++i )
+    {
+      g[i] = gNoGhost[i < n ? i : i - n];
+    }
+    x = anderson.accelerate( x.toViewConst(), g.toViewConst(), isOwned.toViewConst() );
+    xNoGhost = andersonNoGhost.accelerate( xNoGhost.toViewConst(), gNoGhost.toViewConst(), isOwnedNoGhost.toViewConst() );
+
+    for( localIndex i = 0; i < n + numGhosts; ++i )
+    {
+      real64 const expected = xNoGhost[i < n ? i : i - n];
+      EXPECT_NEAR( x[i], expected, 1e-10 * std::abs( expected ) );
+    }
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
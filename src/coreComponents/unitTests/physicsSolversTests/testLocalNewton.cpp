@@ -0,0 +1,184 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file testLocalNewton.cpp
+ */
+
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "physicsSolvers/PhysicsSolverBase.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geos;
+
+CommandLineOptions g_commandLineOptions;
+
+char const * const solverPath = "/Solvers/testSolver";
+
+/**
+ * @brief Single-phase injection in a closed box, with local Newton iterations and a preconditioner reused over the time steps
+ * @param solverType the value of the solverType attribute
+ * @return the XML input
+ */
+string getXmlInput( string const & solverType )
+{
+  return R"xml(
+<Problem>
+
+  <Solvers>
+    <SinglePhaseFVM name="testSolver"
+                    discretization="singlePhaseTPFA"
+                    targetRegions="{ reservoir }"
+                    initialDt="1.0e3" >
+
+      <NonlinearSolverParameters newtonTol="1.0e-8"
+                                 newtonMaxIter="10"
+                                 nonlinearPreconditionerType="LocalNewton"
+                                 localNewtonMaxIter="2"
+                                 localNewtonResidualThreshold="0.1"
+                                 timeStepIncreaseFactor="1.0" />
+
+      <LinearSolverParameters solverType=")xml" + solverType + R"xml("
+                              preconditionerType="amg"
+                              preconditionerReuse="timeStep"
+                              preconditionerReuseIterationFactor="1000"
+                              krylovTol="1.0e-10" />
+
+    </SinglePhaseFVM>
+  </Solvers>
+
+  <NumericalMethods>
+    <FiniteVolume>
+      <TwoPointFluxApproximation name="singlePhaseTPFA" />
+    </FiniteVolume>
+  </NumericalMethods>
+
+  <Mesh>
+    <InternalMesh name="mesh"
+                  elementTypes="{ C3D8 }"
+                  xCoords="{   0, 10 }"
+                  yCoords="{   0, 10 }"
+                  zCoords="{ -10,  0 }"
+                  nx="{ 5 }"
+                  ny="{ 5 }"
+                  nz="{ 5 }"
+                  cellBlockNames="{ cellBlock }" />
+  </Mesh>
+
+  <ElementRegions>
+    <CellElementRegion name="reservoir"
+                       cellBlocks="{ cellBlock }"
+                       materialList="{ water, rock }" />
+  </ElementRegions>
+
+  <Constitutive>
+    <CompressibleSinglePhaseFluid name="water"
+                                  defaultDensity="1000"
+                                  defaultViscosity="0.001"
+                                  referencePressure="0.0"
+                                  compressibility="5e-10"
+                                  viscosibility="1e-8" />
+
+    <CompressibleSolidConstantPermeability name="rock"
+                                           solidModelName="nullSolid"
+                                           porosityModelName="rockPorosity"
+                                           permeabilityModelName="rockPerm" />
+    <NullModel name="nullSolid" />
+    <PressurePorosity name="rockPorosity"
+                      defaultReferencePorosity="0.05"
+                      referencePressure="0.0"
+                      compressibility="1.0e-9" />
+    <ConstantPermeability name="rockPerm"
+                          permeabilityComponents="{ 1.0e-12, 1.0e-12, 1.0e-15 }" />
+  </Constitutive>
+
+  <FieldSpecifications>
+    <SourceFlux name="sourceFlux"
+                objectPath="ElementRegions/reservoir"
+                component="1"
+                scale="-1.0"
+                setNames="{ sourceBox }" />
+
+    <HydrostaticEquilibrium name="equil"
+                            objectPath="ElementRegions"
+                            maxNumberOfEquilibrationIterations="100"
+                            datumElevation="-5"
+                            datumPressure="1.895e7" />
+  </FieldSpecifications>
+
+  <Geometry>
+    <Box name="sourceBox"
+         xMin="{ -0.01, -0.01, -10.01 }"
+         xMax="{  2.01,  2.01,  -7.99 }" />
+  </Geometry>
+
+  <Events maxTime="5.0e3">
+    <PeriodicEvent name="solverApplications"
+                   target="/Solvers/testSolver" />
+  </Events>
+
+</Problem>
+)xml";
+}
+
+/**
+ * @brief Run the injection problem and check that the global preconditioner survives the local Newton iterations
+ * @param solverType the Krylov solver of the global system
+ */
+void runInjection( string const & solverType )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  ProblemManager & problem = state.getProblemManager();
+
+  problem.parseInputString( getXmlInput( solverType ) );
+  problem.problemSetup();
+  problem.applyInitialConditions();
+
+  EXPECT_FALSE( problem.runSimulation() ) << "Simulation exited early.";
+
+  PhysicsSolverBase const & solver = problem.getGroupByPath< PhysicsSolverBase >( solverPath );
+  SolverStatistics const & solverStats = solver.getSolverStatistics();
+  EXPECT_EQ( solverStats.getNumTimeStepCuts(), 0 );
+
+  // the local Newton iterations were performed ...
+  EXPECT_GT( solverStats.getNumSuccessfulLocalNewtonIterations() + solverStats.getNumDiscardedLocalNewtonIterations(), 0 );
+
+  // ... and the global preconditioner was set up once per time step, then reused by the other global solves of the step
+  EXPECT_GT( solverStats.getNumSuccessfulNonlinearIterations(), solverStats.getNumTimeSteps() );
+  EXPECT_EQ( solver.getPreconditionerReuseTracker().numSetups(), solverStats.getNumTimeSteps() );
+}
+
+TEST( LocalNewton, globalPreconditionerReused )
+{
+  runInjection( "gmres" );
+}
+
+TEST( LocalNewton, globalPreconditionerReusedNativeKrylov )
+{
+  // s-step GMRES is only implemented natively, with the default preconditioner held by the solver
+  runInjection( "sstepGmres" );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
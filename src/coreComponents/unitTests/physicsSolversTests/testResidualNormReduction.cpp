@@ -0,0 +1,112 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file testResidualNormReduction.cpp
+ */
+
+#include "common/DataTypes.hpp"
+#include "common/MpiWrapper.hpp"
+#include "mainInterface/initialization.hpp"
+#include "physicsSolvers/PhysicsSolverBaseKernels.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geos;
+using namespace geos::physicsSolverBaseKernels;
+
+/// @return the sum of ( rank + 1 ) over the MPI ranks
+real64 sumOfRanks()
+{
+  real64 const size = MpiWrapper::commSize( MPI_COMM_GEOS );
+  return size * ( size + 1.0 ) / 2.0;
+}
+
+TEST( ResidualNormReduction, mixedNorms )
+{
+  real64 const rank = MpiWrapper::commRank( MPI_COMM_GEOS );
+  real64 const size = MpiWrapper::commSize( MPI_COMM_GEOS );
+
+  // norms, maxima and sums are interleaved, as done by the subsolvers of a coupled solver
+  ResidualNormReduction reduction;
+  integer const linfNorm = reduction.addNorm( NormType::Linf, 1.0 + rank );
+  integer const l2Norm = reduction.addNorm( NormType::L2, 4.0 * ( 1.0 + rank ), 1.0 );
+  integer const maxValue = reduction.addMax( -rank );
+  integer const sumValue = reduction.addSum( 2.0 );
+  integer const linfNorm2 = reduction.addNorm( NormType::Linf, 10.0 - rank );
+
+  // the indices of the norms are independent of the values registered directly
+  EXPECT_EQ( linfNorm, 0 );
+  EXPECT_EQ( l2Norm, 1 );
+  EXPECT_EQ( linfNorm2, 2 );
+
+  // the maxima and sums are numbered separately, after the ones registered by the norms
+  EXPECT_EQ( maxValue, 1 );
+  EXPECT_EQ( sumValue, 2 );
+
+  reduction.reduce();
+
+  EXPECT_DOUBLE_EQ( reduction.globalNorm( linfNorm ), size );
+  EXPECT_DOUBLE_EQ( reduction.globalNorm( l2Norm ), std::sqrt( 4.0 * sumOfRanks() ) / std::sqrt( size ) );
+  EXPECT_DOUBLE_EQ( reduction.globalNorm( linfNorm2 ), 10.0 );
+  EXPECT_DOUBLE_EQ( reduction.globalMax( maxValue ), 0.0 );
+  EXPECT_DOUBLE_EQ( reduction.globalSum( sumValue ), 2.0 * size );
+}
+
+TEST( ResidualNormReduction, linfNormsOnly )
+{
+  real64 const rank = MpiWrapper::commRank( MPI_COMM_GEOS );
+  real64 const size = MpiWrapper::commSize( MPI_COMM_GEOS );
+
+  // no value is reduced with a sum
+  ResidualNormReduction reduction;
+  integer const norm0 = reduction.addNorm( NormType::Linf, 1.0 + rank );
+  integer const norm1 = reduction.addNorm( NormType::Linf, 3.0 );
+  reduction.reduce();
+
+  EXPECT_DOUBLE_EQ( reduction.globalNorm( norm0 ), size );
+  EXPECT_DOUBLE_EQ( reduction.globalNorm( norm1 ), 3.0 );
+}
+
+TEST( ResidualNormReduction, l2NormsOnly )
+{
+  real64 const rank = MpiWrapper::commRank( MPI_COMM_GEOS );
+  real64 const size = MpiWrapper::commSize( MPI_COMM_GEOS );
+
+  // no value is reduced with a maximum
+  ResidualNormReduction reduction;
+  integer const norm0 = reduction.addNorm( NormType::L2, 1.0 + rank, 4.0 );
+  integer const norm1 = reduction.addNorm( NormType::L2, 9.0, 1.0 + rank );
+  reduction.reduce();
+
+  EXPECT_DOUBLE_EQ( reduction.globalNorm( norm0 ), std::sqrt( sumOfRanks() ) / std::sqrt( 4.0 * size ) );
+  EXPECT_DOUBLE_EQ( reduction.globalNorm( norm1 ), std::sqrt( 9.0 * size ) / std::sqrt( sumOfRanks() ) );
+}
+
+TEST( ResidualNormReduction, empty )
+{
+  // nothing was registered: no collective is needed
+  ResidualNormReduction reduction;
+  EXPECT_NO_THROW( reduction.reduce() );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
@@ -0,0 +1,258 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file testSolidMechanicsMatrixFree.cpp
+ */
+
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEM.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsMatrixFreeOperator.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geos;
+
+CommandLineOptions g_commandLineOptions;
+
+char const * const solverPath = "/Solvers/lagsolve";
+
+/// Elastic bar clamped on one end and pulled on the other one by a prescribed displacement
+char const * const xmlInput =
+  R"xml(
+<Problem>
+
+  <Solvers gravityVector="{ 0.0, 0.0, 0.0 }">
+    <SolidMechanics_LagrangianFEM name="lagsolve"
+                                  timeIntegrationOption="QuasiStatic"
+                                  discretization="FE1"
+                                  targetRegions="{ Region1 }"
+                                  useMatrixFreeSolver="1">
+      <LinearSolverParameters solverType="cg"
+                              preconditionerType="jacobi" />
+    </SolidMechanics_LagrangianFEM>
+  </Solvers>
+
+  <NumericalMethods>
+    <FiniteElements>
+      <FiniteElementSpace name="FE1"
+                          order="1" />
+    </FiniteElements>
+  </NumericalMethods>
+
+  <Mesh>
+    <InternalMesh name="mesh1"
+                  elementTypes="{ C3D8 }"
+                  xCoords="{ 0, 10 }"
+                  yCoords="{ 0, 2 }"
+                  zCoords="{ 0, 2 }"
+                  nx="{ 10 }"
+                  ny="{ 2 }"
+                  nz="{ 2 }"
+                  cellBlockNames="{ cb1 }" />
+  </Mesh>
+
+  <ElementRegions>
+    <CellElementRegion name="Region1"
+                       cellBlocks="{ * }"
+                       materialList="{ rock }" />
+  </ElementRegions>
+
+  <Constitutive>
+    <ElasticIsotropic name="rock"
+                      defaultDensity="2700"
+                      defaultBulkModulus="5.5556e9"
+                      defaultShearModulus="4.16667e9" />
+  </Constitutive>
+
+  <FieldSpecifications>
+    <FieldSpecification name="clamped"
+                        objectPath="nodeManager"
+                        fieldName="totalDisplacement"
+                        scale="0.0"
+                        setNames="{ xneg }" />
+
+    <FieldSpecification name="pulled"
+                        objectPath="nodeManager"
+                        fieldName="totalDisplacement"
+                        component="0"
+                        scale="1.0e-3"
+                        setNames="{ xpos }" />
+  </FieldSpecifications>
+
+  <Events maxTime="1.0">
+    <PeriodicEvent name="solverApplications"
+                   forceDt="1.0"
+                   target="/Solvers/lagsolve" />
+  </Events>
+
+</Problem>
+)xml";
+
+class SolidMechanicsMatrixFreeTest : public ::testing::Test
+{
+public:
+
+  SolidMechanicsMatrixFreeTest():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    ProblemManager & problem = state.getProblemManager();
+    problem.parseInputString( xmlInput );
+    problem.problemSetup();
+    problem.applyInitialConditions();
+
+    solver = &problem.getGroupByPath< SolidMechanicsLagrangianFEM >( solverPath );
+    DomainPartition & domain = problem.getDomainPartition();
+    DofManager & dofManager = solver->getDofManager();
+
+    // the matrix-free setup only holds the diagonal of the Jacobian ...
+    solver->setupSystem( domain,
+                         dofManager,
+                         solver->getLocalMatrix(),
+                         solver->getSystemRhs(),
+                         solver->getSystemSolution() );
+    solver->implicitStepSetup( time, dt, domain );
+
+    // ... the reference stiffness is assembled by the same kernels in a matrix with the full sparsity pattern
+    SparsityPattern< globalIndex > pattern;
+    dofManager.setSparsityPattern( pattern );
+    localMatrix.assimilate< parallelDevicePolicy<> >( std::move( pattern ) );
+
+    ParallelVector & rhs = solver->getSystemRhs();
+    rhs.zero();
+    arrayView1d< real64 > const localRhs = rhs.open();
+    solver->assembleSystem( time, dt, domain, dofManager, localMatrix.toViewConstSizes(), localRhs );
+    solver->applyBoundaryConditions( time, dt, domain, dofManager, localMatrix.toViewConstSizes(), localRhs );
+    rhs.close();
+
+    matrix.create( localMatrix.toViewConst(), dofManager.numLocalDofs(), MPI_COMM_GEOS );
+    diagonal.create( dofManager.numLocalDofs(), MPI_COMM_GEOS );
+    matrix.extractDiagonal( diagonal );
+
+    // the rows of the prescribed displacements have been replaced by their diagonal entry
+    localMatrix.move( hostMemorySpace, false );
+    globalIndex const rankOffset = dofManager.rankOffset();
+    constrainedDofs.resize( localMatrix.numRows() );
+    for( localIndex row = 0; row < localMatrix.numRows(); ++row )
+    {
+      arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( row );
+      arraySlice1d< real64 const > const entries = localMatrix.getEntries( row );
+      constrainedDofs[row] = 1;
+      for( localIndex k = 0; k < columns.size(); ++k )
+      {
+        if( columns[k] != rankOffset + row && entries[k] != 0.0 )
+        {
+          constrainedDofs[row] = 0;
+        }
+      }
+    }
+  }
+
+  static real64 constexpr time = 0.0;
+  static real64 constexpr dt = 1.0;
+
+  GeosxState state;
+  SolidMechanicsLagrangianFEM * solver;
+
+  CRSMatrix< real64, globalIndex > localMatrix;
+  ParallelMatrix matrix;
+  ParallelVector diagonal;
+  array1d< integer > constrainedDofs;
+};
+
+real64 constexpr SolidMechanicsMatrixFreeTest::time;
+real64 constexpr SolidMechanicsMatrixFreeTest::dt;
+
+TEST_F( SolidMechanicsMatrixFreeTest, applyMatchesAssembledStiffness )
+{
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+  DofManager const & dofManager = solver->getDofManager();
+  localIndex const numLocalDofs = dofManager.numLocalDofs();
+
+  integer numConstrained = 0;
+  for( localIndex i = 0; i < numLocalDofs; ++i )
+  {
+    numConstrained += constrainedDofs[i];
+  }
+  ASSERT_GT( MpiWrapper::sum( numConstrained ), 0 );
+
+  SolidMechanicsMatrixFreeOperator const stiffness( *solver,
+                                                    domain,
+                                                    dofManager,
+                                                    diagonal,
+                                                    constrainedDofs.toViewConst() );
+
+  ParallelVector src;
+  src.create( numLocalDofs, MPI_COMM_GEOS );
+  src.rand( 1984 );
+
+  // assembled operator: the constrained rows are replaced by their diagonal entry, the columns are kept
+  ParallelVector expected;
+  expected.create( numLocalDofs, MPI_COMM_GEOS );
+  matrix.apply( src, expected );
+
+  // matrix-free operator: the constrained columns are eliminated ...
+  ParallelVector result;
+  result.create( numLocalDofs, MPI_COMM_GEOS );
+  stiffness.apply( src, result );
+
+  // ... and their contribution is moved to the right-hand side, given the prescribed values on the constrained rows
+  ParallelVector lifted;
+  lifted.create( numLocalDofs, MPI_COMM_GEOS );
+  {
+    arrayView1d< real64 const > const srcValues = src.values();
+    arrayView1d< real64 const > const diagValues = diagonal.values();
+    arrayView1d< real64 > const liftedValues = lifted.open();
+    for( localIndex i = 0; i < numLocalDofs; ++i )
+    {
+      liftedValues[i] = constrainedDofs[i] ? diagValues[i] * srcValues[i] : 0.0;
+    }
+    lifted.close();
+  }
+  stiffness.liftConstraints( lifted );
+
+  real64 const tol = 1.0e-12 * expected.normInf();
+  arrayView1d< real64 const > const expectedValues = expected.values();
+  arrayView1d< real64 const > const resultValues = result.values();
+  arrayView1d< real64 const > const liftedValues = lifted.values();
+  for( localIndex i = 0; i < numLocalDofs; ++i )
+  {
+    if( constrainedDofs[i] )
+    {
+      EXPECT_NEAR( resultValues[i], expectedValues[i], tol ) << "constrained row " << i;
+      EXPECT_NEAR( liftedValues[i], expectedValues[i], tol ) << "constrained row " << i;
+    }
+    else
+    {
+      EXPECT_NEAR( resultValues[i] - liftedValues[i], expectedValues[i], tol ) << "row " << i;
+    }
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
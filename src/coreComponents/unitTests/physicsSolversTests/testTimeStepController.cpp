@@ -0,0 +1,188 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2023-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file testTimeStepController.cpp
+ */
+
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "physicsSolvers/PhysicsSolverBase.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geos;
+
+CommandLineOptions g_commandLineOptions;
+
+char const * const solverPath = "/Solvers/testSolver";
+
+real64 constexpr initialDt = 10.0;
+
+/**
+ * @brief Single-phase injection in a closed box, run with the given time-step controller
+ * @param controllerType the value of the timeStepControllerType attribute
+ * @param truncationErrorTol the value of the timeStepTruncationErrorTolerance attribute
+ * @return the XML input
+ */
+string getXmlInput( string const & controllerType,
+                    real64 const truncationErrorTol )
+{
+  return string( R"xml(
+<Problem>
+
+  <Solvers>
+    <SinglePhaseFVM name="testSolver"
+                    discretization="singlePhaseTPFA"
+                    targetRegions="{ reservoir }"
+                    initialDt=")xml" ) + std::to_string( initialDt ) + R"xml(" >
+
+      <NonlinearSolverParameters newtonMaxIter="10"
+                                 timeStepIncreaseFactor="2.0"
+                                 timeStepControllerType=")xml" + controllerType + R"xml("
+                                 timeStepTruncationErrorTolerance=")xml" + std::to_string( truncationErrorTol ) + R"xml(" />
+
+    </SinglePhaseFVM>
+  </Solvers>
+
+  <NumericalMethods>
+    <FiniteVolume>
+      <TwoPointFluxApproximation name="singlePhaseTPFA" />
+    </FiniteVolume>
+  </NumericalMethods>
+
+  <Mesh>
+    <InternalMesh name="mesh"
+                  elementTypes="{ C3D8 }"
+                  xCoords="{   0, 10 }"
+                  yCoords="{   0, 10 }"
+                  zCoords="{ -10,  0 }"
+                  nx="{ 5 }"
+                  ny="{ 5 }"
+                  nz="{ 5 }"
+                  cellBlockNames="{ cellBlock }" />
+  </Mesh>
+
+  <ElementRegions>
+    <CellElementRegion name="reservoir"
+                       cellBlocks="{ cellBlock }"
+                       materialList="{ water, rock }" />
+  </ElementRegions>
+
+  <Constitutive>
+    <CompressibleSinglePhaseFluid name="water"
+                                  defaultDensity="1000"
+                                  defaultViscosity="0.001"
+                                  referencePressure="0.0"
+                                  compressibility="5e-10"
+                                  viscosibility="0.0" />
+
+    <CompressibleSolidConstantPermeability name="rock"
+                                           solidModelName="nullSolid"
+                                           porosityModelName="rockPorosity"
+                                           permeabilityModelName="rockPerm" />
+    <NullModel name="nullSolid" />
+    <PressurePorosity name="rockPorosity"
+                      defaultReferencePorosity="0.05"
+                      referencePressure="0.0"
+                      compressibility="1.0e-9" />
+    <ConstantPermeability name="rockPerm"
+                          permeabilityComponents="{ 1.0e-12, 1.0e-12, 1.0e-15 }" />
+  </Constitutive>
+
+  <FieldSpecifications>
+    <SourceFlux name="sourceFlux"
+                objectPath="ElementRegions/reservoir"
+                component="1"
+                scale="-0.1"
+                setNames="{ sourceBox }" />
+
+    <HydrostaticEquilibrium name="equil"
+                            objectPath="ElementRegions"
+                            maxNumberOfEquilibrationIterations="100"
+                            datumElevation="-5"
+                            datumPressure="1.895e7" />
+  </FieldSpecifications>
+
+  <Geometry>
+    <Box name="sourceBox"
+         xMin="{ -0.01, -0.01, -10.01 }"
+         xMax="{  2.01,  2.01,  -7.99 }" />
+  </Geometry>
+
+  <Events maxTime="1.0e5">
+    <PeriodicEvent name="solverApplications"
+                   target="/Solvers/testSolver" />
+  </Events>
+
+</Problem>
+)xml";
+}
+
+/**
+ * @brief Run the injection problem
+ * @param controllerType the time-step controller
+ * @param truncationErrorTol the target truncation error of the PID controller
+ * @return the number of accepted time steps
+ */
+integer runInjection( string const & controllerType,
+                      real64 const truncationErrorTol )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  ProblemManager & problem = state.getProblemManager();
+
+  string const xmlInput = getXmlInput( controllerType, truncationErrorTol );
+  problem.parseInputString( xmlInput );
+  problem.problemSetup();
+  problem.applyInitialConditions();
+
+  EXPECT_FALSE( problem.runSimulation() ) << "Simulation exited early.";
+
+  PhysicsSolverBase const & solver = problem.getGroupByPath< PhysicsSolverBase >( solverPath );
+  SolverStatistics const & solverStats = solver.getSolverStatistics();
+  EXPECT_EQ( solverStats.getNumTimeStepCuts(), 0 );
+  EXPECT_EQ( solverStats.getNumNonConvergedTimeSteps(), 0 );
+
+  return solverStats.getNumTimeSteps();
+}
+
+TEST( TimeStepController, PIDIncreasesTimeStep )
+{
+  integer const numTimeSteps = runInjection( "PID", 1.0e-2 );
+
+  // the pressure evolves smoothly towards a linear increase: the truncation error allows larger steps,
+  // far fewer than the maxTime / initialDt = 1e4 steps taken without increase
+  EXPECT_GT( numTimeSteps, 2 );
+  EXPECT_LT( numTimeSteps, 100 );
+}
+
+TEST( TimeStepController, PIDFollowsTolerance )
+{
+  integer const numTimeStepsLoose = runInjection( "PID", 1.0e-1 );
+  integer const numTimeStepsTight = runInjection( "PID", 1.0e-4 );
+
+  // a tighter truncation error tolerance takes smaller time steps
+  EXPECT_GT( numTimeStepsTight, numTimeStepsLoose );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
@@ -419,6 +419,29 @@ protected:
     } );
   }
 
+  void TestFusedResidualNorm()
+  {
+    DomainPartition & domain = state.getProblemManager().getDomainPartition();
+    DofManager const & dofManager = solver->getDofManager();
+
+    CRSMatrix< real64, globalIndex > const & jacobian = solver->getLocalMatrix();
+    array1d< real64 > residual( jacobian.numRows() );
+    residual.zero();
+    jacobian.zero();
+    solver->assembleSystem( TIME, DT, domain, dofManager, jacobian.toViewConstSizes(), residual.toView() );
+    solver->applyBoundaryConditions( TIME, DT, domain, dofManager, jacobian.toViewConstSizes(), residual.toView() );
+
+    // the coupled norm reduces the norms of the reservoir and well solvers together
+    real64 const coupledNorm = solver->calculateResidualNorm( TIME, DT, domain, dofManager, residual.toViewConst() );
+
+    // each subsolver reduces its own norm separately
+    real64 const reservoirNorm = solver->reservoirSolver()->calculateResidualNorm( TIME, DT, domain, dofManager, residual.toViewConst() );
+    real64 const wellNorm = solver->wellSolver()->calculateResidualNorm( TIME, DT, domain, dofManager, residual.toViewConst() );
+
+    EXPECT_GT( coupledNorm, 0.0 );
+    EXPECT_NEAR( coupledNorm, std::sqrt( reservoirNorm * reservoirNorm + wellNorm * wellNorm ), 1e-12 * coupledNorm );
+  }
+
   static real64 constexpr TIME = 0.0;
   static real64 constexpr DT = 1e4;
   static real64 constexpr EPS = std::numeric_limits< real64 >::epsilon();
@@ -511,6 +534,11 @@ TEST_F( SinglePhaseReservoirSolverInternalWellTest, jacobianNumericalCheck_Accum
   TestAssembleAccumulationTerms();
 }
 
+TEST_F( SinglePhaseReservoirSolverInternalWellTest, fusedResidualNorm )
+{
+  TestFusedResidualNorm();
+}
+
 
 /**
  * @brief Test SinglePhaseReservoirSolver with VTKWell generator